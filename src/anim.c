@@ -0,0 +1,369 @@
+/* anim.c
+ *  Boot animation player. Each frame is stored as a packed row range (pack.h)
+ *  against the frame before, so it's unpacked straight over the last one in
+ *  the panel's draw buffer a band at a time, then only those rows are sent.
+ *  Frames start on a timer at the animation's rate; the work runs from the
+ *  main loop between Maple packets, like the VMU screen (lcd.c)
+ */
+
+#include "anim.h"
+#include "display.h"
+#include "lcd.h"
+
+#define ANIM_BAND 8 // lines unpacked per step
+
+// Placeholder until there's a DC logo to bundle: the MaplePad logo opening
+// out from the middle. Made with tools/pack_image -a, see the README
+// 96x64 RGB565, 61 frames at 33 ms, 3883 bytes packed from 749568 by tools/pack_image
+static const uint8_t bootAnimation_data[3883] = {
+    0x7f, 0x00, 0x00, 0x5f, 0x00, 0x00, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f,
+    0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f,
+    0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f,
+    0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f,
+    0x8e, 0x0d, 0x18, 0xe3, 0xd6, 0x9a, 0x8c, 0x71, 0x21, 0x04, 0xc6, 0x38, 0xf7, 0xbe, 0xad, 0x75,
+    0x21, 0x24, 0xc6, 0x18, 0xbd, 0xf7, 0x31, 0x86, 0xde, 0xfb, 0xef, 0x7d, 0x7b, 0xef, 0x81, 0x2c,
+    0x08, 0x61, 0x7b, 0xcf, 0xe7, 0x3c, 0xef, 0x5d, 0xf7, 0x9e, 0xa5, 0x34, 0x10, 0x82, 0x08, 0x41,
+    0x84, 0x10, 0xde, 0xdb, 0xf7, 0x9e, 0xde, 0xdb, 0x39, 0xe7, 0x00, 0x00, 0x08, 0x41, 0x6b, 0x6d,
+    0xf7, 0x9e, 0xbd, 0xf7, 0x29, 0x45, 0x00, 0x00, 0x08, 0x00, 0x82, 0x28, 0xee, 0x59, 0xff, 0x9e,
+    0xff, 0x3c, 0xff, 0x5d, 0xec, 0xb2, 0xff, 0x9e, 0xe2, 0xca, 0xec, 0x30, 0xff, 0xbe, 0xfe, 0xfb,
+    0xc9, 0x85, 0xb8, 0x20, 0xdb, 0x0b, 0xfe, 0xfb, 0xd2, 0x89, 0xc0, 0x00, 0xec, 0x70, 0xe4, 0x71,
+    0xc9, 0xc6, 0xf6, 0x9a, 0xe3, 0xce, 0xd0, 0x80, 0xd0, 0x80, 0x42, 0xd0, 0x81, 0x03, 0xd8, 0x81,
+    0xd8, 0xa1, 0xb8, 0x81, 0x48, 0x20, 0x8c, 0x4f, 0x00, 0x00, 0x3b, 0x7b, 0xcf, 0xc6, 0x18, 0xce,
+    0x59, 0xa5, 0x34, 0x84, 0x30, 0xef, 0x7d, 0x10, 0xa2, 0x42, 0x08, 0xef, 0x7d, 0xb5, 0xb6, 0x84,
+    0x30, 0xb5, 0xb6, 0xbd, 0xd7, 0x00, 0x00, 0x08, 0x41, 0x94, 0xb2, 0xde, 0xfb, 0x5a, 0xeb, 0x6b,
+    0x4d, 0xef, 0x5d, 0x42, 0x08, 0x21, 0x24, 0xbd, 0xf7, 0xad, 0x55, 0x4a, 0x49, 0x4a, 0x69, 0xef,
+    0x5d, 0xa5, 0x14, 0x00, 0x00, 0x5a, 0xeb, 0xce, 0x79, 0xad, 0x75, 0xd6, 0xba, 0x31, 0xc7, 0x40,
+    0x00, 0xba, 0xca, 0xf7, 0x1c, 0xf4, 0xf3, 0xda, 0x07, 0xfe, 0xda, 0xf5, 0x34, 0xd0, 0x61, 0xf5,
+    0xf7, 0xf6, 0x38, 0xf6, 0x17, 0xdb, 0xae, 0xff, 0x9e, 0xdb, 0x0b, 0xd0, 0x00, 0xd9, 0x85, 0xf6,
+    0x17, 0xdb, 0x6d, 0xc9, 0x86, 0xfe, 0xfb, 0xeb, 0xce, 0xec, 0x0f, 0xff, 0x3c, 0xd2, 0x48, 0xc0,
+    0x40, 0xc8, 0x81, 0x44, 0xd0, 0x81, 0x03, 0xd8, 0x81, 0xc8, 0x81, 0x80, 0x60, 0x10, 0x00, 0x8a,
+    0x8f, 0x3a, 0x63, 0x2c, 0xf7, 0x9e, 0xd6, 0x9a, 0x10, 0xa2, 0x39, 0xc7, 0xe7, 0x3c, 0x08, 0x61,
+    0x52, 0xaa, 0xff, 0xff, 0x84, 0x30, 0x08, 0x41, 0x9c, 0xd3, 0xa5, 0x34, 0x00, 0x00, 0x73, 0xae,
+    0xe7, 0x1c, 0x4a, 0x69, 0x00, 0x00, 0xa5, 0x14, 0xa5, 0x14, 0x39, 0xc7, 0xc6, 0x38, 0x73, 0x8e,
+    0x08, 0x41, 0x08, 0x41, 0x52, 0x8a, 0xde, 0xfb, 0x9c, 0xf3, 0x29, 0x45, 0xc6, 0x18, 0x39, 0xa7,
+    0x5b, 0x0c, 0xce, 0x38, 0x78, 0x82, 0xd1, 0xc6, 0xfe, 0xdb, 0xec, 0xf3, 0xd0, 0x41, 0xe2, 0x69,
+    0xff, 0x1c, 0xda, 0x48, 0xd0, 0x60, 0xf6, 0x79, 0xf7, 0x7d, 0xb9, 0x65, 0xc1, 0x64, 0xff, 0x7d,
+    0xe2, 0x48, 0xd0, 0x00, 0xda, 0x07, 0xf6, 0x38, 0xe3, 0x6d, 0xed, 0x13, 0xf6, 0x9a, 0xe3, 0x8d,
+    0xfe, 0xba, 0xf5, 0x75, 0xd8, 0xe2, 0xd0, 0x60, 0x42, 0xc8, 0x81, 0x43, 0xd0, 0x81, 0x03, 0xd8,
+    0x81, 0xd8, 0x81, 0x98, 0x60, 0x30, 0x20, 0x89, 0x8f, 0x39, 0x8c, 0x51, 0xff, 0xdf, 0x4a, 0x69,
+    0x00, 0x00, 0x84, 0x10, 0xc6, 0x18, 0x08, 0x41, 0xad, 0x55, 0xde, 0xdb, 0x08, 0x41, 0x29, 0x45,
+    0xce, 0x59, 0x63, 0x2c, 0x29, 0x65, 0xd6, 0xba, 0x84, 0x10, 0x00, 0x00, 0x42, 0x28, 0xde, 0xdb,
+    0x4a, 0x69, 0x9c, 0xf3, 0x6b, 0x6d, 0x00, 0x20, 0x39, 0xc7, 0xb5, 0x96, 0xc6, 0x38, 0xf7, 0xbe,
+    0x63, 0x2c, 0x7b, 0xef, 0x7b, 0xef, 0x08, 0x82, 0xa5, 0x55, 0xe4, 0xb2, 0xc0, 0x40, 0xf5, 0x34,
+    0xf6, 0x58, 0xd9, 0x24, 0xd0, 0x40, 0xf6, 0x18, 0xed, 0x34, 0xd0, 0x81, 0xd9, 0xc6, 0xff, 0xbe,
+    0xe3, 0xef, 0xc8, 0x20, 0xeb, 0xad, 0xfe, 0xfb, 0xd0, 0xc1, 0xd0, 0x60, 0xec, 0x0f, 0xf6, 0x99,
+    0xec, 0xf3, 0xff, 0xbe, 0xf5, 0x75, 0xf5, 0xf7, 0xff, 0xff, 0xe2, 0xea, 0xd0, 0x60, 0x43, 0xd0,
+    0x81, 0x00, 0xc8, 0x81, 0x44, 0xd0, 0x81, 0x02, 0xd8, 0x81, 0xc0, 0x81, 0x48, 0x20, 0x88, 0x7f,
+    0x00, 0x00, 0x5f, 0x00, 0x00, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf,
+    0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf,
+    0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf,
+    0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xbf, 0x9f, 0xe3,
+    0x02, 0xbd, 0xd7, 0xa5, 0x14, 0x08, 0x61, 0xce, 0x19, 0x10, 0x00, 0x80, 0x00, 0xe2, 0xeb, 0xff,
+    0x3c, 0xd9, 0x64, 0xd0, 0x60, 0xd0, 0x81, 0xd0, 0x40, 0xd0, 0x40, 0xd0, 0x81, 0xc8, 0x81, 0xc8,
+    0x60, 0x98, 0x20, 0x78, 0x41, 0xa8, 0x81, 0xc8, 0x60, 0xd0, 0x60, 0xd0, 0x81, 0xd0, 0x60, 0xd0,
+    0x60, 0xd0, 0x81, 0xd0, 0xa1, 0xc0, 0x81, 0xb0, 0x81, 0x80, 0x40, 0x20, 0x00, 0xcf, 0xce, 0x0d,
+    0x18, 0xc3, 0x63, 0x2c, 0x18, 0xe3, 0x00, 0x00, 0x10, 0xa2, 0x52, 0xaa, 0x10, 0xa2, 0x42, 0x08,
+    0xb5, 0x96, 0x31, 0xa6, 0x00, 0x00, 0x18, 0xc3, 0x42, 0x08, 0x08, 0x61, 0xc3, 0x04, 0x18, 0xe3,
+    0x21, 0x04, 0x4a, 0x69, 0xe7, 0x1c, 0x42, 0x08, 0xc1, 0x02, 0x08, 0x61, 0x29, 0x45, 0x10, 0xa2,
+    0xc3, 0x01, 0x18, 0xc3, 0x18, 0xe3, 0xc3, 0x1c, 0x40, 0x81, 0x99, 0xa6, 0xb9, 0x03, 0xf5, 0xf7,
+    0xff, 0xff, 0xec, 0x71, 0xd0, 0xa1, 0xd0, 0x60, 0xe2, 0x48, 0xd9, 0xe6, 0xd0, 0x60, 0xd0, 0xa1,
+    0xd2, 0xca, 0xcc, 0x0f, 0xa8, 0x81, 0xc0, 0x40, 0xc0, 0xc2, 0xc9, 0x03, 0xd0, 0x60, 0xeb, 0xce,
+    0xe3, 0x0b, 0xd8, 0xa1, 0xd8, 0x80, 0xd8, 0x81, 0xd8, 0x81, 0xd8, 0xa1, 0xa8, 0x60, 0x88, 0x60,
+    0x20, 0x00, 0xcd, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xce, 0x39, 0x00, 0x20, 0xce,
+    0x59, 0xb5, 0x96, 0x10, 0x82, 0x10, 0x82, 0xde, 0xfb, 0x5a, 0xeb, 0x21, 0x04, 0xef, 0x7d, 0x6b,
+    0x4d, 0x00, 0x00, 0x7b, 0xcf, 0xce, 0x79, 0x10, 0xa2, 0x84, 0x10, 0xce, 0x59, 0x18, 0xe3, 0x08,
+    0x41, 0xbd, 0xd7, 0xa5, 0x34, 0x10, 0xa2, 0x18, 0xc3, 0x00, 0x00, 0x39, 0xe7, 0xce, 0x59, 0x4a,
+    0x69, 0x8c, 0x71, 0xd6, 0xba, 0x10, 0xa2, 0x29, 0x65, 0x08, 0x41, 0x5b, 0x2c, 0xf6, 0xda, 0xe2,
+    0x07, 0xda, 0x28, 0xfe, 0xfb, 0xe3, 0x4c, 0xd0, 0x00, 0xe3, 0xae, 0xff, 0x3c, 0xda, 0x28, 0xc0,
+    0x00, 0xe4, 0xd2, 0xfe, 0xfb, 0xd8, 0xe2, 0xd9, 0x03, 0xfe, 0xda, 0xec, 0x30, 0xd0, 0x00, 0xe2,
+    0x68, 0xff, 0x3c, 0xfe, 0xba, 0xfe, 0xfb, 0xff, 0xbe, 0xf6, 0xdb, 0xff, 0xbe, 0xf5, 0xb6, 0xd9,
+    0x23, 0x82, 0x45, 0xd8, 0x81, 0x42, 0xd0, 0x81, 0x03, 0xd8, 0x81, 0xc8, 0x81, 0x70, 0x40, 0x18,
+    0x00, 0xc6, 0xce, 0x13, 0x4a, 0x69, 0xe7, 0x1c, 0x4a, 0x49, 0x08, 0x41, 0x9c, 0xf3, 0xbd, 0xf7,
+    0x08, 0x41, 0x8c, 0x71, 0xce, 0x79, 0x00, 0x20, 0x39, 0xe7, 0xde, 0xfb, 0x63, 0x0c, 0x18, 0xe3,
+    0xc6, 0x38, 0x94, 0xb2, 0x00, 0x20, 0x8c, 0x71, 0xef, 0x5d, 0x4a, 0x49, 0xc1, 0x23, 0x10, 0xa2,
+    0xc6, 0x38, 0x52, 0x8a, 0x52, 0xaa, 0xef, 0x5d, 0x4a, 0x49, 0x00, 0x00, 0x00, 0x20, 0x63, 0x4d,
+    0xf7, 0xdf, 0xf5, 0x75, 0xd0, 0x40, 0xec, 0x50, 0xf6, 0x9a, 0xd9, 0xa6, 0xe2, 0x69, 0xff, 0x5c,
+    0xe4, 0xb2, 0xc8, 0x61, 0xd1, 0x64, 0xff, 0x3c, 0xe3, 0x6d, 0xd0, 0x61, 0xec, 0xb2, 0xfe, 0xda,
+    0xd8, 0xc2, 0xd9, 0xe6, 0xfe, 0xba, 0xff, 0xbe, 0xf5, 0xf7, 0xf6, 0xba, 0xff, 0x3c, 0xed, 0x95,
+    0xf6, 0x59, 0xe3, 0x0b, 0xd0, 0x40, 0x42, 0xd0, 0x81, 0x01, 0xb0, 0x81, 0xb8, 0x81, 0x43, 0xd0,
+    0x81, 0x43, 0xd8, 0x81, 0x04, 0xe0, 0xa1, 0xe0, 0xa1, 0xa0, 0x60, 0x40, 0x20, 0x08, 0x00, 0xc4,
+    0xe4, 0x02, 0xce, 0x79, 0x8c, 0x71, 0x08, 0x41, 0xc9, 0x19, 0x08, 0x00, 0x30, 0x20, 0x98, 0x60,
+    0xe0, 0xa1, 0xe0, 0xa1, 0xd0, 0xa1, 0xc8, 0x20, 0xe3, 0x8d, 0xff, 0x3c, 0xc9, 0x44, 0xc8, 0x60,
+    0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0xb8, 0x81, 0x58, 0x40, 0x40, 0x20,
+    0xc8, 0x81, 0xe0, 0xa1, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xa8, 0x60, 0x28, 0x20, 0xd3, 0xe3,
+    0x02, 0x4a, 0x69, 0xe7, 0x3c, 0x31, 0x86, 0xcc, 0x08, 0x18, 0x00, 0x70, 0x40, 0xb0, 0x81, 0xd0,
+    0x80, 0xd8, 0x81, 0xfe, 0x9a, 0xec, 0x91, 0xd0, 0x60, 0xc8, 0x81, 0x42, 0xc0, 0x81, 0x0d, 0xc8,
+    0x81, 0xc8, 0x81, 0xa0, 0x61, 0x58, 0x41, 0x88, 0x60, 0xd0, 0x81, 0xc0, 0x81, 0xc8, 0x81, 0xd8,
+    0x81, 0xc8, 0x81, 0x98, 0x60, 0x70, 0x40, 0x38, 0x20, 0x10, 0x00, 0xd1, 0xff, 0xdf, 0xff, 0xdf,
+    0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xce, 0x13, 0xa5, 0x14,
+    0xe7, 0x3c, 0x63, 0x2c, 0x94, 0xb2, 0xd6, 0x9a, 0x29, 0x65, 0x00, 0x00, 0xc6, 0x18, 0x8c, 0x51,
+    0x42, 0x28, 0xce, 0x59, 0x9c, 0xf3, 0x00, 0x00, 0x29, 0x45, 0xce, 0x79, 0xc6, 0x38, 0xa5, 0x34,
+    0xff, 0xff, 0x8c, 0x71, 0x08, 0x61, 0xc1, 0x2e, 0x6b, 0x4d, 0xe7, 0x1c, 0x8c, 0x71, 0xde, 0xdb,
+    0x63, 0x0c, 0x00, 0x00, 0x08, 0x41, 0x6b, 0x8e, 0xff, 0x5c, 0xff, 0x5d, 0xe2, 0xaa, 0xd0, 0x00,
+    0xec, 0x91, 0xff, 0x3c, 0xed, 0x13, 0xff, 0x1b, 0xfe, 0xfb, 0xd9, 0xc6, 0xd0, 0x00, 0xe2, 0xa9,
+    0xfe, 0xfb, 0xe2, 0x48, 0xec, 0x2f, 0xff, 0x1c, 0xe2, 0x48, 0xd0, 0x81, 0xf5, 0x75, 0xff, 0x3c,
+    0xe4, 0x0f, 0xe3, 0x6d, 0xf6, 0x38, 0xe3, 0x4c, 0xec, 0xd2, 0xec, 0xd2, 0xd0, 0xc2, 0xd0, 0x60,
+    0xd0, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0x58, 0x40, 0x28, 0x20, 0x60, 0x40, 0x70, 0x40, 0x68, 0x40,
+    0x78, 0x40, 0x88, 0x60, 0x88, 0x60, 0x42, 0x90, 0x60, 0x04, 0xa0, 0x60, 0xb0, 0x81, 0xb0, 0x80,
+    0x60, 0x40, 0x10, 0x00, 0xc3, 0xcd, 0x05, 0x39, 0xc7, 0xd6, 0xba, 0xd6, 0x9a, 0xce, 0x59, 0xb5,
+    0x96, 0x31, 0x86, 0xc1, 0x0b, 0xa5, 0x34, 0xef, 0x5d, 0xd6, 0xba, 0x94, 0xb2, 0x08, 0x41, 0x00,
+    0x00, 0x08, 0x61, 0x63, 0x2c, 0xa5, 0x14, 0xce, 0x79, 0xd6, 0x9a, 0x31, 0xa6, 0xc2, 0x28, 0x52,
+    0xaa, 0xce, 0x59, 0xc6, 0x18, 0x4a, 0x69, 0x00, 0x00, 0x00, 0x20, 0x6b, 0x6d, 0xf5, 0xf7, 0xf5,
+    0x54, 0xf5, 0xd6, 0xd0, 0xa1, 0xd0, 0x40, 0xda, 0x48, 0xec, 0xf3, 0xf5, 0xb6, 0xff, 0x7d, 0xe3,
+    0xce, 0xd0, 0x80, 0xd8, 0x20, 0xe2, 0x27, 0xff, 0x1b, 0xff, 0x1b, 0xfe, 0x9a, 0xe2, 0xca, 0xd0,
+    0x20, 0xd0, 0xc2, 0xe3, 0x2b, 0xd2, 0x48, 0xc8, 0x40, 0xd9, 0x23, 0xd9, 0x03, 0xd9, 0x24, 0xe3,
+    0xae, 0xc9, 0xc6, 0xc8, 0x40, 0xd8, 0xa1, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0xa1, 0xb8, 0x81, 0x10,
+    0x00, 0xc9, 0x03, 0x08, 0x00, 0x20, 0x20, 0x40, 0x20, 0x20, 0x00, 0xc3, 0xe4, 0x02, 0x10, 0x82,
+    0xe7, 0x3c, 0x6b, 0x4d, 0xc7, 0x03, 0x20, 0x00, 0x80, 0x60, 0xc8, 0x81, 0xe0, 0xa1, 0x44, 0xd0,
+    0x81, 0x15, 0xd0, 0x20, 0xec, 0xb2, 0xfe, 0xba, 0xd0, 0xa1, 0xd8, 0x81, 0xd8, 0x81, 0xd0, 0x81,
+    0xc8, 0x81, 0xc8, 0x81, 0xd8, 0x81, 0x90, 0x61, 0x10, 0x00, 0x10, 0x00, 0x50, 0x40, 0x80, 0x60,
+    0xb0, 0x80, 0xc8, 0x81, 0xd0, 0x81, 0xe8, 0xa1, 0xd0, 0x81, 0x60, 0x40, 0x08, 0x00, 0xd0, 0xe4,
+    0x02, 0x6b, 0x4d, 0xe7, 0x1c, 0x18, 0xe3, 0xc8, 0x04, 0x08, 0x00, 0x58, 0x40, 0xb8, 0x81, 0xd8,
+    0xa1, 0xd8, 0x81, 0x81, 0x14, 0xc8, 0x60, 0xd0, 0xe2, 0xff, 0x3c, 0xeb, 0xce, 0xd0, 0x40, 0xd0,
+    0x81, 0xd8, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0xc0, 0x81, 0xd0, 0x81, 0x78, 0x40, 0x08, 0x00, 0x70,
+    0x40, 0xc8, 0x81, 0xd8, 0x81, 0xd8, 0xa1, 0xd8, 0xa1, 0xe0, 0xa1, 0xb0, 0x80, 0x40, 0x20, 0xd2,
+    0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf,
+    0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xcd, 0x04, 0x9c, 0xf3, 0xc6, 0x38, 0x31, 0xa6,
+    0x18, 0xc3, 0x00, 0x20, 0xc2, 0x02, 0x31, 0xa6, 0x73, 0xae, 0x4a, 0x69, 0xc4, 0x02, 0x10, 0x82,
+    0x94, 0xb2, 0x7b, 0xcf, 0xc4, 0x01, 0x21, 0x24, 0x08, 0x41, 0xc1, 0x1d, 0x5b, 0x0c, 0xed, 0xf7,
+    0xea, 0xca, 0xf6, 0x18, 0xe3, 0x0b, 0xd0, 0x00, 0xd0, 0xa1, 0xd8, 0x60, 0xd0, 0x00, 0xeb, 0x6d,
+    0xfd, 0x75, 0xe1, 0x64, 0xe0, 0x60, 0xb8, 0x60, 0xa8, 0xa1, 0x9b, 0x0b, 0xdb, 0xce, 0xd9, 0x85,
+    0xd0, 0x20, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x20, 0xc0, 0x20, 0xd0, 0x80, 0xd0, 0x60, 0xd0, 0x40,
+    0xd0, 0xa1, 0xd8, 0x60, 0xc0, 0x60, 0xc0, 0x81, 0x43, 0xd0, 0x81, 0x01, 0xe0, 0xa1, 0x58, 0x40,
+    0xd1, 0xcc, 0x02, 0x42, 0x28, 0xe7, 0x1c, 0x6b, 0x6d, 0xcd, 0x02, 0x10, 0x82, 0x39, 0xe7, 0x18,
+    0xe3, 0xc7, 0x12, 0x4a, 0x08, 0xe6, 0x58, 0xea, 0x27, 0xec, 0x0f, 0xfd, 0xd6, 0xe0, 0x60, 0xe0,
+    0x80, 0xd8, 0xa1, 0xd0, 0x81, 0xd0, 0x60, 0xc1, 0xe7, 0xb9, 0xa6, 0xa8, 0x60, 0x88, 0x60, 0x40,
+    0x20, 0x20, 0x00, 0x30, 0x00, 0xc8, 0x00, 0xd0, 0x40, 0x42, 0xd0, 0x81, 0x04, 0xc8, 0x81, 0xc8,
+    0x81, 0xd8, 0x81, 0xd0, 0x81, 0xd0, 0xa1, 0x42, 0xd0, 0x81, 0x01, 0xc0, 0x81, 0xc8, 0x81, 0x82,
+    0x01, 0xd8, 0xa1, 0x80, 0x60, 0xd1, 0xe5, 0x02, 0x31, 0xa6, 0xad, 0x75, 0x08, 0x61, 0xc3, 0x05,
+    0x10, 0x00, 0x60, 0x40, 0xc0, 0x81, 0xd8, 0xa1, 0xd8, 0x81, 0xd0, 0x81, 0x44, 0xd8, 0x81, 0x0d,
+    0xd8, 0xa1, 0xd8, 0x81, 0xe0, 0x80, 0xe5, 0x34, 0xa2, 0xca, 0x58, 0x00, 0x60, 0x40, 0xd8, 0xa1,
+    0xd8, 0x81, 0xd8, 0x81, 0x78, 0x40, 0x20, 0x00, 0x28, 0x20, 0x08, 0x00, 0xc5, 0x03, 0x10, 0x00,
+    0x28, 0x20, 0x30, 0x20, 0x08, 0x00, 0xcf, 0xe5, 0x02, 0x9c, 0xd3, 0xce, 0x79, 0x08, 0x41, 0xc5,
+    0x03, 0x38, 0x20, 0xa0, 0x60, 0xe0, 0xa1, 0xd8, 0xa1, 0x45, 0xd0, 0x81, 0x0b, 0xd0, 0x60, 0xd9,
+    0xc6, 0xff, 0xbe, 0xea, 0x89, 0xd0, 0x60, 0xa0, 0x60, 0xc8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xc0,
+    0x81, 0x70, 0x40, 0x20, 0x00, 0xc1, 0x07, 0x08, 0x00, 0x30, 0x20, 0x48, 0x20, 0x58, 0x40, 0x78,
+    0x40, 0x98, 0x60, 0xa0, 0x60, 0x50, 0x40, 0x90, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf,
+    0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf,
+    0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xcb, 0x03, 0x08, 0x41, 0xa5, 0x34, 0xc6, 0x38,
+    0x21, 0x24, 0xd6, 0x0f, 0x08, 0x00, 0x58, 0xe3, 0xee, 0x38, 0xeb, 0x4c, 0xd1, 0x85, 0xf6, 0xba,
+    0xb2, 0x07, 0xa8, 0x00, 0x98, 0x60, 0x78, 0x40, 0x60, 0x40, 0x58, 0x40, 0x38, 0x00, 0x28, 0x00,
+    0x20, 0x00, 0x08, 0x00, 0xc1, 0x02, 0x78, 0x40, 0xd8, 0xa1, 0xd0, 0xa1, 0x83, 0x42, 0xd0, 0x81,
+    0x05, 0xd8, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0xc0, 0x81, 0x82, 0x02, 0xd8,
+    0x81, 0xb0, 0x80, 0x28, 0x20, 0xd0, 0xcb, 0x02, 0x52, 0xaa, 0xe7, 0x3c, 0x6b, 0x4d, 0xd6, 0x0a,
+    0x18, 0x00, 0x70, 0x20, 0xed, 0x13, 0xc5, 0x13, 0x68, 0x41, 0xdd, 0x75, 0x94, 0x71, 0x20, 0x00,
+    0x20, 0x00, 0x10, 0x00, 0x08, 0x00, 0xc7, 0x00, 0x78, 0x60, 0x44, 0xd0, 0x81, 0x83, 0x04, 0xd0,
+    0x81, 0xd0, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0x83, 0x02, 0xd0, 0x81, 0xe0, 0xa1, 0x60,
+    0x40, 0xd0, 0xe9, 0x0a, 0x08, 0x00, 0x48, 0x20, 0x80, 0x40, 0x80, 0x60, 0x68, 0x40, 0x60, 0x40,
+    0x50, 0x40, 0x50, 0x40, 0x50, 0x20, 0x48, 0x20, 0x48, 0x20, 0x42, 0x38, 0x20, 0x01, 0x20, 0x00,
+    0x10, 0x00, 0xc2, 0x04, 0x08, 0x00, 0x90, 0x60, 0xe0, 0xa1, 0xb8, 0x81, 0x38, 0x20, 0xc1, 0x01,
+    0x20, 0x00, 0x28, 0x20, 0xd9, 0xe6, 0x00, 0x21, 0x24, 0xc2, 0x04, 0x08, 0x00, 0x48, 0x20, 0xa8,
+    0x60, 0xd8, 0xa1, 0xe8, 0xa1, 0x42, 0xd8, 0x81, 0x12, 0xd0, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0xc8,
+    0x81, 0xd0, 0x81, 0xb0, 0x60, 0x80, 0x60, 0x70, 0x20, 0x40, 0xe3, 0x18, 0x82, 0x00, 0x00, 0x68,
+    0x40, 0xe0, 0xa1, 0xd8, 0xa1, 0xb0, 0x61, 0x28, 0x20, 0x00, 0x00, 0x28, 0x20, 0x18, 0x00, 0xd9,
+    0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf,
+    0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf,
+    0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xca, 0x03, 0x18, 0xc3, 0xbd, 0xd7, 0xb5, 0xb6,
+    0x18, 0xe3, 0xd6, 0x06, 0x20, 0x00, 0x8a, 0x89, 0xe6, 0xdb, 0x28, 0xc3, 0x63, 0x2c, 0xc6, 0x38,
+    0x10, 0x82, 0xca, 0x01, 0x10, 0x00, 0x98, 0x60, 0x83, 0x0b, 0xc8, 0x81, 0xd0, 0x81, 0xd8, 0x81,
+    0xd0, 0x81, 0xd8, 0x81, 0xb0, 0x80, 0x80, 0x60, 0xc8, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xc8, 0x81,
+    0xc8, 0x81, 0x82, 0x01, 0xd8, 0xa1, 0x90, 0x60, 0xd0, 0xca, 0x02, 0x73, 0xae, 0xe7, 0x3c, 0x52,
+    0xaa, 0xd7, 0x05, 0x00, 0x20, 0xbe, 0x18, 0x5b, 0x0c, 0x29, 0x86, 0xd6, 0xba, 0x39, 0xe7, 0xcb,
+    0x02, 0x38, 0x20, 0xc8, 0x81, 0xd8, 0x81, 0x84, 0x08, 0xd0, 0x81, 0xd8, 0x81, 0xe0, 0xa1, 0x80,
+    0x60, 0x10, 0x00, 0x70, 0x40, 0xc8, 0x81, 0xd8, 0xa1, 0xd0, 0x81, 0x83, 0x01, 0xd8, 0x81, 0x98,
+    0x60, 0xd0, 0xfc, 0x02, 0x18, 0x00, 0xc0, 0x81, 0x50, 0x40, 0xc4, 0x01, 0x28, 0x20, 0x28, 0x20,
+    0xd8, 0xea, 0x02, 0x18, 0x00, 0x18, 0x00, 0x08, 0x00, 0xce, 0x03, 0x08, 0x00, 0xb8, 0x81, 0xd0,
+    0x81, 0x40, 0x20, 0xc2, 0x02, 0x10, 0x00, 0x30, 0x20, 0x18, 0x00, 0xd8, 0xff, 0xdf, 0xff, 0xdf,
+    0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf,
+    0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf,
+    0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xc9, 0x03, 0x29, 0x65,
+    0xce, 0x79, 0x9c, 0xd3, 0x00, 0x20, 0xd7, 0x04, 0x42, 0x28, 0xe7, 0x3c, 0x52, 0x8a, 0xce, 0x59,
+    0x6b, 0x4d, 0xcc, 0x01, 0x50, 0x40, 0xd0, 0x81, 0x86, 0x06, 0xd0, 0x81, 0xb0, 0x81, 0x40, 0x20,
+    0x00, 0x00, 0x38, 0x20, 0xb8, 0x81, 0xe0, 0xa1, 0x44, 0xd0, 0x81, 0x02, 0xd8, 0x81, 0xb0, 0x81,
+    0x10, 0x00, 0xcf, 0xc9, 0x02, 0x18, 0xc3, 0x42, 0x28, 0x18, 0xe3, 0xd8, 0x04, 0x6b, 0x6d, 0xf7,
+    0xbe, 0xe7, 0x3c, 0x73, 0xae, 0x00, 0x20, 0xcc, 0x00, 0x60, 0x40, 0x83, 0x05, 0xc8, 0x81, 0xd0,
+    0x81, 0xd0, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0x70, 0x40, 0xc2, 0x02, 0x68, 0x40, 0xd0, 0x81, 0xd8,
+    0xa1, 0x45, 0xd0, 0x81, 0x00, 0x30, 0x20, 0xcf, 0xfc, 0x01, 0x18, 0x00, 0x08, 0x00, 0xc6, 0x02,
+    0x20, 0x20, 0x30, 0x20, 0x08, 0x00, 0xd6, 0xfc, 0x01, 0x38, 0x20, 0x68, 0x40, 0xc5, 0x02, 0x08,
+    0x00, 0x30, 0x20, 0x18, 0x00, 0xd7, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf,
+    0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf,
+    0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf,
+    0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xe5, 0x03,
+    0x21, 0x04, 0x7b, 0xef, 0x4a, 0x49, 0x08, 0x41, 0xcd, 0x01, 0x48, 0x20, 0xc8, 0x81, 0x82, 0x42,
+    0xd0, 0x81, 0x02, 0xd8, 0xa1, 0xc8, 0x81, 0x50, 0x20, 0xc2, 0x02, 0x08, 0x00, 0x78, 0x40, 0xc8,
+    0x81, 0x83, 0x02, 0xd8, 0x81, 0xc8, 0x81, 0x38, 0x20, 0xcf, 0xe6, 0x00, 0x00, 0x20, 0xcf, 0x01,
+    0x68, 0x40, 0xd0, 0x81, 0x84, 0x02, 0xd8, 0x81, 0xd8, 0xa1, 0x90, 0x60, 0xc5, 0x02, 0x78, 0x40,
+    0xd8, 0x81, 0xd8, 0x81, 0x42, 0xd0, 0x81, 0x01, 0xd8, 0xa1, 0x60, 0x40, 0xcf, 0xff, 0xc6, 0x02,
+    0x10, 0x00, 0x38, 0x20, 0x10, 0x00, 0xd5, 0xff, 0xc6, 0x01, 0x30, 0x20, 0x20, 0x00, 0xd6, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xf7,
+    0x01, 0x80, 0x40, 0xd8, 0xa1, 0x45, 0xd0, 0x81, 0x01, 0xb0, 0x61, 0x20, 0x00, 0xc5, 0x01, 0x18,
+    0x00, 0x98, 0x60, 0x43, 0xd0, 0x81, 0x01, 0xd8, 0xa1, 0x78, 0x60, 0xcf, 0xf7, 0x02, 0x60, 0x40,
+    0xc8, 0x81, 0xd8, 0x81, 0x82, 0x02, 0xd8, 0x81, 0xb8, 0x81, 0x30, 0x20, 0xc7, 0x02, 0x10, 0x00,
+    0x98, 0x60, 0xd8, 0x81, 0x82, 0x00, 0x98, 0x60, 0xcf, 0xff, 0xc8, 0x01, 0x30, 0x20, 0x28, 0x20,
+    0xd4, 0xff, 0xc7, 0x02, 0x20, 0x00, 0x30, 0x20, 0x08, 0x00, 0xd4, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xf7, 0x01, 0x88, 0x60, 0xd8, 0xa1, 0x44, 0xd0, 0x81, 0x00, 0x80, 0x60, 0xc9,
+    0x05, 0x20, 0x00, 0xa8, 0x61, 0xd8, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0x90, 0x60, 0xcf, 0xf7, 0x01,
+    0x80, 0x60, 0xd8, 0x81, 0x82, 0x02, 0xd8, 0x81, 0x80, 0x60, 0x10, 0x00, 0xca, 0x05, 0x28, 0x00,
+    0xb0, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0x18, 0x00, 0xce, 0xff, 0xca, 0x01, 0x38, 0x20,
+    0x20, 0x00, 0xd2, 0xff, 0xc9, 0x01, 0x38, 0x20, 0x20, 0x00, 0xd3, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xf7, 0x00, 0x88, 0x60, 0x82,
+    0x02, 0xd8, 0x81, 0xb8, 0x81, 0x28, 0x20, 0xcc, 0x04, 0x30, 0x20, 0xb8, 0x81, 0xd8, 0x81, 0xd0,
+    0x81, 0x30, 0x20, 0xce, 0xf7, 0x05, 0x80, 0x60, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xc8, 0x81,
+    0x48, 0x20, 0xce, 0x03, 0x40, 0x20, 0xb8, 0x81, 0xd8, 0x81, 0x48, 0x20, 0xce, 0xff, 0xcb, 0x02,
+    0x10, 0x00, 0x38, 0x20, 0x20, 0x00, 0xd0, 0xff, 0xca, 0x02, 0x08, 0x00, 0x40, 0x20, 0x18, 0x00,
+    0xd1, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xf7, 0x04, 0x88, 0x60, 0xd8, 0x81, 0xd8,
+    0x81, 0xc8, 0x81, 0x68, 0x40, 0xd0, 0x02, 0x40, 0x20, 0xd8, 0x81, 0x90, 0x60, 0xce, 0xf7, 0x03,
+    0xa0, 0x60, 0xd8, 0x81, 0xe0, 0xa1, 0x88, 0x60, 0xd2, 0x01, 0x68, 0x40, 0xa8, 0x60, 0xce, 0xff,
+    0xcd, 0x02, 0x10, 0x00, 0x38, 0x20, 0x28, 0x20, 0xce, 0xff, 0xcc, 0x02, 0x10, 0x00, 0x38, 0x20,
+    0x20, 0x20, 0xcf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xf7, 0x03, 0x98, 0x60, 0xd8, 0x81, 0xb0, 0x80, 0x28, 0x20, 0xd2, 0x02, 0x08,
+    0x00, 0x80, 0x40, 0x28, 0x20, 0xcd, 0xf6, 0x03, 0x10, 0x00, 0xb0, 0x80, 0xd8, 0x81, 0x38, 0x20,
+    0xd4, 0x01, 0x10, 0x00, 0x20, 0x00, 0xcd, 0xff, 0xcf, 0x03, 0x08, 0x00, 0x30, 0x20, 0x48, 0x20,
+    0x20, 0x00, 0xcb, 0xff, 0xce, 0x03, 0x08, 0x00, 0x30, 0x20, 0x30, 0x20, 0x08, 0x00, 0xcc, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xf6, 0x03, 0x20, 0x00, 0xc8, 0x81, 0x88, 0x60, 0x08,
+    0x00, 0xe4, 0xf6, 0x02, 0x38, 0x20, 0xb0, 0x60, 0x20, 0x00, 0xe5, 0xff, 0xd2, 0x03, 0x18, 0x00,
+    0x50, 0x41, 0x60, 0x41, 0x20, 0x20, 0xc8, 0xff, 0xd1, 0x03, 0x28, 0x20, 0x50, 0x41, 0x40, 0x20,
+    0x08, 0x00, 0xc9, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xdf, 0xff,
+    0xdf, 0xff, 0xdf, 0xf6, 0x01, 0x50, 0x40, 0x50, 0x20, 0xe6, 0xf6, 0x01, 0x20, 0x00, 0x08, 0x00,
+    0xe6, 0xff, 0xd3, 0x02, 0x10, 0x00, 0x30, 0x20, 0x20, 0x00, 0xc8,
+};
+
+static const PackedFrame bootAnimation_frames[61] = {
+    {0, 64, 0}, {28, 36, 671}, {26, 38, 1136}, {24, 40, 1564},
+    {22, 42, 1910}, {20, 44, 2210}, {18, 46, 2482}, {16, 48, 2680},
+    {14, 50, 2845}, {12, 52, 2985}, {10, 54, 3131}, {8, 56, 3277},
+    {6, 58, 3423}, {4, 60, 3575}, {2, 62, 3723}, {1, 2, 3873},
+    {64, 64, 3883}, {64, 64, 3883}, {64, 64, 3883}, {64, 64, 3883},
+    {64, 64, 3883}, {64, 64, 3883}, {64, 64, 3883}, {64, 64, 3883},
+    {64, 64, 3883}, {64, 64, 3883}, {64, 64, 3883}, {64, 64, 3883},
+    {64, 64, 3883}, {64, 64, 3883}, {64, 64, 3883}, {64, 64, 3883},
+    {64, 64, 3883}, {64, 64, 3883}, {64, 64, 3883}, {64, 64, 3883},
+    {64, 64, 3883}, {64, 64, 3883}, {64, 64, 3883}, {64, 64, 3883},
+    {64, 64, 3883}, {64, 64, 3883}, {64, 64, 3883}, {64, 64, 3883},
+    {64, 64, 3883}, {64, 64, 3883}, {64, 64, 3883}, {64, 64, 3883},
+    {64, 64, 3883}, {64, 64, 3883}, {64, 64, 3883}, {64, 64, 3883},
+    {64, 64, 3883}, {64, 64, 3883}, {64, 64, 3883}, {64, 64, 3883},
+    {64, 64, 3883}, {64, 64, 3883}, {64, 64, 3883}, {64, 64, 3883},
+    {64, 64, 3883},
+};
+
+const PackedAnimation bootAnimation = {{96, 64, 2, sizeof(bootAnimation_data), bootAnimation_data}, 61, 33, bootAnimation_frames};
+
+AnimStats animStats = {0};
+
+// Everything here runs on core0, the timer only raises a flag
+static const PackedAnimation *playing = NULL;
+static struct repeating_timer frameTimer;
+static volatile bool frameDue = false;
+static int frame;    // being unpacked, or next to go
+static int nextLine; // next line of it, -1 until it's started
+static const uint8_t *src;
+
+static bool frameTick(struct repeating_timer *t) {
+  if (frameDue)
+    animStats.late++;
+  frameDue = true;
+  return true;
+}
+
+bool animStart(const PackedAnimation *anim) {
+  if (display->mono || !display->uiRow)
+    return false;
+
+  animStop();
+  memset(&animStats, 0, sizeof(animStats));
+  playing = anim;
+  frame = 0;
+  nextLine = -1;
+  frameDue = true; // first frame straight away
+  lcdCover(true);
+
+  // negative interval means the callback is called every frameMs regardless of how long it takes to execute
+  add_repeating_timer_ms(-anim->frameMs, frameTick, NULL, &frameTimer);
+  return true;
+}
+
+void animStop() {
+  if (!playing)
+    return;
+
+  cancel_repeating_timer(&frameTimer);
+  playing = NULL;
+  lcdCover(false);
+}
+
+bool animActive() { return playing != NULL; }
+
+bool animStep() {
+  if (!playing)
+    return false;
+
+  uint32_t start = time_us_32();
+  const PackedFrame *f = &playing->frames[frame];
+
+  if (nextLine < 0) {
+    if (!frameDue)
+      return false;
+    if (frame == playing->frameCount) { // the last frame has had its time on screen
+      animStop();
+      return true;
+    }
+    if (f->y0 < f->y1) {
+      if (displayBusy()) // the previous frame is still going out
+        return false;
+      display->beginDraw();
+    }
+    frameDue = false;
+    src = playing->image.data + f->offset;
+    nextLine = f->y0;
+  } else if (nextLine < f->y1) {
+    int end = MIN(nextLine + ANIM_BAND, f->y1);
+    animStats.lines += end - nextLine;
+    for (; nextLine < end; nextLine++)
+      src = unpackLine(&playing->image, src, display->uiRow(nextLine), nextLine ? display->uiRow(nextLine - 1) : NULL);
+  } else {
+    if (f->y0 < f->y1)
+      updateDisplayRows(f->y0, f->y1);
+    animStats.frames++;
+    frame++;
+    nextLine = -1;
+  }
+
+  uint32_t took = time_us_32() - start;
+  if (took > animStats.maxStepUs)
+    animStats.maxStepUs = took;
+  return true;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "pack.h"
+
+typedef struct {
+  uint32_t frames;    // frames sent to the panel
+  uint32_t late;      // frame ticks that came round before the last frame was out
+  uint32_t lines;     // lines unpacked
+  uint32_t maxStepUs; // longest single step, i.e. the most a Maple response can be held up
+} AnimStats;
+
+extern AnimStats animStats;
+
+extern const PackedAnimation bootAnimation;
+
+// Play an animation over the VMU screen, which is held back until it ends.
+// Colour panels only, returns false (and does nothing) on the SSD1306
+bool animStart(const PackedAnimation *anim);
+
+// Stop early, e.g. when the menu opens, and hand the screen back to the VMU
+void animStop(void);
+
+bool animActive(void);
+
+// Do one bounded slice of animation work. Returns true if there was any
+bool animStep(void);
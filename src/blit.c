@@ -0,0 +1,376 @@
+/* blit.c
+ *  fast 1bpp VMU framebuffer -> panel format converters
+ */
+
+#include "blit.h"
+
+#if BLIT_INTERP
+#include "hardware/interp.h"
+#endif
+
+// 4 VMU pixels (one nibble) -> lit mask for the 4 words of 8 doubled RGB565 pixels
+#define NIBBLE_WORD(n, k) ((n) & (8 >> (k)) ? 0xffffffffu : 0)
+#define NIBBLE(n) {NIBBLE_WORD(n, 0), NIBBLE_WORD(n, 1), NIBBLE_WORD(n, 2), NIBBLE_WORD(n, 3)}
+static uint32_t nibbleMask[16][4] = {
+  NIBBLE(0), NIBBLE(1), NIBBLE(2), NIBBLE(3), NIBBLE(4), NIBBLE(5), NIBBLE(6), NIBBLE(7),
+  NIBBLE(8), NIBBLE(9), NIBBLE(10), NIBBLE(11), NIBBLE(12), NIBBLE(13), NIBBLE(14), NIBBLE(15),
+};
+
+// 4 pixels -> 4 RGB565 pixels at 1:1, as 2 words, left pixel in the low half as it's first in memory
+#define PIXEL_WORD(n, l, r) (((n) & (l) ? 0xffffu : 0) | ((n) & (r) ? 0xffff0000u : 0))
+#define PIXELS(n) {PIXEL_WORD(n, 8, 4), PIXEL_WORD(n, 2, 1)}
+static uint32_t pixelMask[16][2] = {
+  PIXELS(0), PIXELS(1), PIXELS(2), PIXELS(3), PIXELS(4), PIXELS(5), PIXELS(6), PIXELS(7),
+  PIXELS(8), PIXELS(9), PIXELS(10), PIXELS(11), PIXELS(12), PIXELS(13), PIXELS(14), PIXELS(15),
+};
+
+// Bytes go out high byte first, so a pixel pair is hi, lo, hi, lo in memory
+static inline uint32_t colorPair(uint16_t color) {
+  uint32_t pair = (color >> 8) | ((color & 0xff) << 8);
+  return pair | pair << 16;
+}
+
+void rowColorsSolid(RowColors *colors, uint16_t color) {
+  for (int row = 0; row < ROW_COLORS; row++) {
+    colors->fg[row] = color;
+    colors->bg[row] = 0;
+  }
+}
+
+// Each row is bg with the lit pixels flipped over to fg: one table lookup
+// for the row's colours, then a mask per word
+void vmuBlitRGB565(const uint8_t *lcd, int numCols, int firstRow, int lastRow, const RowColors *colors, uint8_t *fb, int stride) {
+  const int rowBytes = numCols * 8 * 2 * 2; // 8 pixels per byte, doubled, 2 bytes each
+
+  for (int row = firstRow; row < lastRow; row++) {
+    const uint8_t *src = &lcd[row * numCols];
+    uint8_t *line = &fb[row * 2 * stride];
+    uint32_t *dst = (uint32_t *)line;
+    const uint32_t bg = colorPair(colors->bg[row]);
+    const uint32_t flip = colorPair(colors->fg[row]) ^ bg;
+
+    for (int col = 0; col < numCols; col++) {
+      const uint32_t *hi = nibbleMask[src[col] >> 4];
+      const uint32_t *lo = nibbleMask[src[col] & 0x0f];
+      dst[0] = bg ^ (hi[0] & flip);
+      dst[1] = bg ^ (hi[1] & flip);
+      dst[2] = bg ^ (hi[2] & flip);
+      dst[3] = bg ^ (hi[3] & flip);
+      dst[4] = bg ^ (lo[0] & flip);
+      dst[5] = bg ^ (lo[1] & flip);
+      dst[6] = bg ^ (lo[2] & flip);
+      dst[7] = bg ^ (lo[3] & flip);
+      dst += 8;
+    }
+    memcpy(line + stride, line, rowBytes); // vertical doubling
+  }
+}
+
+// 4 vertical VMU pixels (bit 0 = top) -> one SSD1306 page byte with every pixel doubled
+static const uint8_t doubleBits[16] = {
+  0x00, 0x03, 0x0c, 0x0f, 0x30, 0x33, 0x3c, 0x3f,
+  0xc0, 0xc3, 0xcc, 0xcf, 0xf0, 0xf3, 0xfc, 0xff,
+};
+
+// 8x8 bit matrix transpose, byte j bit k <-> byte k bit j (Hacker's Delight 7-3).
+// Done as two 32 bit halves since the M0+ has no 64 bit shifts
+static inline void transpose8(uint32_t *lo, uint32_t *hi) {
+  uint32_t x = *lo, y = *hi, t;
+
+  t = (x ^ (x >> 7)) & 0x00AA00AA;
+  x = x ^ t ^ (t << 7);
+  t = (y ^ (y >> 7)) & 0x00AA00AA;
+  y = y ^ t ^ (t << 7);
+
+  t = (x ^ (x >> 14)) & 0x0000CCCC;
+  x = x ^ t ^ (t << 14);
+  t = (y ^ (y >> 14)) & 0x0000CCCC;
+  y = y ^ t ^ (t << 14);
+
+  // last step swaps 4x4 blocks between the halves
+  t = (x ^ (y << 4)) & 0xF0F0F0F0;
+  x = x ^ t;
+  y = y ^ (t >> 4);
+
+  *lo = x;
+  *hi = y;
+}
+
+void vmuBlitPage(const uint8_t *lcd, int numCols, int firstRow, int lastRow, bool on, uint8_t *fb, int stride, int xOffset) {
+  // work on bands of 8 VMU rows, which become two full 8 pixel high pages
+  firstRow &= ~7;
+  lastRow = (lastRow + 7) & ~7;
+
+  for (int row = firstRow; row < lastRow; row += 8) {
+    uint8_t *top = &fb[(row >> 2) * stride + xOffset];
+    uint8_t *bottom = top + stride;
+
+    for (int col = 0; col < numCols; col++) {
+      const uint8_t *src = &lcd[row * numCols + col];
+      uint32_t lo = 0, hi = 0;
+
+      if (on) {
+        lo = src[0] | (src[numCols] << 8) | (src[numCols * 2] << 16) | ((uint32_t)src[numCols * 3] << 24);
+        hi = src[numCols * 4] | (src[numCols * 5] << 8) | (src[numCols * 6] << 16) | ((uint32_t)src[numCols * 7] << 24);
+        transpose8(&lo, &hi);
+      }
+
+      // byte k of the result is source bit k, i.e. pixel 7 - k, rows in bits 0..7
+      for (int k = 7; k >= 4; k--) {
+        uint8_t v = hi >> ((k - 4) * 8);
+        top[0] = top[1] = doubleBits[v & 0x0f];
+        bottom[0] = bottom[1] = doubleBits[v >> 4];
+        top += 2;
+        bottom += 2;
+      }
+      for (int k = 3; k >= 0; k--) {
+        uint8_t v = lo >> (k * 8);
+        top[0] = top[1] = doubleBits[v & 0x0f];
+        bottom[0] = bottom[1] = doubleBits[v >> 4];
+        top += 2;
+        bottom += 2;
+      }
+    }
+  }
+}
+
+// One row of 1bpp pixels (MSB = leftmost) to RGB565 at 1:1, with the interpolator working
+// out both nibbles' table entries from a single write when it's enabled
+static inline void expandRow(const uint8_t *bits, int numBytes, uint32_t bg, uint32_t flip, uint32_t *dst) {
+  for (int i = 0; i < numBytes; i++) {
+#if BLIT_INTERP
+    interp_set_accumulator(interp0, 0, bits[i] * 0x1001); // lane 0 takes the high nibble from bits 4-7, lane 1 the low one from 12-15
+    const uint32_t *hi = (const uint32_t *)interp_peek_lane_result(interp0, 0);
+    const uint32_t *lo = (const uint32_t *)interp_peek_lane_result(interp0, 1);
+#else
+    const uint32_t *hi = pixelMask[bits[i] >> 4];
+    const uint32_t *lo = pixelMask[bits[i] & 0x0f];
+#endif
+    dst[0] = bg ^ (hi[0] & flip);
+    dst[1] = bg ^ (hi[1] & flip);
+    dst[2] = bg ^ (lo[0] & flip);
+    dst[3] = bg ^ (lo[1] & flip);
+    dst += 4;
+  }
+}
+
+#if BLIT_INTERP
+// Both lanes give &pixelMask[nibble] for expandRow, (nibble << 3) being the byte offset
+static void setupInterp() {
+  interp_config cfg = interp_default_config();
+  interp_config_set_shift(&cfg, 1);
+  interp_config_set_mask(&cfg, 3, 6);
+  interp_set_config(interp0, 0, &cfg);
+
+  cfg = interp_default_config();
+  interp_config_set_cross_input(&cfg, true); // reads lane 0's accumulator
+  interp_config_set_shift(&cfg, 9);
+  interp_config_set_mask(&cfg, 3, 6);
+  interp_set_config(interp0, 1, &cfg);
+
+  interp_set_base(interp0, 0, (uintptr_t)pixelMask);
+  interp_set_base(interp0, 1, (uintptr_t)pixelMask);
+}
+#else
+static inline void setupInterp() {}
+#endif
+
+void testBlitRGB565(const uint8_t *lcd, int numCols, int firstCol, int lastCol, int firstRow, int lastRow, const RowColors *colors, uint8_t *fb, int stride) {
+  setupInterp();
+  for (int row = firstRow; row < lastRow; row++) {
+    const uint32_t bg = colorPair(colors->bg[row]);
+    expandRow(&lcd[row * numCols + firstCol], lastCol - firstCol, bg, colorPair(colors->fg[row]) ^ bg, (uint32_t *)&fb[row * stride]);
+  }
+}
+
+// Bit n of a byte to bit 2n of a halfword, for interleaving two bytes of output pixels
+#define SPREAD(n) (((n) & 1) | ((n) & 2) << 1 | ((n) & 4) << 2 | ((n) & 8) << 3 | ((n) & 16) << 4 | ((n) & 32) << 5 | ((n) & 64) << 6 | ((n) & 128) << 7)
+#define SPREAD4(n) SPREAD(n), SPREAD(n + 1), SPREAD(n + 2), SPREAD(n + 3)
+#define SPREAD16(n) SPREAD4(n), SPREAD4(n + 4), SPREAD4(n + 8), SPREAD4(n + 12)
+#define SPREAD64(n) SPREAD16(n), SPREAD16(n + 16), SPREAD16(n + 32), SPREAD16(n + 48)
+static uint16_t spread[256] = {SPREAD64(0), SPREAD64(64), SPREAD64(128), SPREAD64(192)};
+
+// Scale2x on 8 pixels at a time. Each pixel P becomes a 2x2 block E0 E1 / E2 E3, all P unless
+// two of its neighbours along a diagonal edge agree (Scale2x rules), with U, D, L, R the pixels
+// above, below, left and right, edges repeating. Done with whole bytes as bitwise compares,
+// then the E bytes are interleaved into the two 1bpp output rows
+void vmuBlitRGB565Smooth(const uint8_t *lcd, int numCols, int numRows, int firstRow, int lastRow, const RowColors *colors, uint8_t *fb, int stride) {
+  uint8_t top[SMOOTH_MAX_COLS * 2], bottom[SMOOTH_MAX_COLS * 2];
+
+  setupInterp();
+  for (int row = firstRow; row < lastRow; row++) {
+    const uint8_t *src = &lcd[row * numCols];
+    const uint8_t *up = row > 0 ? src - numCols : src;
+    const uint8_t *down = row < numRows - 1 ? src + numCols : src;
+
+    for (int col = 0; col < numCols; col++) {
+      const uint32_t p = src[col], u = up[col], d = down[col];
+      const uint32_t prev = col > 0 ? src[col - 1] : p >> 7; // only bit 0 is used
+      const uint32_t next = col < numCols - 1 ? src[col + 1] : (p & 1) << 7; // only bit 7 is used
+      const uint32_t l = ((p >> 1) | (prev << 7)) & 0xff;
+      const uint32_t r = ((p << 1) | (next >> 7)) & 0xff;
+
+      const uint32_t e0 = p ^ (~(l ^ u) & (l ^ d) & (u ^ r) & (u ^ p));
+      const uint32_t e1 = p ^ (~(u ^ r) & (u ^ l) & (r ^ d) & (r ^ p));
+      const uint32_t e2 = p ^ (~(d ^ l) & (d ^ r) & (l ^ u) & (l ^ p));
+      const uint32_t e3 = p ^ (~(r ^ d) & (r ^ u) & (d ^ l) & (d ^ p));
+
+      const uint32_t t = spread[e0] << 1 | spread[e1];
+      const uint32_t b = spread[e2] << 1 | spread[e3];
+      top[col * 2] = t >> 8;
+      top[col * 2 + 1] = t;
+      bottom[col * 2] = b >> 8;
+      bottom[col * 2 + 1] = b;
+    }
+
+    const uint32_t bg = colorPair(colors->bg[row]);
+    const uint32_t flip = colorPair(colors->fg[row]) ^ bg;
+    expandRow(top, numCols * 2, bg, flip, (uint32_t *)&fb[row * 2 * stride]);
+    expandRow(bottom, numCols * 2, bg, flip, (uint32_t *)&fb[(row * 2 + 1) * stride]);
+  }
+}
+
+void testBlitPage(const uint8_t *lcd, int numCols, int firstRow, int lastRow, bool on, uint8_t *fb, int stride, int xOffset) {
+  // 8 LCD rows make one page
+  firstRow &= ~7;
+  lastRow = (lastRow + 7) & ~7;
+
+  for (int row = firstRow; row < lastRow; row += 8) {
+    uint8_t *page = &fb[(row >> 3) * stride + xOffset];
+
+    for (int col = 0; col < numCols; col++) {
+      const uint8_t *src = &lcd[row * numCols + col];
+      uint32_t lo = 0, hi = 0;
+
+      if (on) {
+        lo = src[0] | (src[numCols] << 8) | (src[numCols * 2] << 16) | ((uint32_t)src[numCols * 3] << 24);
+        hi = src[numCols * 4] | (src[numCols * 5] << 8) | (src[numCols * 6] << 16) | ((uint32_t)src[numCols * 7] << 24);
+        transpose8(&lo, &hi);
+      }
+
+      // byte k of the result is pixel 7 - k, already in page bit order
+      page[0] = hi >> 24;
+      page[1] = hi >> 16;
+      page[2] = hi >> 8;
+      page[3] = hi;
+      page[4] = lo >> 24;
+      page[5] = lo >> 16;
+      page[6] = lo >> 8;
+      page[7] = lo;
+      page += 8;
+    }
+  }
+}
+
+void rgbFillRect(uint8_t *fb, int stride, int x0, int x1, int y0, int y1, uint16_t color) {
+  if (x0 >= x1 || y0 >= y1)
+    return;
+
+  // build the first row, then copy it down
+  uint8_t *first = &fb[y0 * stride + x0 * 2];
+  for (int x = x0; x < x1; x++) {
+    first[(x - x0) * 2] = color >> 8;
+    first[(x - x0) * 2 + 1] = color & 0xff;
+  }
+  for (int y = y0 + 1; y < y1; y++)
+    memcpy(&fb[y * stride + x0 * 2], first, (x1 - x0) * 2);
+}
+
+void rgbBlitMask(uint8_t *fb, int stride, const uint8_t *mask, int maskStride, int x, int y, int w, int h, uint16_t fg, uint16_t bg) {
+  for (int r = 0; r < h; r++) {
+    const uint8_t *src = &mask[r * maskStride];
+    uint8_t *dst = &fb[(y + r) * stride + x * 2];
+    for (int c = 0; c < w; c++) {
+      uint16_t pixel = (src[c >> 3] & (0x80 >> (c & 7))) ? fg : bg;
+      *dst++ = pixel >> 8;
+      *dst++ = pixel & 0xff;
+    }
+  }
+}
+
+void pageFillRect(uint8_t *fb, int stride, int x0, int x1, int y0, int y1, bool on) {
+  for (int page = y0 >> 3; page <= (y1 - 1) >> 3 && y0 < y1; page++) {
+    int top = MAX(y0, page * 8) & 7;
+    int bottom = MIN(y1, page * 8 + 8) - page * 8; // exclusive
+    uint8_t bits = (0xff << top) & (0xff >> (8 - bottom));
+    uint8_t *dst = &fb[page * stride];
+    for (int x = x0; x < x1; x++)
+      dst[x] = on ? dst[x] | bits : dst[x] & ~bits;
+  }
+}
+
+void pageBlitMask(uint8_t *fb, int stride, const uint8_t *mask, int maskStride, int x, int y, int w, int h, bool fg, bool bg) {
+  for (int r = 0; r < h; r++) {
+    const uint8_t *src = &mask[r * maskStride];
+    uint8_t *dst = &fb[((y + r) >> 3) * stride + x];
+    uint8_t bit = 1 << ((y + r) & 7);
+    for (int c = 0; c < w; c++) {
+      bool on = (src[c >> 3] & (0x80 >> (c & 7))) ? fg : bg;
+      dst[c] = on ? dst[c] | bit : dst[c] & ~bit;
+    }
+  }
+}
+
+Glyph glyphAtlas[GLYPH_COUNT];
+
+void glyphAtlasBuild(const tFont *font) {
+  memset(glyphAtlas, 0, sizeof(glyphAtlas));
+
+  for (int i = 0; i < font->length; i++) {
+    long code = font->chars[i].code;
+    if (code < GLYPH_FIRST || code >= GLYPH_FIRST + GLYPH_COUNT)
+      continue;
+
+    // font images are stored bottom up, with the glyph in bits 7..2 and set bits as background
+    const uint8_t *data = font->chars[i].image->data;
+    Glyph *glyph = &glyphAtlas[code - GLYPH_FIRST];
+    for (int r = 0; r < GLYPH_H; r++) {
+      uint8_t bits = ~data[GLYPH_H - 1 - r] & 0xfc;
+      glyph->rows[r] = bits;
+      for (int c = 0; c < GLYPH_W; c++)
+        if (bits & (0x80 >> c))
+          glyph->cols[c] |= 1 << r;
+    }
+  }
+}
+
+void rgbBlitText(uint8_t *fb, int stride, const char *text, int n, int x, int y, uint16_t fg, uint16_t bg) {
+  // swapped to memory order once, so every pixel is a single halfword store
+  const uint16_t on = (fg >> 8) | (fg << 8);
+  const uint16_t off = (bg >> 8) | (bg << 8);
+  uint16_t *cell = (uint16_t *)&fb[y * stride + x * 2];
+
+  for (int i = 0; i < n; i++, cell += GLYPH_W) {
+    const uint8_t *rows = glyphFor(text[i])->rows;
+    uint16_t *dst = cell;
+    for (int r = 0; r < GLYPH_H; r++, dst += stride / 2) {
+      uint8_t bits = rows[r];
+      dst[0] = (bits & 0x80) ? on : off;
+      dst[1] = (bits & 0x40) ? on : off;
+      dst[2] = (bits & 0x20) ? on : off;
+      dst[3] = (bits & 0x10) ? on : off;
+      dst[4] = (bits & 0x08) ? on : off;
+      dst[5] = (bits & 0x04) ? on : off;
+    }
+  }
+}
+
+// Each glyph column covers 10 bits of two or three pages, so it's one read-modify-write per page
+// rather than one per pixel
+void pageBlitText(uint8_t *fb, int stride, const char *text, int n, int x, int y, bool fg, bool bg) {
+  const int shift = y & 7;
+  const int pages = (shift + GLYPH_H + 7) >> 3;
+  const uint32_t cellBits = ((1u << GLYPH_H) - 1) << shift;
+  uint8_t *top = &fb[(y >> 3) * stride + x];
+
+  for (int i = 0; i < n; i++) {
+    const uint16_t *cols = glyphFor(text[i])->cols;
+    for (int c = 0; c < GLYPH_W; c++, top++) {
+      uint32_t lit = ((fg ? cols[c] : 0) | (bg ? ~cols[c] : 0)) & ((1u << GLYPH_H) - 1);
+      lit <<= shift;
+      uint8_t *dst = top;
+      for (int p = 0; p < pages; p++, dst += stride)
+        *dst = (*dst & ~(uint8_t)(cellBits >> (p * 8))) | (uint8_t)(lit >> (p * 8));
+    }
+  }
+}
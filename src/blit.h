@@ -0,0 +1,93 @@
+/* blit.h
+ *  fast 1bpp VMU framebuffer -> panel format converters
+ *  (no SDK dependencies so they can be built and checked on a PC)
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "font.h"
+
+#ifndef MIN
+#define MIN(a, b) ((b) > (a) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif
+
+// Let the RP2040 interpolator generate the lookup addresses in the 1:1 and Scale2x RGB565
+// blitters. Set with cmake -DBLIT_INTERP=ON, blit_bench checks it against a software
+// model in tools/hardware/interp.h
+#ifndef BLIT_INTERP
+#define BLIT_INTERP 0
+#endif
+
+#define ROW_COLORS 64 // enough for the 128x64 test mode screen
+
+// Colours the VMU screen is drawn in, per LCD row: lit pixels on row r get fg[r], the rest bg[r].
+// Gradients and animated themes only change this table, the bitmap is drawn the same way
+typedef struct {
+  uint16_t fg[ROW_COLORS];
+  uint16_t bg[ROW_COLORS];
+} RowColors;
+
+// One colour on black for every row, the plain per page palette
+void rowColorsSolid(RowColors *colors, uint16_t color);
+
+// Expand rows [firstRow, lastRow) of a 1bpp VMU bitmap (numCols bytes per row, MSB = leftmost)
+// to 2x scaled RGB565 in big-endian byte order, as the SSD1331 takes it. fb must be word aligned
+void vmuBlitRGB565(const uint8_t *lcd, int numCols, int firstRow, int lastRow, const RowColors *colors, uint8_t *fb, int stride);
+
+// Same, but 2x with Scale2x (EPX) rather than doubling, so diagonal edges step by one output pixel
+// instead of two. numRows is the bitmap's height; each output row also depends on the VMU rows
+// either side, so a caller redrawing changed rows takes one more at each end. numCols up to 16
+#define SMOOTH_MAX_COLS 16
+void vmuBlitRGB565Smooth(const uint8_t *lcd, int numCols, int numRows, int firstRow, int lastRow, const RowColors *colors, uint8_t *fb, int stride);
+
+// Same as above, but into SSD1306 page layout (byte = 8 vertical pixels, bit 0 on top) at column xOffset.
+// Works on whole bands of 8 VMU rows (2 pages), so the row range is widened to multiples of 8
+void vmuBlitPage(const uint8_t *lcd, int numCols, int firstRow, int lastRow, bool on, uint8_t *fb, int stride, int xOffset);
+
+// 1:1 versions for the 128x64 test mode screen. The RGB565 one only draws byte columns [firstCol, lastCol),
+// so the 96 pixel wide SSD1331 can show the middle of it
+void testBlitRGB565(const uint8_t *lcd, int numCols, int firstCol, int lastCol, int firstRow, int lastRow, const RowColors *colors, uint8_t *fb, int stride);
+
+void testBlitPage(const uint8_t *lcd, int numCols, int firstRow, int lastRow, bool on, uint8_t *fb, int stride, int xOffset);
+
+// Region helpers the panel backends build on. Rectangles are [x0, x1) x [y0, y1), already clipped.
+// Masks are 1bpp rows of maskStride bytes, MSB = leftmost pixel; set bits get fg, clear ones bg
+void rgbFillRect(uint8_t *fb, int stride, int x0, int x1, int y0, int y1, uint16_t color);
+
+void rgbBlitMask(uint8_t *fb, int stride, const uint8_t *mask, int maskStride, int x, int y, int w, int h, uint16_t fg, uint16_t bg);
+
+void pageFillRect(uint8_t *fb, int stride, int x0, int x1, int y0, int y1, bool on);
+
+void pageBlitMask(uint8_t *fb, int stride, const uint8_t *mask, int maskStride, int x, int y, int w, int h, bool fg, bool bg);
+
+// Text. The 6x10 menu font is packed once into a table indexed by ASCII code, in both the row
+// form the RGB565 panels draw from and the column form the SSD1306 pages want
+#define GLYPH_W 6
+#define GLYPH_H 10
+#define GLYPH_FIRST 0x20 // ' '
+#define GLYPH_COUNT 96   // up to 0x7f, anything else draws as a blank cell
+
+typedef struct {
+  uint8_t rows[GLYPH_H];  // top row first, MSB = leftmost pixel, set bits lit
+  uint16_t cols[GLYPH_W]; // leftmost column first, bit 0 = top row
+} Glyph;
+
+extern Glyph glyphAtlas[GLYPH_COUNT];
+
+void glyphAtlasBuild(const tFont *font);
+
+static inline const Glyph *glyphFor(char c) {
+  unsigned index = (unsigned char)c - GLYPH_FIRST;
+  return &glyphAtlas[index < GLYPH_COUNT ? index : 0];
+}
+
+// Draw n characters left to right from x as whole GLYPH_W x GLYPH_H cells, lit pixels in fg and
+// the rest of each cell in bg. Every cell must be on the buffer; the RGB565 fb must be halfword aligned
+void rgbBlitText(uint8_t *fb, int stride, const char *text, int n, int x, int y, uint16_t fg, uint16_t bg);
+
+void pageBlitText(uint8_t *fb, int stride, const char *text, int n, int x, int y, bool fg, bool bg);
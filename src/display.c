@@ -3,105 +3,14 @@
  */
 
 #include "display.h"
-#include "ssd1331.h"
-#include "ssd1306.h"
-
-#define TRUE 1
-#define FALSE 0
-
-// Math constants we'll use
-double const pi = 3.1415926535897932384626433; // pi
-double const twopi = 2.0 * pi;                 // pi times 2
-double const two_over_pi = 2.0 / pi;           // 2/pi
-double const halfpi = pi / 2.0;                // pi divided by 2
-double const threehalfpi = 3.0 * pi / 2.0;     // pi times 3/2, used in tan routines
-double const four_over_pi = 4.0 / pi;          // 4/pi, used in tan routines
-double const qtrpi = pi / 4.0;                 // pi/4.0, used in tan routines
-double const sixthpi = pi / 6.0;               // pi/6.0, used in atan routines
-double const twelfthpi = pi / 12.0;            // pi/12.0, used in atan routines
-
-float cos_32s(float x) {
-  const float c1 = 0.99940307;
-  const float c2 = -0.49558072;
-  const float c3 = 0.03679168;
-
-  float x2; // The input argument squared
-
-  x2 = x * x;
-  return (c1 + x2 * (c2 + c3 * x2));
-}
-
-//
-//  This is the main cosine approximation "driver"
-// It reduces the input argument's range to [0, pi/2],
-// and then calls the approximator.
-// See the notes for an explanation of the range reduction.
-//
-float cos32(float x) {
-  int q; // what quadrant are we in?
-
-  x = fmod(x, twopi); // Get rid of values > 2* pi
-  if (x < 0)
-    x = -x; // cos(-x) = cos(x)
-  q = (x * two_over_pi);
-  switch (q) {
-  case 0:
-    return cos_32s(x);
-  case 1:
-    return -cos_32s(pi - x);
-  case 2:
-    return -cos_32s(x - pi);
-  case 3:
-    return cos_32s(twopi - x);
-  }
-}
-//
-//   The sine is just cosine shifted a half-pi, so
-// we'll adjust the argument and call the cosine approximation.
-//
-float sin32(float x) { return cos32(halfpi - x); }
 
-double atan_66s(double x) {
-  const double c1 = 1.6867629106;
-  const double c2 = 0.4378497304;
-  const double c3 = 1.6867633134;
+extern const DisplayDriver ssd1331Driver, ssd1306Driver, st7789Driver, sh8601Driver;
 
-  double x2; // The input argument squared
-
-  x2 = x * x;
-  return (x * (c1 + x2 * c2) / (c3 + x2));
-}
-
-double atan66(double x) {
-  double tansixthpi = tan(sixthpi);     // tan(pi/6), used in atan routines
-  double tantwelfthpi = tan(twelfthpi); // tan(pi/12), used in atan routines
-  double y;                             // return from atan__s function
-  int complement = FALSE;               // true if arg was >1
-  int region = FALSE;                   // true depending on region arg is in
-  int sign = FALSE;                     // true if arg was < 0
-
-  if (x < 0) {
-    x = -x;
-    sign = TRUE; // arctan(-x)=-arctan(x)
-  }
-  if (x > 1.0) {
-    x = 1.0 / x; // keep arg between 0 and 1
-    complement = TRUE;
-  }
-  if (x > tantwelfthpi) {
-    x = (x - tansixthpi) / (1 + tansixthpi * x); // reduce arg to under tan(pi/12)
-    region = TRUE;
-  }
+// Picked once at boot by displaySelect(), everything below draws through it
+const DisplayDriver *display = &ssd1331Driver;
 
-  y = atan_66s(x); // run the approximation
-  if (region)
-    y += sixthpi; // correct for region we're in
-  if (complement)
-    y = halfpi - y; // correct for 1/x if we did that
-  if (sign)
-    y = -y; // correct for negative arg
-  return (y);
-}
+// Panel traffic, for checking what the dirty row tracking saves
+DisplayStats displayStats = {0};
 
 #define HSV_HUE_SEXTANT 256
 #define HSV_HUE_STEPS (6 * HSV_HUE_SEXTANT)
@@ -181,564 +90,159 @@ void fast_hsv2rgb_32bit(uint16_t h, uint8_t s, uint8_t v, uint8_t *r, uint8_t *g
   }
 }
 
+// Only for the odd pixel, e.g. ellipses and lines. Anything rectangular
+// should go through fillRect() or a mask blit
 void setPixel(uint8_t x, uint8_t y, uint16_t color) {
-  if (oledType) // 1
-    setPixelSSD1331(x, y, color);
-  else // 0
-    setPixelSSD1306(x + 16, y, color ? 1 : 0);
+  if (x < UI_W && y < UI_H)
+    display->setPixel(x + display->xOffset, y, color);
 }
 
-// bool getPixel(uint8_t x, uint8_t y)
-// {
-//   if (oledType) // 1
-//     return(getPixelSSD1331(x, y));
-//   else // 0
-//     return(getPixelSSD1306(x + 16, y));
-// }
-
-void drawEllipse(uint8_t xc, uint8_t yc, uint8_t xr, uint8_t yr, int angle, uint16_t color, bool fill) {
-  int step = 120;
-  float theta = 0;
-  float sangle, cangle = 0;
-  float rangle = 0;
-  float kf = 0;
-  float x, y = 0;
-  int xrot, yrot = 0;
-  int exmax, eymax = 0;
-  int exmin, eymin = 128;
-
-  uint8_t ellipse_start, ellipse_end = 0;
-
-  rangle = angle * M_PI / 180.0;
-  kf = (360 * M_PI / 180.0) / step;
-  sangle = sin32(rangle);
-  cangle = cos32(rangle);
-
-  for (int i = 0; i < step; i++) {
-    theta = i * kf;
-    x = xc + xr * cos32(theta);
-    y = yc + yr * sin32(theta);
-    xrot = round(xc + (x - xc) * cangle - (y - yc) * sangle);
-    yrot = round(yc + (x - xc) * sangle + (y - yc) * cangle);
-    setPixel(xrot, yrot, color);
-
-    // grab ellipse bounding box
-    if (xrot < exmin)
-      exmin = xrot;
-    if (xrot > exmax)
-      exmax = xrot;
-    if (yrot < eymin)
-      eymin = yrot;
-    if (yrot > eymax)
-      eymax = yrot;
+// 1bpp mask onto the 96x64 area, set bits in fg and clear ones in bg. Falls
+// back to single pixels in the rare case it hangs off the edge
+static void blitMask(const uint8_t *mask, int maskStride, int x, int y, int w, int h, uint16_t fg, uint16_t bg) {
+  if (x >= 0 && y >= 0 && x + w <= UI_W && y + h <= UI_H) {
+    display->blitMask(mask, maskStride, x + display->xOffset, y, w, h, fg, bg);
+    return;
   }
+  for (int j = 0; j < h; j++)
+    for (int i = 0; i < w; i++)
+      setPixel(x + i, y + j, (mask[j * maskStride + (i >> 3)] & (0x80 >> (i & 7))) ? fg : bg);
+}
 
-  // ...there must be a faster way to do this 😖
-  // if(fill){
-  //   for(int j = eymin; j <= eymax; j++){
-
-  //     int i = 0;
-  //     for(i = exmin; !getPixel(i,j); i++){}
-  //     ellipse_start = i;
-
-  //     for(i = exmax; !getPixel(i,j); i--){}
-  //     ellipse_end = i;
-
-  //     for(i = ellipse_start; i <= ellipse_end; i++){
-  //       setPixel(i, j, color);
-  //     }
-  //   }
+// Rasteriser spans (raster.c) land here, ctx points at the colour
+static void fillSpan(void *ctx, int x0, int x1, int y) { fillRect(x0, x1, y, y, *(const uint16_t *)ctx); }
 
-  // }
-};
+// angle is in degrees. Outline or filled, one fillRect per span, no floats
+void drawEllipse(uint8_t xc, uint8_t yc, uint8_t xr, uint8_t yr, int angle, uint16_t color, bool fill) {
+  rasterEllipseRotated(xc, yc, xr, yr, ANGLE_FROM_DEGREES(angle), fill, fillSpan, &color);
+}
 
-void drawLine(int x0, int y0, int w, uint16_t color) { hagl_draw_line(x0, y0, x0 + w, y0, color); }
+void drawLine(int x0, int y0, int w, uint16_t color) { fillRect(x0, x0 + w, y0, y0, color); }
 
 void hagl_draw_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  rasterLine(x0, y0, x1, y1, fillSpan, &color);
+}
 
-  int16_t dx;
-  int16_t sx;
-  int16_t dy;
-  int16_t sy;
-  int16_t err;
-  int16_t e2;
+// Corners are inclusive
+void fillRect(int x0, int x1, int y0, int y1, uint16_t color) {
+  int left = MAX(MIN(x0, x1), 0);
+  int right = MIN(MAX(x0, x1) + 1, UI_W);
+  int top = MAX(MIN(y0, y1), 0);
+  int bottom = MIN(MAX(y0, y1) + 1, UI_H);
 
-  dx = (x1 - x0);
-  sx = x0 < x1 ? 1 : -1;
-  dy = (y1 - y0);
-  sy = y0 < y1 ? 1 : -1;
-  err = (dx > dy ? dx : -dy) / 2;
+  if (left < right && top < bottom)
+    display->fillRect(left + display->xOffset, right + display->xOffset, top, bottom, color);
+}
 
-  while (1) {
-    setPixel(x0, y0, color);
+void fillCircle(int x0, int y0, int r, uint16_t color) { rasterEllipse(x0, y0, r, r, true, fillSpan, &color); }
 
-    if (x0 == x1 && y0 == y1) {
-      break;
-    };
+// Cursor arrow, 5x5 at x 89, y 53 on the first line
+static const uint8_t cursorMask[5] = {0x38, 0x78, 0xf8, 0x78, 0x38};
 
-    e2 = err + err;
+// Toggle switch, 18x7 at x 3, y 52 on the first line
+static const uint8_t toggleOnMask[7 * 3] = {
+    0x3f, 0xff, 0x00, 0x47, 0xff, 0x80, 0x83, 0xff, 0xc0, 0x83, 0xff, 0xc0,
+    0x83, 0xff, 0xc0, 0x47, 0xff, 0x80, 0x3f, 0xff, 0x00};
+static const uint8_t toggleOffMask[7 * 3] = {
+    0x3f, 0xff, 0x00, 0x40, 0x08, 0x80, 0x80, 0x10, 0x40, 0x80, 0x10, 0x40,
+    0x80, 0x10, 0x40, 0x40, 0x08, 0x80, 0x3f, 0xff, 0x00};
 
-    if (e2 > -dx) {
-      err -= dy;
-      x0 += sx;
-    }
+// Menu lines are 12 pixels apart from the bottom, so line iy covers
+// y 50 - 12 * iy to 61 - 12 * iy, text, toggle and cursor included
+DisplayRect clearLine(int iy) {
+  int y = 50 - 12 * iy;
 
-    if (e2 < dy) {
-      err += dx;
-      y0 += sy;
-    }
-  }
-}
-
-void fillRect(int x0, int x1, int y0, int y1, uint16_t color) {
-  for (int i = y0; i <= y1; i++) {
-    hagl_draw_line(x0, i, x1, i, color);
-  }
-}
-
-void fillCircle(int x0, int y0, int r, uint16_t color) {
-  int f = 1 - r;
-  int ddF_x = 1;
-  int ddF_y = -2 * r;
-  int x = 0;
-  int y = r;
-
-  fillRect(x0, x0, y0 - r, y0 + r, color);
-  fillRect(x0 - r, x0 + r, y0, y0, color);
-
-  while (x < y) {
-    if (f >= 0) {
-      y--;
-      ddF_y += 2;
-      f += ddF_y;
-    }
-    x++;
-    ddF_x += 2;
-    f += ddF_x;
-
-    fillRect(x0 - x, x0 + x, y0 + y, y0 + y, color);
-    fillRect(x0 - x, x0 + x, y0 - y, y0 - y, color);
-    fillRect(x0 - y, x0 + y, y0 + x, y0 + x, color);
-    fillRect(x0 - y, x0 + y, y0 - x, y0 - x, color);
-  }
+  fillRect(0, UI_W - 1, y, y + 11, 0x0000);
+  return (DisplayRect){0, UI_W, MAX(y, 0), MIN(y + 12, UI_H)};
 }
 
+// Only draws, the cursor on other lines stays until they're cleared
 void drawCursor(int iy, uint16_t color) {
-  for (int i = 87; i <= 95; i++) {
-    for (int j = 0; j <= 63; j++) {
-      setPixel(i, j, 0x00);
-    }
-  }
-  for (int i = 93; i >= 90; i--) {
-    for (int j = 57; j >= 53; j--) {
-      if (i > 90)
-        setPixel(i, j - (12 * iy), color);
-      else if ((j > 53) && (j < 57))
-        setPixel(i, j - (12 * iy), color);
-    }
-  }
-  setPixel(89, 55 - (12 * iy), color);
+  blitMask(cursorMask, 1, 89, 53 - (12 * iy), 5, 5, color, 0x0000);
 }
 
 void drawToggle(int iy, uint16_t color, bool on) {
-  if (on) {
-    for (int i = 20; i >= 3; i--) {
-      for (int j = 58; j >= 52; j--) {
-        if (!((i >= 4 && i <= 8) && (j >= 53 && j <= 57)))
-          setPixel(i, j - (12 * iy), color);
-      }
-    }
-    setPixel(20, 58 - (12 * iy), 0x0000);
-    setPixel(20, 57 - (12 * iy), 0x0000);
-    setPixel(20, 53 - (12 * iy), 0x0000);
-    setPixel(20, 52 - (12 * iy), 0x0000);
-    setPixel(19, 58 - (12 * iy), 0x0000);
-    setPixel(19, 52 - (12 * iy), 0x0000);
-
-    setPixel(3, 58 - (12 * iy), 0x0000);
-    setPixel(3, 57 - (12 * iy), 0x0000);
-    setPixel(3, 53 - (12 * iy), 0x0000);
-    setPixel(3, 52 - (12 * iy), 0x0000);
-    setPixel(4, 58 - (12 * iy), 0x0000);
-    setPixel(4, 52 - (12 * iy), 0x0000);
-
-    setPixel(4, 57 - (12 * iy), color);
-    setPixel(8, 57 - (12 * iy), color);
-    setPixel(8, 53 - (12 * iy), color);
-    setPixel(4, 53 - (12 * iy), color);
-  } else {
-    for (int i = 18; i >= 5; i--) {
-      setPixel(i, 58 - (12 * iy), color);
-      setPixel(i, 52 - (12 * iy), color);
-    }
-    for (int j = 56; j >= 54; j--) {
-      setPixel(3, j - (12 * iy), color);
-      setPixel(14, j - (12 * iy), color);
-      setPixel(20, j - (12 * iy), color);
-    }
-    setPixel(4, 57 - (12 * iy), color);
-    setPixel(4, 53 - (12 * iy), color);
-    setPixel(15, 57 - (12 * iy), color);
-    setPixel(15, 53 - (12 * iy), color);
-    setPixel(19, 57 - (12 * iy), color);
-    setPixel(19, 53 - (12 * iy), color);
-  }
+  blitMask(on ? toggleOnMask : toggleOffMask, 3, 3, 52 - (12 * iy), 18, 7, color, 0x0000);
 }
 
-void putLetter(int ix, int iy, int index, uint16_t color) {
-  tFont x = Font;
-  tChar y = Font.chars[index]; // select character from 0 - 54
-  tImage z = *y.image;         // data array from tImage "Font_0x79"
-  uint8_t *a = z.data;         // row of character data
-
-  for (int i = 0; i <= 9; i++) {
-    for (int j = 2; j <= 7; j++) { // iterate through bits in row of character
-      if (!((1 << j) & a[i]))
-        setPixel((88 - (ix * 6)) - j, (59 - (iy * 10) - (iy * 2)) - i, color);
-      else
-        setPixel((88 - (ix * 6)) - j, (59 - (iy * 10) - (iy * 2)) - i, 0x0000);
+// Menu text runs right to left from x 88, one 6x10 cell per character, with
+// lines 12 pixels apart counting up from the bottom. Cells that are fully on
+// screen go to the panel in one call; any hanging off an edge are clipped a
+// pixel at a time. Returns the area drawn over
+DisplayRect putString(const char *text, int ix, int iy, uint16_t color) {
+  const int len = strlen(text);
+  const int right = 88 - 1 - GLYPH_W * ix; // right edge of the first character's cell
+  const int y = (59 - 12 * iy) - 9;
+  DisplayRect dirty = {MAX(right - GLYPH_W * len, 0), MIN(right, UI_W), MAX(y, 0), MIN(y + GLYPH_H, UI_H)};
+  char cells[UI_W / GLYPH_W];
+  int n = 0, left = 0;
+
+  if (dirty.x0 >= dirty.x1 || dirty.y0 >= dirty.y1)
+    return (DisplayRect){0};
+
+  for (int i = len - 1; i >= 0; i--) {
+    int x = right - GLYPH_W * (i + 1);
+    if (x >= 0 && x + GLYPH_W <= UI_W && y >= 0 && y + GLYPH_H <= UI_H) {
+      if (n == 0)
+        left = x;
+      cells[n++] = text[i];
+    } else if (x < UI_W && x + GLYPH_W > 0) {
+      blitMask(glyphFor(text[i])->rows, 1, x, y, GLYPH_W, GLYPH_H, color, 0x0000);
     }
   }
-}
-
-void putString(char *text, int ix, int iy, uint16_t color) {
-  for (int i = 0; text[i] != '\0'; i++) {
-    switch (text[i]) {
-    case ' ':
-      putLetter(ix + i, iy, 0, color);
-      break;
-
-    case '-':
-      putLetter(ix + i, iy, 1, color);
-      break;
-
-    case '.':
-      putLetter(ix + i, iy, 2, color);
-      break;
-
-    case 'A':
-      putLetter(ix + i, iy, 3, color);
-      break;
-
-    case 'B':
-      putLetter(ix + i, iy, 4, color);
-      break;
-
-    case 'C':
-      putLetter(ix + i, iy, 5, color);
-      break;
-
-    case 'D':
-      putLetter(ix + i, iy, 6, color);
-      break;
-
-    case 'E':
-      putLetter(ix + i, iy, 7, color);
-      break;
-
-    case 'F':
-      putLetter(ix + i, iy, 8, color);
-      break;
-
-    case 'G':
-      putLetter(ix + i, iy, 9, color);
-      break;
-
-    case 'H':
-      putLetter(ix + i, iy, 10, color);
-      break;
-
-    case 'I':
-      putLetter(ix + i, iy, 11, color);
-      break;
-
-    case 'J':
-      putLetter(ix + i, iy, 12, color);
-      break;
-
-    case 'K':
-      putLetter(ix + i, iy, 13, color);
-      break;
-
-    case 'L':
-      putLetter(ix + i, iy, 14, color);
-      break;
-
-    case 'M':
-      putLetter(ix + i, iy, 15, color);
-      break;
-
-    case 'N':
-      putLetter(ix + i, iy, 16, color);
-      break;
-
-    case 'O':
-      putLetter(ix + i, iy, 17, color);
-      break;
+  if (n)
+    display->blitText(cells, n, left + display->xOffset, y, color, 0x0000);
 
-    case 'P':
-      putLetter(ix + i, iy, 18, color);
-      break;
-
-    case 'Q':
-      putLetter(ix + i, iy, 19, color);
-      break;
-
-    case 'R':
-      putLetter(ix + i, iy, 20, color);
-      break;
-
-    case 'S':
-      putLetter(ix + i, iy, 21, color);
-      break;
-
-    case 'T':
-      putLetter(ix + i, iy, 22, color);
-      break;
-
-    case 'U':
-      putLetter(ix + i, iy, 23, color);
-      break;
-
-    case 'V':
-      putLetter(ix + i, iy, 24, color);
-      break;
-
-    case 'W':
-      putLetter(ix + i, iy, 25, color);
-      break;
-
-    case 'X':
-      putLetter(ix + i, iy, 26, color);
-      break;
-
-    case 'Y':
-      putLetter(ix + i, iy, 27, color);
-      break;
-
-    case 'Z':
-      putLetter(ix + i, iy, 28, color);
-      break;
-
-    case 'a':
-      putLetter(ix + i, iy, 29, color);
-      break;
-
-    case 'b':
-      putLetter(ix + i, iy, 30, color);
-      break;
-
-    case 'c':
-      putLetter(ix + i, iy, 31, color);
-      break;
-
-    case 'd':
-      putLetter(ix + i, iy, 32, color);
-      break;
-
-    case 'e':
-      putLetter(ix + i, iy, 33, color);
-      break;
-
-    case 'f':
-      putLetter(ix + i, iy, 34, color);
-      break;
-
-    case 'g':
-      putLetter(ix + i, iy, 35, color);
-      break;
-
-    case 'h':
-      putLetter(ix + i, iy, 36, color);
-      break;
-
-    case 'i':
-      putLetter(ix + i, iy, 37, color);
-      break;
-
-    case 'j':
-      putLetter(ix + i, iy, 38, color);
-      break;
-
-    case 'k':
-      putLetter(ix + i, iy, 39, color);
-      break;
-
-    case 'l':
-      putLetter(ix + i, iy, 40, color);
-      break;
-
-    case 'm':
-      putLetter(ix + i, iy, 41, color);
-      break;
-
-    case 'n':
-      putLetter(ix + i, iy, 42, color);
-      break;
-
-    case 'o':
-      putLetter(ix + i, iy, 43, color);
-      break;
-
-    case 'p':
-      putLetter(ix + i, iy, 44, color);
-      break;
-
-    case 'q':
-      putLetter(ix + i, iy, 45, color);
-      break;
-
-    case 'r':
-      putLetter(ix + i, iy, 46, color);
-      break;
-
-    case 's':
-      putLetter(ix + i, iy, 47, color);
-      break;
-
-    case 't':
-      putLetter(ix + i, iy, 48, color);
-      break;
-
-    case 'u':
-      putLetter(ix + i, iy, 49, color);
-      break;
-
-    case 'v':
-      putLetter(ix + i, iy, 50, color);
-      break;
-
-    case 'w':
-      putLetter(ix + i, iy, 51, color);
-      break;
-
-    case 'x':
-      putLetter(ix + i, iy, 52, color);
-      break;
-
-    case 'y':
-      putLetter(ix + i, iy, 53, color);
-      break;
-
-    case 'z':
-      putLetter(ix + i, iy, 54, color);
-      break;
-
-    case '!':
-      putLetter(ix + i, iy, 55, color);
-      break;
-
-    case '#':
-      putLetter(ix + i, iy, 56, color);
-      break;
-
-    case '%':
-      putLetter(ix + i, iy, 57, color);
-      break;
-
-    case '&':
-      putLetter(ix + i, iy, 58, color);
-      break;
-
-    case '\'':
-      putLetter(ix + i, iy, 59, color);
-      break;
-
-    case '(':
-      putLetter(ix + i, iy, 60, color);
-      break;
-
-    case ')':
-      putLetter(ix + i, iy, 61, color);
-      break;
-
-    case '*':
-      putLetter(ix + i, iy, 62, color);
-      break;
-
-    case '+':
-      putLetter(ix + i, iy, 63, color);
-      break;
-
-    case ',':
-      putLetter(ix + i, iy, 64, color);
-      break;
-
-    case '0':
-      putLetter(ix + i, iy, 65, color);
-      break;
-
-    case '1':
-      putLetter(ix + i, iy, 66, color);
-      break;
-
-    case '2':
-      putLetter(ix + i, iy, 67, color);
-      break;
-
-    case '3':
-      putLetter(ix + i, iy, 68, color);
-      break;
-
-    case '4':
-      putLetter(ix + i, iy, 69, color);
-      break;
+  return dirty;
+}
 
-    case '5':
-      putLetter(ix + i, iy, 70, color);
-      break;
+// Draw VMU rows [firstRow, lastRow) 2x scaled into the 96x64 area
+void drawVMU(const uint8_t *lcd, const RowColors *colors, bool smooth, int firstRow, int lastRow) {
+  display->blitVMU(lcd, colors, smooth, firstRow, lastRow);
+}
 
-    case '6':
-      putLetter(ix + i, iy, 71, color);
-      break;
+// Draw rows [firstRow, lastRow) of the 128x64 test mode screen at 1:1, as
+// much of it as the panel has room for
+void drawTestLCD(const uint8_t *lcd, const RowColors *colors, int firstRow, int lastRow) {
+  display->blitTest(lcd, colors, firstRow, lastRow);
+}
 
-    case '7':
-      putLetter(ix + i, iy, 72, color);
-      break;
+// The SSD1331 or SSD1306, from the OLED_PIN strap, unless one of the
+// opt-in panels is built in
+void displaySelect(bool ssd1331) {
+#if DISPLAY_ST7789
+  display = &st7789Driver;
+#elif DISPLAY_SH8601
+  display = &sh8601Driver;
+#else
+  display = ssd1331 ? &ssd1331Driver : &ssd1306Driver;
+#endif
+  glyphAtlasBuild(&Font);
+}
 
-    case '8':
-      putLetter(ix + i, iy, 73, color);
-      break;
+void displayInit() { display->init(); }
 
-    case '9':
-      putLetter(ix + i, iy, 74, color);
-      break;
+static void displayFlush(int x0, int x1, int y0, int y1) {
+  displayStats.frames++;
+  displayStats.lastBytes = display->flush(x0, x1, y0, y1);
+  displayStats.bytes += displayStats.lastBytes;
+}
 
-    case ':':
-      putLetter(ix + i, iy, 75, color);
-      break;
+void updateDisplay() { displayFlush(0, display->width, 0, display->height); }
 
-    case ';':
-      putLetter(ix + i, iy, 76, color);
-      break;
+// Only sends rows [y0, y1) of the 96x64 area
+void updateDisplayRows(int y0, int y1) { displayFlush(display->xOffset, display->xOffset + UI_W, y0, y1); }
 
-    case '=':
-      putLetter(ix + i, iy, 77, color);
-      break;
+// Same for the test mode screen, which may be wider than the 96x64 area
+void updateTestLCDRows(int y0, int y1) { displayFlush(0, display->width, y0, y1); }
 
-    default:
-      break;
-    }
-  }
-}
+// Called from the main loop to push out frames the display deferred
+void displayPoll() { display->poll(); }
 
-void displayInit() {
-  if (oledType) // 1
-    ssd1331_init();
-  else // 0
-    ssd1306_init();
-}
+// True while the panel is still behind, so a new frame would only be merged into a queued one
+bool displayBusy() { return display->busy(); }
 
-void updateDisplay() {
-  if (oledType) // 1
-    updateSSD1331();
-  else // 0
-    updateSSD1306();
-}
+// Shortest time between VMU frames the panel can keep up with
+uint32_t displayFrameUs() { return display->frameUs; }
 
-void clearDisplay() {
-  if (oledType) // 1
-    clearSSD1331();
-  else // 0
-    clearSSD1306();
-}
\ No newline at end of file
+void clearDisplay() { display->clear(); }
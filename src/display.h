@@ -14,18 +14,64 @@
 #include "maple.h"
 #include "menu.h"
 #include "font.h"
+#include "blit.h"
+#include "raster.h"
+#include "pack.h"
 
 extern tFont Font;
 
-float cos_32s(float x);
-
-float cos32(float x);
-
-float sin32(float x);
-
-double atan_66s(double x);
-
-double atan66(double x);
+// Panel backend. Normally the SSD1331 or SSD1306 is picked at boot from the
+// OLED_PIN strap. The ST7789 and SH8601 share pins with the buttons on the
+// standard wiring, so they're only built in when selected here
+#define DISPLAY_ST7789 0
+#define DISPLAY_SH8601 0
+
+#define UI_W 96 // the menu and VMU screen are drawn in a 96x64 area
+#define UI_H 64
+
+// What every panel backend implements. Coordinates are the backend's own
+// drawing area (width x height), with the 96x64 UI area at xOffset.
+// Rectangles are [x0, x1) x [y0, y1) and arrive clipped
+typedef struct {
+  const char *name; // shown in the menu, 7 chars
+  int width, height;
+  int xOffset;
+  uint32_t frameUs; // shortest VMU frame interval the panel keeps up with
+  bool mono;        // one colour, anything but 0x0000 is lit
+
+  void (*begin)(void);     // bus, pins and panel init, once at boot
+  void (*init)(void);      // panel registers only, from begin
+  bool (*setFlip)(void);   // sends OLED_FLIP's orientation alone, false while a frame is going out
+  void (*splash)(void);
+  void (*clear)(void);
+  void (*beginDraw)(void); // about to draw, hold queued frames until the next flush
+  void (*setPixel)(int x, int y, uint16_t color);
+  void (*fillRect)(int x0, int x1, int y0, int y1, uint16_t color);
+  void (*blitMask)(const uint8_t *mask, int maskStride, int x, int y, int w, int h, uint16_t fg, uint16_t bg);
+  void (*blitText)(const char *text, int n, int x, int y, uint16_t fg, uint16_t bg); // whole glyph cells, left to right
+  void (*blitVMU)(const uint8_t *lcd, const RowColors *colors, bool smooth, int firstRow, int lastRow); // 48x32, 2x into the UI area, Scale2x if smooth
+  void (*blitTest)(const uint8_t *lcd, const RowColors *colors, int firstRow, int lastRow); // 128x64 test mode, 1:1
+  uint32_t (*flush)(int x0, int x1, int y0, int y1); // starts sending a region, returns the bytes it'll take
+  bool (*busy)(void);                                 // still behind, a new frame would only be queued
+  void (*poll)(void);                                 // push out anything queued
+  uint8_t *(*uiRow)(int y); // RGB565 row y of the UI area in the draw buffer, NULL on mono panels
+} DisplayDriver;
+
+extern const DisplayDriver *display;
+
+typedef struct {
+  int x0, x1, y0, y1; // [x0, x1) x [y0, y1) of the 96x64 area, empty when x0 == x1
+} DisplayRect;
+
+typedef struct {
+  uint32_t frames;    // updates sent to the panel
+  uint32_t bytes;     // pixel data bytes sent in total
+  uint32_t lastBytes; // pixel data bytes in the last update
+  uint32_t coalesced; // updates merged into a frame still waiting for the panel
+  uint32_t dropped;   // queued frames thrown away (SSD1306 NAK, SSD1331 re-init)
+} DisplayStats;
+
+extern DisplayStats displayStats;
 
 void fast_hsv2rgb_32bit(uint16_t h, uint8_t s, uint8_t v, uint8_t *r, uint8_t *g, uint8_t *b);
 
@@ -41,16 +87,32 @@ void fillRect(int x0, int x1, int y0, int y1, uint16_t color);
 
 void fillCircle(int x0, int y0, int r, uint16_t color);
 
+DisplayRect clearLine(int iy);
+
 void drawCursor(int iy, uint16_t color);
 
 void drawToggle(int iy, uint16_t color, bool on);
 
-void putLetter(int ix, int iy, int index, uint16_t color);
+DisplayRect putString(const char *text, int ix, int iy, uint16_t color);
+
+void drawVMU(const uint8_t *lcd, const RowColors *colors, bool smooth, int firstRow, int lastRow);
 
-void putString(char *text, int ix, int iy, uint16_t color);
+void drawTestLCD(const uint8_t *lcd, const RowColors *colors, int firstRow, int lastRow);
 
 void updateDisplay(void);
 
+void updateDisplayRows(int y0, int y1);
+
+void updateTestLCDRows(int y0, int y1);
+
+void displayPoll(void);
+
+bool displayBusy(void);
+
+uint32_t displayFrameUs(void);
+
 void clearDisplay(void);
 
+void displaySelect(bool ssd1331);
+
 void displayInit(void);
\ No newline at end of file
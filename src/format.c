@@ -224,7 +224,9 @@ uint32_t pagePalette[] = {
   0xf6abe596
 };
 
-uint32_t CheckFormatted(uint8_t *MemoryCard, uint32_t CurrentPage)
+static const uint8_t RootMagic[16] = {0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55};
+
+uint32_t FormatCard(uint8_t *MemoryCard, uint32_t CurrentPage)
 {
 	uint32_t SectorDirty = 0;
 	const RootBlock Root =
@@ -233,34 +235,127 @@ uint32_t CheckFormatted(uint8_t *MemoryCard, uint32_t CurrentPage)
 			1, pagePalette[CurrentPage - 1] >> 8 & 0xFF,	pagePalette[CurrentPage - 1] >> 16 & 0xFF, pagePalette[CurrentPage - 1] >> 24 & 0xFF, pagePalette[CurrentPage - 1] & 0xFF, {0}, {0x20, 0x21, 0x03, 0x02, 0x09, 0x00, 0x00, 0x01}, {0}, CARD_BLOCKS - 1,
 			0, ROOT_BLOCK, FAT_BLOCK, NUM_FAT_BLOCKS, DIRECTORY_BLOCK, NUM_DIRECTORY_BLOCKS, 0,	SAVE_BLOCK,	NUM_SAVE_BLOCKS, 0x800000};
 
-	if (memcmp(&MemoryCard[ROOT_BLOCK * BLOCK_SIZE], Root.Magic, sizeof(Root.Magic)) != 0)
+	// Initialize ourselves. Saves user a step + means we can have a fancy icon
+	uint32_t StartOfDirectoryBlock = Root.DirectoryBlock - Root.DirectorySizeInBlocks + 1;
+	memset(&MemoryCard[StartOfDirectoryBlock * BLOCK_SIZE], 0, (256 - StartOfDirectoryBlock) * BLOCK_SIZE);
+	memcpy(&MemoryCard[ROOT_BLOCK * BLOCK_SIZE], &Root, sizeof(Root));
+
+	const DirectoryEntry IconDataVMS = {FileType_Data, 0, SAVE_BLOCK - 2, "ICONDATA_VMS", {0x20, 0x21, 0x03, 0x02, 0x09, 0x00, 0x00, 0x01}, 2, 0};
+	memcpy(&MemoryCard[Root.DirectoryBlock * BLOCK_SIZE], &IconDataVMS, sizeof(IconDataVMS));
+	memcpy(&MemoryCard[IconDataVMS.FirstBlock * BLOCK_SIZE], &IconData, sizeof(IconData));
+
+	uint32_t StartOfFATBlock = Root.FATBlock - Root.FATSizeInBlocks + 1;
+	uint16_t *FAT = (uint16_t *)&MemoryCard[StartOfFATBlock * BLOCK_SIZE];
+	for (uint32_t Block = 0; Block < Root.FATSizeInBlocks * (BLOCK_SIZE / sizeof(uint16_t)); Block++)
 	{
-		// If not formatted then initialize ourselves. Saves user a step + means we can have a fancy icon
-		uint32_t StartOfDirectoryBlock = Root.DirectoryBlock - Root.DirectorySizeInBlocks + 1;
-		memset(&MemoryCard[StartOfDirectoryBlock * BLOCK_SIZE], 0, (256 - StartOfDirectoryBlock) * BLOCK_SIZE);
-		memcpy(&MemoryCard[ROOT_BLOCK * BLOCK_SIZE], &Root, sizeof(Root));
+		FAT[Block] = FATType_Free;
+	}
+	AllocateFAT(FAT, ROOT_BLOCK, 1);
+	AllocateFAT(FAT, StartOfFATBlock, Root.FATSizeInBlocks);
+	AllocateFAT(FAT, StartOfDirectoryBlock, Root.DirectorySizeInBlocks);
+	FAT[IconDataVMS.FirstBlock] = IconDataVMS.FirstBlock + 1;
+	FAT[IconDataVMS.FirstBlock + 1] = FATType_EOF;
 
-		const DirectoryEntry IconDataVMS = {FileType_Data, 0, SAVE_BLOCK - 2, "ICONDATA_VMS", {0x20, 0x21, 0x03, 0x02, 0x09, 0x00, 0x00, 0x01}, 2, 0};
-		memcpy(&MemoryCard[Root.DirectoryBlock * BLOCK_SIZE], &IconDataVMS, sizeof(IconDataVMS));
-		memcpy(&MemoryCard[IconDataVMS.FirstBlock * BLOCK_SIZE], &IconData, sizeof(IconData));
+#if PICO_HW
+	// Everything above StartOfDirectoryBlock now needs writing to flash + icon data
+	SectorDirty |= ~((1u << ((StartOfDirectoryBlock * BLOCK_SIZE) / FLASH_SECTOR_SIZE)) - 1);
+	SectorDirty |= 1u << ((IconDataVMS.FirstBlock * BLOCK_SIZE) / FLASH_SECTOR_SIZE);
+#endif
+	return SectorDirty;
+}
 
-		uint32_t StartOfFATBlock = Root.FATBlock - Root.FATSizeInBlocks + 1;
-		uint16_t *FAT = (uint16_t *)&MemoryCard[StartOfFATBlock * BLOCK_SIZE];
-		for (uint32_t Block = 0; Block < Root.FATSizeInBlocks * (BLOCK_SIZE / sizeof(uint16_t)); Block++)
+uint32_t CheckFormatted(uint8_t *MemoryCard, uint32_t CurrentPage)
+{
+	if (memcmp(&MemoryCard[ROOT_BLOCK * BLOCK_SIZE], RootMagic, sizeof(RootMagic)) != 0)
+	{
+		return FormatCard(MemoryCard, CurrentPage);
+	}
+	return 0;
+}
+
+// Valid root and no user blocks allocated, what a BIOS "format" leaves in the root and FAT
+static int IsEmptyFAT(const uint8_t *MemoryCard)
+{
+	if (memcmp(&MemoryCard[ROOT_BLOCK * BLOCK_SIZE], RootMagic, sizeof(RootMagic)) != 0)
+	{
+		return 0;
+	}
+
+	const uint16_t *FAT = (const uint16_t *)&MemoryCard[FAT_BLOCK * BLOCK_SIZE];
+	for (uint32_t Block = 0; Block < FORMAT_FIRST_BLOCK; Block++)
+	{
+		if (FAT[Block] != FATType_Free)
 		{
-			FAT[Block] = FATType_Free;
+			return 0;
 		}
-		AllocateFAT(FAT, ROOT_BLOCK, 1);
-		AllocateFAT(FAT, StartOfFATBlock, Root.FATSizeInBlocks);
-		AllocateFAT(FAT, StartOfDirectoryBlock, Root.DirectorySizeInBlocks);
-		FAT[IconDataVMS.FirstBlock] = IconDataVMS.FirstBlock + 1;
-		FAT[IconDataVMS.FirstBlock + 1] = FATType_EOF;
+	}
+	return 1;
+}
 
-#if PICO_HW
-		// Everything above StartOfDirectoryBlock now needs writing to flash + icon data
-		SectorDirty |= ~((1u << ((StartOfDirectoryBlock * BLOCK_SIZE) / FLASH_SECTOR_SIZE)) - 1);
-		SectorDirty |= 1u << ((IconDataVMS.FirstBlock * BLOCK_SIZE) / FLASH_SECTOR_SIZE);
-#endif
+int IsFreshFormat(const uint8_t *MemoryCard)
+{
+	// What a BIOS "format" leaves behind: valid root, empty directory and no user blocks allocated
+	if (!IsEmptyFAT(MemoryCard))
+	{
+		return 0;
+	}
+
+	for (uint32_t i = FORMAT_FIRST_BLOCK * BLOCK_SIZE; i < (DIRECTORY_BLOCK + 1) * BLOCK_SIZE; i++)
+	{
+		if (MemoryCard[i])
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+uint32_t ClearFormattedDirectory(uint8_t *MemoryCard)
+{
+	// With no user blocks allocated the directory can only be empty. Clearing it as soon as
+	// such a FAT comes in makes the card read as formatted straight away, and the BIOS's own
+	// directory writes that follow change nothing
+	uint32_t SectorDirty = 0;
+	if (!IsEmptyFAT(MemoryCard))
+	{
+		return 0;
+	}
+
+	for (uint32_t Block = FORMAT_FIRST_BLOCK; Block <= DIRECTORY_BLOCK; Block++)
+	{
+		uint8_t *Data = &MemoryCard[Block * BLOCK_SIZE];
+		for (uint32_t i = 0; i < BLOCK_SIZE; i++)
+		{
+			if (Data[i])
+			{
+				memset(Data, 0, BLOCK_SIZE);
+				SectorDirty |= 1u << (Block * BLOCK_SIZE / CARD_SECTOR_SIZE);
+				break;
+			}
+		}
 	}
 	return SectorDirty;
-}
\ No newline at end of file
+}
+
+int FormatBlockWritten(uint32_t *Seen, uint8_t *MemoryCard, uint32_t Block, uint32_t *SectorDirty)
+{
+	// A BIOS format rewrites the directory, FAT and root, the top FORMAT_BLOCKS blocks, and
+	// nothing else. A write anywhere else starts the count again
+	if (Block < FORMAT_FIRST_BLOCK || Block >= CARD_BLOCKS)
+	{
+		*Seen = 0;
+		return 0;
+	}
+
+	*Seen |= 1u << (Block - FORMAT_FIRST_BLOCK);
+	if (Block == FAT_BLOCK)
+	{
+		*SectorDirty |= ClearFormattedDirectory(MemoryCard);
+	}
+	if (*Seen != (1u << FORMAT_BLOCKS) - 1 || !IsFreshFormat(MemoryCard))
+	{
+		return 0;
+	}
+	*Seen = 0;
+	return 1;
+}
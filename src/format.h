@@ -1,3 +1,5 @@
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -12,8 +14,20 @@ extern "C" {
 #define NUM_SAVE_BLOCKS 31 // Not sure what this means
 
 #define BLOCK_SIZE 512
+#define CARD_SECTOR_SIZE 4096 // flash erase sector, 8 blocks
+
+#define FORMAT_FIRST_BLOCK (DIRECTORY_BLOCK - NUM_DIRECTORY_BLOCKS + 1) // directory, FAT and root
+#define FORMAT_BLOCKS (CARD_BLOCKS - FORMAT_FIRST_BLOCK)                  // are the top 15 blocks
 
 uint32_t CheckFormatted(uint8_t *MemoryCard, uint32_t CurrentPage);
+uint32_t FormatCard(uint8_t *MemoryCard, uint32_t CurrentPage);
+int IsFreshFormat(const uint8_t *MemoryCard);
+// Directory cleared if the FAT has no user blocks allocated, returns the sectors it changed
+uint32_t ClearFormattedDirectory(uint8_t *MemoryCard);
+// Call on each completed memory card block write. Clears the directory as soon as a BIOS
+// format's FAT is in and returns 1 once the format's last block has been written.
+// *Seen starts at 0
+int FormatBlockWritten(uint32_t *Seen, uint8_t *MemoryCard, uint32_t Block, uint32_t *SectorDirty);
 
 #ifdef __cplusplus
 }
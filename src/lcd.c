@@ -0,0 +1,211 @@
+/* lcd.c
+ *  VMU screen render stage. LCDWrite drops frames in a single slot mailbox
+ *  and the main loop draws them in short slices whenever there's no Maple
+ *  packet waiting, so responses never wait on display work. Frames start no
+ *  faster than the panel can take them; writes in between are merged.
+ *  Colours come from a per row table (theme.h); an animated theme only
+ *  rebuilds the table and draws the kept frame again
+ */
+
+#include "lcd.h"
+#include "display.h"
+#include "menu.h"
+#include "theme.h"
+
+#define LCD_BAND 8 // LCD rows drawn per slice
+#define ALL_ROWS 0xFFFFFFFFFFFFFFFFull
+
+typedef struct {
+  uint8_t frame[LCDTestFramebufferSize]; // big enough for either screen
+  int width, height;
+  uint64_t dirtyRows;
+  uint16_t color;
+  bool full;
+} LCDMailbox;
+
+typedef enum { LCD_IDLE, LCD_DRAW, LCD_SEND } LCDRenderState;
+
+LCDStats lcdStats = {0};
+
+// Everything here runs on core0 (LCDWrite and the main loop), so no locking
+static LCDMailbox mailbox = {.dirtyRows = ALL_ROWS}; // first frame is drawn in full
+static uint8_t frame[LCDTestFramebufferSize];
+static int width, height;
+static uint64_t dirtyRows;
+static uint16_t color;
+static uint16_t drawnColor = 0;
+static int drawnWidth = LCD_Width;
+static bool clearFirst = true; // the splash or the menu is up, either can cover more than the VMU area
+static bool covered = false;
+static LCDRenderState state = LCD_IDLE;
+static int firstRow, lastRow, nextRow;
+static uint32_t lastFrameStart = 0;
+static bool held = false; // current mailbox frame already counted as throttled
+static RowColors rowColors;
+static int drawnTheme = -1;
+static bool smooth = false; // Scale2x the VMU screen, from the menu setting at each frame start
+static uint32_t themeTick = 0;
+static uint32_t lastThemeStep = 0;
+
+void lcdPost(const uint8_t *lcd, int lcdWidth, int lcdHeight, uint64_t dirty, uint16_t newColor) {
+  if (mailbox.full) {
+    lcdStats.coalesced++;
+    if (mailbox.width != lcdWidth) // switched screens before the last one was drawn
+      dirty = ALL_ROWS;
+  }
+
+  memcpy(mailbox.frame, lcd, lcdWidth * lcdHeight / 8);
+  mailbox.width = lcdWidth;
+  mailbox.height = lcdHeight;
+  mailbox.dirtyRows |= dirty; // keep rows a replaced frame would have redrawn
+  mailbox.color = newColor;
+  mailbox.full = true;
+  lcdStats.received++;
+}
+
+// Rebuild the colour table for the page colour, theme and tick
+static void lcdBuildColors() {
+  uint32_t start = time_us_32();
+
+  themeColors(vmuTheme, color, themeTick, height, &rowColors);
+  drawnColor = color;
+  drawnTheme = vmuTheme;
+
+  uint32_t took = time_us_32() - start;
+  if (took > lcdStats.maxThemeUs)
+    lcdStats.maxThemeUs = took;
+}
+
+// Put the frame on screen back in the mailbox, to be drawn again in full
+static void lcdRepost() {
+  memcpy(mailbox.frame, frame, width * height / 8);
+  mailbox.width = width;
+  mailbox.height = height;
+  mailbox.color = color;
+  mailbox.dirtyRows = ALL_ROWS;
+  mailbox.full = true;
+}
+
+static void lcdStartFrame() {
+  lastFrameStart = time_us_32();
+  held = false;
+
+  width = mailbox.width;
+  height = mailbox.height;
+  memcpy(frame, mailbox.frame, width * height / 8);
+  dirtyRows = mailbox.dirtyRows;
+  color = mailbox.color;
+  mailbox.dirtyRows = 0;
+  mailbox.full = false;
+
+  if (clearFirst) {
+    clearDisplay();
+    clearFirst = false;
+    dirtyRows = ALL_ROWS;
+  }
+  if (width != drawnWidth) { // between VMU and test mode, the two cover different areas
+    clearDisplay();
+    drawnWidth = width;
+    drawnTheme = -1; // gradients span the screen height
+  }
+  if (color != drawnColor || vmuTheme != drawnTheme) { // page, theme or tick changed, recolour everything
+    lcdBuildColors();
+    dirtyRows = ALL_ROWS;
+  }
+  if ((vmuSmooth == 1 && !display->mono) != smooth) {
+    smooth = !smooth;
+    dirtyRows = ALL_ROWS;
+  }
+  if (smooth && width == LCD_Width) // Scale2x output rows depend on the rows either side
+    dirtyRows |= dirtyRows << 1 | dirtyRows >> 1;
+  dirtyRows &= ALL_ROWS >> (64 - height);
+
+  // only the rows that changed get redrawn and sent
+  if (dirtyRows) {
+    firstRow = __builtin_ctzll(dirtyRows);
+    lastRow = 64 - __builtin_clzll(dirtyRows);
+    nextRow = firstRow;
+    state = LCD_DRAW;
+  }
+}
+
+void lcdCover(bool cover) {
+  if (cover == covered)
+    return;
+  covered = cover;
+  state = LCD_IDLE; // anything half drawn is drawn again in full
+  if (cover)
+    return;
+
+  clearFirst = true;
+  if (!mailbox.full && width) // nothing new from the console, put the last frame back
+    lcdRepost();
+  if (mailbox.full) {
+    mailbox.dirtyRows = ALL_ROWS;
+  } else { // no VMU screen yet either
+    clearDisplay();
+    updateDisplay();
+    clearFirst = false;
+  }
+}
+
+bool lcdRenderStep() {
+  uint32_t start = time_us_32();
+
+  if (covered) { // the menu is drawing, frames wait in the mailbox
+    displayPoll();
+    return false;
+  }
+
+  switch (state) {
+  case LCD_IDLE: {
+    // an animated theme redraws the kept frame each tick, paced like a console frame
+    bool themeDue = width && !display->mono && themeAnimated(vmuTheme) && start - lastThemeStep >= THEME_FRAME_MS * 1000;
+
+    displayPoll();
+    if (!mailbox.full && !themeDue)
+      break;
+    if (displayBusy() || start - lastFrameStart < displayFrameUs()) {
+      if (mailbox.full && !held)
+        lcdStats.throttled++;
+      held = mailbox.full;
+      break;
+    }
+    if (themeDue) {
+      lastThemeStep = start;
+      themeTick++;
+      drawnTheme = -1; // new table at the frame start
+      lcdStats.themeFrames++;
+      if (!mailbox.full)
+        lcdRepost();
+    }
+    lcdStartFrame();
+    break;
+  }
+  case LCD_DRAW: {
+    int end = MIN((nextRow + LCD_BAND) & ~(LCD_BAND - 1), lastRow); // bands line up with SSD1306 pages
+    if (width == LCD_Width)
+      drawVMU(frame, &rowColors, smooth, nextRow, end);
+    else
+      drawTestLCD(frame, &rowColors, nextRow, end);
+    nextRow = end;
+    if (nextRow >= lastRow)
+      state = LCD_SEND;
+    break;
+  }
+  case LCD_SEND:
+    if (width == LCD_Width)
+      updateDisplayRows(firstRow * 2, lastRow * 2);
+    else
+      updateTestLCDRows(firstRow, lastRow);
+    lcdStats.drawn++;
+    state = LCD_IDLE;
+    break;
+  }
+
+  uint32_t elapsed = time_us_32() - start;
+  if (elapsed > lcdStats.maxSliceUs)
+    lcdStats.maxSliceUs = elapsed;
+
+  return state != LCD_IDLE || mailbox.full;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "maple.h"
+
+typedef struct {
+  uint32_t received;    // LCD writes from the console
+  uint32_t coalesced;   // writes replaced in the mailbox before they were drawn
+  uint32_t drawn;       // frames drawn and sent to the panel
+  uint32_t throttled;   // frames held back for the panel's frame rate or a busy panel
+  uint32_t maxSliceUs;  // longest single render step, i.e. the most a Maple response can be held up
+  uint32_t themeFrames; // redraws for an animated theme, each a full frame in the same slices
+  uint32_t maxThemeUs;  // longest colour table rebuild, done once per frame at most
+} LCDStats;
+
+extern LCDStats lcdStats;
+
+// Hand a frame to the render stage, either the 48x32 VMU screen or the 128x64 test mode one.
+// Rows that changed since the last post are set in dirtyRows
+void lcdPost(const uint8_t *frame, int width, int height, uint64_t dirtyRows, uint16_t color);
+
+// Do one bounded slice of render work. Returns true while there's more to do
+bool lcdRenderStep(void);
+
+// Hold the VMU screen back while the menu is drawn over it. Uncovering redraws the latest frame in full
+void lcdCover(bool covered);
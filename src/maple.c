@@ -20,6 +20,8 @@
 #include "maple.h"
 #include "menu.h"
 #include "display.h"
+#include "lcd.h"
+#include "anim.h"
 
 // Maple Bus Defines and Funcs
 
@@ -43,7 +45,8 @@
 // Memory Card
 #define PHASE_SIZE (BLOCK_SIZE / 4)
 #define FLASH_WRITE_DELAY 16      // About quarter of a second if polling once a frame
-#define FLASH_OFFSET (128 * 1024) // How far into flash to store the memory card data. Check maplepad.bin for real code size
+#define FLASH_OFFSET (128 * 1024) // Firmware lives below this (check maplepad.bin for real code size), VMU pages in the block store above (store.h)
+#define CHECKSUM_LOG_OFFSET (FLASH_OFFSET * 9 + FLASH_SECTOR_SIZE) // Scrubber's sector checksums (scrub.h), the sector after flashData
 
 #if PICO
 #define PAGE_BUTTON 21 // Pull GP21 low for Page Cycle. Avoid page cycling for ~10s after saving or copying VMU data to avoid data corruption
@@ -54,6 +57,8 @@
 #define PAGE_BUTTON_MASK 0x0608   // X, Y, and Start
 #define PAGE_BACKWARD_MASK 0x0048 // Start and D-pad Left
 #define PAGE_FORWARD_MASK 0x0088  // Start and D-pad Right
+#define MENU_MASK 0x0208          // Y and Start with nothing else, held for MENU_HOLD_MS opens the menu
+#define MENU_HOLD_MS 2000
 
 #define INPUT_ACT 20
 #define OLED_PIN 22
@@ -87,12 +92,6 @@
     x = __builtin_bswap32(x);                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                                          \
   } while (0)
 
-#define LCD_Width 48
-#define LCD_Height 32
-#define LCD_NumCols 6          // 48 / 8
-#define LCDFramebufferSize 192 // (48 * 32) / 8
-#define BPPacket 192           // Bytes Per Packet
-
 const uint16_t color = 0xffff;
 
 volatile uint16_t palette[] = {
@@ -116,6 +115,7 @@ typedef enum ESendState_e {
   SEND_VMU_ALL_INFO,
   SEND_MEMORY_INFO,
   SEND_LCD_INFO,
+  SEND_LCD_TEST_INFO,
   SEND_PURUPURU_INFO,
   SEND_PURUPURU_ALL_INFO,
   SEND_PURUPURU_MEDIA_INFO,
@@ -170,6 +170,7 @@ static FAllInfoPacket SubPeripheral0AllInfoPacket;          // Send buffer for m
 static FAllInfoPacket SubPeripheral1AllInfoPacket;          // Send buffer for memory card info packet (pre-built for speed)
 static FMemoryInfoPacket MemoryInfoPacket;                  // Send buffer for memory card info packet (pre-built for speed)
 static FLCDInfoPacket LCDInfoPacket;                        // Send buffer for LCD info packet (pre-built for speed)
+static FLCDInfoPacket LCDTestInfoPacket;                    // Send buffer for the test mode block's LCD info packet (pre-built for speed)
 static FPuruPuruInfoPacket PuruPuruInfoPacket;              // Send buffer for PuruPuru info packet (pre-built for speed)
 static FPuruPuruConditionPacket PuruPuruConditionPacket;    // Send buffer for PuruPuru condition packet (pre-built for speed)
 static FTimerConditionPacket TimerConditionPacket;          // Send buffer for timer condition packet (pre-built for speed)
@@ -189,10 +190,16 @@ static uint TXDMAChannel = 0;
 volatile bool inputActive = false;
 
 // Memory Card
-static uint8_t MemoryCard[128 * 1024];
+static uint8_t MemoryCard[128 * 1024] __attribute__((aligned(4)));
 static uint SectorDirty = 0;
 static uint SendBlockAddress = ~0u;
 static uint MessagesSinceWrite = FLASH_WRITE_DELAY;
+static uint32_t FormatBlocks = 0; // system blocks a BIOS format rewrites seen so far, see FormatBlockWritten()
+static ChecksumTable Checksums; // Checksum of each sector of every page as last programmed, mirrors the log in flash
+static bool SettingsDirty = false;  // flashData needs writing at the next flash write slot
+
+// Flash scrubber
+static ScrubState Scrub = {0};
 volatile bool PageCycle = false;
 volatile bool VMUCycle = false;
 static uint8_t VMUCycleCount = 0;
@@ -201,10 +208,24 @@ volatile bool inputFlag = 0;
 volatile uint64_t lastInput = 0;
 
 // LCD
-static const uint8_t NumWrites = LCDFramebufferSize / BPPacket;
+// Block size in 32 byte units - 1, and number of write phases per block
+#define LCD_FUNC_DEF (((BPPacket / 32 - 1) << 16) | ((LCDFramebufferSize / BPPacket) << 12))
 static uint8_t LCDFramebuffer[LCDFramebufferSize] = {0};
-volatile bool LCDUpdated = false;
-volatile bool endSplash = true;
+static uint8_t LCDTestFramebuffer[LCDTestFramebufferSize] = {0};
+
+typedef struct LCDBlock_s {
+  uint Block;
+  uint8_t *Framebuffer;
+  uint Size;
+  uint Width;
+  uint Height;
+  uint64_t DirtyRows; // rows changed by the phases received so far
+} LCDBlock;
+
+static LCDBlock LCDBlocks[] = {
+    {LCD_BLOCK_VMU, LCDFramebuffer, LCDFramebufferSize, LCD_Width, LCD_Height, 0},
+    {LCD_BLOCK_TEST, LCDTestFramebuffer, LCDTestFramebufferSize, LCD_TestWidth, LCD_TestHeight, 0},
+};
 
 // Timer
 static uint8_t dateTime[8] = {0};
@@ -259,10 +280,61 @@ void softResetHandler() {
   }
 }
 
+static void countFlashError() {
+  if (flashErrors < 0xFF) {
+    flashErrors++;
+    SettingsDirty = true;
+  }
+}
+
+// Append checksums set since the last call to the log, erasing it when full (once every couple of
+// hundred sector writes, then all pages' checksums are written back in one go)
+static void logChecksums() {
+  ChecksumRecord Records[CHECKSUM_PAGE_RECORDS];
+  int Offset;
+
+  while ((Offset = checksumLogNext(&Checksums, Records)) != -1) {
+    uint Interrupts = save_and_disable_interrupts();
+    if (Offset == CHECKSUM_LOG_FULL) {
+      flash_range_erase(CHECKSUM_LOG_OFFSET, FLASH_SECTOR_SIZE);
+      checksumLogErased(&Checksums);
+    } else {
+      flash_range_program(CHECKSUM_LOG_OFFSET + Offset, (const uint8_t *)Records, FLASH_PAGE_SIZE);
+    }
+    restore_interrupts(Interrupts);
+  }
+}
+
+// Flash access for the block store, which does the rest (store.c)
+static void storeErase(uint32_t Offset) {
+  uint Interrupts = save_and_disable_interrupts();
+  flash_range_erase(Offset, FLASH_SECTOR_SIZE);
+  restore_interrupts(Interrupts);
+}
+
+static void storeProgram(uint32_t Offset, const uint8_t *Data, uint32_t Size) {
+  uint Interrupts = save_and_disable_interrupts();
+  flash_range_program(Offset, Data, Size);
+  restore_interrupts(Interrupts);
+}
+
+static const StoreFlash Store = {(const uint8_t *)XIP_BASE, storeErase, storeProgram};
+
+// The current page is worked on in RAM and only its changed blocks go back to the store
 void readFlash() {
-  memset(MemoryCard, 0, sizeof(MemoryCard));
-  memcpy(MemoryCard, (uint8_t *)XIP_BASE + (FLASH_OFFSET * currentPage),
-         sizeof(MemoryCard)); // read into variable
+  uint Page = currentPage - 1;
+
+  storeReadPage(Page, MemoryCard);
+  // A sector that doesn't match the checksum logged when it was programmed went bad while the page
+  // wasn't loaded. There's no good copy left to repair it from but it's counted. Sectors with
+  // nothing logged (written by older firmware) are taken as they are and logged now
+  for (uint Sector = 0; Sector < sizeof(MemoryCard) / FLASH_SECTOR_SIZE; Sector++) {
+    uint32_t Checksum = sectorChecksum((uint32_t *)&MemoryCard[Sector * FLASH_SECTOR_SIZE], FLASH_SECTOR_SIZE / sizeof(uint32_t), 0);
+    if (checksumSet(&Checksums, Page, Sector, Checksum))
+      countFlashError();
+  }
+  logChecksums();
+  scrubReset(&Scrub);
   SectorDirty = CheckFormatted(MemoryCard, currentPage);
 }
 
@@ -274,6 +346,87 @@ void updateFlashData() // Update calibration data and flags
   restore_interrupts(Interrupt);
 }
 
+// Same, but at the next flash write slot, so the Maple bus doesn't wait on it
+void queueFlashDataUpdate() { SettingsDirty = true; }
+
+// Write a sector of the current page back to the store. Only blocks that changed are written, each
+// copy-on-write to a block already holding the same data (on any page) or to an erased one, so
+// saves shared between pages take no extra flash. The sector's checksum is logged afterwards, for
+// the scrubber and the next readFlash()
+void flushSector(uint Sector) {
+  uint Page = currentPage - 1;
+
+  for (uint Block = Sector * STORE_SECTOR_BLOCKS; Block < (Sector + 1) * STORE_SECTOR_BLOCKS; Block++)
+    if (!storeWrite(Page, Block, &MemoryCard[Block * BLOCK_SIZE]))
+      countFlashError();
+  checksumSet(&Checksums, Page, Sector, sectorChecksum((const uint32_t *)&MemoryCard[Sector * FLASH_SECTOR_SIZE], FLASH_SECTOR_SIZE / sizeof(uint32_t), 0));
+  scrubSectorWritten(&Scrub, Sector); // a pass part way through this sector has the old data in it
+  logChecksums(); // one flash page program, nothing if the checksum was already logged
+}
+
+// Where the scrubber finds part of the current page, through the uncached alias so scrubbing
+// doesn't evict code from the XIP cache
+static const uint8_t *scrubChunk(uint32_t Offset) {
+  return (const uint8_t *)XIP_NOCACHE_NOALLOC_BASE + storeBlockOffset(currentPage - 1, Offset / BLOCK_SIZE) + Offset % BLOCK_SIZE;
+}
+
+// Verify a small chunk of the current page in flash against the checksums logged when it was
+// programmed (scrub.c). Bad sectors are rewritten from the RAM copy and counted in flashErrors.
+// Only called from the controller status slot once the response is on its way and no other
+// packet is waiting, and the work per call is bounded by SCRUB_CHUNK.
+void scrubStep() {
+  int Bad = scrubPoll(&Scrub, scrubChunk, Checksums.Sums[currentPage - 1], SectorDirty);
+
+  if (Bad >= 0) {
+    SectorDirty |= 1u << Bad;
+    countFlashError();
+  }
+}
+
+// Pages from a data-only image (tools/make_image) go into the store like any other write, then the
+// import header is erased so it only happens once. A power cut part way just imports them again
+static void importPages() {
+  const StoreImport *Import = (const StoreImport *)(XIP_BASE + STORE_IMPORT);
+  if (Import->Magic != STORE_IMPORT_MAGIC || Import->Check != storeImportCheck(Import))
+    return;
+
+  uint8_t page0 = currentPage;
+  for (int page = 1; page <= 8; page++) {
+    if (Import->Load == page)
+      memcpy(MemoryCard, (uint8_t *)XIP_BASE + STORE_IMPORT + FLASH_SECTOR_SIZE, sizeof(MemoryCard));
+    else if (Import->Wipe & (1u << (page - 1)))
+      memset(MemoryCard, 0xFF, sizeof(MemoryCard)); // as erased flash, formatted below
+    else
+      continue;
+    currentPage = page;
+    CheckFormatted(MemoryCard, page);
+    for (uint Sector = 0; Sector < sizeof(MemoryCard) / FLASH_SECTOR_SIZE; Sector++)
+      flushSector(Sector);
+  }
+  currentPage = page0;
+  storeErase(STORE_IMPORT);
+}
+
+// Pre-format VMU pages since rumble timer interrupt interferes with on-the-fly formatting
+void preformatPages() {
+  uint8_t page0 = currentPage;
+  uint Interrupts = save_and_disable_interrupts();
+
+  for (int page = 1; page <= 8; page++) {
+    currentPage = page;
+
+    readFlash(); // includes checkFormatted
+
+    while (SectorDirty) {
+      uint Sector = 31 - __builtin_clz(SectorDirty);
+      SectorDirty &= ~(1 << Sector);
+      flushSector(Sector);
+    }
+  }
+  restore_interrupts(Interrupts);
+  currentPage = page0;
+}
+
 uint CalcCRC(const uint *Words, uint NumWords) {
   uint XOR_Checksum = 0;
   for (uint i = 0; i < NumWords; i++) {
@@ -393,7 +546,7 @@ void BuildSubPeripheral0InfoPacket() // Visual Memory Unit
   SubPeripheral0InfoPacket.Info.Func = __builtin_bswap32(0x0E);              // Function Types (up to 3). Note: Higher index in FuncData means
                                                                              // higher priority on DC subperipheral
   SubPeripheral0InfoPacket.Info.FuncData[0] = __builtin_bswap32(0x7E7E3F40); // Function Definition Block for Function Type 3 (Timer)
-  SubPeripheral0InfoPacket.Info.FuncData[1] = __builtin_bswap32(0x00051000); // Function Definition Block for Function Type 2 (LCD)
+  SubPeripheral0InfoPacket.Info.FuncData[1] = __builtin_bswap32(LCD_FUNC_DEF); // Function Definition Block for Function Type 2 (LCD)
   SubPeripheral0InfoPacket.Info.FuncData[2] = __builtin_bswap32(0x000f4100); // Function Definition Block for Function Type 1 (Storage)
   SubPeripheral0InfoPacket.Info.AreaCode = -1;
   SubPeripheral0InfoPacket.Info.ConnectorDirection = 0;
@@ -419,7 +572,7 @@ void BuildSubPeripheral0AllInfoPacket() // Visual Memory Unit
   SubPeripheral0AllInfoPacket.Info.Func = __builtin_bswap32(0x0E);              // Function Types (up to 3). Note: Higher index in FuncData means
                                                                                 // higher priority on DC subperipheral
   SubPeripheral0AllInfoPacket.Info.FuncData[0] = __builtin_bswap32(0x7E7E3F40); // Function Definition Block for Function Type 3 (Timer)
-  SubPeripheral0AllInfoPacket.Info.FuncData[1] = __builtin_bswap32(0x00051000); // Function Definition Block for Function Type 2 (LCD)
+  SubPeripheral0AllInfoPacket.Info.FuncData[1] = __builtin_bswap32(LCD_FUNC_DEF); // Function Definition Block for Function Type 2 (LCD)
   SubPeripheral0AllInfoPacket.Info.FuncData[2] = __builtin_bswap32(0x000f4100); // Function Definition Block for Function Type 1 (Storage)
   SubPeripheral0AllInfoPacket.Info.AreaCode = -1;
   SubPeripheral0AllInfoPacket.Info.ConnectorDirection = 0;
@@ -516,22 +669,31 @@ void BuildMemoryInfoPacket() {
   MemoryInfoPacket.CRC = CalcCRC((uint *)&MemoryInfoPacket.Header, sizeof(MemoryInfoPacket) / sizeof(uint) - 2);
 }
 
-void BuildLCDInfoPacket() {
-  LCDInfoPacket.BitPairsMinus1 = (sizeof(LCDInfoPacket) - 7) * 4 - 1;
+static void BuildLCDInfo(FLCDInfoPacket *Packet, uint Width, uint Height, uint8_t Phases) {
+  Packet->BitPairsMinus1 = (sizeof(*Packet) - 7) * 4 - 1;
 
-  LCDInfoPacket.Header.Command = CMD_RESPOND_DATA_TRANSFER;
-  LCDInfoPacket.Header.Destination = ADDRESS_DREAMCAST;
-  LCDInfoPacket.Header.Origin = ADDRESS_SUBPERIPHERAL0;
-  LCDInfoPacket.Header.NumWords = sizeof(LCDInfoPacket.Info) / sizeof(uint);
+  Packet->Header.Command = CMD_RESPOND_DATA_TRANSFER;
+  Packet->Header.Destination = ADDRESS_DREAMCAST;
+  Packet->Header.Origin = ADDRESS_SUBPERIPHERAL0;
+  Packet->Header.NumWords = sizeof(Packet->Info) / sizeof(uint);
 
-  LCDInfoPacket.Info.Func = __builtin_bswap32(FUNC_LCD);
+  Packet->Info.Func = __builtin_bswap32(FUNC_LCD);
 
-  LCDInfoPacket.Info.dX = LCD_Width - 1;  // 48 dots wide (dX + 1)
-  LCDInfoPacket.Info.dY = LCD_Height - 1; // 32 dots tall (dY + 1)
-  LCDInfoPacket.Info.GradContrast = 0x10; // Gradation = 1 bit/dot, Contrast = 0 (disabled)
-  LCDInfoPacket.Info.Reserved = 0;
+  Packet->Info.dX = Width - 1;  // dots wide (dX + 1)
+  Packet->Info.dY = Height - 1; // dots tall (dY + 1)
+  Packet->Info.GradContrast = 0x10; // Gradation = 1 bit/dot, Contrast = 0 (disabled)
+  Packet->Info.Reserved = Phases;
 
-  LCDInfoPacket.CRC = CalcCRC((uint *)&LCDInfoPacket.Header, sizeof(LCDInfoPacket) / sizeof(uint) - 2);
+  Packet->CRC = CalcCRC((uint *)&Packet->Header, sizeof(*Packet) / sizeof(uint) - 2);
+}
+
+// The 48x32 VMU screen is exactly what LCD_FUNC_DEF says, one BPPacket phase, and its
+// Reserved byte stays 0 as on a real VMU. LCD_FUNC_DEF can only describe one block
+// size, so the 128x64 test block's geometry comes back when media info is asked for
+// at LCD_BLOCK_TEST, with its phase count (the last one short) in Reserved
+void BuildLCDInfoPacket() {
+  BuildLCDInfo(&LCDInfoPacket, LCD_Width, LCD_Height, 0);
+  BuildLCDInfo(&LCDTestInfoPacket, LCD_TestWidth, LCD_TestHeight, LCD_TestPhases);
 }
 
 void BuildPuruPuruInfoPacket() {
@@ -676,15 +838,51 @@ int SendPacket(const uint *Words, uint NumWords) {
   dma_channel_set_trans_count(TXDMAChannel, NumWords, true);
 }
 
+// The console gets an idle pad while the menu has the buttons
+static void SendMenuControllerStatus() {
+  ControllerPacket.Controller.Buttons = 0xFFFF;
+  ControllerPacket.Controller.LeftTrigger = 0x00;
+  ControllerPacket.Controller.RightTrigger = 0x00;
+  ControllerPacket.Controller.JoyX = 0x80;
+  ControllerPacket.Controller.JoyY = 0x80;
+
+  if (autoResetEnable)
+    gpio_set_dir(INPUT_ACT, GPIO_OUT); // using the menu counts as input
+
+  ControllerPacket.CRC = CalcCRC((uint *)&ControllerPacket.Header, sizeof(ControllerPacket) / sizeof(uint) - 2);
+  SendPacket((uint *)&ControllerPacket, sizeof(ControllerPacket) / sizeof(uint));
+}
+
 void SendControllerStatus() {
+  static uint32_t menuHoldStart = 0;
   uint Buttons = 0x0000FFFF;
 
+  if (menuActive()) {
+    SendMenuControllerStatus();
+    return;
+  }
+
   for (int i = 0; i < NUM_BUTTONS; i++) {
     if (!gpio_get(ButtonInfos[i].InputIO)) {
       Buttons &= ~ButtonInfos[i].DCButtonMask;
     }
   }
 
+  // Y and Start alone: X+Y+Start cycles pages and A+B+X+Y+Start is the console's soft reset
+  if ((~Buttons & 0xFFFF) == MENU_MASK) {
+    uint32_t now = to_ms_since_boot(get_absolute_time());
+    if (!menuHoldStart)
+      menuHoldStart = now | 1; // 0 means not held
+    else if (now - menuHoldStart >= MENU_HOLD_MS) {
+      menuHoldStart = 0;
+      openMenu();
+      SendMenuControllerStatus();
+      return;
+    }
+  } else {
+    menuHoldStart = 0;
+  }
+
 #if MAPLEPAD
   // placeholder
 #endif
@@ -869,8 +1067,10 @@ void BlockWrite(uint Address, uint *Data, uint NumWords) {
   assert(NumWords * sizeof(uint) == PHASE_SIZE);
 
   uint MemoryOffset = Block * BLOCK_SIZE + Phase * PHASE_SIZE;
-  memcpy(&MemoryCard[MemoryOffset], Data, PHASE_SIZE);
-  SectorDirty |= 1u << (MemoryOffset / FLASH_SECTOR_SIZE);
+  if (memcmp(&MemoryCard[MemoryOffset], Data, PHASE_SIZE) != 0) { // rewriting identical data doesn't need a flash write
+    memcpy(&MemoryCard[MemoryOffset], Data, PHASE_SIZE);
+    SectorDirty |= 1u << (MemoryOffset / FLASH_SECTOR_SIZE);
+  }
   MessagesSinceWrite = 0;
 
   ACKPacket.Header.Origin = ADDRESS_SUBPERIPHERAL0;
@@ -879,22 +1079,44 @@ void BlockWrite(uint Address, uint *Data, uint NumWords) {
   NextPacketSend = SEND_ACK;
 }
 
-void LCDWrite(uint Address, uint *Data, uint NumWords, uint BlockNum) {
-  assert(NumWords * sizeof(uint) == (LCDFramebufferSize / NumWrites));
+// Block 0 is the 48x32 VMU screen, block 0x10 the 128x64 test mode screen.
+// Frames bigger than one packet arrive in phases of BPPacket bytes and are
+// drawn once the last one is in. Anything that doesn't fit is refused
+bool LCDWrite(uint Address, uint *Data, uint NumWords) {
+  uint Phase = (Address >> 16) & 0xFF;
+  uint Block = Address & 0xFFFF;
+  uint Bytes = NumWords * sizeof(uint);
 
-  if (BlockNum == 0x10) // 128x64 Test Mode
-  {
-    memcpy(&LCDFramebuffer[512], Data, NumWords * sizeof(uint));
-  } else if (BlockNum == 0x00) { // Normal mode
-    memcpy(LCDFramebuffer, Data, NumWords * sizeof(uint));
+  LCDBlock *LCD = NULL;
+  for (uint i = 0; i < sizeof(LCDBlocks) / sizeof(LCDBlocks[0]); i++) {
+    if (LCDBlocks[i].Block == Block)
+      LCD = &LCDBlocks[i];
   }
 
-  LCDUpdated = true;
+  uint Offset = Phase * BPPacket;
+  if (!LCD || Offset + Bytes > LCD->Size)
+    return false;
+
+  const uint8_t *Src = (const uint8_t *)Data;
+  uint RowBytes = LCD->Width / 8;
+  for (uint Row = Offset / RowBytes; Row * RowBytes < Offset + Bytes; Row++) {
+    uint Start = MAX(Row * RowBytes, Offset);
+    uint End = MIN((Row + 1) * RowBytes, Offset + Bytes);
+    if (memcmp(&LCD->Framebuffer[Start], &Src[Start - Offset], End - Start))
+      LCD->DirtyRows |= 1ull << Row;
+  }
+  memcpy(&LCD->Framebuffer[Offset], Src, Bytes);
+
+  if (Offset + Bytes == LCD->Size) { // whole frame in, drawn from the main loop when idle
+    lcdPost(LCD->Framebuffer, LCD->Width, LCD->Height, LCD->DirtyRows, palette[currentPage - 1]);
+    LCD->DirtyRows = 0;
+  }
 
   ACKPacket.Header.Origin = ADDRESS_SUBPERIPHERAL0;
   ACKPacket.CRC = CalcCRC((uint *)&ACKPacket.Header, sizeof(ACKPacket) / sizeof(uint) - 2);
 
   NextPacketSend = SEND_ACK;
+  return true;
 }
 
 void PuruPuruWrite(uint Address, uint *Data, uint NumWords) {
@@ -922,10 +1144,19 @@ void BlockCompleteWrite(uint Address, uint func) {
 
   assert(Phase == 4);
 
-  uint MemoryOffset = Block * BLOCK_SIZE;
-  SectorDirty |= 1u << (MemoryOffset / FLASH_SECTOR_SIZE);
+  // Data already landed (and dirtied its sector) in BlockWrite
   MessagesSinceWrite = 0;
 
+  if (func == __builtin_bswap32(FUNC_MEMORY_CARD)) {
+    // BIOS format: the directory is cleared in RAM as soon as its empty FAT is in, keeping
+    // the root the BIOS wrote. Once its last block is in nothing more is coming, so the
+    // flush goes straight out instead of waiting FLASH_WRITE_DELAY
+    uint32_t Cleared = 0;
+    if (FormatBlockWritten(&FormatBlocks, MemoryCard, Block, &Cleared))
+      MessagesSinceWrite = FLASH_WRITE_DELAY;
+    SectorDirty |= Cleared;
+  }
+
   if (func == __builtin_bswap32(FUNC_MEMORY_CARD) || func == __builtin_bswap32(FUNC_LCD)) {
     ACKPacket.Header.Origin = ADDRESS_SUBPERIPHERAL0;
   } else if (func == __builtin_bswap32(FUNC_VIBRATION)) {
@@ -1067,7 +1298,9 @@ bool ConsumePacket(uint Size) {
               NextPacketSend = SEND_MEMORY_INFO;
               return true;
             } else if (Header->NumWords >= 2 && *PacketData == __builtin_bswap32(FUNC_LCD)) {
-              NextPacketSend = SEND_LCD_INFO;
+              // location word as in LCDWrite, block number in the low 16 bits
+              bool Test = (__builtin_bswap32(*(PacketData + 1)) & 0xFFFF) == LCD_BLOCK_TEST;
+              NextPacketSend = Test ? SEND_LCD_TEST_INFO : SEND_LCD_INFO;
               return true;
             }
             break;
@@ -1087,14 +1320,8 @@ bool ConsumePacket(uint Size) {
               BlockWrite(__builtin_bswap32(*(PacketData + 1)), PacketData + 2, Header->NumWords - 2);
               return true;
             } else if (Header->NumWords >= 2 && *PacketData == __builtin_bswap32(FUNC_LCD)) {
-              if (*(PacketData + 1) == __builtin_bswap32(0)) // Block 0
-              {
-                LCDWrite(__builtin_bswap32(*(PacketData + 1)), PacketData + 2, Header->NumWords - 2, 0);
+              if (LCDWrite(__builtin_bswap32(*(PacketData + 1)), PacketData + 2, Header->NumWords - 2))
                 return true;
-              } else if (*(PacketData + 1) == __builtin_bswap32(0x10)) { // Block 1
-                LCDWrite(__builtin_bswap32(*(PacketData + 1)), PacketData + 2, Header->NumWords - 2, 1);
-                return true;
-              }
             } else if (Header->NumWords >= 2 && *PacketData == __builtin_bswap32(FUNC_TIMER)) {
               TimerWrite(__builtin_bswap32(*(PacketData + 1)), PacketData + 2, Header->NumWords - 2);
               return true;
@@ -1550,6 +1777,9 @@ int main() {
 
   memset(flashData, 0, sizeof(flashData));
   memcpy(flashData, (uint8_t *)XIP_BASE + (FLASH_OFFSET * 9), sizeof(flashData)); // read into variable
+  checksumLoad(&Checksums, (const ChecksumRecord *)(XIP_BASE + CHECKSUM_LOG_OFFSET));
+  storeInit(&Store); // the first boot after older firmware takes its pages over where they are
+  importPages();
 
   // Input activity pin (faux open drain)
   gpio_init(INPUT_ACT);
@@ -1559,25 +1789,17 @@ int main() {
   gpio_put(INPUT_ACT, 0);
   gpio_set_dir(INPUT_ACT, GPIO_IN);
 
-    // Pre-format VMU pages since rumble timer interrupt interferes with on-the-fly formatting
-  if (firstBoot || version != CURRENT_FW_VERSION) { // flash is 0xFF when erased! also run if FW version is different (post-update)
-    uint Interrupts = save_and_disable_interrupts();
-
-    for (int page = 1; page <= 8; page++) {
-      currentPage = page;
-
-      readFlash(); // includes checkFormatted
-
-      while (SectorDirty) {
-        uint Sector = 31 - __builtin_clz(SectorDirty);
-        SectorDirty &= ~(1 << Sector);
-        uint SectorOffset = Sector * FLASH_SECTOR_SIZE;
+  // Settings from a data-only UF2 (tools/make_image) are kept as-is, whichever firmware version wrote them
+  if (settingsImport == SETTINGS_IMPORT_MAGIC) {
+    preformatPages(); // pages the update didn't touch may still be blank
+    settingsImport = 0;
+    version = CURRENT_FW_VERSION;
+    firstBoot = 0;
+    updateFlashData();
+  }
 
-        flash_range_erase((FLASH_OFFSET * currentPage) + SectorOffset, FLASH_SECTOR_SIZE);
-        flash_range_program((FLASH_OFFSET * currentPage) + SectorOffset, &MemoryCard[SectorOffset], FLASH_SECTOR_SIZE);
-      }
-    }
-    restore_interrupts(Interrupts);
+  if (firstBoot || version != CURRENT_FW_VERSION) { // flash is 0xFF when erased! also run if FW version is different (post-update)
+    preformatPages();
     currentPage = 1;
 
     // Also set up some reasonable analog stick, trigger and flag defaults
@@ -1612,6 +1834,10 @@ int main() {
     swapLR = 0;
     autoResetEnable = 0;
     autoResetTimer = 0x5A; // 180s
+    flashErrors = 0;
+    bootVideo = 0;
+    vmuTheme = 0; // THEME_SOLID
+    vmuSmooth = 0;
     version = CURRENT_FW_VERSION;
 
     firstBoot = 0; // first boot setup done
@@ -1631,24 +1857,10 @@ int main() {
   oledType = gpio_get(OLED_PIN);
   updateFlashData();
 
-  if (oledType) { // set up SPI for SSD1331 OLED
-    spi_init(SSD1331_SPI, SSD1331_SPEED);
-    spi_set_format(spi0, 8, SPI_CPOL_1, SPI_CPHA_1, SPI_MSB_FIRST);
-    gpio_set_function(SCK, GPIO_FUNC_SPI);
-    gpio_set_function(MOSI, GPIO_FUNC_SPI);
-
-    ssd1331_init();
-    splashSSD1331(); // n.b. splashSSD1331 configures DMA channel!
-  } else {           // set up I2C for SSD1306 OLED
-    i2c_init(SSD1306_I2C, I2C_CLOCK * 1000);
-    gpio_set_function(I2C_SDA, GPIO_FUNC_I2C);
-    gpio_set_function(I2C_SCL, GPIO_FUNC_I2C);
-    gpio_pull_up(I2C_SDA);
-    gpio_pull_up(I2C_SCL);
-
-    ssd1306_init();
-    splashSSD1306();
-  }
+  displaySelect(oledType);
+  display->begin();
+  if (bootVideo != 1 || !animStart(&bootAnimation)) // plays from the main loop below
+    display->splash();
 
 #if ENABLE_RUMBLE
   // PWM setup for rumble
@@ -1682,10 +1894,7 @@ int main() {
   SetupButtons();
 
   if (!gpio_get(ButtonInfos[3].InputIO) && !gpio_get(ButtonInfos[8].InputIO)) { // Y + Start
-    runMenu();
-    updateFlashData();
-    clearDisplay();
-    updateDisplay();
+    openMenu(); // runs from the main loop below, alongside the Maple bus
   }
 
   // Read current VMU into memory
@@ -1720,6 +1929,11 @@ int main() {
 
   uint StartOfPacket = 0;
   while (true) {
+    // Run the menu, the boot animation and the VMU screen in slices while core1 has nothing for us
+    while (!multicore_fifo_rvalid())
+      if (!menuTask() && !animStep() && !lcdRenderStep())
+        __wfe(); // core1 sends an event with each packet, the menu timer interrupt wakes us too
+
     uint EndOfPacket = multicore_fifo_pop_blocking();
 
     // TODO: Improve. Would be nice not to move here
@@ -1765,44 +1979,19 @@ int main() {
           if (SectorDirty && !multicore_fifo_rvalid() && MessagesSinceWrite >= FLASH_WRITE_DELAY) {
             uint Sector = 31 - __builtin_clz(SectorDirty);
             SectorDirty &= ~(1 << Sector);
-            uint SectorOffset = Sector * FLASH_SECTOR_SIZE;
-
-            uint Interrupts = save_and_disable_interrupts();
-            flash_range_erase((FLASH_OFFSET * currentPage) + SectorOffset, FLASH_SECTOR_SIZE);
-            flash_range_program((FLASH_OFFSET * currentPage) + SectorOffset, &MemoryCard[SectorOffset], FLASH_SECTOR_SIZE);
-            restore_interrupts(Interrupts);
+            flushSector(Sector);
+          } else if (SettingsDirty && !multicore_fifo_rvalid() && MessagesSinceWrite >= FLASH_WRITE_DELAY) {
+            updateFlashData();
+            SettingsDirty = false;
           } else if (!SectorDirty && MessagesSinceWrite >= FLASH_WRITE_DELAY && PageCycle) {
             readFlash();
             PageCycle = false;
             VMUCycle = true;
           } else if (MessagesSinceWrite < FLASH_WRITE_DELAY) {
             MessagesSinceWrite++;
-          }
-          if (LCDUpdated) {
-            if (!oledType && endSplash){ // clear SSD1306 128x64 splashscreen
-              clearDisplay();
-              endSplash = false;
-            }
-
-            // thanks, gpt-4! :D
-            int x, y, pixel, bb;
-            for (int fb = 0; fb < LCDFramebufferSize; fb++) {
-                y = (fb / LCD_NumCols) * 2;
-                int mod = (fb % LCD_NumCols) * 16;
-                for (bb = 0; bb <= 7; bb++) {
-                    x = mod + (14 - bb * 2);
-                    pixel = ((LCDFramebuffer[fb] >> bb) & 0x01) * palette[currentPage - 1];
-                    if (LCD_Width == 48 && LCD_Height == 32) {
-                        setPixel(x, y, pixel);
-                        setPixel(x + 1, y, pixel);
-                        setPixel(x, y + 1, pixel);
-                        setPixel(x + 1, y + 1, pixel);
-                    }
-                }
-            }
-
-            updateDisplay();
-            LCDUpdated = false;
+          } else if (vmuEnable && !multicore_fifo_rvalid()) {
+            if (!storeIdleStep()) // erases for later saves, when there's nothing else to do
+              scrubStep();
           }
           break;
         case SEND_PURUPURU_STATUS:
@@ -1828,6 +2017,9 @@ int main() {
         case SEND_LCD_INFO:
           SendPacket((uint *)&LCDInfoPacket, sizeof(LCDInfoPacket) / sizeof(uint));
           break;
+        case SEND_LCD_TEST_INFO:
+          SendPacket((uint *)&LCDTestInfoPacket, sizeof(LCDTestInfoPacket) / sizeof(uint));
+          break;
         case SEND_ACK:
           SendPacket((uint *)&ACKPacket, sizeof(ACKPacket) / sizeof(uint));
           break;
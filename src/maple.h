@@ -6,6 +6,8 @@
 #include <time.h>
 #include <stdint.h>
 #include "format.h"
+#include "scrub.h"
+#include "store.h"
 #include "maple.pio.h"
 #include "pico/stdlib.h"
 
@@ -50,10 +52,26 @@
 #define VER_1_6 0x0B
 #define VER_1_7 0x0C
 
+#define LCD_Width 48
+#define LCD_Height 32
+#define LCD_NumCols 6          // 48 / 8
+#define LCDFramebufferSize 192 // (48 * 32) / 8
+#define BPPacket 192           // Bytes Per Packet
+
+#define LCD_TestWidth 128
+#define LCD_TestHeight 64
+#define LCDTestFramebufferSize 1024 // (128 * 64) / 8, sent in several phases
+#define LCD_TestPhases ((LCDTestFramebufferSize + BPPacket - 1) / BPPacket) // 6, the last one 64 bytes
+
+#define LCD_BLOCK_VMU 0x00  // LCD block numbers
+#define LCD_BLOCK_TEST 0x10 // 128x64 test mode
+
 extern uint8_t flashData[];
 
 void updateFlashData();
 
+void queueFlashDataUpdate();
+
 typedef struct PacketHeader_s {
   int8_t Command;
   uint8_t Destination;
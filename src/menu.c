@@ -15,18 +15,64 @@
 #include "maple.h"
 #include "menu.h"
 #include "display.h"
+#include "lcd.h"
+#include "anim.h"
+#include "theme.h"
+
+// The menu runs alongside the Maple responder. A 10 ms timer reads the
+// buttons into press events and cycles the colour; everything else,
+// drawing included, happens in menuTask() from the main loop between
+// packets, one event or one redraw at a time
+#define BUTTON_A 0 // ButtonInfos order
+#define BUTTON_Y 3
+#define BUTTON_UP 4
+#define BUTTON_DOWN 5
+#define BUTTON_LEFT 6
+#define BUTTON_RIGHT 7
+#define BUTTON_START 8
+#define DPAD_BITS 0x00f0
+
+#define REPEAT_DELAY_TICKS 30 // a held D-pad direction repeats after 300 ms...
+#define REPEAT_TICKS 6        // ...every 60 ms, for scrolling and adjusting values
+#define EVENT_QUEUE 16        // power of two
+
+typedef enum { SCREEN_CLOSED, SCREEN_LIST, SCREEN_STICK_CAL, SCREEN_TRIGGER_CAL, SCREEN_EDIT } MenuScreen;
+
+// One adjustable value on an edit screen
+typedef struct {
+  const char *name; // "X Deadzone", or just the axis over "AntiDeadzone"
+  uint8_t *value;
+  uint8_t max;
+  bool anti;
+  bool seconds; // autoreset timer, 2 s units
+  const char *const *labels; // shown instead of the number, one per value
+} EditField;
 
 uint32_t flipLockout;
-volatile bool redraw = 1;
+static bool flipPending;
+
+// Time spent in menu work, for checking it leaves the Maple bus alone
+MenuStats menuStats = {0};
 
 struct repeating_timer redrawTimer;
 
 static uint16_t color = 0x0000;
 
-int paletteVMU(menu *self) {
-  // draw VMU palette selection
-  return (1);
-}
+static volatile MenuScreen screen = SCREEN_CLOSED;
+static int step;           // how far the current screen has got
+static bool stepDrawn;     // the current step is on the panel
+static uint32_t stepStart; // ms
+static const EditField *fields;
+static int numFields;
+static bool vmuWasEnabled;
+
+// Button presses from the timer, for menuTask()
+static volatile uint8_t events[EVENT_QUEUE];
+static volatile uint8_t eventHead = 0, eventTail = 0;
+static volatile bool tickPending = false;
+static volatile bool resyncButtons = true;
+
+extern volatile bool PageCycle;
 
 int paletteUI(menu *self) {
   // draw UI palette selection
@@ -38,450 +84,256 @@ int buttontest(menu *self) {
   return (1);
 }
 
-int sCal(menu *self) {
-  // draw stick calibration
-  redraw = 0; // Disable redrawMenu
-
-  while (!gpio_get(ButtonInfos[0].InputIO));
+static void setStep(int n) {
+  step = n;
+  stepStart = to_ms_since_boot(get_absolute_time());
+  stepDrawn = false;
+}
 
-  clearDisplay();
-  char *cal_string = "Center stick,";
-  putString(cal_string, 0, 0, color);
-  cal_string = "then press A!";
-  putString(cal_string, 0, 1, color);
-  updateDisplay();
+static void enterScreen(MenuScreen next, const EditField *editFields, int count) {
+  fields = editFields;
+  numFields = count;
+  screen = next;
+  setStep(0);
+}
 
-  sleep_ms(50);
-  while (gpio_get(ButtonInfos[0].InputIO));
+// Back to the list, with whatever the screen changed written at the next flash slot
+static void leaveScreen() {
+  queueFlashDataUpdate();
+  invalidateMenu();
+  screen = SCREEN_LIST;
+}
 
+static void readStickCenter() {
   adc_select_input(0); // X
   xCenter = adc_read() >> 4;
 
   adc_select_input(1); // Y
   yCenter = adc_read() >> 4;
 
-  clearDisplay();
-  cal_string = "Move stick";
-  putString(cal_string, 0, 0, color);
-  cal_string = "  around";
-  putString(cal_string, 0, 1, color);
-  cal_string = "  a lot!";
-  putString(cal_string, 0, 2, color);
-  updateDisplay();
-
   xMin = 0x80;
   xMax = 0x80;
   yMin = 0x80;
   yMax = 0x80;
+}
 
-  uint32_t start = to_ms_since_boot(get_absolute_time());
-  while ((to_ms_since_boot(get_absolute_time()) - start) < 4000 ? true : gpio_get(ButtonInfos[0].InputIO)) {
-    static bool prompt = true;
-    static uint8_t xData = 0;
-    static uint8_t yData = 0;
-
-    adc_select_input(0); // X
-    xData = adc_read() >> 4;
-
-    adc_select_input(1); // Y
-    yData = adc_read() >> 4;
-
-    if (xData < xMin)
-      xMin = xData;
-    else if (xData > xMax)
-      xMax = xData;
-
-    if (yData < yMin)
-      yMin = yData;
-    else if (yData > yMax)
-      yMax = yData;
-
-    // printf("\033[H\033[2J");
-    // printf("\033[36m");
-    // printf("xRaw: 0x%04x  yRaw: 0x%02x\n", xRaw, yRaw);
-    // printf("xData: 0x%02x  yData: 0x%02x\n", xData, yData);
-    // printf("xMin: 0x%02x  xMax: 0x%02x yMin: 0x%02x yMax: 0x%02x\n", xMin, xMax, yMin, yMax);
-    // sleep_ms(50);
-
-    if ((to_ms_since_boot(get_absolute_time()) - start) >= 4000 && prompt) {
-      prompt = false;
-      cal_string = "  Press A";
-      putString(cal_string, 0, 3, color);
-      cal_string = " when done!";
-      putString(cal_string, 0, 4, color);
-      updateDisplay();
-    }
-  }
+static void sampleStickRange() {
+  adc_select_input(0); // X
+  uint8_t xData = adc_read() >> 4;
 
-  // Write config values to flash
-  updateFlashData();
+  adc_select_input(1); // Y
+  uint8_t yData = adc_read() >> 4;
 
-  redraw = 1;
+  if (xData < xMin)
+    xMin = xData;
+  else if (xData > xMax)
+    xMax = xData;
 
-  return (1);
+  if (yData < yMin)
+    yMin = yData;
+  else if (yData > yMax)
+    yMax = yData;
 }
 
-int tCal(menu *self) {
-  // draw trigger calibration
-  redraw = 0; // Disable redrawMenu
-
-  while (!gpio_get(ButtonInfos[0].InputIO))
-    ;
-
+// Centre, then 4 s of moving the stick around before A is taken
+static void drawStickCal() {
   clearDisplay();
-  char *cal_string = "leave";
-  putString(cal_string, 0, 0, color);
-  cal_string = "triggers idle";
-  putString(cal_string, 0, 1, color);
-  cal_string = "and press A";
-  putString(cal_string, 0, 2, color);
+  if (step == 0) {
+    putString("Center stick,", 0, 0, color);
+    putString("then press A!", 0, 1, color);
+  } else {
+    putString("Move stick", 0, 0, color);
+    putString("  around", 0, 1, color);
+    putString("  a lot!", 0, 2, color);
+    if (step == 2) {
+      putString("  Press A", 0, 3, color);
+      putString(" when done!", 0, 4, color);
+    }
+  }
   updateDisplay();
+}
 
-  sleep_ms(500);
-  while (gpio_get(ButtonInfos[0].InputIO))
-    ;
-
-  adc_select_input(2); // L
-  lMin = adc_read() >> 4;
-
-  adc_select_input(3); // R
-  rMin = adc_read() >> 4;
+static void stickCalButton(int button) {
+  if (button != BUTTON_A)
+    return;
 
-  clearDisplay();
-  cal_string = "hold lMax";
-  putString(cal_string, 0, 0, color);
-  cal_string = "and press A";
-  putString(cal_string, 0, 1, color);
-  updateDisplay();
-
-  sleep_ms(500);
-  while (gpio_get(ButtonInfos[0].InputIO))
-    ;
+  if (step == 0) {
+    readStickCenter();
+    setStep(1);
+  } else if (step == 2) {
+    leaveScreen();
+  }
+}
 
-  adc_select_input(2); // lMax
-  lMax = adc_read() >> 4;
+static void stickCalTick() {
+  if (step > 0)
+    sampleStickRange();
+  if (step == 1 && to_ms_since_boot(get_absolute_time()) - stepStart >= 4000)
+    setStep(2);
+}
 
+// Idle triggers, then each one held down, A after each
+static void drawTriggerCal() {
   clearDisplay();
-  cal_string = "hold rMax";
-  putString(cal_string, 0, 0, color);
-  cal_string = "and press A";
-  putString(cal_string, 0, 1, color);
+  if (step == 0) {
+    putString("leave", 0, 0, color);
+    putString("triggers idle", 0, 1, color);
+    putString("and press A", 0, 2, color);
+  } else {
+    putString(step == 1 ? "hold lMax" : "hold rMax", 0, 0, color);
+    putString("and press A", 0, 1, color);
+  }
   updateDisplay();
+}
 
-  sleep_ms(500);
-  while (gpio_get(ButtonInfos[0].InputIO))
-    ;
-
-  adc_select_input(3); // rMax
-  rMax = adc_read() >> 4;
+static void triggerCalButton(int button) {
+  if (button != BUTTON_A)
+    return;
+
+  if (step == 0) {
+    adc_select_input(2); // L
+    lMin = adc_read() >> 4;
+
+    adc_select_input(3); // R
+    rMin = adc_read() >> 4;
+    setStep(1);
+  } else if (step == 1) {
+    adc_select_input(2); // lMax
+    lMax = adc_read() >> 4;
+    setStep(2);
+  } else {
+    adc_select_input(3); // rMax
+    rMax = adc_read() >> 4;
 
-  if (lMin > lMax) {
-    uint temp = lMin;
-    lMin = lMax;
-    lMax = temp;
-  }
+    if (lMin > lMax) {
+      uint temp = lMin;
+      lMin = lMax;
+      lMax = temp;
+    }
 
-  if (rMin > rMax) {
-    uint temp = rMin;
-    rMin = rMax;
-    rMax = temp;
+    if (rMin > rMax) {
+      uint temp = rMin;
+      rMin = rMax;
+      rMax = temp;
+    }
+    leaveScreen();
   }
-
-  // Write config values to flash
-  updateFlashData();
-
-  redraw = 1;
-
-  return (1);
 }
 
-int sDeadzone(menu *self) {
-  // draw deadzone configuration
-
-  redraw = 0;
+// Up/Down step by 1, Left/Right by 8, A moves to the next field
+static void drawEdit() {
+  const EditField *f = &fields[step];
+  char data[16];
 
-  char* cal_string = "X Deadzone";
-  char sdata[5] = {0};
-
-  while(!gpio_get(ButtonInfos[0].InputIO));
-
-  while (gpio_get(ButtonInfos[0].InputIO)) {
-    clearDisplay();
-    putString(cal_string, 0, 0, color);
-    sprintf(sdata, "0x%02x", xDeadzone);
-    putString(sdata, 3, 2, color);
-    updateDisplay();
-
-    if (!gpio_get(ButtonInfos[4].InputIO)){
-      if (xDeadzone < 128)
-        xDeadzone++;}
-    else if (!gpio_get(ButtonInfos[5].InputIO)){
-      if (xDeadzone > 0)
-        xDeadzone--;}
-    else if (!gpio_get(ButtonInfos[6].InputIO)){
-      if (xDeadzone > 7)
-        xDeadzone = xDeadzone - 8;}
-    else if (!gpio_get(ButtonInfos[7].InputIO)){
-      if (xDeadzone < 121)
-        xDeadzone = xDeadzone + 8;}
-
-    sleep_ms(60);
+  clearDisplay();
+  if (f->labels) {
+    putString(f->name, 0, 0, color);
+    putString(f->labels[*f->value], 0, 2, color);
+  } else if (f->seconds) {
+    putString(f->name, 0, 0, color);
+    snprintf(data, sizeof(data), "%03d seconds", *f->value * 2);
+    putString(data, 0, 2, color);
+  } else if (f->anti) {
+    putString(f->name, 5, 0, color);
+    putString("AntiDeadzone", 0, 1, color);
+    snprintf(data, sizeof(data), "0x%02x", *f->value);
+    putString(data, 3, 3, color);
+  } else {
+    putString(f->name, 0, 0, color);
+    snprintf(data, sizeof(data), "0x%02x", *f->value);
+    putString(data, 3, 2, color);
   }
+  updateDisplay();
+}
 
-  while(!gpio_get(ButtonInfos[0].InputIO));
-
-  while (gpio_get(ButtonInfos[0].InputIO)) {
-    clearDisplay();
-    cal_string = "X";
-    putString(cal_string, 5, 0, color);
-    cal_string = "AntiDeadzone";
-    putString(cal_string, 0, 1, color);
-    sprintf(sdata, "0x%02x", xAntiDeadzone);
-    putString(sdata, 3, 3, color);
-    updateDisplay();
-
-    if (!gpio_get(ButtonInfos[4].InputIO)){
-      if (xAntiDeadzone < 128)
-        xAntiDeadzone++;}
-    else if (!gpio_get(ButtonInfos[5].InputIO)){
-      if (xAntiDeadzone > 0)
-        xAntiDeadzone--;}
-    else if (!gpio_get(ButtonInfos[6].InputIO)){
-      if (xAntiDeadzone > 7)
-        xAntiDeadzone = xAntiDeadzone - 8;}
-    else if (!gpio_get(ButtonInfos[7].InputIO)){
-      if (xAntiDeadzone < 121)
-        xAntiDeadzone = xAntiDeadzone + 8;}
-
-    sleep_ms(60);
+static void editButton(int button) {
+  const EditField *f = &fields[step];
+  uint8_t v = *f->value;
+
+  if (button == BUTTON_UP && v < f->max)
+    v++;
+  else if (button == BUTTON_DOWN && v > 0)
+    v--;
+  else if (button == BUTTON_LEFT && v > 7)
+    v -= 8;
+  else if (button == BUTTON_RIGHT && v <= f->max - 8)
+    v += 8;
+  else if (button == BUTTON_A) {
+    if (step + 1 < numFields)
+      setStep(step + 1);
+    else
+      leaveScreen();
+    return;
   }
 
-  while(!gpio_get(ButtonInfos[0].InputIO));
-
-  while (gpio_get(ButtonInfos[0].InputIO)) {
-    clearDisplay();
-    cal_string = "Y Deadzone";
-    putString(cal_string, 0, 0, color);
-    sprintf(sdata, "0x%02x", yDeadzone);
-    putString(sdata, 3, 2, color);
-    updateDisplay();
-
-    if (!gpio_get(ButtonInfos[4].InputIO)){
-      if (yDeadzone < 128)
-        yDeadzone++;}
-    else if (!gpio_get(ButtonInfos[5].InputIO)){
-      if (yDeadzone > 0)
-        yDeadzone--;}
-    else if (!gpio_get(ButtonInfos[6].InputIO)){
-      if (yDeadzone > 7)
-        yDeadzone = yDeadzone - 8;}
-    else if (!gpio_get(ButtonInfos[7].InputIO)){
-      if (yDeadzone < 121)
-        yDeadzone = yDeadzone + 8;}
-
-    sleep_ms(60);
+  if (v != *f->value) {
+    *f->value = v;
+    stepDrawn = false;
   }
+}
 
-  while(!gpio_get(ButtonInfos[0].InputIO));
+static const EditField stickFields[] = {
+  {"X Deadzone", &xDeadzone, 128, false, false},
+  {"X", &xAntiDeadzone, 128, true, false},
+  {"Y Deadzone", &yDeadzone, 128, false, false},
+  {"Y", &yAntiDeadzone, 128, true, false},
+};
 
-  while (gpio_get(ButtonInfos[0].InputIO)) {
-    clearDisplay();
-    cal_string = "Y";
-    putString(cal_string, 5, 0, color);
-    cal_string = "AntiDeadzone";
-    putString(cal_string, 0, 1, color);
-    sprintf(sdata, "0x%02x", yAntiDeadzone);
-    putString(sdata, 3, 3, color);
-    updateDisplay();
+static const EditField triggerFields[] = {
+  {"L Deadzone", &lDeadzone, 128, false, false},
+  {"L", &lAntiDeadzone, 128, true, false},
+  {"R Deadzone", &rDeadzone, 128, false, false},
+  {"R", &rAntiDeadzone, 128, true, false},
+};
 
-    if (!gpio_get(ButtonInfos[4].InputIO)){
-      if (yAntiDeadzone < 128)
-        yAntiDeadzone++;}
-    else if (!gpio_get(ButtonInfos[5].InputIO)){
-      if (yAntiDeadzone > 0)
-        yAntiDeadzone--;}
-    else if (!gpio_get(ButtonInfos[6].InputIO)){
-      if (yAntiDeadzone > 7)
-        yAntiDeadzone = yAntiDeadzone - 8;}
-    else if (!gpio_get(ButtonInfos[7].InputIO)){
-      if (yAntiDeadzone < 121)
-        yAntiDeadzone = yAntiDeadzone + 8;}
-
-    sleep_ms(60);
-  }
+static const EditField timerFields[] = {
+  {"Autoreset", &autoResetTimer, 255, false, true},
+};
 
-  updateFlashData();
+static const char *const scalerNames[] = {"Sharp (fast)", "Smooth"};
 
-  clearDisplay();
-  
-  redraw = 1;
+static const EditField themeFields[] = {
+  {"VMU Theme", &vmuTheme, THEME_COUNT - 1, false, false, themeNames},
+  {"VMU Scaling", &vmuSmooth, 1, false, false, scalerNames},
+};
 
+int sCal(menu *self) {
+  // stick calibration
+  enterScreen(SCREEN_STICK_CAL, NULL, 0);
   return (1);
 }
 
-int tDeadzone(menu *self) {
-  // draw deadzone configuration
-
-  redraw = 0;
-
-  char* cal_string = "L Deadzone";
-  char tdata[5];
-
-  while(!gpio_get(ButtonInfos[0].InputIO));
-
-  while (gpio_get(ButtonInfos[0].InputIO)) {
-    clearDisplay();
-    putString(cal_string, 0, 0, color);
-    sprintf(tdata, "0x%02x", lDeadzone);
-    putString(tdata, 3, 2, color);
-    updateDisplay();
-
-    if (!gpio_get(ButtonInfos[4].InputIO)){
-      if (lDeadzone < 128)
-        lDeadzone++;}
-    else if (!gpio_get(ButtonInfos[5].InputIO)){
-      if (lDeadzone > 0)
-        lDeadzone--;}
-    else if (!gpio_get(ButtonInfos[6].InputIO)){
-      if (lDeadzone > 7)
-        lDeadzone = lDeadzone - 8;}
-    else if (!gpio_get(ButtonInfos[7].InputIO)){
-      if (lDeadzone < 121)
-        lDeadzone = lDeadzone + 8;}
-
-    sleep_ms(60);
-  }
-
-  while(!gpio_get(ButtonInfos[0].InputIO));
-
-  while (gpio_get(ButtonInfos[0].InputIO)) {
-    clearDisplay();
-    cal_string = "L";
-    putString(cal_string, 5, 0, color);
-    cal_string = "AntiDeadzone";
-    putString(cal_string, 0, 1, color);
-    sprintf(tdata, "0x%02x", lAntiDeadzone);
-    putString(tdata, 3, 3, color);
-    updateDisplay();
-
-    if (!gpio_get(ButtonInfos[4].InputIO)){
-      if (lAntiDeadzone < 128)
-        lAntiDeadzone++;}
-    else if (!gpio_get(ButtonInfos[5].InputIO)){
-      if (lAntiDeadzone > 0)
-        lAntiDeadzone--;}
-    else if (!gpio_get(ButtonInfos[6].InputIO)){
-      if (lAntiDeadzone > 7)
-        lAntiDeadzone = lAntiDeadzone - 8;}
-    else if (!gpio_get(ButtonInfos[7].InputIO)){
-      if (lAntiDeadzone < 121)
-        lAntiDeadzone = lAntiDeadzone + 8;}
-
-    sleep_ms(60);
-  }
-
-  while(!gpio_get(ButtonInfos[0].InputIO));
-
-  while (gpio_get(ButtonInfos[0].InputIO)) {
-    clearDisplay();
-    cal_string = "R Deadzone";
-    putString(cal_string, 0, 0, color);
-    sprintf(tdata, "0x%02x", rDeadzone);
-    putString(tdata, 3, 2, color);
-    updateDisplay();
-
-    if (!gpio_get(ButtonInfos[4].InputIO)){
-      if (rDeadzone < 128)
-        rDeadzone++;}
-    else if (!gpio_get(ButtonInfos[5].InputIO)){
-      if (rDeadzone > 0)
-        rDeadzone--;}
-    else if (!gpio_get(ButtonInfos[6].InputIO)){
-      if (rDeadzone > 7)
-        rDeadzone = rDeadzone - 8;}
-    else if (!gpio_get(ButtonInfos[7].InputIO)){
-      if (rDeadzone < 121)
-        rDeadzone = rDeadzone + 8;}
-
-    sleep_ms(60);
-  }
-
-  while(!gpio_get(ButtonInfos[0].InputIO));
-
-  while (gpio_get(ButtonInfos[0].InputIO)) {
-    clearDisplay();
-    cal_string = "R";
-    putString(cal_string, 5, 0, color);
-    cal_string = "AntiDeadzone";
-    putString(cal_string, 0, 1, color);
-    sprintf(tdata, "0x%02x", rAntiDeadzone);
-    putString(tdata, 3, 3, color);
-    updateDisplay();
-
-    if (!gpio_get(ButtonInfos[4].InputIO)){
-      if (rAntiDeadzone < 128)
-        rAntiDeadzone++;}
-    else if (!gpio_get(ButtonInfos[5].InputIO)){
-      if (rAntiDeadzone > 0)
-        rAntiDeadzone--;}
-    else if (!gpio_get(ButtonInfos[6].InputIO)){
-      if (rAntiDeadzone > 7)
-        rAntiDeadzone = rAntiDeadzone - 8;}
-    else if (!gpio_get(ButtonInfos[7].InputIO)){
-      if (rAntiDeadzone < 121)
-        rAntiDeadzone = rAntiDeadzone + 8;}
-
-    sleep_ms(60);
-  }
-
-  updateFlashData();
+int tCal(menu *self) {
+  // trigger calibration
+  enterScreen(SCREEN_TRIGGER_CAL, NULL, 0);
+  return (1);
+}
 
-  clearDisplay();
-  redraw = 1;
+int sDeadzone(menu *self) {
+  // stick deadzone configuration
+  enterScreen(SCREEN_EDIT, stickFields, sizeof(stickFields) / sizeof(EditField));
+  return (1);
+}
 
+int tDeadzone(menu *self) {
+  // trigger deadzone configuration
+  enterScreen(SCREEN_EDIT, triggerFields, sizeof(triggerFields) / sizeof(EditField));
   return (1);
 }
 
 int timerAdjust(menu *self) {
-  // draw deadzone configuration
-
-  redraw = 0;
-
-  char* cal_string = "Autoreset";
-  char tdata[5];
-
-  while(!gpio_get(ButtonInfos[0].InputIO));
-
-  while (gpio_get(ButtonInfos[0].InputIO)) {
-    clearDisplay();
-    putString(cal_string, 0, 0, color);
-    sprintf(tdata, "%03d seconds", autoResetTimer * 2);
-    putString(tdata, 0, 2, color);
-    updateDisplay();
-
-    if (!gpio_get(ButtonInfos[4].InputIO)){
-      if (autoResetTimer < 255)
-        autoResetTimer++;}
-    else if (!gpio_get(ButtonInfos[5].InputIO)){
-      if (autoResetTimer > 0)
-        autoResetTimer--;}
-    else if (!gpio_get(ButtonInfos[6].InputIO)){
-      if (autoResetTimer > 7)
-        autoResetTimer = autoResetTimer - 8;}
-    else if (!gpio_get(ButtonInfos[7].InputIO)){
-      if (autoResetTimer < 248)
-        autoResetTimer = autoResetTimer + 8;}
-
-    sleep_ms(60);
-  }
-
-  while(!gpio_get(ButtonInfos[0].InputIO));
-
-  updateFlashData();
-
-  clearDisplay();
-  redraw = 1;
+  // autoreset timeout
+  enterScreen(SCREEN_EDIT, timerFields, sizeof(timerFields) / sizeof(EditField));
+  return (1);
+}
 
+int paletteVMU(menu *self) {
+  // VMU colour theme, drawn over each page's palette colour, then the upscaler
+  if (vmuTheme >= THEME_COUNT) // erased flash
+    vmuTheme = THEME_SOLID;
+  if (vmuSmooth > 1)
+    vmuSmooth = 0;
+  enterScreen(SCREEN_EDIT, themeFields, sizeof(themeFields) / sizeof(EditField));
   return (1);
 }
 
@@ -495,16 +347,10 @@ int toggleOption(menu *self) {
 
       flipLockout = to_ms_since_boot(get_absolute_time());
 
-      cancel_repeating_timer(&redrawTimer);
       updateFlags();
-      updateFlashData();
+      queueFlashDataUpdate();
 
-      if(oledType)
-        ssd1331_init();
-      else ssd1306_init();
-      sleep_ms(100);
-
-      add_repeating_timer_ms(-10, rainbowCycle, NULL, &redrawTimer);
+      flipPending = true; // sent from menuTask() once the panel's DMA is idle
       return (1);
     } else
       return (1);
@@ -583,9 +429,9 @@ int tConfig(menu *self) {
   return (1);
 }
 
-static menu settings[11] = {
+static menu settings[12] = {
   {"Back          ", 2, 1, 1, 1, 1, mainmen}, 
-  {"Boot Video    ", 3, 1, 0, 1, 1, dummy},        
+  {"Boot Video    ", 1, 1, 0, 0, 1, toggleOption},
   {"Rumble        ", 1, 1, 0, 1, 1, toggleOption}, 
   {"VMU           ", 1, 1, 0, 1, 1, toggleOption}, 
   {"UI Color      ", 2, 1, 0, 1, 1, paletteUI}, // ssd1331 present
@@ -593,6 +439,7 @@ static menu settings[11] = {
   {"OLED Flip     ", 1, 0, 0, 0, 1, toggleOption},
   {"Autoreset     ", 1, 0, 0, 0, 1, toggleOption},
   {"Adjust Timeout", 2, 0, 0, 1, 1, timerAdjust},
+  {"Flash Err:  0", 3, 0, 0, 1, 1, dummy},
 
   #if HKT7700 
   {"Dev:  HKT-7700", 3, 0, 0, 1, 1, dummy},
@@ -622,6 +469,7 @@ void loadFlags() {
   settings[3].on = vmuEnable;
   settings[6].on = oledFlip;
   settings[7].on = autoResetEnable;
+  settings[1].on = bootVideo == 1; // erased flash reads 0xFF
 }
 
 void updateFlags() {
@@ -635,6 +483,7 @@ void updateFlags() {
   vmuEnable = settings[3].on;
   oledFlip = settings[6].on;
   autoResetEnable = settings[7].on;
+  bootVideo = settings[1].on;
 }
 
 void getSelectedEntry() {
@@ -664,25 +513,129 @@ void getLastVisibleEntry() {
   }
 }
 
+// What each of the five menu lines shows, so a tick only redraws the lines
+// that changed. shownColor is what they're drawn in
+typedef struct {
+  char name[sizeof(((menu *)0)->name) + 1]; // names may fill the array with no terminator
+  int type;                                 // -1 for a blank line
+  bool on;
+  bool cursor;
+} MenuLine;
+
+static MenuLine shownLines[MENU_LINES];
+static volatile bool shownValid = false;
+static uint16_t shownColor = 0;
+
+// Something else drew over the menu, e.g. a submenu screen, so the next tick draws all of it
+void invalidateMenu() { shownValid = false; }
+
 void redrawMenu() {
-  clearDisplay();
+  MenuLine lines[MENU_LINES];
+  int y0 = UI_H, y1 = 0;
 
-  int i = 0;
+  memset(lines, 0, sizeof(lines)); // padding too, lines are compared with memcmp
+  for (int iy = 0; iy < MENU_LINES; iy++)
+    lines[iy].type = -1;
 
+  // entryModifier counts down past zero as the list scrolls, so lines are mod 256
   for (uint8_t n = 0; n < currentNumEntries; n++) {
-    if (currentMenu[n].visible) {
-      putString(currentMenu[n].name, 0, n + entryModifier, color);
-      if (currentMenu[n].type == 1) // boolean type menu
-        drawToggle(n + entryModifier, color, currentMenu[n].on);
+    int iy = (int8_t)(n + entryModifier);
+    if (currentMenu[n].visible && iy >= 0 && iy < MENU_LINES) {
+      memcpy(lines[iy].name, currentMenu[n].name, sizeof(currentMenu[n].name));
+      lines[iy].type = currentMenu[n].type;
+      lines[iy].on = currentMenu[n].type == 1 && currentMenu[n].on;
     }
-    drawCursor(selectedEntry + entryModifier, color);
   }
-  updateDisplay();
+  int cursor = (int8_t)(selectedEntry + entryModifier);
+  if (cursor >= 0 && cursor < MENU_LINES)
+    lines[cursor].cursor = true;
+
+  // A colour step only matters on a colour panel, where every line has to
+  // be drawn again. A mono one shows any colour the same
+  bool recolor = shownValid && color != shownColor && !display->mono;
+  if (!shownValid)
+    clearDisplay();
+  if (recolor)
+    menuStats.recolors++;
+
+  for (int iy = 0; iy < MENU_LINES; iy++) {
+    if (shownValid && !recolor && !memcmp(&lines[iy], &shownLines[iy], sizeof(MenuLine)))
+      continue;
+
+    DisplayRect area = clearLine(iy);
+    if (lines[iy].type >= 0) {
+      putString(lines[iy].name, 0, iy, color);
+      if (lines[iy].type == 1) // boolean type menu
+        drawToggle(iy, color, lines[iy].on);
+    }
+    if (lines[iy].cursor)
+      drawCursor(iy, color);
+
+    y0 = MIN(y0, area.y0);
+    y1 = MAX(y1, area.y1);
+    menuStats.lines++;
+  }
+
+  if (!shownValid)
+    updateDisplay();
+  else if (y0 < y1)
+    updateDisplayRows(y0, y1);
+  if (y0 < y1)
+    menuStats.flushes++;
+
+  memcpy(shownLines, lines, sizeof(lines));
+  shownColor = color;
+  shownValid = true;
 }
 
 static uint16_t hue = 0;
 
+static void pushEvent(uint8_t button) {
+  if ((uint8_t)(eventHead - eventTail) < EVENT_QUEUE)
+    events[eventHead++ % EVENT_QUEUE] = button;
+}
+
+// Runs in the timer IRQ. A button counts once it reads the same on two
+// ticks in a row, and buttons already down when the menu opens (the Y +
+// Start that opened it) are ignored until they're let go
+static void sampleButtons() {
+  static uint16_t last = 0, stable = 0;
+  static uint8_t heldTicks = 0;
+  uint16_t now = 0;
+
+  for (int i = 0; i < NUM_BUTTONS; i++)
+    if (!gpio_get(ButtonInfos[i].InputIO))
+      now |= 1 << i;
+
+  if (resyncButtons) {
+    resyncButtons = false;
+    last = stable = now;
+    heldTicks = 0;
+    return;
+  }
+
+  uint16_t settled = ~(now ^ last);
+  uint16_t next = (stable & ~settled) | (now & settled);
+  uint16_t pressed = next & ~stable;
+  last = now;
+
+  if ((next & DPAD_BITS) != (stable & DPAD_BITS))
+    heldTicks = 0;
+  else if (next & DPAD_BITS)
+    heldTicks++;
+  if (heldTicks == REPEAT_DELAY_TICKS) {
+    pressed |= next & DPAD_BITS;
+    heldTicks -= REPEAT_TICKS;
+  }
+  stable = next;
+
+  for (int i = 0; i < NUM_BUTTONS; i++)
+    if (pressed & (1 << i))
+      pushEvent(i);
+}
+
 bool rainbowCycle(struct repeating_timer *t) {
+  uint32_t start = time_us_32();
   static uint8_t r = 0x00;
   static uint8_t g = 0x00;
   static uint8_t b = 0x00;
@@ -696,13 +649,153 @@ bool rainbowCycle(struct repeating_timer *t) {
   else
     hue++;
 
-  if (redraw)
-    redrawMenu();
+  sampleButtons();
+  tickPending = true;
+
+  uint32_t took = time_us_32() - start;
+  menuStats.ticks++;
+  if (took > menuStats.maxTickUs)
+    menuStats.maxTickUs = took;
 
   return (true);
 }
 
-void runMenu() {
+static void closeMenu() {
+  cancel_repeating_timer(&redrawTimer);
+  screen = SCREEN_CLOSED;
+
+  updateFlags();
+  queueFlashDataUpdate();
+  if (vmuEnable && !vmuWasEnabled)
+    PageCycle = true; // load the VMU and reconnect it, same as a page change
+
+  lcdCover(false);
+}
+
+static void listButton(int button) {
+  if (button == BUTTON_UP) {
+    /* check currently selected entry
+    if element is not the top one, deselect current entry
+    and select the first enabled entry above it */
+    if (selectedEntry) { // i.e. not 0
+      currentMenu[selectedEntry].selected = false;
+      currentMenu[selectedEntry - 1].selected = true;
+
+      getFirstVisibleEntry();
+      if ((selectedEntry == firstVisibleEntry) && (firstVisibleEntry)) {
+        currentMenu[firstVisibleEntry + 4].visible = false;
+        currentMenu[firstVisibleEntry - 1].visible = true;
+        entryModifier++;
+      }
+    }
+  }
+
+  else if (button == BUTTON_DOWN) {
+    /* check currently selected entry
+    if entry is not the bottom one, deselect current entry
+    and select first enabled entry below it */
+    if (selectedEntry < currentNumEntries - 1) {
+      currentMenu[selectedEntry].selected = false;
+      currentMenu[selectedEntry + 1].selected = true;
+
+      getLastVisibleEntry();
+      if ((selectedEntry == lastVisibleEntry) && (lastVisibleEntry < currentNumEntries)) {
+        currentMenu[lastVisibleEntry - 4].visible = false;
+        currentMenu[lastVisibleEntry + 1].visible = true;
+        entryModifier--;
+      }
+    }
+  }
+
+  else if (button == BUTTON_A) {
+    /* check currently selected entry
+    if entry is enabled, run entry's function
+    entry functions should set currentMenu if they enter a submenu. */
+    if (currentMenu[selectedEntry].enabled)
+      if (!currentMenu[selectedEntry].run(&currentMenu[selectedEntry]))
+        closeMenu();
+  }
+  /* Entrys' functions should all return 1 except for mainMenu.exitToPad,
+  which should return 0 and close the menu. */
+
+  getSelectedEntry(); // where to draw cursor
+}
+
+static void menuButton(int button) {
+  switch (screen) {
+  case SCREEN_LIST:
+    listButton(button);
+    break;
+  case SCREEN_STICK_CAL:
+    stickCalButton(button);
+    break;
+  case SCREEN_TRIGGER_CAL:
+    triggerCalButton(button);
+    break;
+  case SCREEN_EDIT:
+    editButton(button);
+    break;
+  default:
+    break;
+  }
+}
+
+static void menuTick() {
+  switch (screen) {
+  case SCREEN_LIST:
+    redrawMenu();
+    return;
+  case SCREEN_STICK_CAL:
+    stickCalTick();
+    if (!stepDrawn)
+      drawStickCal();
+    break;
+  case SCREEN_TRIGGER_CAL:
+    if (!stepDrawn)
+      drawTriggerCal();
+    break;
+  case SCREEN_EDIT:
+    if (!stepDrawn)
+      drawEdit();
+    break;
+  default:
+    return;
+  }
+  stepDrawn = true;
+}
+
+bool menuActive() { return screen != SCREEN_CLOSED; }
+
+// One button event or one redraw per call, so a Maple packet never waits
+// long. Returns true if there was something to do
+bool menuTask() {
+  if (screen == SCREEN_CLOSED)
+    return false;
+
+  uint32_t start = time_us_32();
+
+  if (flipPending && display->setFlip()) {
+    flipPending = false;
+    invalidateMenu();
+  } else if (eventTail != eventHead) {
+    menuButton(events[eventTail++ % EVENT_QUEUE]);
+  } else if (tickPending) {
+    tickPending = false;
+    menuTick();
+  } else {
+    return false;
+  }
+
+  uint32_t took = time_us_32() - start;
+  menuStats.steps++;
+  menuStats.lastUs = took;
+  menuStats.totalUs += took;
+  if (took > menuStats.maxUs)
+    menuStats.maxUs = took;
+  return true;
+}
+
+void openMenu() {
 
   // Check for menu button combo (Start + Down + B)
 
@@ -760,10 +853,14 @@ void runMenu() {
 
   loadFlags();
 
-  if (oledType) { // SSD1331
-    strcpy(settings[5].name, "OLED: SSD1331");
-  } else { // SSD1306
-    strcpy(settings[5].name, "OLED: SSD1306");
+  snprintf(settings[9].name, sizeof(settings[9].name), "Flash Err:%3d", flashErrors);
+
+  snprintf(settings[5].name, sizeof(settings[5].name), "OLED: %s", display->name);
+
+  settings[1].enabled = !display->mono; // no boot animation on the SSD1306
+  mainMenu[3].enabled = !display->mono; // or colour themes
+
+  if (!oledType) { // SSD1306
 
     // disable color-only menu entries
     //mainMenu[3].enabled = false;
@@ -771,70 +868,18 @@ void runMenu() {
 
   }
 
-  // negative interval means the callback func is called every 10ms regardless of how long callback takes to execute
-  add_repeating_timer_ms(-10, rainbowCycle, NULL, &redrawTimer);
-
-  while (1) {
-    getSelectedEntry(); // where to draw cursor
-    // redrawMenu(); // called by redrawTimer
+  getSelectedEntry();
+  vmuWasEnabled = vmuEnable;
+  eventHead = eventTail = 0;
+  tickPending = false;
+  resyncButtons = true;
+  memset(&menuStats, 0, sizeof(menuStats));
 
-    // Wait for A button release (submenu rate-limit)
-    while (!gpio_get(ButtonInfos[0].InputIO));
+  animStop(); // the menu takes over the screen
+  lcdCover(true);
+  invalidateMenu();
+  screen = SCREEN_LIST;
 
-    uint8_t pressed = 0;
-    do {
-      for (int i = 0; i < 9; i++) {
-        pressed |= (!gpio_get(ButtonInfos[i].InputIO));
-      }
-    } while (!pressed);
-
-    sleep_ms(75); // Wait out switch bounce + rate-limiting
-
-    if (!gpio_get(ButtonInfos[4].InputIO)) { // Up
-      /* check currently selected entry
-      if element is not the top one, deselect current entry
-      and select the first enabled entry above it */
-      if (selectedEntry) { // i.e. not 0
-        currentMenu[selectedEntry].selected = false;
-        currentMenu[selectedEntry - 1].selected = true;
-
-        getFirstVisibleEntry();
-        if ((selectedEntry == firstVisibleEntry) && (firstVisibleEntry)) {
-          currentMenu[firstVisibleEntry + 4].visible = false;
-          currentMenu[firstVisibleEntry - 1].visible = true;
-          entryModifier++;
-        }
-      }
-
-    }
-
-    else if (!gpio_get(ButtonInfos[5].InputIO)) { // Down
-      /* check currently selected entry
-      if entry is not the bottom one, deselect current entry
-      and select first enabled entry below it */
-      if (selectedEntry < currentNumEntries - 1) {
-        currentMenu[selectedEntry].selected = false;
-        currentMenu[selectedEntry + 1].selected = true;
-
-        getLastVisibleEntry();
-        if ((selectedEntry == lastVisibleEntry) && (lastVisibleEntry < currentNumEntries)) {
-          currentMenu[lastVisibleEntry - 4].visible = false;
-          currentMenu[lastVisibleEntry + 1].visible = true;
-          entryModifier--;
-        }
-      }
-    }
-
-    else if (!gpio_get(ButtonInfos[0].InputIO)) { // A
-      /* check currently selected entry
-      if entry is enabled, run entry's function
-      entry functions should set currentMenu if they enter a submenu. */
-      if (currentMenu[selectedEntry].enabled)
-        if (!currentMenu[selectedEntry].run(&currentMenu[selectedEntry]))
-          break;
-    }
-    /* Entrys' functions should all return 1 except for mainMenu.exitToPad,
-    which should return 0 and result in a break from this while loop. */
-  }
-  cancel_repeating_timer(&redrawTimer);
+  // negative interval means the callback func is called every 10ms regardless of how long callback takes to execute
+  add_repeating_timer_ms(-10, rainbowCycle, NULL, &redrawTimer);
 }
@@ -50,6 +50,13 @@
 #define autoResetEnable flashData[31]
 #define autoResetTimer flashData[32] // units are 2s, max value 8.5 minutes
 #define version flashData[33]
+#define settingsImport flashData[34] // SETTINGS_IMPORT_MAGIC when written by tools/make_image
+#define flashErrors flashData[35] // bad VMU sectors found by the flash scrubber (and rewritten) or on loading a page
+#define bootVideo flashData[36]   // play the boot animation instead of the splash, colour panels only
+#define vmuTheme flashData[37]    // VMU screen colour theme (theme.h), over each page's palette colour
+#define vmuSmooth flashData[38]   // 1: VMU screen upscaled with Scale2x rather than doubled, colour panels only
+
+#define SETTINGS_IMPORT_MAGIC 0xA5
 
 extern ButtonInfo ButtonInfos[];
 
@@ -65,6 +72,22 @@ struct menu_s {
   int (*run)(menu *self);
 };
 
+#define MENU_LINES 5 // lines on screen at once
+
+typedef struct {
+  uint32_t ticks;     // rainbowCycle calls, one per 10 ms
+  uint32_t maxTickUs; // longest rainbowCycle, the time the menu takes in IRQ context
+  uint32_t steps;     // menuTask calls that did something
+  uint32_t lines;     // menu lines redrawn
+  uint32_t recolors;  // colour steps, which redraw every line on a colour panel
+  uint32_t flushes;   // updates sent to the panel
+  uint32_t lastUs;    // time in the last step
+  uint32_t maxUs;     // longest step, the most a Maple response can be held up
+  uint32_t totalUs;   // time in all steps, load = totalUs / (ticks * 10000)
+} MenuStats;
+
+extern MenuStats menuStats;
+
 int paletteVMU(menu *);
 
 int paletteUI(menu *);
@@ -97,8 +120,14 @@ void loadFlags(void);
 
 void updateFlags(void);
 
+void invalidateMenu(void);
+
 void redrawMenu(void);
 
 bool rainbowCycle(struct repeating_timer *);
 
-void runMenu(void);
\ No newline at end of file
+void openMenu(void);
+
+bool menuActive(void);
+
+bool menuTask(void);
\ No newline at end of file
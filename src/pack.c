@@ -0,0 +1,57 @@
+/* pack.c
+ *  packed splash image decoder
+ *
+ *  A line only ever refers back to the one above it, so a panel can be fed
+ *  from two line buffers: one decoding while DMA sends the other
+ */
+
+#include <string.h>
+
+#include "pack.h"
+
+const uint8_t *unpackLine(const PackedImage *img, const uint8_t *src, uint8_t *line, const uint8_t *above) {
+  const int unit = img->unit;
+  uint8_t *const start = line;
+  uint8_t *const end = line + img->width * unit;
+
+  while (line < end) {
+    const int op = *src >> 6;
+    const int n = ((*src++ & (PACK_MAX - 1)) + 1) * unit;
+
+    switch (op) {
+    case PACK_LITERAL:
+      memcpy(line, src, n);
+      src += n;
+      break;
+    case PACK_RUN:
+      if (unit == 1) {
+        memset(line, *src, n);
+      } else {
+        uint16_t pixel, *p = (uint16_t *)line;
+        memcpy(&pixel, src, 2); // data is byte aligned
+        for (int i = 0; i < n; i += 2)
+          *p++ = pixel;
+      }
+      src += unit;
+      break;
+    case PACK_UP:
+      memcpy(line, above + (line - start), n);
+      break;
+    default: // PACK_SKIP
+      break;
+    }
+    line += n;
+  }
+  return src;
+}
+
+void unpackImage(const PackedImage *img, uint8_t *dst, int stride) {
+  const uint8_t *src = img->data;
+  const uint8_t *above = NULL;
+
+  for (int y = 0; y < img->height; y++) {
+    src = unpackLine(img, src, dst, above);
+    above = dst;
+    dst += stride;
+  }
+}
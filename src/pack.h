@@ -0,0 +1,51 @@
+/* pack.h
+ *  packed splash images and animations: run length and copy-from-above
+ *  codes over whole pixels, decoded a line at a time (no SDK dependencies
+ *  so they can be built and checked on a PC)
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+// Each line is a string of codes, never running into the next line. A code
+// is one byte, the top two bits saying what it is and the low six how many
+// units (1 to 64) it covers
+#define PACK_LITERAL 0 // followed by that many units
+#define PACK_RUN 1     // followed by one unit, repeated
+#define PACK_UP 2      // same as the line above
+#define PACK_SKIP 3    // leave what's there, unchanged since the last frame
+#define PACK_MAX 64
+
+// Made by tools/pack_image. A unit is a pixel for RGB565 (2 bytes, panel
+// byte order) or a column of eight for the SSD1306, whose lines are its pages
+typedef struct {
+  uint16_t width;  // units per line
+  uint16_t height; // lines
+  uint8_t unit;    // bytes per unit, 1 or 2
+  uint32_t size;   // packed bytes
+  const uint8_t *data;
+} PackedImage;
+
+// One animation frame: lines [y0, y1) changed since the frame before and
+// are coded against it, PACK_SKIP where a pixel didn't. The first frame is
+// coded in full. Nothing changed when y0 == y1
+typedef struct {
+  uint16_t y0, y1;
+  uint32_t offset; // where its codes start in image.data
+} PackedFrame;
+
+typedef struct {
+  PackedImage image; // frame size, and the codes for all of them
+  uint16_t frameCount;
+  uint16_t frameMs; // fixed interval between frames
+  const PackedFrame *frames;
+} PackedAnimation;
+
+// Decodes the line starting at src into line, which must be 2 byte aligned
+// for RGB565. above is the previous line as decoded, NULL on the first.
+// Returns where the next line starts
+const uint8_t *unpackLine(const PackedImage *img, const uint8_t *src, uint8_t *line, const uint8_t *above);
+
+// Whole image, lines stride bytes apart
+void unpackImage(const PackedImage *img, uint8_t *dst, int stride);
@@ -0,0 +1,211 @@
+/* raster.c
+ *  integer line and ellipse rasterisers, Q15 sine and a binary angle atan2
+ *
+ *  The M0+ has no FPU, so everything here is adds, shifts and the odd
+ *  multiply. The old float routines cost 120 soft-float sin/cos pairs per
+ *  ellipse
+ */
+
+#include <stdlib.h>
+
+#include "raster.h"
+
+// sin() over the first quarter turn, Q15, ANGLE_TURN / 4 + 1 entries
+static const int16_t sineTable[ANGLE_TURN / 4 + 1] = {
+    0, 201, 402, 603, 804, 1005, 1206, 1407, 1608, 1809, 2009, 2210,
+    2410, 2611, 2811, 3012, 3212, 3412, 3612, 3811, 4011, 4210, 4410, 4609,
+    4808, 5007, 5205, 5404, 5602, 5800, 5998, 6195, 6393, 6590, 6786, 6983,
+    7179, 7375, 7571, 7767, 7962, 8157, 8351, 8545, 8739, 8933, 9126, 9319,
+    9512, 9704, 9896, 10087, 10278, 10469, 10659, 10849, 11039, 11228, 11417, 11605,
+    11793, 11980, 12167, 12353, 12539, 12725, 12910, 13094, 13279, 13462, 13645, 13828,
+    14010, 14191, 14372, 14553, 14732, 14912, 15090, 15269, 15446, 15623, 15800, 15976,
+    16151, 16325, 16499, 16673, 16846, 17018, 17189, 17360, 17530, 17700, 17869, 18037,
+    18204, 18371, 18537, 18703, 18868, 19032, 19195, 19357, 19519, 19680, 19841, 20000,
+    20159, 20317, 20475, 20631, 20787, 20942, 21096, 21250, 21403, 21554, 21705, 21856,
+    22005, 22154, 22301, 22448, 22594, 22739, 22884, 23027, 23170, 23311, 23452, 23592,
+    23731, 23870, 24007, 24143, 24279, 24413, 24547, 24680, 24811, 24942, 25072, 25201,
+    25329, 25456, 25582, 25708, 25832, 25955, 26077, 26198, 26319, 26438, 26556, 26674,
+    26790, 26905, 27019, 27133, 27245, 27356, 27466, 27575, 27683, 27790, 27896, 28001,
+    28105, 28208, 28310, 28411, 28510, 28609, 28706, 28803, 28898, 28992, 29085, 29177,
+    29268, 29358, 29447, 29534, 29621, 29706, 29791, 29874, 29956, 30037, 30117, 30195,
+    30273, 30349, 30424, 30498, 30571, 30643, 30714, 30783, 30852, 30919, 30985, 31050,
+    31113, 31176, 31237, 31297, 31356, 31414, 31470, 31526, 31580, 31633, 31685, 31736,
+    31785, 31833, 31880, 31926, 31971, 32014, 32057, 32098, 32137, 32176, 32213, 32250,
+    32285, 32318, 32351, 32382, 32412, 32441, 32469, 32495, 32521, 32545, 32567, 32589,
+    32609, 32628, 32646, 32663, 32678, 32692, 32705, 32717, 32728, 32737, 32745, 32752,
+    32757, 32761, 32765, 32766, 32767};
+
+int sinQ15(int angle) {
+  const int quarter = ANGLE_TURN / 4;
+  int i = angle & (quarter - 1);
+
+  switch ((angle & (ANGLE_TURN - 1)) / quarter) {
+  case 0:
+    return sineTable[i];
+  case 1:
+    return sineTable[quarter - i];
+  case 2:
+    return -sineTable[i];
+  default:
+    return -sineTable[quarter - i];
+  }
+}
+
+int cosQ15(int angle) { return sinQ15(angle + ANGLE_TURN / 4); }
+
+// atan(t) ~ t * pi/4 + t * (1 - t) * (0.2447 + 0.0663 * t) on [0, 1], within
+// 0.0015 rad. In binary angle units that's t * 128 + t * (1 - t) * (39.88 + 10.81 * t)
+int atan2Angle(int y, int x) {
+  int ax = abs(x), ay = abs(y);
+  int t, a;
+
+  if (ax == 0 && ay == 0)
+    return 0;
+
+  t = (ax >= ay) ? (ay << 15) / ax : (ax << 15) / ay;       // Q15, first octant
+  a = ((t * (32768 - t)) >> 15) * (40837 + ((11069 * t) >> 15)); // t * (1 - t) * (...), Q25
+  a = ((t << 7) + (a >> 10) + (1 << 14)) >> 15;
+
+  if (ay > ax)
+    a = ANGLE_TURN / 4 - a;
+  if (x < 0)
+    a = ANGLE_TURN / 2 - a;
+  if (y < 0)
+    a = ANGLE_TURN - a;
+  return a & (ANGLE_TURN - 1);
+}
+
+void rasterLine(int x0, int y0, int x1, int y1, RasterSpan span, void *ctx) {
+  const int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+  const int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+  int err = dx + dy;
+  int runX = x0; // pixels from runX to x0 on row y0 are plotted but not sent yet
+
+  while (x0 != x1 || y0 != y1) {
+    const int e2 = 2 * err;
+    const int lastX = x0;
+
+    if (e2 >= dy) {
+      err += dy;
+      x0 += sx;
+    }
+    if (e2 <= dx) {
+      err += dx;
+      span(ctx, runX < lastX ? runX : lastX, runX < lastX ? lastX : runX, y0);
+      y0 += sy;
+      runX = x0;
+    }
+  }
+  span(ctx, runX < x0 ? runX : x0, runX < x0 ? x0 : runX, y0);
+}
+
+// Row y of the ellipse touches x from -outer to -inner either side of xc
+static void ellipseRow(int xc, int yc, int y, int outer, int inner, bool fill, RasterSpan span, void *ctx) {
+  if (fill || inner <= 0) {
+    span(ctx, xc - outer, xc + outer, yc + y);
+    if (y)
+      span(ctx, xc - outer, xc + outer, yc - y);
+    return;
+  }
+  span(ctx, xc - outer, xc - inner, yc + y);
+  span(ctx, xc + inner, xc + outer, yc + y);
+  if (y) {
+    span(ctx, xc - outer, xc - inner, yc - y);
+    span(ctx, xc + inner, xc + outer, yc - y);
+  }
+}
+
+// Zingl's midpoint ellipse, one quadrant from (-rx, 0) to (0, ry) mirrored.
+// The error terms stay under 2 * rx * ry^2, fine in 32 bits for any panel
+void rasterEllipse(int xc, int yc, int rx, int ry, bool fill, RasterSpan span, void *ctx) {
+  const int32_t a2 = (int32_t)rx * rx, b2 = (int32_t)ry * ry;
+  int x = -rx, y = 0;
+  int rowX = x; // first x on row y
+  int32_t err = x * (2 * b2 + x) + b2;
+
+  if (rx <= 0 || ry <= 0) {
+    rasterLine(xc - abs(rx), yc - abs(ry), xc + abs(rx), yc + abs(ry), span, ctx);
+    return;
+  }
+
+  do {
+    const int32_t e2 = 2 * err;
+    const int lastX = x;
+
+    if (e2 >= (x * 2 + 1) * b2)
+      err += (++x * 2 + 1) * b2;
+    if (e2 <= (y * 2 + 1) * a2) {
+      err += (++y * 2 + 1) * a2;
+      ellipseRow(xc, yc, y - 1, -rowX, -lastX, fill, span, ctx);
+      rowX = x;
+    } else if (x > 0) {
+      ellipseRow(xc, yc, y, -rowX, -lastX, fill, span, ctx);
+    }
+  } while (x <= 0);
+
+  while (y++ < ry) // flat ellipses stop early, finish the tips
+    ellipseRow(xc, yc, y, 0, 0, fill, span, ctx);
+}
+
+#define ELLIPSE_SIDES 64
+
+// Row extents of a rotated ellipse, gathered from its outline before filling
+static int16_t fillLeft[2 * 127 + 1], fillRight[2 * 127 + 1];
+
+static void fillEdge(void *ctx, int x0, int x1, int y) {
+  const int i = y - *(int *)ctx;
+
+  if (x0 < fillLeft[i])
+    fillLeft[i] = x0;
+  if (x1 > fillRight[i])
+    fillRight[i] = x1;
+}
+
+void rasterEllipseRotated(int xc, int yc, int rx, int ry, int angle, bool fill, RasterSpan span, void *ctx) {
+  int s, c, r, top;
+  int lastX = 0, lastY = 0;
+
+  angle &= ANGLE_TURN - 1;
+  if ((angle & (ANGLE_TURN / 4 - 1)) == 0) {
+    if (angle & (ANGLE_TURN / 4))
+      rasterEllipse(xc, yc, ry, rx, fill, span, ctx);
+    else
+      rasterEllipse(xc, yc, rx, ry, fill, span, ctx);
+    return;
+  }
+
+  rx = rx < 0 ? 0 : rx > 127 ? 127 : rx;
+  ry = ry < 0 ? 0 : ry > 127 ? 127 : ry;
+  r = rx > ry ? rx : ry;
+  top = yc - r;
+  if (fill) {
+    for (int i = 0; i <= 2 * r; i++) {
+      fillLeft[i] = INT16_MAX;
+      fillRight[i] = INT16_MIN;
+    }
+  }
+
+  s = sinQ15(angle);
+  c = cosQ15(angle);
+  for (int i = 0; i <= ELLIPSE_SIDES; i++) {
+    // Q8 before rotating so the products stay in 32 bits
+    const int ex = (rx * cosQ15(i * (ANGLE_TURN / ELLIPSE_SIDES)) + 64) >> 7;
+    const int ey = (ry * sinQ15(i * (ANGLE_TURN / ELLIPSE_SIDES)) + 64) >> 7;
+    const int x = xc + ((ex * c - ey * s + (1 << 22)) >> 23);
+    const int y = yc + ((ex * s + ey * c + (1 << 22)) >> 23);
+
+    if (i) {
+      if (fill)
+        rasterLine(lastX, lastY, x, y, fillEdge, &top);
+      else
+        rasterLine(lastX, lastY, x, y, span, ctx);
+    }
+    lastX = x;
+    lastY = y;
+  }
+
+  if (fill)
+    for (int i = 0; i <= 2 * r; i++)
+      if (fillLeft[i] <= fillRight[i])
+        span(ctx, fillLeft[i], fillRight[i], top + i);
+}
@@ -0,0 +1,40 @@
+/* raster.h
+ *  integer line and ellipse rasterisers, Q15 sine and a binary angle atan2
+ *  (no SDK dependencies so they can be built and checked on a PC)
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Angles are binary, ANGLE_TURN per full turn, so wrapping is a mask.
+// 0 points along +x and angles grow towards +y
+#define ANGLE_TURN 1024
+#define ANGLE_FROM_DEGREES(d) ((d) * ANGLE_TURN / 360)
+
+#define Q15_ONE 32767
+
+// Shapes come out as inclusive horizontal spans x0 <= x1 on row y, so a
+// filled shape is one fillRect per row and an outline is no dearer than
+// plotting it. Spans aren't clipped
+typedef void (*RasterSpan)(void *ctx, int x0, int x1, int y);
+
+// sin and cos of a binary angle, -Q15_ONE..Q15_ONE
+int sinQ15(int angle);
+int cosQ15(int angle);
+
+// Binary angle 0..ANGLE_TURN-1 of the vector (x, y), within 1 unit.
+// |x| and |y| must be below 65536, (0, 0) gives 0
+int atan2Angle(int y, int x);
+
+// Bresenham, both ends included, one span per row touched
+void rasterLine(int x0, int y0, int x1, int y1, RasterSpan span, void *ctx);
+
+// Midpoint ellipse with radii rx, ry (a circle when equal), outline or
+// filled. Each row is sent once when filled
+void rasterEllipse(int xc, int yc, int rx, int ry, bool fill, RasterSpan span, void *ctx);
+
+// Ellipse rotated by a binary angle. Multiples of a quarter turn go through
+// rasterEllipse(), anything else is a 64-sided polygon. Radii up to 127
+void rasterEllipseRotated(int xc, int yc, int rx, int ry, int angle, bool fill, RasterSpan span, void *ctx);
@@ -0,0 +1,124 @@
+/* scrub.c
+ *  background flash scrubber and the checksum log it checks against
+ */
+
+#include "scrub.h"
+
+uint32_t sectorChecksum(const uint32_t *Words, uint32_t NumWords, uint32_t Checksum) {
+  for (uint32_t i = 0; i < NumWords; i++)
+    Checksum = ((Checksum << 1) | (Checksum >> 31)) ^ Words[i];
+  return Checksum;
+}
+
+void scrubReset(ScrubState *Scrub) {
+  Scrub->Sector = 0;
+  Scrub->Offset = 0;
+  Scrub->Checksum = 0;
+}
+
+void scrubSectorWritten(ScrubState *Scrub, uint32_t Sector) {
+  if (Sector == Scrub->Sector) {
+    Scrub->Offset = 0;
+    Scrub->Checksum = 0;
+  }
+}
+
+int scrubPoll(ScrubState *Scrub, const uint8_t *(*Chunk)(uint32_t Offset), const uint32_t *Checksums, uint32_t Dirty) {
+  int Bad = -1;
+
+  if (++Scrub->PollsSinceStep < SCRUB_INTERVAL)
+    return -1;
+  Scrub->PollsSinceStep = 0;
+
+  const uint32_t *Words = (const uint32_t *)Chunk(Scrub->Sector * SCRUB_SECTOR_SIZE + Scrub->Offset);
+  Scrub->Checksum = sectorChecksum(Words, SCRUB_CHUNK / sizeof(uint32_t), Scrub->Checksum);
+  Scrub->Offset += SCRUB_CHUNK;
+
+  if (Scrub->Offset == SCRUB_SECTOR_SIZE) {
+    // Dirty sectors are expected to differ until they're flushed
+    if (!(Dirty & (1u << Scrub->Sector))) {
+      Scrub->SectorsChecked++;
+      if (Scrub->Checksum != Checksums[Scrub->Sector]) {
+        Scrub->SectorsBad++;
+        Bad = Scrub->Sector;
+      }
+    }
+    Scrub->Sector = (Scrub->Sector + 1) % SCRUB_SECTORS;
+    Scrub->Offset = 0;
+    Scrub->Checksum = 0;
+  }
+  return Bad;
+}
+
+static uint16_t RecordCheck(uint32_t Slot, uint32_t Checksum) { return ~(Slot ^ Checksum ^ (Checksum >> 16)); }
+
+void checksumLoad(ChecksumTable *Table, const ChecksumRecord *Log) {
+  for (uint32_t Page = 0; Page < CHECKSUM_PAGES; Page++) {
+    Table->Known[Page] = 0;
+    Table->Unlogged[Page] = 0;
+  }
+  Table->Next = 0;
+
+  for (uint32_t i = 0; i < CHECKSUM_RECORDS; i++) {
+    ChecksumRecord Record = Log[i];
+    if (Record.Checksum == 0xFFFFFFFF && Record.Slot == 0xFFFF && Record.Check == 0xFFFF)
+      continue; // erased
+    Table->Next = i + 1; // appending carries on after anything programmed, torn or not
+    if (Record.Slot >= CHECKSUM_PAGES * SCRUB_SECTORS || Record.Check != RecordCheck(Record.Slot, Record.Checksum))
+      continue;
+    uint32_t Page = Record.Slot / SCRUB_SECTORS, Sector = Record.Slot % SCRUB_SECTORS;
+    Table->Sums[Page][Sector] = Record.Checksum;
+    Table->Known[Page] |= 1u << Sector;
+  }
+}
+
+int checksumSet(ChecksumTable *Table, uint32_t Page, uint32_t Sector, uint32_t Checksum) {
+  uint32_t Bit = 1u << Sector;
+  int Differs = 0;
+
+  if (Table->Known[Page] & Bit) {
+    if (Table->Sums[Page][Sector] == Checksum)
+      return 0;
+    Differs = 1;
+  }
+  Table->Sums[Page][Sector] = Checksum;
+  Table->Known[Page] |= Bit;
+  Table->Unlogged[Page] |= Bit;
+  return Differs;
+}
+
+int checksumLogNext(ChecksumTable *Table, ChecksumRecord *Records) {
+  uint32_t Pending = 0;
+  for (uint32_t Page = 0; Page < CHECKSUM_PAGES; Page++)
+    Pending += __builtin_popcount(Table->Unlogged[Page]);
+  if (!Pending)
+    return -1;
+  if (Table->Next + Pending > CHECKSUM_RECORDS)
+    return CHECKSUM_LOG_FULL; // at most 256 after an erase, so they always fit then
+
+  for (uint32_t i = 0; i < CHECKSUM_PAGE_RECORDS; i++) {
+    Records[i].Checksum = 0xFFFFFFFF;
+    Records[i].Slot = 0xFFFF;
+    Records[i].Check = 0xFFFF;
+  }
+
+  // Fill from the next free record to the end of its flash page
+  uint32_t First = Table->Next - Table->Next % CHECKSUM_PAGE_RECORDS;
+  for (uint32_t Page = 0; Page < CHECKSUM_PAGES && Table->Next < First + CHECKSUM_PAGE_RECORDS; Page++) {
+    while (Table->Unlogged[Page] && Table->Next < First + CHECKSUM_PAGE_RECORDS) {
+      uint32_t Sector = __builtin_ctz(Table->Unlogged[Page]);
+      ChecksumRecord *Record = &Records[Table->Next++ - First];
+      Record->Slot = Page * SCRUB_SECTORS + Sector;
+      Record->Checksum = Table->Sums[Page][Sector];
+      Record->Check = RecordCheck(Record->Slot, Record->Checksum);
+      Table->Unlogged[Page] &= ~(1u << Sector);
+    }
+  }
+  return First * sizeof(ChecksumRecord);
+}
+
+void checksumLogErased(ChecksumTable *Table) {
+  for (uint32_t Page = 0; Page < CHECKSUM_PAGES; Page++)
+    Table->Unlogged[Page] = Table->Known[Page];
+  Table->Next = 0;
+}
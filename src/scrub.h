@@ -0,0 +1,79 @@
+/* scrub.h
+ *  background flash scrubber for the current VMU page: each sector in flash
+ *  is checked a chunk at a time against the checksum logged when it was last
+ *  programmed. The checksums of all pages live in a log sector of their own,
+ *  so a sector that goes bad while its page isn't loaded (or across a power
+ *  cycle) is caught when the page is read back in. No SDK dependencies so it
+ *  can be built and checked on a PC
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#define SCRUB_SECTOR_SIZE 4096 // FLASH_SECTOR_SIZE
+#define SCRUB_SECTORS 32       // sectors in a 128KB page
+#define SCRUB_INTERVAL 4       // Controller polls between scrub steps
+#define SCRUB_CHUNK 512        // Bytes of flash verified per scrub step
+
+#define CHECKSUM_PAGES 8        // VMU pages
+#define CHECKSUM_LOG_SIZE 4096  // FLASH_SECTOR_SIZE, the log is one sector
+#define CHECKSUM_LOG_PAGE 256   // FLASH_PAGE_SIZE, the log is programmed a page at a time
+#define CHECKSUM_LOG_FULL (-2)  // checksumLogNext(): erase the log first
+
+typedef struct ScrubState_s {
+  uint32_t Sector;
+  uint32_t Offset;
+  uint32_t Checksum;
+  uint32_t PollsSinceStep;
+  uint32_t SectorsChecked; // telemetry
+  uint32_t SectorsBad;     // telemetry
+} ScrubState;
+
+// One checksum in the log. Records are appended as sectors get programmed (programming only
+// clears bits so the rest of a flash page is written as 0xFF) and the last one for a slot wins
+typedef struct ChecksumRecord_s {
+  uint32_t Checksum;
+  uint16_t Slot;  // page * SCRUB_SECTORS + sector
+  uint16_t Check; // catches a record torn by a power cut
+} ChecksumRecord;
+
+#define CHECKSUM_RECORDS (CHECKSUM_LOG_SIZE / sizeof(ChecksumRecord))
+#define CHECKSUM_PAGE_RECORDS (CHECKSUM_LOG_PAGE / sizeof(ChecksumRecord))
+
+typedef struct ChecksumTable_s {
+  uint32_t Sums[CHECKSUM_PAGES][SCRUB_SECTORS];
+  uint32_t Known[CHECKSUM_PAGES];    // sectors with a checksum
+  uint32_t Unlogged[CHECKSUM_PAGES]; // sectors whose checksum isn't in the log yet
+  uint32_t Next;                     // first free record in the log
+} ChecksumTable;
+
+uint32_t sectorChecksum(const uint32_t *Words, uint32_t NumWords, uint32_t Checksum);
+
+// Start again from the first sector, e.g. when another page has been read in
+void scrubReset(ScrubState *Scrub);
+
+// Sector was just programmed (or found unchanged) and its checksum updated. A pass part way
+// through it has old data in its running checksum, so that sector starts over
+void scrubSectorWritten(ScrubState *Scrub, uint32_t Sector);
+
+// Called once per controller poll. Every SCRUB_INTERVAL polls, checksums the next SCRUB_CHUNK
+// bytes of the page as programmed, from where Chunk says that part of the page is in flash (a
+// chunk is one store block). When a sector is complete it's compared against Checksums, unless
+// it's in Dirty (waiting to be flushed, so expected to differ). Returns the sector found bad, or -1
+int scrubPoll(ScrubState *Scrub, const uint8_t *(*Chunk)(uint32_t Offset), const uint32_t *Checksums, uint32_t Dirty);
+
+// Rebuild the table from the log sector as it is in flash
+void checksumLoad(ChecksumTable *Table, const ChecksumRecord *Log);
+
+// Record a sector's checksum (Page counts from 0), to be logged by checksumLogNext().
+// Returns 1 if a different checksum was on record for it
+int checksumSet(ChecksumTable *Table, uint32_t Page, uint32_t Sector, uint32_t Checksum);
+
+// Fills Records (CHECKSUM_PAGE_RECORDS of them) with the next flash page of the log to program.
+// Returns its offset into the log, CHECKSUM_LOG_FULL when the log has to be erased (and
+// checksumLogErased() called) first, or -1 when everything is logged
+int checksumLogNext(ChecksumTable *Table, ChecksumRecord *Records);
+
+// The log sector has been erased, so every known checksum gets logged again
+void checksumLogErased(ChecksumTable *Table);
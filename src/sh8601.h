@@ -6,23 +6,41 @@
 
 #include "pico/stdlib.h"
 #include "pico/binary_info.h"
-#include "hardware/spi.h"
 #include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/pio.h"
+#include "hardware/clocks.h"
 
-#define SH8601_SPI spi0
-#define SH8601_SPEED 20000000 // 62.5MHz
-#define SH8601_DC 0
+// Quad SPI from a PIO state machine. pio1 SM 0-2 are the Maple RX, so this
+// takes SM 3. D0-D3 must be consecutive for out pins
+#define SH8601_PIO pio1
+#define SH8601_SM 3
+#define SH8601_QSPI_HZ 40000000 // SCK, 4 bits per clock
 #define SH8601_CS 1
 #define SH8601_SCK 2
-#define SH8601_MOSI 3
-#define SH8601_RST 5
-#define SH8601_PWR_EN 6
+#define SH8601_D0 3 // D0-D3 on 3-6
+#define SH8601_RST 7
+#define SH8601_PWR_EN 8
 
 #define SH8601_OLED_W 368
 #define SH8601_OLED_H 448
 
+// The 96x64 UI is stretched 3.5x to 336x224 in the middle, so every VMU
+// pixel (2x2 in the UI) comes out 7x7. Start and size stay even, which the
+// panel wants for its address windows
+#define SH8601_OUT_W 336
+#define SH8601_OUT_H 224
+#define SH8601_UI_X ((SH8601_OLED_W - SH8601_OUT_W) / 2)
+#define SH8601_UI_Y ((SH8601_OLED_H - SH8601_OUT_H) / 2)
+#define SH8601_FRAME_US 16667 // a full 336x224 frame is ~7.5ms of QSPI
+
 #define OLED_FLIP flashData[18]
 
+// QSPI opcodes: command writes go on D0 only, pixel writes on all four.
+// The command itself sits in the middle byte of the 24 bit address
+#define SH8601_QSPI_CMD 0x02
+#define SH8601_QSPI_PIXELS 0x32
+
 // SH8601 Commands
 #define SH8601_CMD_NOP 0x00
 #define SH8601_CMD_SWRESET 0x01
@@ -85,9 +103,17 @@
 #define SH8601_READ_ID2 0xDB
 #define SH8601_READ_ID3 0xDC
 
-void sh8601WriteCommand(const uint8_t data);
+typedef struct {
+  uint32_t frames;      // updates streamed out
+  uint32_t lines;       // panel lines sent
+  uint32_t linesPerSec; // over the last update
+  uint32_t lastSendUs;  // window setup until the last line has left the DMA
+  uint32_t ramBytes;    // canvas, line buffers and column map, vs 330K for a full framebuffer
+} SH8601Stats;
+
+extern SH8601Stats sh8601Stats;
 
-void sh8601WriteData(const uint8_t data);
+void sh8601WriteCommand(uint8_t cmd, const uint8_t *data, int len);
 
 void sh8601SetPixel(const uint8_t x, const uint8_t y, const uint16_t color);
 
@@ -95,6 +121,6 @@ void sh8601_clear(void);
 
 void sh8601_update(void);
 
-void sh8601_splash(void);
+void splashSH8601(void);
 
 void sh8601_init();
\ No newline at end of file
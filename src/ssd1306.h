@@ -4,6 +4,7 @@
 #include <string.h>
 #include "pico/stdlib.h"
 #include "hardware/i2c.h"
+#include "hardware/dma.h"
 
 // SSD1306 defines
 #define SSD1306_ADDRESS 0x3C
@@ -14,6 +15,9 @@
 // value in KHz
 #define I2C_CLOCK 3000
 
+// don't start VMU frames faster than 30Hz, I2C is far slower than the SSD1331's SPI
+#define SSD1306_FRAME_US 33333
+
 #define SSD1306_LCDWIDTH 128
 #define SSD1306_LCDHEIGHT 64
 #define SSD1306_FRAMEBUFFER_SIZE (SSD1306_LCDWIDTH * SSD1306_LCDHEIGHT / 8)
@@ -51,12 +55,22 @@
 #define SSD1306_SETCOMPINS 0xDA
 #define SSD1306_SETVCOMDETECT 0xDB
 
+extern uint8_t *Framebuffer;
+
+bool ssd1306Busy();
+
+void ssd1306WaitIdle();
+
+void ssd1306Poll();
+
 void ssd1306SendCommand(uint8_t cmd);
 
 void ssd1306SendCommandBuffer(uint8_t *inbuf, int len);
 
 void ssd1306_init();
 
+void updateSSD1306Window(int x0, int x1, int p0, int p1);
+
 void updateSSD1306();
 
 void clearSSD1306();
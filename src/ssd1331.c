@@ -5,825 +5,221 @@
 #include "ssd1331.h"
 #include "maple.h"
 #include "display.h"
+#include "blit.h"
 
 #define TRUE 1
 #define FALSE 0
 
-uint8_t oledFB[96 * 64 * 2] = {0x00};
+// Front/back pair: everything draws into oledFB (the back buffer) while DMA
+// sends the front one. Word aligned for vmuBlitRGB565
+static uint8_t oledBuffers[2][OLED_FB_SIZE] __attribute__((aligned(4))) = {0x00};
+uint8_t *oledFB = oledBuffers[0];
+static uint8_t *oledFront = oledBuffers[1];
 
 static volatile uint dma_tx;
 static dma_channel_config c;
+static bool dmaClaimed = false;
+static volatile bool dmaActive = false;
+static volatile bool framePending = false;
+static volatile bool drawing = false; // back buffer is being drawn, poll mustn't swap it
+static volatile int pendingY0, pendingY1;
 
-const uint8_t icon[] = {
-    // MaplePad splashscreen
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0010 (16)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0020 (32)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0030 (48)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0040 (64)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0050 (80)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0060 (96)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0070 (112)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0080 (128)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0090 (144)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x00A0 (160)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x00B0 (176)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x00C0 (192)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x00D0 (208)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x00E0 (224)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x00F0 (240)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0100 (256)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0110 (272)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0120 (288)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0130 (304)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0140 (320)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0150 (336)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0160 (352)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0170 (368)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0180 (384)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0190 (400)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x01A0 (416)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x01B0 (432)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x30, 0x20, // 0x01C0 (448)
-    0x38, 0x20, 0x20, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x01D0 (464)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x01E0 (480)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x01F0 (496)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0200 (512)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0210 (528)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x80, 0x60, // 0x0220 (544)
-    0x80, 0x60, 0x70, 0x60, 0x30, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0230 (560)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0240 (576)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0250 (592)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0260 (608)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0270 (624)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x70, 0x60, 0x90, 0x80, // 0x0280 (640)
-    0x88, 0x80, 0x78, 0x60, 0x38, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0290 (656)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x02A0 (672)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x02B0 (688)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x02C0 (704)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x02D0 (720)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x20, 0x80, 0x60, 0x88, 0x80, // 0x02E0 (736)
-    0x60, 0x40, 0x28, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x02F0 (752)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0300 (768)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0310 (784)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0320 (800)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0330 (816)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x40, 0x88, 0x80, 0x78, 0x60, // 0x0340 (832)
-    0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0350 (848)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0360 (864)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0370 (880)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0380 (896)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0390 (912)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x80, 0x60, 0x48, 0x40, // 0x03A0 (928)
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x03B0 (944)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x03C0 (960)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x03D0 (976)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x03E0 (992)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x03F0 (1008)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x48, 0x40, 0x78, 0x60, 0x30, 0x20, // 0x0400 (1024)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0410 (1040)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0420 (1056)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0430 (1072)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0440 (1088)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0450 (1104)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x40, 0x70, 0x60, 0x28, 0x20, // 0x0460 (1120)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0470 (1136)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0480 (1152)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0490 (1168)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x04A0 (1184)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x04B0 (1200)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x40, 0x78, 0x60, 0x30, 0x20, // 0x04C0 (1216)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x04D0 (1232)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x04E0 (1248)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x04F0 (1264)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0500 (1280)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0510 (1296)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x40, 0x78, 0x60, 0x30, 0x20, // 0x0520 (1312)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x18, 0x00, 0x98, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0530 (1328)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0540 (1344)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0550 (1360)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0560 (1376)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0570 (1392)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x20, 0x78, 0x60, 0x38, 0x20, // 0x0580 (1408)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x70, 0x60, 0xE0, 0xC0, 0xD8, 0xC0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0590 (1424)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x05A0 (1440)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x05B0 (1456)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x05C0 (1472)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x05D0 (1488)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x20, 0x78, 0x60, 0x48, 0x40, // 0x05E0 (1504)
-    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x78, 0x60, 0xE0, 0xC0, 0xF0, 0xE0, 0x68, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x05F0 (1520)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0600 (1536)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0610 (1552)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0620 (1568)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0630 (1584)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x70, 0x60, 0x68, 0x60, // 0x0640 (1600)
-    0x31, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x58, 0x40, 0xC0, 0xA0, 0xE8, 0xC0, 0xF0, 0xE0, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0650 (1616)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0660 (1632)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0670 (1648)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0680 (1664)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x45, 0xAD, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0690 (1680)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x68, 0x60, 0x29, 0x45, // 0x06A0 (1696)
-    0xAD, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0xC0, 0xA0, 0xE8, 0xE0, 0xF0, 0xE0, 0xE8, 0xE0, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x06B0 (1712)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x06C0 (1728)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x06D0 (1744)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x06E0 (1760)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x30, 0x84, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x06F0 (1776)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x23, 0xC6, 0x18, // 0x0700 (1792)
-    0x94, 0xD2, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x90, 0x80, 0xE0, 0xC0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0x68, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0710 (1808)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0720 (1824)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0730 (1840)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0740 (1856)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x38, 0x20, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0750 (1872)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xEB, 0xFF, 0xFF, // 0x0760 (1888)
-    0x84, 0x10, 0x38, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x40, 0xD0, 0xC0, 0xF0, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0770 (1904)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0780 (1920)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0790 (1936)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x07A0 (1952)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xE3, 0xB5, 0x96, 0xAD, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x07B0 (1968)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xE3, 0xB5, 0xB6, 0xFF, 0xFF, // 0x07C0 (1984)
-    0xB3, 0x4B, 0x60, 0x60, 0x10, 0x00, 0x00, 0x00, 0x20, 0x20, 0xA0, 0x80, 0xE8, 0xC0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0xF0, 0xE0, 0x90, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x07D0 (2000)
-    0x18, 0x00, 0x30, 0x20, 0x30, 0x20, 0x28, 0x20, 0x20, 0x20, 0x20, 0x20, 0x18, 0x20, 0x38, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x30, 0x20, 0x20, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x07E0 (2016)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x07F0 (2032)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0800 (2048)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xEB, 0xFF, 0xFF, 0x9C, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0810 (2064)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xEB, 0xFF, 0xFF, 0xB5, 0xB6, // 0x0820 (2080)
-    0x81, 0x43, 0x80, 0x60, 0x30, 0x20, 0x00, 0x00, 0x50, 0x40, 0xD8, 0xC0, 0xE8, 0xE0, 0xD0, 0xA0, 0xE0, 0xC0, 0xF0, 0xE0, 0xF0, 0xE0, 0x80, 0x80, 0x20, 0x20, 0x38, 0x20, 0x58, 0x40, 0x88, 0x80, // 0x0830 (2096)
-    0xB0, 0xA0, 0xC0, 0xA0, 0xC8, 0xC0, 0xC0, 0xA0, 0xB8, 0xA0, 0xB0, 0xA0, 0xB8, 0xA0, 0xD8, 0xC0, 0xD0, 0xC0, 0xD0, 0xC0, 0xD8, 0xC0, 0xD0, 0xC0, 0xC0, 0xA0, 0xB8, 0xA0, 0x58, 0x40, 0x08, 0x00, // 0x0840 (2112)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0850 (2128)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0860 (2144)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xF3, 0xFF, 0xFF, 0x5A, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0870 (2160)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0x71, 0xFF, 0xFF, 0x62, 0xEB, // 0x0880 (2176)
-    0x50, 0x40, 0x90, 0x80, 0x60, 0x40, 0x18, 0x00, 0x80, 0x60, 0xE0, 0xC0, 0xF0, 0xC0, 0xA8, 0x80, 0xE8, 0xC0, 0xF0, 0xE0, 0xF0, 0xE0, 0xB8, 0xA0, 0xA8, 0xA0, 0xC8, 0xC0, 0xE8, 0xE0, 0xF0, 0xE0, // 0x0890 (2192)
-    0xF0, 0xE0, 0xF0, 0xE0, 0xF0, 0xE0, 0xF0, 0xE0, 0xF0, 0xE0, 0xF0, 0xE0, 0xF0, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0xF0, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0xB0, 0xA0, // 0x08A0 (2208)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x08B0 (2224)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x08C0 (2240)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 0x34, 0xB5, 0x96, 0x18, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x08D0 (2256)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xE3, 0xD6, 0xBA, 0xC6, 0x18, 0x18, 0xE3, // 0x08E0 (2272)
-    0x28, 0x20, 0x80, 0x80, 0x80, 0x80, 0x48, 0x40, 0x98, 0x80, 0xE0, 0xC0, 0xC8, 0xA0, 0xB0, 0xA0, 0xF0, 0xE0, 0xF0, 0xE0, 0xF0, 0xE0, 0xF0, 0xE0, 0xF0, 0xE0, 0xF0, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, // 0x08F0 (2288)
-    0xE8, 0xE0, 0xE8, 0xC0, 0xE8, 0xE0, 0xE0, 0xC0, 0xD8, 0xC0, 0xC8, 0xA0, 0xD8, 0xC0, 0xF0, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xE8, 0xE0, 0xD0, 0xC0, 0xB8, 0xA0, 0x00, 0x00, 0x00, 0x00, // 0x0900 (2304)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0910 (2320)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0920 (2336)
-    0x00, 0x00, 0x00, 0x00, 0x29, 0x45, 0xC6, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0930 (2352)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x40, 0x58, 0x40, 0x68, 0x60, 0x68, 0x60, 0x60, 0x60, 0x58, 0x40, 0x4A, 0x69, 0xFF, 0xFF, 0x63, 0x4C, 0x10, 0x00, // 0x0940 (2368)
-    0x08, 0x00, 0x50, 0x40, 0x88, 0x80, 0x70, 0x60, 0xA0, 0x80, 0xE0, 0xC0, 0xB0, 0xA0, 0xE8, 0xC0, 0xF0, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0xE8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, // 0x0950 (2384)
-    0xE8, 0xE0, 0xD8, 0xC0, 0xC8, 0xA0, 0xB0, 0x80, 0xB0, 0x80, 0xC0, 0xA0, 0xE8, 0xC0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0xB8, 0xA0, 0x58, 0x40, 0x38, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, // 0x0960 (2400)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x62, // 0x0970 (2416)
-    0x00, 0x20, 0x18, 0xE3, 0x5A, 0xEB, 0x18, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0980 (2432)
-    0x00, 0x00, 0x00, 0x00, 0xA5, 0x14, 0xBD, 0xF7, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0990 (2448)
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x20, 0xA8, 0xA0, 0xD8, 0xC0, 0xC8, 0xC0, 0xD0, 0xC0, 0xE0, 0xC0, 0xE0, 0xC0, 0xE0, 0xC0, 0xE0, 0xC0, 0xD9, 0x83, 0xCE, 0x79, 0xFF, 0xFF, 0x5A, 0xAB, 0x91, 0x43, // 0x09A0 (2464)
-    0x60, 0x60, 0x50, 0x40, 0x78, 0x60, 0x90, 0x80, 0x98, 0x80, 0xD0, 0xA0, 0xB0, 0x80, 0xF8, 0xE0, 0xE8, 0xE0, 0xE8, 0xC0, 0xE8, 0xC0, 0xF0, 0xE0, 0xC0, 0xA0, 0xB8, 0xA0, 0xB0, 0xA0, 0xA8, 0x80, // 0x09B0 (2480)
-    0xB0, 0xA0, 0xB8, 0xA0, 0xC8, 0xA0, 0xE0, 0xC0, 0xF0, 0xE0, 0xF0, 0xE0, 0xF0, 0xE0, 0xF0, 0xE0, 0xE0, 0xC0, 0x90, 0x80, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x09C0 (2496)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x66, 0xCE, 0x79, 0x18, 0xE3, 0x00, 0x00, 0x18, 0xE3, 0x7B, 0xEF, 0xBD, 0xF7, 0xFF, 0xFF, // 0x09D0 (2512)
-    0x10, 0x62, 0xD6, 0xBA, 0xFF, 0xFF, 0x5A, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x73, 0xCE, 0x8C, 0x71, 0x18, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xE3, 0x5A, 0xEB, 0x52, 0xAA, // 0x09E0 (2528)
-    0x4A, 0x69, 0x42, 0x08, 0xD6, 0xBA, 0xFF, 0xFF, 0x10, 0x62, 0x00, 0x00, 0x18, 0xE3, 0x5A, 0xEB, 0x52, 0xAA, 0x52, 0xAA, 0x5A, 0xEB, 0x18, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xE3, // 0x09F0 (2544)
-    0x4A, 0x69, 0x52, 0xAA, 0xE0, 0xC0, 0xC8, 0xC0, 0xB0, 0xA0, 0xB0, 0xA0, 0xE8, 0xC0, 0xE9, 0xA3, 0xE3, 0x6B, 0x52, 0xAA, 0x42, 0x08, 0x84, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A, 0xAB, // 0x0A00 (2560)
-    0xE0, 0xC0, 0xC8, 0xA0, 0x63, 0x2C, 0x5A, 0xCB, 0x90, 0x80, 0xB8, 0xA0, 0xC8, 0xA0, 0xE8, 0xE0, 0x4A, 0x69, 0x84, 0x10, 0xB8, 0xA0, 0xA0, 0xA0, 0xC9, 0x02, 0x52, 0x6A, 0xD8, 0xC0, 0xF1, 0xA3, // 0x0A10 (2576)
-    0x7B, 0xEF, 0x9C, 0xF3, 0xF8, 0xE0, 0xF0, 0xE0, 0xE8, 0xE0, 0xE0, 0xC0, 0xE8, 0xE0, 0xD0, 0xC0, 0x88, 0x80, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0A20 (2592)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xEB, 0xFF, 0xFF, 0xB5, 0xB6, 0x18, 0xE3, 0xA5, 0x14, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xDB, // 0x0A30 (2608)
-    0x21, 0x04, 0x18, 0xE3, 0xF7, 0xBE, 0xD6, 0xDA, 0x00, 0x00, 0xDE, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0x71, 0xFF, 0xFF, 0xFF, 0xFF, // 0x0A40 (2624)
-    0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x34, 0x10, 0x82, 0x10, 0x82, 0x00, 0x20, 0xB5, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xB2, // 0x0A50 (2640)
-    0xFF, 0xFF, 0xFF, 0xFF, 0x63, 0x2C, 0x48, 0x40, 0x68, 0x60, 0xD0, 0xC0, 0xF0, 0xE0, 0x8C, 0x71, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x6B, 0x6D, 0xF7, 0xDE, 0xD6, 0xBA, // 0x0A60 (2656)
-    0xE1, 0xA3, 0x94, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0x73, 0xCE, 0xA0, 0x80, 0xD8, 0xC0, 0xB8, 0xA0, 0xB5, 0xB6, 0xE7, 0x3C, 0xD8, 0xC0, 0xF1, 0x42, 0xFF, 0xFF, 0xD6, 0xBA, 0xF8, 0xE0, 0xFB, 0x6B, // 0x0A70 (2672)
-    0xFF, 0xFF, 0xD6, 0xBA, 0xD8, 0xC0, 0xD8, 0xC0, 0xD8, 0xC0, 0xD8, 0xC0, 0xB0, 0xA0, 0x58, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0A80 (2688)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xE3, 0xB5, 0xB6, 0xFF, 0xFF, 0x94, 0x92, 0xDE, 0xFB, 0x84, 0x10, 0xEF, 0x9D, 0xFF, 0xFF, // 0x0A90 (2704)
-    0x5A, 0xEB, 0x00, 0x00, 0x73, 0x8E, 0xFF, 0xFF, 0xD6, 0x9A, 0x63, 0x2C, 0x5A, 0xEB, 0xFF, 0xFF, 0xB5, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xEC, 0xCE, 0x99, 0x8C, 0x71, 0x18, 0xE3, // 0x0AA0 (2720)
-    0xE7, 0x1C, 0xFF, 0xFF, 0x6B, 0x6D, 0x10, 0x82, 0xFF, 0xFF, 0xD6, 0x9A, 0x84, 0x30, 0x63, 0x4C, 0x29, 0x45, 0xCE, 0x39, 0xFF, 0xFF, 0x84, 0x30, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x49, 0xE7, 0x3C, // 0x0AB0 (2736)
-    0xFF, 0xFF, 0xFF, 0xFF, 0x73, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x62, 0xEC, 0xCE, 0x99, 0x9C, 0xF3, 0xF9, 0xA3, 0xDE, 0xFB, 0xFF, 0xFF, 0x63, 0x2C, 0xD8, 0xC0, 0x84, 0x10, 0xFF, 0xFF, // 0x0AC0 (2752)
-    0x9C, 0xF3, 0x6B, 0x4D, 0x5A, 0xEB, 0xFF, 0xFF, 0xB5, 0x96, 0xB0, 0x80, 0xA0, 0x80, 0xC8, 0xA0, 0xAD, 0x55, 0xD6, 0xDA, 0xF8, 0xE0, 0xF9, 0xC4, 0xDE, 0xDB, 0xAD, 0x75, 0xE9, 0xA3, 0xAD, 0x75, // 0x0AD0 (2768)
-    0xFF, 0xFF, 0x5A, 0xEB, 0xD8, 0xC0, 0xC0, 0xA0, 0x90, 0x80, 0x60, 0x60, 0x28, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0AE0 (2784)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x6D, 0x00, 0x00, 0x7B, 0xAF, 0xFF, 0xFF, // 0x0AF0 (2800)
-    0x5A, 0xEB, 0x00, 0x00, 0x84, 0x30, 0xFF, 0xFF, 0x8C, 0x71, 0x00, 0x00, 0x18, 0xE3, 0xD6, 0xDA, 0xB5, 0xD6, 0x08, 0x41, 0x10, 0x62, 0x6B, 0x4D, 0xC6, 0x38, 0x20, 0xE4, 0x00, 0x20, 0x10, 0x62, // 0x0B00 (2816)
-    0xA5, 0x34, 0xC6, 0x18, 0x29, 0x65, 0xFF, 0xFF, 0xDE, 0xFB, 0x84, 0x10, 0x00, 0x00, 0x00, 0x00, 0x18, 0xE3, 0x52, 0x8A, 0xFF, 0xFF, 0x73, 0x8E, 0x00, 0x00, 0x20, 0xE4, 0xBD, 0xF7, 0x00, 0x00, // 0x0B10 (2832)
-    0x7B, 0xEF, 0xFF, 0xFF, 0x52, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x39, 0xE7, 0xC6, 0x38, 0x31, 0x86, 0xF0, 0xE0, 0xF1, 0x21, 0xBD, 0xD7, 0xDE, 0xDB, 0xF1, 0xA3, 0xE8, 0xE0, 0x84, 0x10, 0xFF, 0xFF, // 0x0B20 (2848)
-    0xB5, 0xB6, 0xE8, 0xC0, 0xFA, 0x67, 0xE7, 0x3C, 0x94, 0xB2, 0xB0, 0x80, 0xC8, 0xA0, 0xF1, 0xA3, 0xE7, 0x3C, 0xDE, 0xDB, 0xF9, 0xA3, 0x9C, 0xF3, 0xFF, 0xFF, 0xEF, 0x5D, 0x52, 0x8A, 0xFF, 0xFF, // 0x0B30 (2864)
-    0xE7, 0x1C, 0xA1, 0x63, 0x68, 0x60, 0x38, 0x20, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0B40 (2880)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x30, 0xFF, 0xFF, 0xCE, 0x79, 0x18, 0xE3, 0x00, 0x00, 0x6B, 0x6D, 0xD6, 0xBA, // 0x0B50 (2896)
-    0x18, 0xE3, 0x18, 0xE3, 0xE7, 0x1C, 0xFF, 0xFF, 0x5A, 0xEB, 0x00, 0x00, 0x00, 0x00, 0xD6, 0xBA, 0xFF, 0xFF, 0x10, 0x82, 0xFF, 0xFF, 0xD6, 0xBA, 0x4A, 0x49, 0x00, 0x00, 0x10, 0x62, 0xFF, 0xFF, // 0x0B60 (2912)
-    0xD6, 0xBA, 0x21, 0x04, 0x08, 0x41, 0xDE, 0xFB, 0xFF, 0xFF, 0x10, 0x62, 0x18, 0xE3, 0x5A, 0xEB, 0xBD, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x79, 0x00, 0x00, 0xBD, 0xF7, 0x20, 0xE4, 0x00, 0x00, // 0x0B70 (2928)
-    0x84, 0x10, 0xFF, 0xFF, 0x5A, 0xEB, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x38, 0x4A, 0x49, 0x20, 0x20, 0xA8, 0xE1, 0xFE, 0x17, 0xF7, 0xDE, 0xBD, 0xF7, 0xF8, 0xE0, 0xF9, 0xA3, 0xD6, 0x9A, 0xFF, 0xFF, // 0x0B80 (2944)
-    0xF3, 0x6B, 0xF8, 0xE0, 0xFB, 0x8B, 0xFF, 0xFF, 0x7B, 0xAF, 0xB8, 0xA0, 0xA0, 0x80, 0xC3, 0x4B, 0xFF, 0xFF, 0xE7, 0x3C, 0x73, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, // 0x0B90 (2960)
-    0x84, 0x10, 0xA8, 0xA0, 0x68, 0x60, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0BA0 (2976)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xE3, 0xE7, 0x1C, 0xFF, 0xFF, 0x5A, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x84, 0x30, 0x63, 0x2C, // 0x0BB0 (2992)
-    0x00, 0x00, 0x4A, 0x69, 0xFF, 0xFF, 0xB5, 0xB6, 0x18, 0xE3, 0x00, 0x00, 0x63, 0x0C, 0xF7, 0xBE, 0x21, 0x24, 0x21, 0x24, 0xD6, 0xBA, 0xAD, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xC6, 0x38, // 0x0BC0 (3008)
-    0xC6, 0x38, 0x00, 0x20, 0xBD, 0xD7, 0xFF, 0xFF, 0x10, 0x82, 0x00, 0x20, 0x63, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x52, 0x8A, 0x42, 0x08, 0x4A, 0x49, 0x00, 0x00, 0x00, 0x00, // 0x0BD0 (3024)
-    0xA5, 0x34, 0xD6, 0xBA, 0x21, 0x04, 0x18, 0xE3, 0xC6, 0x18, 0xA5, 0x34, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xD6, 0xBA, 0xEF, 0x7D, 0xE8, 0xE0, 0xF8, 0xE0, 0xFB, 0x6B, 0xFF, 0xFF, 0xC6, 0x18, // 0x0BE0 (3040)
-    0xF1, 0xA3, 0xD1, 0x83, 0xAD, 0x75, 0xFF, 0xFF, 0xBB, 0x2B, 0xB0, 0x80, 0xB1, 0x63, 0xAD, 0x95, 0xFF, 0xFF, 0x52, 0xAA, 0xB5, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0x6B, 0x4D, 0xFF, 0xDF, 0xFF, 0xFF, // 0x0BF0 (3056)
-    0xF3, 0x6B, 0xF0, 0xE0, 0xE8, 0xC0, 0xC0, 0xA0, 0x80, 0x60, 0x38, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0C00 (3072)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xEB, 0xFF, 0xFF, 0xC6, 0x18, 0x18, 0xE3, 0x00, 0x00, 0x29, 0x45, 0xC6, 0x38, 0x00, 0x00, // 0x0C10 (3088)
-    0x00, 0x00, 0xBD, 0xF7, 0xFF, 0xFF, 0x5A, 0xEB, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x7D, 0xC6, 0x38, 0x00, 0x00, 0x4A, 0x69, 0xFF, 0xFF, 0x84, 0x10, 0x00, 0x00, 0x18, 0xE3, 0x7B, 0xEF, 0xDE, 0xFB, // 0x0C20 (3104)
-    0xFF, 0xFF, 0x10, 0x62, 0x00, 0x20, 0x10, 0x62, 0x21, 0x04, 0x5A, 0xAB, 0xDE, 0xFB, 0x5A, 0xEB, 0x8C, 0x91, 0xFF, 0xFF, 0xB5, 0x96, 0x18, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x18, 0xE3, 0x7B, 0xEF, // 0x0C30 (3120)
-    0xDE, 0xFB, 0xFF, 0xFF, 0x10, 0x62, 0x4A, 0x69, 0xFF, 0xFF, 0x8C, 0x71, 0x00, 0x00, 0x18, 0xE3, 0x6B, 0x6D, 0xF7, 0xBE, 0xFE, 0x37, 0xE1, 0x01, 0xD1, 0x83, 0xB5, 0xB6, 0xFF, 0xFF, 0xEB, 0x6B, // 0x0C40 (3136)
-    0xB8, 0xA0, 0xD3, 0x4B, 0xFF, 0xFF, 0xB5, 0xB6, 0xB1, 0x43, 0xC1, 0x63, 0x5A, 0xCB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x34, // 0x0C50 (3152)
-    0xF1, 0xA3, 0xF0, 0xE0, 0xF0, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0xD8, 0xC0, 0x88, 0x80, 0x28, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0C60 (3168)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xE3, 0xB5, 0xB6, 0xFF, 0xFF, 0x5A, 0xEB, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xF7, 0x52, 0x8A, 0x00, 0x00, // 0x0C70 (3184)
-    0x00, 0x00, 0xCE, 0x99, 0x7B, 0xEF, 0x18, 0xE3, 0x00, 0x00, 0xA5, 0x54, 0xEF, 0x7D, 0x00, 0x20, 0x00, 0x00, 0x84, 0x30, 0xFF, 0xFF, 0x18, 0xE3, 0x18, 0xE3, 0x5A, 0xCB, 0xFF, 0xFF, 0xBE, 0x17, // 0x0C80 (3200)
-    0x10, 0x62, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xEB, 0xFF, 0xFF, 0x63, 0x4C, 0x00, 0x00, 0x94, 0x92, 0xDE, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xE3, 0x8C, 0x71, 0xFF, 0xFF, // 0x0C90 (3216)
-    0xD6, 0x9A, 0x10, 0x62, 0x00, 0x20, 0x73, 0xCE, 0xFF, 0xFF, 0x18, 0xE3, 0x18, 0xE3, 0x5A, 0xCB, 0xFF, 0xFF, 0xC6, 0x58, 0xD9, 0x01, 0xC8, 0xC0, 0xF3, 0x6B, 0xFF, 0xFF, 0xC6, 0x18, 0xD1, 0x83, // 0x0CA0 (3232)
-    0xB8, 0xA0, 0xB5, 0xB6, 0xFF, 0xFF, 0xD3, 0x4B, 0xD0, 0xA0, 0xCB, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x4B, // 0x0CB0 (3248)
-    0xD0, 0xC0, 0xE8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0xC8, 0xC0, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0CC0 (3264)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xEB, 0xFF, 0xFF, 0xCE, 0x79, 0x39, 0xA7, 0x00, 0x00, 0xD6, 0x9A, 0x94, 0x92, 0x00, 0x00, 0x00, 0x00, // 0x0CD0 (3280)
-    0x52, 0xAA, 0xCE, 0x79, 0x18, 0xE3, 0x00, 0x00, 0x63, 0x0C, 0xF7, 0xBE, 0x6B, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x8C, 0x91, 0xFF, 0xFF, 0x8C, 0x91, 0xA5, 0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A, 0xEB, // 0x0CE0 (3296)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x6D, 0xFF, 0xFF, 0xC6, 0x38, 0x94, 0xD2, 0xBD, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, // 0x0CF0 (3312)
-    0x63, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x84, 0x30, 0xFF, 0xFF, 0x9D, 0x13, 0xA5, 0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0x6B, 0xD0, 0xC0, 0xE8, 0xE0, 0xE4, 0x4F, 0xFF, 0xFF, 0xE1, 0x83, 0xB0, 0xA0, // 0x0D00 (3328)
-    0x6B, 0x6D, 0xEF, 0x7D, 0x8C, 0x71, 0xB9, 0x84, 0xE1, 0x22, 0xF7, 0xBE, 0xFF, 0xFF, 0xC6, 0x18, 0xB5, 0xB6, 0xF7, 0xBE, 0xFF, 0xFF, 0x8C, 0x71, 0xAD, 0x55, 0xFF, 0xFF, 0x73, 0xAE, 0xD9, 0x83, // 0x0D10 (3344)
-    0xC0, 0xA0, 0xA0, 0x80, 0xA8, 0x80, 0xC0, 0xA0, 0xE8, 0xC0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xD8, 0xC0, 0x48, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0D20 (3360)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x79, 0xC6, 0x38, 0x84, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0D30 (3376)
-    0x84, 0x10, 0xFF, 0xFF, 0xAD, 0x75, 0x94, 0xD2, 0xE7, 0x5C, 0xFF, 0xFF, 0x10, 0x82, 0x00, 0x00, 0x00, 0x00, 0x8C, 0x71, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x54, 0x18, 0xE3, // 0x0D40 (3392)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9C, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xE7, 0xEF, 0x5D, 0xFF, 0xFF, 0xD6, 0xBA, // 0x0D50 (3408)
-    0x18, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x8C, 0x71, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xF7, 0xE1, 0xA3, 0xF8, 0xE0, 0xE8, 0xE0, 0xCB, 0xAD, 0xFF, 0xFF, 0xEF, 0x5D, 0x94, 0xB2, // 0x0D60 (3424)
-    0xEF, 0x5D, 0xBD, 0xF7, 0xF8, 0xE0, 0xB9, 0x02, 0xFF, 0xFF, 0xCE, 0x59, 0x7B, 0xEF, 0xF1, 0xA3, 0xF0, 0xE0, 0xA5, 0x14, 0xFB, 0xAC, 0xF9, 0xA3, 0x6B, 0x8D, 0xA5, 0x14, 0xE9, 0xA3, 0xE0, 0xC0, // 0x0D70 (3440)
-    0xF8, 0xE0, 0xF8, 0xE0, 0xE8, 0xC0, 0xC8, 0xA0, 0xB0, 0x80, 0xC8, 0xA0, 0xF0, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xE0, 0xC0, 0x58, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0D80 (3456)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA5, 0x14, 0xE7, 0x3C, 0x9C, 0xF3, 0x84, 0x30, 0x20, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0D90 (3472)
-    0x4A, 0x69, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x18, 0x39, 0xC7, 0x21, 0x24, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x18, 0xE3, 0x5A, 0xEB, 0x7B, 0xEF, 0xFF, 0xFF, 0xDE, 0xFB, 0x00, 0x00, 0x00, 0x00, // 0x0DA0 (3488)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x45, 0x84, 0x30, 0x63, 0x2C, 0x18, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xE7, 0xDE, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x63, 0x2C, // 0x0DB0 (3504)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xE3, 0x5A, 0xEB, 0x7B, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0x6B, 0xF8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xFB, 0x4B, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0xBA, // 0x0DC0 (3520)
-    0x94, 0xB2, 0xF8, 0xE0, 0xF8, 0xE0, 0xC0, 0xC0, 0xD9, 0x22, 0xF9, 0x00, 0xB8, 0xA0, 0xC8, 0xA0, 0xF0, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xE8, 0xE0, 0xE0, 0xC0, // 0x0DD0 (3536)
-    0xD8, 0xC0, 0xE0, 0xC0, 0xF0, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0xD8, 0xC0, 0xC0, 0xA0, 0xD8, 0xC0, 0xF0, 0xE0, 0xF8, 0xE0, 0xE0, 0xC0, 0x58, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0DE0 (3552)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xE3, 0x7B, 0xEF, 0xDE, 0xFB, 0xFF, 0xFF, 0x10, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0DF0 (3568)
-    0x18, 0xE3, 0x5A, 0xEB, 0x5A, 0xEB, 0x18, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xD6, 0xBA, 0x52, 0xAA, 0x00, 0x00, 0x00, 0x00, // 0x0E00 (3584)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x86, 0xDE, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0xBA, 0x18, 0xE3, // 0x0E10 (3600)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x70, 0x80, 0xDE, 0xFB, 0x84, 0x30, 0xF9, 0xA3, 0xF8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xC9, 0x63, 0xD3, 0x4B, 0xFB, 0x6B, 0xE9, 0xA3, // 0x0E20 (3616)
-    0xF0, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xD0, 0xA0, 0xC8, 0xA0, 0xF8, 0xE0, 0xE8, 0xE0, 0xA8, 0x80, 0xE0, 0xC0, 0xF0, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0xE0, 0xC0, 0xA8, 0xA0, // 0x0E30 (3632)
-    0xB8, 0xA0, 0xD8, 0xC0, 0xE0, 0xC0, 0xE8, 0xC0, 0xF0, 0xE0, 0xF8, 0xE0, 0xF0, 0xC0, 0xD0, 0xA0, 0xC8, 0xA0, 0xD8, 0xC0, 0xF8, 0xE0, 0xE0, 0xC0, 0x68, 0x60, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0E40 (3648)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xEB, 0xFF, 0xFF, 0xC6, 0x58, 0x10, 0x62, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0E50 (3664)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x62, 0xFF, 0xFF, 0x10, 0x62, 0x00, 0x00, 0x00, 0x00, // 0x0E60 (3680)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x38, 0x29, 0x65, 0x8C, 0x71, 0xFF, 0xFF, 0x63, 0x2C, 0x00, 0x00, // 0x0E70 (3696)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x20, 0xC1, 0x02, 0xFF, 0xFF, 0xF1, 0x42, 0xF8, 0xE0, 0xF8, 0xE0, 0xE0, 0xC0, 0xB0, 0x80, 0xB0, 0xA0, 0xF0, 0xE0, 0xE8, 0xC0, 0xE0, 0xC0, // 0x0E80 (3712)
-    0xF8, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0xD8, 0xC0, 0xC0, 0xA0, 0xF8, 0xE0, 0xF8, 0xE0, 0xD0, 0xA0, 0xB0, 0x80, 0xF0, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0xE8, 0xE0, 0x88, 0x80, // 0x0E90 (3728)
-    0x40, 0x40, 0x58, 0x40, 0x78, 0x60, 0xA0, 0x80, 0xD8, 0xC0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xE8, 0xC0, 0xD0, 0xA0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xB8, 0xA0, 0x00, 0x00, 0x00, 0x00, // 0x0EA0 (3744)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xE3, 0xAD, 0x75, 0xFF, 0xFF, 0x4A, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0EB0 (3760)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x62, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, // 0x0EC0 (3776)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 0xF7, 0x29, 0x45, 0x00, 0x00, 0x73, 0xCE, 0xC6, 0x18, 0x18, 0xE3, 0x00, 0x00, // 0x0ED0 (3792)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x60, 0xE0, 0xE0, 0xF1, 0x22, 0xF9, 0x00, 0xF0, 0xE0, 0xD0, 0xC0, 0xA0, 0x80, 0xD0, 0xC0, 0xF0, 0xE0, 0xE8, 0xC0, 0xE0, 0xC0, 0xF0, 0xE0, // 0x0EE0 (3808)
-    0xE8, 0xE0, 0xE8, 0xC0, 0xE0, 0xC0, 0xD8, 0xC0, 0xB8, 0xA0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0xB0, 0x80, 0xB0, 0x80, 0xF0, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xE8, 0xC0, 0xB0, 0xA0, // 0x0EF0 (3824)
-    0x28, 0x20, 0x00, 0x00, 0x08, 0x00, 0x20, 0x20, 0x68, 0x60, 0xE0, 0xC0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0xE8, 0xE0, 0xE8, 0xE0, 0xF0, 0xE0, 0xF0, 0xE0, 0x40, 0x40, 0x00, 0x00, // 0x0F00 (3840)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xEB, 0xFF, 0xFF, 0xD6, 0x9A, 0x18, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0F10 (3856)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0F20 (3872)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xEF, 0x7B, 0xCF, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0F30 (3888)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x20, 0xA8, 0xA0, 0xF0, 0xE0, 0xF8, 0xE0, 0xD8, 0xC0, 0xB0, 0x80, 0xB0, 0xA0, 0xE0, 0xC0, 0xF8, 0xE0, 0xF0, 0xE0, 0xF0, 0xE0, 0xF0, 0xE0, 0xD8, 0xC0, // 0x0F40 (3904)
-    0x98, 0x80, 0xE0, 0xC0, 0xE0, 0xC0, 0xE0, 0xC0, 0xB8, 0xA0, 0xF8, 0xE0, 0xF0, 0xE0, 0xE8, 0xC0, 0xE8, 0xE0, 0xB8, 0xA0, 0xA8, 0x80, 0xF0, 0xE0, 0xF8, 0xE0, 0xF8, 0xE0, 0xE8, 0xE0, 0xD8, 0xC0, // 0x0F50 (3920)
-    0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x48, 0x40, 0x98, 0x80, 0xD0, 0xC0, 0xE8, 0xE0, 0xF0, 0xE0, 0xF0, 0xE0, 0xE8, 0xE0, 0xE8, 0xE0, 0xE8, 0xE0, 0x90, 0x80, 0x00, 0x00, // 0x0F60 (3936)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xE3, 0xC6, 0x18, 0xFF, 0xFF, 0x4A, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0F70 (3952)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0F80 (3968)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x45, 0xC6, 0x38, 0x00, 0x00, 0x00, 0x00, 0x84, 0x30, 0x73, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0F90 (3984)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x40, 0xE0, 0xC0, 0xF0, 0xE0, 0xC0, 0xA0, 0xA0, 0x80, 0xD8, 0xC0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0xF0, 0xE0, 0xE8, 0xE0, 0xC8, 0xC0, 0x50, 0x40, // 0x0FA0 (4000)
-    0x60, 0x60, 0xE0, 0xC0, 0xD8, 0xC0, 0xE0, 0xC0, 0xB8, 0xA0, 0xF8, 0xE0, 0xF0, 0xE0, 0xE8, 0xC0, 0xD0, 0xC0, 0xE0, 0xC0, 0xC0, 0xA0, 0xB0, 0xA0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0xE0, 0xC0, // 0x0FB0 (4016)
-    0xA0, 0x80, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x30, 0x20, 0x78, 0x60, 0xB8, 0xA0, 0xE0, 0xC0, 0xE8, 0xC0, 0xE0, 0xC0, 0xE0, 0xC0, 0xC8, 0xC0, 0x00, 0x00, // 0x0FC0 (4032)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x69, 0xFF, 0xFF, 0xC6, 0x18, 0x18, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0FD0 (4048)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0FE0 (4064)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x38, 0x29, 0x45, 0x00, 0x00, 0x29, 0x45, 0xBD, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x0FF0 (4080)
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xB0, 0xA0, 0xF0, 0xE0, 0xF0, 0xE0, 0xD8, 0xC0, 0xE8, 0xC0, 0xF0, 0xE0, 0xF0, 0xE0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0xA0, 0x80, 0x80, 0x30, 0x20, 0x08, 0x00, // 0x1000 (4096)
-    0x58, 0x40, 0xE0, 0xC0, 0xD8, 0xC0, 0xE0, 0xC0, 0xB8, 0xA0, 0xF8, 0xE0, 0xE8, 0xC0, 0xE8, 0xC0, 0xA0, 0xA0, 0xD8, 0xC0, 0xE8, 0xC0, 0xB0, 0x80, 0xC0, 0xA0, 0xF8, 0xE0, 0xF0, 0xE0, 0xD8, 0xC0, // 0x1010 (4112)
-    0xD8, 0xC0, 0x70, 0x60, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x98, 0x80, 0xD0, 0xC0, 0xF0, 0xE0, 0xE8, 0xC0, 0xE8, 0xC0, 0x18, 0x00, // 0x1020 (4128)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x18, 0xFF, 0xFF, 0x5A, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1030 (4144)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1040 (4160)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xE3, 0x9C, 0xF3, 0xA5, 0x34, 0x00, 0x00, 0x00, 0x00, 0xC6, 0x38, 0x20, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1050 (4176)
-    0x08, 0x00, 0x38, 0x20, 0x98, 0x80, 0xE8, 0xC0, 0xF8, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0xA0, 0x90, 0x80, 0x58, 0x40, 0x28, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1060 (4192)
-    0x50, 0x40, 0xD8, 0xC0, 0xD0, 0xC0, 0xE0, 0xC0, 0xB8, 0xA0, 0xF8, 0xE0, 0xE0, 0xC0, 0xE0, 0xC0, 0x78, 0x60, 0xB0, 0xA0, 0xE0, 0xC0, 0xE0, 0xC0, 0xA8, 0x80, 0xD8, 0xC0, 0xF8, 0xE0, 0xE8, 0xE0, // 0x1070 (4208)
-    0xE0, 0xC0, 0xC0, 0xA0, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x50, 0x40, 0xE0, 0xC0, 0xA8, 0xA0, // 0x1080 (4224)
-    0x00, 0x00, 0x00, 0x00, 0x31, 0x66, 0xCE, 0x99, 0x6B, 0x6D, 0x18, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1090 (4240)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x10A0 (4256)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xEB, 0xFF, 0xFF, 0x7B, 0xAF, 0x00, 0x00, 0x84, 0x10, 0x4A, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, // 0x10B0 (4272)
-    0x78, 0x60, 0xE8, 0xC0, 0xF0, 0xE0, 0xF0, 0xE0, 0xF0, 0xE0, 0xE0, 0xC0, 0xA8, 0xA0, 0x78, 0x60, 0x48, 0x40, 0x20, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x10C0 (4288)
-    0x50, 0x40, 0xD0, 0xC0, 0xD0, 0xC0, 0xE0, 0xC0, 0xB8, 0xA0, 0xF8, 0xE0, 0xD8, 0xC0, 0xE0, 0xC0, 0x60, 0x40, 0x68, 0x60, 0xD0, 0xC0, 0xE0, 0xC0, 0xE0, 0xC0, 0xA8, 0x80, 0xF0, 0xE0, 0xF0, 0xE0, // 0x10D0 (4304)
-    0xD8, 0xC0, 0xD8, 0xC0, 0x88, 0x80, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x40, 0xE8, 0xE0, // 0x10E0 (4320)
-    0x00, 0x00, 0x00, 0x00, 0x42, 0x28, 0x62, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x10F0 (4336)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1100 (4352)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xAA, 0xFF, 0xFF, 0xE7, 0x5C, 0x7B, 0xEF, 0x5A, 0xAB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x40, // 0x1110 (4368)
-    0xF0, 0xE0, 0xF8, 0xE0, 0xF0, 0xE0, 0xB8, 0xA0, 0x80, 0x60, 0x48, 0x40, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1120 (4384)
-    0x38, 0x20, 0xB8, 0xA0, 0xC8, 0xC0, 0xE8, 0xC0, 0xA8, 0x80, 0xF8, 0xE0, 0xD8, 0xC0, 0xD8, 0xC0, 0x50, 0x40, 0x10, 0x00, 0x88, 0x80, 0xD8, 0xC0, 0xE8, 0xE0, 0xC0, 0xA0, 0xB8, 0xA0, 0xF0, 0xE0, // 0x1130 (4400)
-    0xE8, 0xE0, 0xD8, 0xC0, 0xC0, 0xA0, 0x48, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x40, // 0x1140 (4416)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1150 (4432)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1160 (4448)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xA5, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0xD8, 0xC0, // 0x1170 (4464)
-    0xE0, 0xC0, 0x90, 0x80, 0x60, 0x60, 0x20, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1180 (4480)
-    0x28, 0x20, 0xA8, 0xA0, 0xC8, 0xC0, 0xF0, 0xE0, 0x98, 0x80, 0xF8, 0xE0, 0xD0, 0xC0, 0xD0, 0xC0, 0x50, 0x40, 0x00, 0x00, 0x28, 0x20, 0xA8, 0xA0, 0xE0, 0xC0, 0xF0, 0xE0, 0xB0, 0x80, 0xC0, 0xA0, // 0x1190 (4496)
-    0xF0, 0xE0, 0xE0, 0xC0, 0xE0, 0xC0, 0x90, 0x80, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x11A0 (4512)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x11B0 (4528)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x11C0 (4544)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x30, 0x63, 0x2C, 0x18, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x80, 0xE8, 0xE0, // 0x11D0 (4560)
-    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x11E0 (4576)
-    0x18, 0x00, 0x88, 0x80, 0xD0, 0xC0, 0xF0, 0xE0, 0xA0, 0x80, 0xF0, 0xC0, 0xD8, 0xC0, 0xC8, 0xC0, 0x48, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0xB8, 0xA0, 0xE0, 0xC0, 0xE8, 0xC0, 0xA8, 0x80, // 0x11F0 (4592)
-    0xC8, 0xA0, 0xF0, 0xE0, 0xE0, 0xC0, 0xD0, 0xC0, 0x48, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1200 (4608)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1210 (4624)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1220 (4640)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x60, 0x58, 0x40, // 0x1230 (4656)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1240 (4672)
-    0x00, 0x00, 0x60, 0x60, 0xD8, 0xC0, 0xD8, 0xC0, 0xA8, 0x80, 0xE0, 0xC0, 0xD8, 0xC0, 0xB0, 0xA0, 0x30, 0x20, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x48, 0x40, 0xB0, 0xA0, 0xE8, 0xC0, 0xE0, 0xC0, // 0x1250 (4688)
-    0xB8, 0x80, 0xB0, 0x80, 0xE8, 0xC0, 0xE8, 0xE0, 0x98, 0x80, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1260 (4704)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1270 (4720)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1280 (4736)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1290 (4752)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x12A0 (4768)
-    0x00, 0x00, 0x40, 0x40, 0xC0, 0xA0, 0xC0, 0xA0, 0xA8, 0x80, 0xD8, 0xC0, 0xD8, 0xC0, 0x98, 0x80, 0x28, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0xB0, 0xA0, 0xD8, 0xC0, // 0x12B0 (4784)
-    0xE0, 0xC0, 0xA8, 0x80, 0xD0, 0xA0, 0xE8, 0xE0, 0xD0, 0xC0, 0x50, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x12C0 (4800)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x12D0 (4816)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x12E0 (4832)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x12F0 (4848)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1300 (4864)
-    0x00, 0x00, 0x20, 0x20, 0x98, 0x80, 0xD8, 0xC0, 0xC8, 0xA0, 0xE8, 0xC0, 0xE0, 0xC0, 0x80, 0x80, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x20, 0x98, 0x80, // 0x1310 (4880)
-    0xD8, 0xC0, 0xD8, 0xC0, 0x98, 0x80, 0xD8, 0xC0, 0xE0, 0xC0, 0x90, 0x80, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1320 (4896)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1330 (4912)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1340 (4928)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1350 (4944)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1360 (4960)
-    0x00, 0x00, 0x08, 0x00, 0x70, 0x60, 0xD8, 0xC0, 0xC8, 0xA0, 0xD8, 0xC0, 0xE8, 0xE0, 0x70, 0x60, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, // 0x1370 (4976)
-    0x78, 0x60, 0xD0, 0xC0, 0xD8, 0xC0, 0xA8, 0x80, 0xC0, 0xA0, 0xD0, 0xC0, 0x48, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1380 (4992)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1390 (5008)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x13A0 (5024)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x13B0 (5040)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x13C0 (5056)
-    0x00, 0x00, 0x00, 0x00, 0x50, 0x40, 0xD8, 0xC0, 0xD8, 0xC0, 0xE0, 0xC0, 0xE0, 0xC0, 0x60, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x13D0 (5072)
-    0x10, 0x00, 0x60, 0x60, 0xC0, 0xA0, 0xD8, 0xC0, 0xB0, 0xA0, 0xE8, 0xE0, 0x98, 0x80, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x13E0 (5088)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x13F0 (5104)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1400 (5120)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1410 (5136)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1420 (5152)
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x20, 0xB8, 0xA0, 0xD0, 0xC0, 0xD0, 0xC0, 0xD0, 0xC0, 0x48, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1430 (5168)
-    0x00, 0x00, 0x08, 0x00, 0x28, 0x20, 0x80, 0x60, 0xC8, 0xC0, 0xF0, 0xE0, 0xE8, 0xC0, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1440 (5184)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1450 (5200)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1460 (5216)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1470 (5232)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1480 (5248)
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x98, 0x80, 0xE0, 0xC0, 0xE8, 0xE0, 0xB0, 0xA0, 0x30, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1490 (5264)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x58, 0x40, 0xD8, 0xC0, 0xF0, 0xE0, 0xD0, 0xC0, 0x30, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x14A0 (5280)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x14B0 (5296)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x14C0 (5312)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x14D0 (5328)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x14E0 (5344)
-    0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x78, 0x60, 0xF0, 0xE0, 0xF0, 0xE0, 0x90, 0x80, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x14F0 (5360)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x68, 0x60, 0xF0, 0xE0, 0xF8, 0xE0, 0x90, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1500 (5376)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1510 (5392)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1520 (5408)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1530 (5424)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1540 (5440)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x40, 0xF0, 0xE0, 0xF0, 0xE0, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1550 (5456)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xA0, 0x80, 0xF8, 0xE0, 0xA0, 0xA0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1560 (5472)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1570 (5488)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1580 (5504)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1590 (5520)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x15A0 (5536)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xE0, 0xC0, 0xC8, 0xC0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x15B0 (5552)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xB0, 0xA0, 0xF0, 0xE0, 0x68, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x15C0 (5568)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x15D0 (5584)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x15E0 (5600)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x15F0 (5616)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1600 (5632)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xC0, 0x98, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1610 (5648)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x60, 0x80, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1620 (5664)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1630 (5680)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1640 (5696)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1650 (5712)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1660 (5728)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE8, 0xC0, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1670 (5744)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1680 (5760)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1690 (5776)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x16A0 (5792)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x16B0 (5808)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x16C0 (5824)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x80, 0x48, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x16D0 (5840)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x16E0 (5856)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x16F0 (5872)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1700 (5888)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1710 (5904)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1720 (5920)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1730 (5936)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1740 (5952)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1750 (5968)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1760 (5984)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1770 (6000)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1780 (6016)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1790 (6032)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x17A0 (6048)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x17B0 (6064)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x17C0 (6080)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x17D0 (6096)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x17E0 (6112)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x17F0 (6128)
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x1800 (6144)
+// 96x64 RGB565, 3055 bytes packed from 12288 by tools/pack_image
+static const uint8_t image_data_maplepad_logo_9664_data[3055] = {
+    0x7f, 0x00, 0x00, 0x5f, 0x00, 0x00, 0xbf, 0x93, 0x02, 0x10, 0x00, 0x30, 0x20, 0x20, 0x00, 0x88,
+    0xbf, 0x92, 0x03, 0x18, 0x00, 0x50, 0x41, 0x60, 0x41, 0x20, 0x20, 0x88, 0xbf, 0x91, 0x03, 0x28,
+    0x20, 0x50, 0x41, 0x40, 0x20, 0x08, 0x00, 0x49, 0x00, 0x00, 0xbf, 0x8f, 0x03, 0x08, 0x00, 0x30,
+    0x20, 0x48, 0x20, 0x20, 0x00, 0x4b, 0x00, 0x00, 0xbf, 0x8e, 0x03, 0x08, 0x00, 0x30, 0x20, 0x30,
+    0x20, 0x08, 0x00, 0x4c, 0x00, 0x00, 0xbf, 0x8d, 0x02, 0x10, 0x00, 0x38, 0x20, 0x28, 0x20, 0x4e,
+    0x00, 0x00, 0xbf, 0x8c, 0x02, 0x10, 0x00, 0x38, 0x20, 0x20, 0x20, 0x4f, 0x00, 0x00, 0xbf, 0x8b,
+    0x02, 0x10, 0x00, 0x38, 0x20, 0x20, 0x00, 0x50, 0x00, 0x00, 0xbf, 0x8a, 0x02, 0x08, 0x00, 0x40,
+    0x20, 0x18, 0x00, 0x51, 0x00, 0x00, 0xbf, 0x8a, 0x01, 0x38, 0x20, 0x20, 0x00, 0x52, 0x00, 0x00,
+    0xbf, 0x89, 0x01, 0x38, 0x20, 0x20, 0x00, 0x53, 0x00, 0x00, 0xbf, 0x88, 0x01, 0x30, 0x20, 0x28,
+    0x20, 0x54, 0x00, 0x00, 0xbf, 0x87, 0x02, 0x20, 0x00, 0x30, 0x20, 0x08, 0x00, 0x94, 0xbf, 0x86,
+    0x02, 0x10, 0x00, 0x38, 0x20, 0x10, 0x00, 0x55, 0x00, 0x00, 0xbf, 0x86, 0x01, 0x30, 0x20, 0x20,
+    0x00, 0x56, 0x00, 0x00, 0xbc, 0x01, 0x18, 0x00, 0x08, 0x00, 0x86, 0x02, 0x20, 0x20, 0x30, 0x20,
+    0x08, 0x00, 0x96, 0xbc, 0x01, 0x38, 0x20, 0x68, 0x40, 0x85, 0x02, 0x08, 0x00, 0x30, 0x20, 0x18,
+    0x00, 0x57, 0x00, 0x00, 0xbc, 0x02, 0x18, 0x00, 0xc0, 0x81, 0x50, 0x40, 0x84, 0x01, 0x28, 0x20,
+    0x28, 0x20, 0x58, 0x00, 0x00, 0xaa, 0x02, 0x18, 0x00, 0x18, 0x00, 0x08, 0x00, 0x8e, 0x03, 0x08,
+    0x00, 0xb8, 0x81, 0xd0, 0x81, 0x40, 0x20, 0x82, 0x02, 0x10, 0x00, 0x30, 0x20, 0x18, 0x00, 0x98,
+    0xa9, 0x0a, 0x08, 0x00, 0x48, 0x20, 0x80, 0x40, 0x80, 0x60, 0x68, 0x40, 0x60, 0x40, 0x50, 0x40,
+    0x50, 0x40, 0x50, 0x20, 0x48, 0x20, 0x48, 0x20, 0x42, 0x38, 0x20, 0x01, 0x20, 0x00, 0x10, 0x00,
+    0x83, 0x03, 0x90, 0x60, 0xe0, 0xa1, 0xb8, 0x81, 0x38, 0x20, 0x81, 0x01, 0x20, 0x00, 0x28, 0x20,
+    0x59, 0x00, 0x00, 0xa6, 0x00, 0x21, 0x24, 0x42, 0x00, 0x00, 0x04, 0x08, 0x00, 0x48, 0x20, 0xa8,
+    0x60, 0xd8, 0xa1, 0xe8, 0xa1, 0x42, 0xd8, 0x81, 0x12, 0xd0, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0xc8,
+    0x81, 0xd0, 0x81, 0xb0, 0x60, 0x80, 0x60, 0x70, 0x20, 0x40, 0xe3, 0x18, 0x82, 0x00, 0x00, 0x68,
+    0x40, 0xe0, 0xa1, 0xd8, 0xa1, 0xb0, 0x61, 0x28, 0x20, 0x00, 0x00, 0x28, 0x20, 0x18, 0x00, 0x99,
+    0xa5, 0x02, 0x31, 0xa6, 0xad, 0x75, 0x08, 0x61, 0x43, 0x00, 0x00, 0x05, 0x10, 0x00, 0x60, 0x40,
+    0xc0, 0x81, 0xd8, 0xa1, 0xd8, 0x81, 0xd0, 0x81, 0x44, 0xd8, 0x81, 0x0d, 0xd8, 0xa1, 0xd8, 0x81,
+    0xe0, 0x80, 0xe5, 0x34, 0xa2, 0xca, 0x58, 0x00, 0x60, 0x40, 0xd8, 0xa1, 0xd8, 0x81, 0xd8, 0x81,
+    0x78, 0x40, 0x20, 0x00, 0x28, 0x20, 0x08, 0x00, 0x85, 0x03, 0x10, 0x00, 0x28, 0x20, 0x30, 0x20,
+    0x08, 0x00, 0x8f, 0xa5, 0x02, 0x9c, 0xd3, 0xce, 0x79, 0x08, 0x41, 0x45, 0x00, 0x00, 0x03, 0x38,
+    0x20, 0xa0, 0x60, 0xe0, 0xa1, 0xd8, 0xa1, 0x45, 0xd0, 0x81, 0x15, 0xd0, 0x60, 0xd9, 0xc6, 0xff,
+    0xbe, 0xea, 0x89, 0xd0, 0x60, 0xa0, 0x60, 0xc8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xc0, 0x81, 0x70,
+    0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x30, 0x20, 0x48, 0x20, 0x58, 0x40, 0x78,
+    0x40, 0x98, 0x60, 0xa0, 0x60, 0x50, 0x40, 0x90, 0xa4, 0x02, 0x10, 0x82, 0xe7, 0x3c, 0x6b, 0x4d,
+    0x47, 0x00, 0x00, 0x03, 0x20, 0x00, 0x80, 0x60, 0xc8, 0x81, 0xe0, 0xa1, 0x84, 0x15, 0xd0, 0x20,
+    0xec, 0xb2, 0xfe, 0xba, 0xd0, 0xa1, 0xd8, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0xc8, 0x81, 0xc8, 0x81,
+    0xd8, 0x81, 0x90, 0x61, 0x10, 0x00, 0x10, 0x00, 0x50, 0x40, 0x80, 0x60, 0xb0, 0x80, 0xc8, 0x81,
+    0xd0, 0x81, 0xe8, 0xa1, 0xd0, 0x81, 0x60, 0x40, 0x08, 0x00, 0x50, 0x00, 0x00, 0xa4, 0x02, 0x6b,
+    0x4d, 0xe7, 0x1c, 0x18, 0xe3, 0x48, 0x00, 0x00, 0x04, 0x08, 0x00, 0x58, 0x40, 0xb8, 0x81, 0xd8,
+    0xa1, 0xd8, 0x81, 0x81, 0x14, 0xc8, 0x60, 0xd0, 0xe2, 0xff, 0x3c, 0xeb, 0xce, 0xd0, 0x40, 0xd0,
+    0x81, 0xd8, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0xc0, 0x81, 0xd0, 0x81, 0x78, 0x40, 0x08, 0x00, 0x70,
+    0x40, 0xc8, 0x81, 0xd8, 0x81, 0xd8, 0xa1, 0xd8, 0xa1, 0xe0, 0xa1, 0xb0, 0x80, 0x40, 0x20, 0x52,
+    0x00, 0x00, 0xa4, 0x02, 0xce, 0x79, 0x8c, 0x71, 0x08, 0x41, 0x49, 0x00, 0x00, 0x19, 0x08, 0x00,
+    0x30, 0x20, 0x98, 0x60, 0xe0, 0xa1, 0xe0, 0xa1, 0xd0, 0xa1, 0xc8, 0x20, 0xe3, 0x8d, 0xff, 0x3c,
+    0xc9, 0x44, 0xc8, 0x60, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0xb8, 0x81,
+    0x58, 0x40, 0x40, 0x20, 0xc8, 0x81, 0xe0, 0xa1, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xa8, 0x60,
+    0x28, 0x20, 0x53, 0x00, 0x00, 0xa3, 0x02, 0x4a, 0x69, 0xe7, 0x3c, 0x31, 0x86, 0x4c, 0x00, 0x00,
+    0x08, 0x18, 0x00, 0x70, 0x40, 0xb0, 0x81, 0xd0, 0x80, 0xd8, 0x81, 0xfe, 0x9a, 0xec, 0x91, 0xd0,
+    0x60, 0xc8, 0x81, 0x42, 0xc0, 0x81, 0x0d, 0xc8, 0x81, 0xc8, 0x81, 0xa0, 0x61, 0x58, 0x41, 0x88,
+    0x60, 0xd0, 0x81, 0xc0, 0x81, 0xc8, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0x98, 0x60, 0x70, 0x40, 0x38,
+    0x20, 0x10, 0x00, 0x91, 0xa3, 0x02, 0xbd, 0xd7, 0xa5, 0x14, 0x08, 0x61, 0x4e, 0x00, 0x00, 0x19,
+    0x10, 0x00, 0x80, 0x00, 0xe2, 0xeb, 0xff, 0x3c, 0xd9, 0x64, 0xd0, 0x60, 0xd0, 0x81, 0xd0, 0x40,
+    0xd0, 0x40, 0xd0, 0x81, 0xc8, 0x81, 0xc8, 0x60, 0x98, 0x20, 0x78, 0x41, 0xa8, 0x81, 0xc8, 0x60,
+    0xd0, 0x60, 0xd0, 0x81, 0xd0, 0x60, 0xd0, 0x60, 0xd0, 0x81, 0xd0, 0xa1, 0xc0, 0x81, 0xb0, 0x81,
+    0x80, 0x40, 0x20, 0x00, 0x8f, 0x8e, 0x0d, 0x18, 0xc3, 0x63, 0x2c, 0x18, 0xe3, 0x00, 0x00, 0x10,
+    0xa2, 0x52, 0xaa, 0x10, 0xa2, 0x42, 0x08, 0xb5, 0x96, 0x31, 0xa6, 0x00, 0x00, 0x18, 0xc3, 0x42,
+    0x08, 0x08, 0x61, 0x83, 0x09, 0x18, 0xe3, 0x21, 0x04, 0x4a, 0x69, 0xe7, 0x1c, 0x42, 0x08, 0x00,
+    0x00, 0x00, 0x00, 0x08, 0x61, 0x29, 0x45, 0x10, 0xa2, 0x83, 0x01, 0x18, 0xc3, 0x18, 0xe3, 0x83,
+    0x1c, 0x40, 0x81, 0x99, 0xa6, 0xb9, 0x03, 0xf5, 0xf7, 0xff, 0xff, 0xec, 0x71, 0xd0, 0xa1, 0xd0,
+    0x60, 0xe2, 0x48, 0xd9, 0xe6, 0xd0, 0x60, 0xd0, 0xa1, 0xd2, 0xca, 0xcc, 0x0f, 0xa8, 0x81, 0xc0,
+    0x40, 0xc0, 0xc2, 0xc9, 0x03, 0xd0, 0x60, 0xeb, 0xce, 0xe3, 0x0b, 0xd8, 0xa1, 0xd8, 0x80, 0xd8,
+    0x81, 0xd8, 0x81, 0xd8, 0xa1, 0xa8, 0x60, 0x88, 0x60, 0x20, 0x00, 0x8d, 0x8e, 0x0d, 0x18, 0xe3,
+    0xd6, 0x9a, 0x8c, 0x71, 0x21, 0x04, 0xc6, 0x38, 0xf7, 0xbe, 0xad, 0x75, 0x21, 0x24, 0xc6, 0x18,
+    0xbd, 0xf7, 0x31, 0x86, 0xde, 0xfb, 0xef, 0x7d, 0x7b, 0xef, 0x81, 0x2c, 0x08, 0x61, 0x7b, 0xcf,
+    0xe7, 0x3c, 0xef, 0x5d, 0xf7, 0x9e, 0xa5, 0x34, 0x10, 0x82, 0x08, 0x41, 0x84, 0x10, 0xde, 0xdb,
+    0xf7, 0x9e, 0xde, 0xdb, 0x39, 0xe7, 0x00, 0x00, 0x08, 0x41, 0x6b, 0x6d, 0xf7, 0x9e, 0xbd, 0xf7,
+    0x29, 0x45, 0x00, 0x00, 0x08, 0x00, 0x82, 0x28, 0xee, 0x59, 0xff, 0x9e, 0xff, 0x3c, 0xff, 0x5d,
+    0xec, 0xb2, 0xff, 0x9e, 0xe2, 0xca, 0xec, 0x30, 0xff, 0xbe, 0xfe, 0xfb, 0xc9, 0x85, 0xb8, 0x20,
+    0xdb, 0x0b, 0xfe, 0xfb, 0xd2, 0x89, 0xc0, 0x00, 0xec, 0x70, 0xe4, 0x71, 0xc9, 0xc6, 0xf6, 0x9a,
+    0xe3, 0xce, 0xd0, 0x80, 0xd0, 0x80, 0x42, 0xd0, 0x81, 0x03, 0xd8, 0x81, 0xd8, 0xa1, 0xb8, 0x81,
+    0x48, 0x20, 0x8c, 0x4f, 0x00, 0x00, 0x3b, 0x7b, 0xcf, 0xc6, 0x18, 0xce, 0x59, 0xa5, 0x34, 0x84,
+    0x30, 0xef, 0x7d, 0x10, 0xa2, 0x42, 0x08, 0xef, 0x7d, 0xb5, 0xb6, 0x84, 0x30, 0xb5, 0xb6, 0xbd,
+    0xd7, 0x00, 0x00, 0x08, 0x41, 0x94, 0xb2, 0xde, 0xfb, 0x5a, 0xeb, 0x6b, 0x4d, 0xef, 0x5d, 0x42,
+    0x08, 0x21, 0x24, 0xbd, 0xf7, 0xad, 0x55, 0x4a, 0x49, 0x4a, 0x69, 0xef, 0x5d, 0xa5, 0x14, 0x00,
+    0x00, 0x5a, 0xeb, 0xce, 0x79, 0xad, 0x75, 0xd6, 0xba, 0x31, 0xc7, 0x40, 0x00, 0xba, 0xca, 0xf7,
+    0x1c, 0xf4, 0xf3, 0xda, 0x07, 0xfe, 0xda, 0xf5, 0x34, 0xd0, 0x61, 0xf5, 0xf7, 0xf6, 0x38, 0xf6,
+    0x17, 0xdb, 0xae, 0xff, 0x9e, 0xdb, 0x0b, 0xd0, 0x00, 0xd9, 0x85, 0xf6, 0x17, 0xdb, 0x6d, 0xc9,
+    0x86, 0xfe, 0xfb, 0xeb, 0xce, 0xec, 0x0f, 0xff, 0x3c, 0xd2, 0x48, 0xc0, 0x40, 0xc8, 0x81, 0x44,
+    0xd0, 0x81, 0x03, 0xd8, 0x81, 0xc8, 0x81, 0x80, 0x60, 0x10, 0x00, 0x8a, 0x8f, 0x3a, 0x63, 0x2c,
+    0xf7, 0x9e, 0xd6, 0x9a, 0x10, 0xa2, 0x39, 0xc7, 0xe7, 0x3c, 0x08, 0x61, 0x52, 0xaa, 0xff, 0xff,
+    0x84, 0x30, 0x08, 0x41, 0x9c, 0xd3, 0xa5, 0x34, 0x00, 0x00, 0x73, 0xae, 0xe7, 0x1c, 0x4a, 0x69,
+    0x00, 0x00, 0xa5, 0x14, 0xa5, 0x14, 0x39, 0xc7, 0xc6, 0x38, 0x73, 0x8e, 0x08, 0x41, 0x08, 0x41,
+    0x52, 0x8a, 0xde, 0xfb, 0x9c, 0xf3, 0x29, 0x45, 0xc6, 0x18, 0x39, 0xa7, 0x5b, 0x0c, 0xce, 0x38,
+    0x78, 0x82, 0xd1, 0xc6, 0xfe, 0xdb, 0xec, 0xf3, 0xd0, 0x41, 0xe2, 0x69, 0xff, 0x1c, 0xda, 0x48,
+    0xd0, 0x60, 0xf6, 0x79, 0xf7, 0x7d, 0xb9, 0x65, 0xc1, 0x64, 0xff, 0x7d, 0xe2, 0x48, 0xd0, 0x00,
+    0xda, 0x07, 0xf6, 0x38, 0xe3, 0x6d, 0xed, 0x13, 0xf6, 0x9a, 0xe3, 0x8d, 0xfe, 0xba, 0xf5, 0x75,
+    0xd8, 0xe2, 0xd0, 0x60, 0x42, 0xc8, 0x81, 0x43, 0xd0, 0x81, 0x03, 0xd8, 0x81, 0xd8, 0x81, 0x98,
+    0x60, 0x30, 0x20, 0x89, 0x8f, 0x39, 0x8c, 0x51, 0xff, 0xdf, 0x4a, 0x69, 0x00, 0x00, 0x84, 0x10,
+    0xc6, 0x18, 0x08, 0x41, 0xad, 0x55, 0xde, 0xdb, 0x08, 0x41, 0x29, 0x45, 0xce, 0x59, 0x63, 0x2c,
+    0x29, 0x65, 0xd6, 0xba, 0x84, 0x10, 0x00, 0x00, 0x42, 0x28, 0xde, 0xdb, 0x4a, 0x69, 0x9c, 0xf3,
+    0x6b, 0x6d, 0x00, 0x20, 0x39, 0xc7, 0xb5, 0x96, 0xc6, 0x38, 0xf7, 0xbe, 0x63, 0x2c, 0x7b, 0xef,
+    0x7b, 0xef, 0x08, 0x82, 0xa5, 0x55, 0xe4, 0xb2, 0xc0, 0x40, 0xf5, 0x34, 0xf6, 0x58, 0xd9, 0x24,
+    0xd0, 0x40, 0xf6, 0x18, 0xed, 0x34, 0xd0, 0x81, 0xd9, 0xc6, 0xff, 0xbe, 0xe3, 0xef, 0xc8, 0x20,
+    0xeb, 0xad, 0xfe, 0xfb, 0xd0, 0xc1, 0xd0, 0x60, 0xec, 0x0f, 0xf6, 0x99, 0xec, 0xf3, 0xff, 0xbe,
+    0xf5, 0x75, 0xf5, 0xf7, 0xff, 0xff, 0xe2, 0xea, 0xd0, 0x60, 0x43, 0xd0, 0x81, 0x00, 0xc8, 0x81,
+    0x44, 0xd0, 0x81, 0x02, 0xd8, 0x81, 0xc0, 0x81, 0x48, 0x20, 0x88, 0x8e, 0x39, 0x00, 0x20, 0xce,
+    0x59, 0xb5, 0x96, 0x10, 0x82, 0x10, 0x82, 0xde, 0xfb, 0x5a, 0xeb, 0x21, 0x04, 0xef, 0x7d, 0x6b,
+    0x4d, 0x00, 0x00, 0x7b, 0xcf, 0xce, 0x79, 0x10, 0xa2, 0x84, 0x10, 0xce, 0x59, 0x18, 0xe3, 0x08,
+    0x41, 0xbd, 0xd7, 0xa5, 0x34, 0x10, 0xa2, 0x18, 0xc3, 0x00, 0x00, 0x39, 0xe7, 0xce, 0x59, 0x4a,
+    0x69, 0x8c, 0x71, 0xd6, 0xba, 0x10, 0xa2, 0x29, 0x65, 0x08, 0x41, 0x5b, 0x2c, 0xf6, 0xda, 0xe2,
+    0x07, 0xda, 0x28, 0xfe, 0xfb, 0xe3, 0x4c, 0xd0, 0x00, 0xe3, 0xae, 0xff, 0x3c, 0xda, 0x28, 0xc0,
+    0x00, 0xe4, 0xd2, 0xfe, 0xfb, 0xd8, 0xe2, 0xd9, 0x03, 0xfe, 0xda, 0xec, 0x30, 0xd0, 0x00, 0xe2,
+    0x68, 0xff, 0x3c, 0xfe, 0xba, 0xfe, 0xfb, 0xff, 0xbe, 0xf6, 0xdb, 0xff, 0xbe, 0xf5, 0xb6, 0xd9,
+    0x23, 0x82, 0x45, 0xd8, 0x81, 0x42, 0xd0, 0x81, 0x03, 0xd8, 0x81, 0xc8, 0x81, 0x70, 0x40, 0x18,
+    0x00, 0x86, 0x8e, 0x39, 0x4a, 0x69, 0xe7, 0x1c, 0x4a, 0x49, 0x08, 0x41, 0x9c, 0xf3, 0xbd, 0xf7,
+    0x08, 0x41, 0x8c, 0x71, 0xce, 0x79, 0x00, 0x20, 0x39, 0xe7, 0xde, 0xfb, 0x63, 0x0c, 0x18, 0xe3,
+    0xc6, 0x38, 0x94, 0xb2, 0x00, 0x20, 0x8c, 0x71, 0xef, 0x5d, 0x4a, 0x49, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xa2, 0xc6, 0x38, 0x52, 0x8a, 0x52, 0xaa, 0xef, 0x5d, 0x4a, 0x49, 0x00, 0x00, 0x00, 0x20,
+    0x63, 0x4d, 0xf7, 0xdf, 0xf5, 0x75, 0xd0, 0x40, 0xec, 0x50, 0xf6, 0x9a, 0xd9, 0xa6, 0xe2, 0x69,
+    0xff, 0x5c, 0xe4, 0xb2, 0xc8, 0x61, 0xd1, 0x64, 0xff, 0x3c, 0xe3, 0x6d, 0xd0, 0x61, 0xec, 0xb2,
+    0xfe, 0xda, 0xd8, 0xc2, 0xd9, 0xe6, 0xfe, 0xba, 0xff, 0xbe, 0xf5, 0xf7, 0xf6, 0xba, 0xff, 0x3c,
+    0xed, 0x95, 0xf6, 0x59, 0xe3, 0x0b, 0xd0, 0x40, 0x42, 0xd0, 0x81, 0x01, 0xb0, 0x81, 0xb8, 0x81,
+    0x43, 0xd0, 0x81, 0x43, 0xd8, 0x81, 0x04, 0xe0, 0xa1, 0xe0, 0xa1, 0xa0, 0x60, 0x40, 0x20, 0x08,
+    0x00, 0x84, 0x8e, 0x13, 0xa5, 0x14, 0xe7, 0x3c, 0x63, 0x2c, 0x94, 0xb2, 0xd6, 0x9a, 0x29, 0x65,
+    0x00, 0x00, 0xc6, 0x18, 0x8c, 0x51, 0x42, 0x28, 0xce, 0x59, 0x9c, 0xf3, 0x00, 0x00, 0x29, 0x45,
+    0xce, 0x79, 0xc6, 0x38, 0xa5, 0x34, 0xff, 0xff, 0x8c, 0x71, 0x08, 0x61, 0x81, 0x2e, 0x6b, 0x4d,
+    0xe7, 0x1c, 0x8c, 0x71, 0xde, 0xdb, 0x63, 0x0c, 0x00, 0x00, 0x08, 0x41, 0x6b, 0x8e, 0xff, 0x5c,
+    0xff, 0x5d, 0xe2, 0xaa, 0xd0, 0x00, 0xec, 0x91, 0xff, 0x3c, 0xed, 0x13, 0xff, 0x1b, 0xfe, 0xfb,
+    0xd9, 0xc6, 0xd0, 0x00, 0xe2, 0xa9, 0xfe, 0xfb, 0xe2, 0x48, 0xec, 0x2f, 0xff, 0x1c, 0xe2, 0x48,
+    0xd0, 0x81, 0xf5, 0x75, 0xff, 0x3c, 0xe4, 0x0f, 0xe3, 0x6d, 0xf6, 0x38, 0xe3, 0x4c, 0xec, 0xd2,
+    0xec, 0xd2, 0xd0, 0xc2, 0xd0, 0x60, 0xd0, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0x58, 0x40, 0x28, 0x20,
+    0x60, 0x40, 0x70, 0x40, 0x68, 0x40, 0x78, 0x40, 0x88, 0x60, 0x88, 0x60, 0x42, 0x90, 0x60, 0x04,
+    0xa0, 0x60, 0xb0, 0x81, 0xb0, 0x80, 0x60, 0x40, 0x10, 0x00, 0x83, 0x8d, 0x13, 0x39, 0xc7, 0xd6,
+    0xba, 0xd6, 0x9a, 0xce, 0x59, 0xb5, 0x96, 0x31, 0x86, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x34, 0xef,
+    0x5d, 0xd6, 0xba, 0x94, 0xb2, 0x08, 0x41, 0x00, 0x00, 0x08, 0x61, 0x63, 0x2c, 0xa5, 0x14, 0xce,
+    0x79, 0xd6, 0x9a, 0x31, 0xa6, 0x42, 0x00, 0x00, 0x28, 0x52, 0xaa, 0xce, 0x59, 0xc6, 0x18, 0x4a,
+    0x69, 0x00, 0x00, 0x00, 0x20, 0x6b, 0x6d, 0xf5, 0xf7, 0xf5, 0x54, 0xf5, 0xd6, 0xd0, 0xa1, 0xd0,
+    0x40, 0xda, 0x48, 0xec, 0xf3, 0xf5, 0xb6, 0xff, 0x7d, 0xe3, 0xce, 0xd0, 0x80, 0xd8, 0x20, 0xe2,
+    0x27, 0xff, 0x1b, 0xff, 0x1b, 0xfe, 0x9a, 0xe2, 0xca, 0xd0, 0x20, 0xd0, 0xc2, 0xe3, 0x2b, 0xd2,
+    0x48, 0xc8, 0x40, 0xd9, 0x23, 0xd9, 0x03, 0xd9, 0x24, 0xe3, 0xae, 0xc9, 0xc6, 0xc8, 0x40, 0xd8,
+    0xa1, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0xa1, 0xb8, 0x81, 0x10, 0x00, 0x49, 0x00, 0x00, 0x03, 0x08,
+    0x00, 0x20, 0x20, 0x40, 0x20, 0x20, 0x00, 0x83, 0x8d, 0x04, 0x9c, 0xf3, 0xc6, 0x38, 0x31, 0xa6,
+    0x18, 0xc3, 0x00, 0x20, 0x42, 0x00, 0x00, 0x02, 0x31, 0xa6, 0x73, 0xae, 0x4a, 0x69, 0x44, 0x00,
+    0x00, 0x02, 0x10, 0x82, 0x94, 0xb2, 0x7b, 0xcf, 0x44, 0x00, 0x00, 0x21, 0x21, 0x24, 0x08, 0x41,
+    0x00, 0x00, 0x00, 0x00, 0x5b, 0x0c, 0xed, 0xf7, 0xea, 0xca, 0xf6, 0x18, 0xe3, 0x0b, 0xd0, 0x00,
+    0xd0, 0xa1, 0xd8, 0x60, 0xd0, 0x00, 0xeb, 0x6d, 0xfd, 0x75, 0xe1, 0x64, 0xe0, 0x60, 0xb8, 0x60,
+    0xa8, 0xa1, 0x9b, 0x0b, 0xdb, 0xce, 0xd9, 0x85, 0xd0, 0x20, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x20,
+    0xc0, 0x20, 0xd0, 0x80, 0xd0, 0x60, 0xd0, 0x40, 0xd0, 0xa1, 0xd8, 0x60, 0xc0, 0x60, 0xc0, 0x81,
+    0x43, 0xd0, 0x81, 0x01, 0xe0, 0xa1, 0x58, 0x40, 0x51, 0x00, 0x00, 0x8c, 0x02, 0x42, 0x28, 0xe7,
+    0x1c, 0x6b, 0x6d, 0x4d, 0x00, 0x00, 0x02, 0x10, 0x82, 0x39, 0xe7, 0x18, 0xe3, 0x47, 0x00, 0x00,
+    0x12, 0x4a, 0x08, 0xe6, 0x58, 0xea, 0x27, 0xec, 0x0f, 0xfd, 0xd6, 0xe0, 0x60, 0xe0, 0x80, 0xd8,
+    0xa1, 0xd0, 0x81, 0xd0, 0x60, 0xc1, 0xe7, 0xb9, 0xa6, 0xa8, 0x60, 0x88, 0x60, 0x40, 0x20, 0x20,
+    0x00, 0x30, 0x00, 0xc8, 0x00, 0xd0, 0x40, 0x42, 0xd0, 0x81, 0x04, 0xc8, 0x81, 0xc8, 0x81, 0xd8,
+    0x81, 0xd0, 0x81, 0xd0, 0xa1, 0x42, 0xd0, 0x81, 0x01, 0xc0, 0x81, 0xc8, 0x81, 0x82, 0x01, 0xd8,
+    0xa1, 0x80, 0x60, 0x91, 0x8b, 0x03, 0x08, 0x41, 0xa5, 0x34, 0xc6, 0x38, 0x21, 0x24, 0x56, 0x00,
+    0x00, 0x14, 0x08, 0x00, 0x58, 0xe3, 0xee, 0x38, 0xeb, 0x4c, 0xd1, 0x85, 0xf6, 0xba, 0xb2, 0x07,
+    0xa8, 0x00, 0x98, 0x60, 0x78, 0x40, 0x60, 0x40, 0x58, 0x40, 0x38, 0x00, 0x28, 0x00, 0x20, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x40, 0xd8, 0xa1, 0xd0, 0xa1, 0x83, 0x42, 0xd0, 0x81,
+    0x05, 0xd8, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0xc0, 0x81, 0x82, 0x02, 0xd8,
+    0x81, 0xb0, 0x80, 0x28, 0x20, 0x90, 0x8b, 0x02, 0x52, 0xaa, 0xe7, 0x3c, 0x6b, 0x4d, 0x56, 0x00,
+    0x00, 0x0a, 0x18, 0x00, 0x70, 0x20, 0xed, 0x13, 0xc5, 0x13, 0x68, 0x41, 0xdd, 0x75, 0x94, 0x71,
+    0x20, 0x00, 0x20, 0x00, 0x10, 0x00, 0x08, 0x00, 0x47, 0x00, 0x00, 0x00, 0x78, 0x60, 0x44, 0xd0,
+    0x81, 0x83, 0x04, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0x83, 0x02, 0xd0,
+    0x81, 0xe0, 0xa1, 0x60, 0x40, 0x90, 0x8a, 0x03, 0x18, 0xc3, 0xbd, 0xd7, 0xb5, 0xb6, 0x18, 0xe3,
+    0x96, 0x06, 0x20, 0x00, 0x8a, 0x89, 0xe6, 0xdb, 0x28, 0xc3, 0x63, 0x2c, 0xc6, 0x38, 0x10, 0x82,
+    0x4a, 0x00, 0x00, 0x01, 0x10, 0x00, 0x98, 0x60, 0x83, 0x0b, 0xc8, 0x81, 0xd0, 0x81, 0xd8, 0x81,
+    0xd0, 0x81, 0xd8, 0x81, 0xb0, 0x80, 0x80, 0x60, 0xc8, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xc8, 0x81,
+    0xc8, 0x81, 0x82, 0x01, 0xd8, 0xa1, 0x90, 0x60, 0x90, 0x8a, 0x02, 0x73, 0xae, 0xe7, 0x3c, 0x52,
+    0xaa, 0x57, 0x00, 0x00, 0x05, 0x00, 0x20, 0xbe, 0x18, 0x5b, 0x0c, 0x29, 0x86, 0xd6, 0xba, 0x39,
+    0xe7, 0x4b, 0x00, 0x00, 0x02, 0x38, 0x20, 0xc8, 0x81, 0xd8, 0x81, 0x84, 0x08, 0xd0, 0x81, 0xd8,
+    0x81, 0xe0, 0xa1, 0x80, 0x60, 0x10, 0x00, 0x70, 0x40, 0xc8, 0x81, 0xd8, 0xa1, 0xd0, 0x81, 0x83,
+    0x01, 0xd8, 0x81, 0x98, 0x60, 0x90, 0x89, 0x03, 0x29, 0x65, 0xce, 0x79, 0x9c, 0xd3, 0x00, 0x20,
+    0x97, 0x04, 0x42, 0x28, 0xe7, 0x3c, 0x52, 0x8a, 0xce, 0x59, 0x6b, 0x4d, 0x4c, 0x00, 0x00, 0x01,
+    0x50, 0x40, 0xd0, 0x81, 0x86, 0x06, 0xd0, 0x81, 0xb0, 0x81, 0x40, 0x20, 0x00, 0x00, 0x38, 0x20,
+    0xb8, 0x81, 0xe0, 0xa1, 0x44, 0xd0, 0x81, 0x02, 0xd8, 0x81, 0xb0, 0x81, 0x10, 0x00, 0x8f, 0x89,
+    0x02, 0x18, 0xc3, 0x42, 0x28, 0x18, 0xe3, 0x58, 0x00, 0x00, 0x04, 0x6b, 0x6d, 0xf7, 0xbe, 0xe7,
+    0x3c, 0x73, 0xae, 0x00, 0x20, 0x8c, 0x00, 0x60, 0x40, 0x83, 0x05, 0xc8, 0x81, 0xd0, 0x81, 0xd0,
+    0x81, 0xd8, 0x81, 0xd0, 0x81, 0x70, 0x40, 0x42, 0x00, 0x00, 0x02, 0x68, 0x40, 0xd0, 0x81, 0xd8,
+    0xa1, 0x45, 0xd0, 0x81, 0x00, 0x30, 0x20, 0x8f, 0x65, 0x00, 0x00, 0x03, 0x21, 0x04, 0x7b, 0xef,
+    0x4a, 0x49, 0x08, 0x41, 0x4d, 0x00, 0x00, 0x01, 0x48, 0x20, 0xc8, 0x81, 0x82, 0x42, 0xd0, 0x81,
+    0x02, 0xd8, 0xa1, 0xc8, 0x81, 0x50, 0x20, 0x82, 0x02, 0x08, 0x00, 0x78, 0x40, 0xc8, 0x81, 0x83,
+    0x02, 0xd8, 0x81, 0xc8, 0x81, 0x38, 0x20, 0x8f, 0x66, 0x00, 0x00, 0x00, 0x00, 0x20, 0x4f, 0x00,
+    0x00, 0x01, 0x68, 0x40, 0xd0, 0x81, 0x84, 0x02, 0xd8, 0x81, 0xd8, 0xa1, 0x90, 0x60, 0x45, 0x00,
+    0x00, 0x02, 0x78, 0x40, 0xd8, 0x81, 0xd8, 0x81, 0x42, 0xd0, 0x81, 0x01, 0xd8, 0xa1, 0x60, 0x40,
+    0x8f, 0x77, 0x00, 0x00, 0x01, 0x80, 0x40, 0xd8, 0xa1, 0x45, 0xd0, 0x81, 0x01, 0xb0, 0x61, 0x20,
+    0x00, 0x85, 0x01, 0x18, 0x00, 0x98, 0x60, 0x43, 0xd0, 0x81, 0x01, 0xd8, 0xa1, 0x78, 0x60, 0x8f,
+    0xb7, 0x02, 0x60, 0x40, 0xc8, 0x81, 0xd8, 0x81, 0x82, 0x02, 0xd8, 0x81, 0xb8, 0x81, 0x30, 0x20,
+    0x47, 0x00, 0x00, 0x02, 0x10, 0x00, 0x98, 0x60, 0xd8, 0x81, 0x82, 0x00, 0x98, 0x60, 0x8f, 0xb7,
+    0x01, 0x88, 0x60, 0xd8, 0xa1, 0x44, 0xd0, 0x81, 0x00, 0x80, 0x60, 0x49, 0x00, 0x00, 0x05, 0x20,
+    0x00, 0xa8, 0x61, 0xd8, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0x90, 0x60, 0x8f, 0xb7, 0x01, 0x80, 0x60,
+    0xd8, 0x81, 0x82, 0x02, 0xd8, 0x81, 0x80, 0x60, 0x10, 0x00, 0x4a, 0x00, 0x00, 0x05, 0x28, 0x00,
+    0xb0, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0x18, 0x00, 0x8e, 0xb7, 0x00, 0x88, 0x60, 0x82,
+    0x02, 0xd8, 0x81, 0xb8, 0x81, 0x28, 0x20, 0x4c, 0x00, 0x00, 0x04, 0x30, 0x20, 0xb8, 0x81, 0xd8,
+    0x81, 0xd0, 0x81, 0x30, 0x20, 0x8e, 0xb7, 0x05, 0x80, 0x60, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81,
+    0xc8, 0x81, 0x48, 0x20, 0x4e, 0x00, 0x00, 0x03, 0x40, 0x20, 0xb8, 0x81, 0xd8, 0x81, 0x48, 0x20,
+    0x8e, 0xb7, 0x04, 0x88, 0x60, 0xd8, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0x68, 0x40, 0x50, 0x00, 0x00,
+    0x02, 0x40, 0x20, 0xd8, 0x81, 0x90, 0x60, 0x8e, 0xb7, 0x03, 0xa0, 0x60, 0xd8, 0x81, 0xe0, 0xa1,
+    0x88, 0x60, 0x52, 0x00, 0x00, 0x01, 0x68, 0x40, 0xa8, 0x60, 0x8e, 0xb7, 0x03, 0x98, 0x60, 0xd8,
+    0x81, 0xb0, 0x80, 0x28, 0x20, 0x92, 0x02, 0x08, 0x00, 0x80, 0x40, 0x28, 0x20, 0x8d, 0xb6, 0x03,
+    0x10, 0x00, 0xb0, 0x80, 0xd8, 0x81, 0x38, 0x20, 0x54, 0x00, 0x00, 0x01, 0x10, 0x00, 0x20, 0x00,
+    0x8d, 0xb6, 0x03, 0x20, 0x00, 0xc8, 0x81, 0x88, 0x60, 0x08, 0x00, 0x64, 0x00, 0x00, 0xb6, 0x02,
+    0x38, 0x20, 0xb0, 0x60, 0x20, 0x00, 0x65, 0x00, 0x00, 0xb6, 0x01, 0x50, 0x40, 0x50, 0x20, 0x66,
+    0x00, 0x00, 0xb6, 0x01, 0x20, 0x00, 0x08, 0x00, 0xa6, 0x7f, 0x00, 0x00, 0x9f, 0xbf, 0x9f,
 };
 
-static const uint8_t image_data_maplepad_logo_9664[12288] = {
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░∙∙∙∙∙░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░▓∙∙∙∙∙∙∙░░░░░░░░░░░░▓▒∙∙░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙▓█∙∙∙∙∙∙∙∙░░░░░░░░░░▒█▒░░░░░░∙∙∙∙∙∙∙∙∙░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█▒∙∙∙∙∙∙∙∙∙∙░░░░░░░░▓█░░░░░░░░∙∙∙░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙▒█∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░█▓░░░░░░░∙∙∙░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█▒∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░▒█░░░░░░░░∙∙░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░█∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░█▓░░░░░░░░∙░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙▓▓∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙▒█▒░░░░░░░░∙░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙▒∙∙∙░∙░▓░∙∙░∙∙∙∙∙∙∙░█░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░██▓░░▒▒░░▒▓░░░░░▓▒░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█▒∙▓█▓∙▓▓░██▒∙∙∙▒███▓∙∙▒███░∙∙▒█▓∙∙∙░████▓█▒▓██▒░▒█▒░▓▓▒█▓░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙▒▓▓▓▒█∙░█▓▒▓▓∙∙▒█░▒█░∙▓▓░░█▓∙░█▓█░∙▒█▓▒█▓░███▒█▒░▒█▒░█▓▓█▒░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░██∙░█∙░█▒∙▓▓∙▒█░∙▓▓░▓▒∙∙░█▓∙▓░░▓░▒█▓░▒█▒░██░░█▒░▒█▒▓█▒█▓░░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙▒█░∙▒▓∙▓█∙∙▓░∙█▒∙░█░▓▒∙░▓▓█▒▒▒∙▓▓░▓█░░█▓░▒█▓░▓█░░▓█▓█▓██▒░░░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙▓▓∙∙█░∙█▒∙▒█∙▒▓∙∙▓▓∙∙∙░▓░▒█∙∙∙░█▒▒█▒░▓█▒░▓█░░█▓░▒██████▓░░░░░░░░░░░░░░░∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░█░∙▓▓∙▒█∙░█░∙▓▒∙▒█░∙∙∙▓░░█░∙∙▒█▓░▓█▒▒█▓░░█▒░▓█░▒█████▓█▒░░░░░░░░░░░░░░░░░∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙▓█▒▒█∙∙▓▒░▓▓∙∙█▓▓█▒∙∙∙▒█▒█░∙∙▒██▒░▓█▓██▒░▒█▒▓█▒░▓█▓▒█▒▓▓░░░░░∙∙∙∙∙∙░░░░░░░░∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙░██▓▓∙∙∙▓██▒∙∙∙░▓██░∙∙∙░▓▓░∙∙▒█▓▓░░▒▓▓█▓░░▒███▒░░▒▒░░░░▓▒░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙▓▓░∙∙∙∙∙░▒░∙∙∙∙∙∙▒▒∙∙∙∙∙∙∙∙∙░█▒█▒░░░░▓▓▒░░░▒▒▒░░░░░░░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙░█▒∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░∙∙∙∙∙∙∙∙∙░█▒▓█░░░░░▒░░░∙∙∙░░░░░░░░░░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙▓▓∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░█▒▒█▒░░∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙░█▒∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙▓▓∙▓▒∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙▓▓∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░█∙░▓∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙▒█░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙▓░∙█░∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░░∙∙░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙█▒∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░█░▓▒∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░∙∙∙░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙▒██▒∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░∙∙∙∙∙░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙▒░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░∙∙∙∙∙∙░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░∙∙∙∙∙∙∙░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░░∙∙∙∙∙∙∙∙░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░∙∙∙∙∙∙∙∙∙∙░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x30, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x50, 0x41, 0x60, 0x41, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0x50, 0x41, 0x40, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x30, 0x20, 0x48, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x30, 0x20, 0x30, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x38, 0x20,
-    0x28, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x38, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x38, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x40, 0x20, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x20, 0x28, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x30, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x38, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x30, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x20, 0x68, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x30, 0x20, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0xc0, 0x81, 0x50, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x20, 0x28, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
-    0xb8, 0x81, 0xd0, 0x81, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x30, 0x20, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x48, 0x20, 0x80, 0x40, 0x80, 0x60, 0x68, 0x40, 0x60, 0x40,
-    0x50, 0x40, 0x50, 0x40, 0x50, 0x20, 0x48, 0x20, 0x48, 0x20, 0x38, 0x20, 0x38, 0x20, 0x38, 0x20, 0x20, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x90, 0x60, 0xe0, 0xa1, 0xb8, 0x81, 0x38, 0x20, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x28, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x48, 0x20, 0xa8, 0x60, 0xd8, 0xa1, 0xe8, 0xa1, 0xd8, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0xc8, 0x81, 0xd0, 0x81, 0xb0, 0x60, 0x80, 0x60, 0x70, 0x20, 0x40, 0xe3, 0x18, 0x82, 0x00, 0x00, 0x68, 0x40, 0xe0, 0xa1, 0xd8, 0xa1, 0xb0, 0x61, 0x28, 0x20, 0x00, 0x00, 0x28, 0x20, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xa6, 0xad, 0x75, 0x08, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x60, 0x40, 0xc0, 0x81, 0xd8, 0xa1, 0xd8, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xd8, 0xa1, 0xd8, 0x81, 0xe0, 0x80, 0xe5, 0x34, 0xa2, 0xca, 0x58, 0x00, 0x60, 0x40, 0xd8, 0xa1, 0xd8, 0x81, 0xd8, 0x81, 0x78, 0x40, 0x20, 0x00, 0x28, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x28, 0x20, 0x30, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xd3, 0xce, 0x79, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x20, 0xa0, 0x60, 0xe0, 0xa1, 0xd8, 0xa1, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x60, 0xd9, 0xc6, 0xff, 0xbe, 0xea, 0x89, 0xd0, 0x60, 0xa0, 0x60, 0xc8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xc0, 0x81, 0x70, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x30, 0x20, 0x48, 0x20, 0x58, 0x40, 0x78, 0x40, 0x98, 0x60, 0xa0, 0x60, 0x50, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x82, 0xe7, 0x3c, 0x6b, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x80, 0x60, 0xc8, 0x81, 0xe0, 0xa1, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x20, 0xec, 0xb2, 0xfe, 0xba, 0xd0, 0xa1, 0xd8, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0xc8, 0x81, 0xc8, 0x81, 0xd8, 0x81, 0x90, 0x61, 0x10, 0x00, 0x10, 0x00, 0x50, 0x40, 0x80, 0x60, 0xb0, 0x80, 0xc8, 0x81,
-    0xd0, 0x81, 0xe8, 0xa1, 0xd0, 0x81, 0x60, 0x40, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x4d, 0xe7, 0x1c, 0x18, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x58, 0x40, 0xb8, 0x81, 0xd8, 0xa1, 0xd8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xc8, 0x60, 0xd0, 0xe2, 0xff, 0x3c, 0xeb, 0xce,
-    0xd0, 0x40, 0xd0, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0xc0, 0x81, 0xd0, 0x81, 0x78, 0x40, 0x08, 0x00, 0x70, 0x40, 0xc8, 0x81, 0xd8, 0x81, 0xd8, 0xa1, 0xd8, 0xa1, 0xe0, 0xa1, 0xb0, 0x80, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x79, 0x8c, 0x71, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x30, 0x20, 0x98, 0x60, 0xe0, 0xa1, 0xe0, 0xa1, 0xd0, 0xa1, 0xc8, 0x20, 0xe3, 0x8d, 0xff, 0x3c, 0xc9, 0x44, 0xc8, 0x60, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0xb8, 0x81, 0x58, 0x40, 0x40, 0x20, 0xc8, 0x81, 0xe0, 0xa1, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xa8, 0x60, 0x28, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x69, 0xe7, 0x3c, 0x31, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x70, 0x40, 0xb0, 0x81, 0xd0, 0x80, 0xd8, 0x81, 0xfe, 0x9a, 0xec, 0x91, 0xd0, 0x60, 0xc8, 0x81, 0xc0, 0x81, 0xc0, 0x81, 0xc0, 0x81, 0xc8, 0x81, 0xc8, 0x81, 0xa0, 0x61, 0x58, 0x41, 0x88, 0x60, 0xd0, 0x81, 0xc0, 0x81, 0xc8, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0x98, 0x60, 0x70, 0x40, 0x38, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd7, 0xa5, 0x14, 0x08, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0xe2, 0xeb, 0xff, 0x3c, 0xd9, 0x64, 0xd0, 0x60, 0xd0, 0x81, 0xd0, 0x40, 0xd0, 0x40, 0xd0, 0x81, 0xc8, 0x81, 0xc8, 0x60, 0x98, 0x20, 0x78, 0x41, 0xa8, 0x81, 0xc8, 0x60, 0xd0, 0x60, 0xd0, 0x81, 0xd0, 0x60, 0xd0, 0x60, 0xd0, 0x81, 0xd0, 0xa1, 0xc0, 0x81, 0xb0, 0x81, 0x80, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc3, 0x63, 0x2c, 0x18, 0xe3, 0x00, 0x00, 0x10, 0xa2, 0x52, 0xaa, 0x10, 0xa2, 0x42, 0x08, 0xb5, 0x96, 0x31, 0xa6, 0x00, 0x00, 0x18, 0xc3, 0x42, 0x08, 0x08, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xe3, 0x21, 0x04, 0x4a, 0x69, 0xe7, 0x1c, 0x42, 0x08, 0x00, 0x00, 0x00, 0x00, 0x08, 0x61, 0x29, 0x45, 0x10, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc3, 0x18, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x81, 0x99, 0xa6, 0xb9, 0x03, 0xf5, 0xf7, 0xff, 0xff, 0xec, 0x71, 0xd0, 0xa1, 0xd0, 0x60, 0xe2, 0x48, 0xd9, 0xe6, 0xd0, 0x60, 0xd0, 0xa1, 0xd2, 0xca, 0xcc, 0x0f, 0xa8, 0x81, 0xc0, 0x40, 0xc0, 0xc2, 0xc9, 0x03, 0xd0, 0x60, 0xeb, 0xce, 0xe3, 0x0b, 0xd8, 0xa1, 0xd8, 0x80, 0xd8, 0x81, 0xd8, 0x81, 0xd8, 0xa1, 0xa8, 0x60, 0x88, 0x60, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xe3, 0xd6, 0x9a, 0x8c, 0x71, 0x21, 0x04, 0xc6, 0x38, 0xf7, 0xbe, 0xad, 0x75, 0x21, 0x24, 0xc6, 0x18, 0xbd, 0xf7, 0x31, 0x86, 0xde, 0xfb, 0xef, 0x7d, 0x7b, 0xef, 0x00, 0x00, 0x00, 0x00, 0x08, 0x61, 0x7b, 0xcf, 0xe7, 0x3c, 0xef, 0x5d, 0xf7, 0x9e, 0xa5, 0x34, 0x10, 0x82, 0x08, 0x41, 0x84, 0x10, 0xde, 0xdb, 0xf7, 0x9e, 0xde, 0xdb, 0x39, 0xe7, 0x00, 0x00, 0x08, 0x41, 0x6b, 0x6d, 0xf7, 0x9e, 0xbd, 0xf7, 0x29, 0x45, 0x00, 0x00, 0x08, 0x00, 0x82, 0x28, 0xee, 0x59, 0xff, 0x9e, 0xff, 0x3c, 0xff, 0x5d, 0xec, 0xb2, 0xff, 0x9e, 0xe2, 0xca, 0xec, 0x30, 0xff, 0xbe, 0xfe, 0xfb, 0xc9, 0x85, 0xb8, 0x20, 0xdb, 0x0b, 0xfe, 0xfb, 0xd2, 0x89, 0xc0, 0x00, 0xec, 0x70, 0xe4, 0x71, 0xc9, 0xc6,
-    0xf6, 0x9a, 0xe3, 0xce, 0xd0, 0x80, 0xd0, 0x80, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xd8, 0xa1, 0xb8, 0x81, 0x48, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xcf, 0xc6, 0x18, 0xce, 0x59, 0xa5, 0x34, 0x84, 0x30, 0xef, 0x7d, 0x10, 0xa2, 0x42, 0x08, 0xef, 0x7d, 0xb5, 0xb6, 0x84, 0x30, 0xb5, 0xb6, 0xbd, 0xd7, 0x00, 0x00, 0x08, 0x41, 0x94, 0xb2, 0xde, 0xfb, 0x5a, 0xeb, 0x6b, 0x4d, 0xef, 0x5d, 0x42, 0x08, 0x21, 0x24, 0xbd, 0xf7, 0xad, 0x55, 0x4a, 0x49, 0x4a, 0x69, 0xef, 0x5d, 0xa5, 0x14, 0x00, 0x00, 0x5a, 0xeb, 0xce, 0x79, 0xad, 0x75, 0xd6, 0xba, 0x31, 0xc7, 0x40, 0x00, 0xba, 0xca, 0xf7, 0x1c, 0xf4, 0xf3, 0xda, 0x07, 0xfe, 0xda, 0xf5, 0x34, 0xd0, 0x61,
-    0xf5, 0xf7, 0xf6, 0x38, 0xf6, 0x17, 0xdb, 0xae, 0xff, 0x9e, 0xdb, 0x0b, 0xd0, 0x00, 0xd9, 0x85, 0xf6, 0x17, 0xdb, 0x6d, 0xc9, 0x86, 0xfe, 0xfb, 0xeb, 0xce, 0xec, 0x0f, 0xff, 0x3c, 0xd2, 0x48, 0xc0, 0x40, 0xc8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0x80, 0x60, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x2c, 0xf7, 0x9e, 0xd6, 0x9a, 0x10, 0xa2, 0x39, 0xc7, 0xe7, 0x3c, 0x08, 0x61, 0x52, 0xaa, 0xff, 0xff, 0x84, 0x30, 0x08, 0x41, 0x9c, 0xd3, 0xa5, 0x34, 0x00, 0x00, 0x73, 0xae, 0xe7, 0x1c, 0x4a, 0x69, 0x00, 0x00, 0xa5, 0x14, 0xa5, 0x14, 0x39, 0xc7, 0xc6, 0x38, 0x73, 0x8e, 0x08, 0x41, 0x08, 0x41, 0x52, 0x8a, 0xde, 0xfb, 0x9c, 0xf3,
-    0x29, 0x45, 0xc6, 0x18, 0x39, 0xa7, 0x5b, 0x0c, 0xce, 0x38, 0x78, 0x82, 0xd1, 0xc6, 0xfe, 0xdb, 0xec, 0xf3, 0xd0, 0x41, 0xe2, 0x69, 0xff, 0x1c, 0xda, 0x48, 0xd0, 0x60, 0xf6, 0x79, 0xf7, 0x7d, 0xb9, 0x65, 0xc1, 0x64, 0xff, 0x7d, 0xe2, 0x48, 0xd0, 0x00, 0xda, 0x07, 0xf6, 0x38, 0xe3, 0x6d, 0xed, 0x13, 0xf6, 0x9a, 0xe3, 0x8d, 0xfe, 0xba, 0xf5, 0x75, 0xd8, 0xe2, 0xd0, 0x60, 0xc8, 0x81, 0xc8, 0x81, 0xc8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0x98, 0x60, 0x30, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x51, 0xff, 0xdf, 0x4a, 0x69, 0x00, 0x00, 0x84, 0x10, 0xc6, 0x18, 0x08, 0x41, 0xad, 0x55, 0xde, 0xdb, 0x08, 0x41, 0x29, 0x45, 0xce, 0x59, 0x63, 0x2c, 0x29, 0x65,
-    0xd6, 0xba, 0x84, 0x10, 0x00, 0x00, 0x42, 0x28, 0xde, 0xdb, 0x4a, 0x69, 0x9c, 0xf3, 0x6b, 0x6d, 0x00, 0x20, 0x39, 0xc7, 0xb5, 0x96, 0xc6, 0x38, 0xf7, 0xbe, 0x63, 0x2c, 0x7b, 0xef, 0x7b, 0xef, 0x08, 0x82, 0xa5, 0x55, 0xe4, 0xb2, 0xc0, 0x40, 0xf5, 0x34, 0xf6, 0x58, 0xd9, 0x24, 0xd0, 0x40, 0xf6, 0x18, 0xed, 0x34, 0xd0, 0x81, 0xd9, 0xc6, 0xff, 0xbe, 0xe3, 0xef, 0xc8, 0x20, 0xeb, 0xad, 0xfe, 0xfb, 0xd0, 0xc1, 0xd0, 0x60, 0xec, 0x0f, 0xf6, 0x99, 0xec, 0xf3, 0xff, 0xbe, 0xf5, 0x75, 0xf5, 0xf7, 0xff, 0xff, 0xe2, 0xea, 0xd0, 0x60, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xc8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xc0, 0x81, 0x48, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
-    0xce, 0x59, 0xb5, 0x96, 0x10, 0x82, 0x10, 0x82, 0xde, 0xfb, 0x5a, 0xeb, 0x21, 0x04, 0xef, 0x7d, 0x6b, 0x4d, 0x00, 0x00, 0x7b, 0xcf, 0xce, 0x79, 0x10, 0xa2, 0x84, 0x10, 0xce, 0x59, 0x18, 0xe3, 0x08, 0x41, 0xbd, 0xd7, 0xa5, 0x34, 0x10, 0xa2, 0x18, 0xc3, 0x00, 0x00, 0x39, 0xe7, 0xce, 0x59, 0x4a, 0x69, 0x8c, 0x71, 0xd6, 0xba, 0x10, 0xa2, 0x29, 0x65, 0x08, 0x41, 0x5b, 0x2c, 0xf6, 0xda, 0xe2, 0x07, 0xda, 0x28, 0xfe, 0xfb, 0xe3, 0x4c, 0xd0, 0x00, 0xe3, 0xae, 0xff, 0x3c, 0xda, 0x28, 0xc0, 0x00, 0xe4, 0xd2, 0xfe, 0xfb, 0xd8, 0xe2, 0xd9, 0x03, 0xfe, 0xda, 0xec, 0x30, 0xd0, 0x00, 0xe2, 0x68, 0xff, 0x3c, 0xfe, 0xba, 0xfe, 0xfb, 0xff, 0xbe, 0xf6, 0xdb, 0xff, 0xbe, 0xf5, 0xb6, 0xd9, 0x23, 0xd0, 0x60, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0x70, 0x40, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x69, 0xe7, 0x1c, 0x4a, 0x49, 0x08, 0x41, 0x9c, 0xf3, 0xbd, 0xf7, 0x08, 0x41, 0x8c, 0x71, 0xce, 0x79, 0x00, 0x20, 0x39, 0xe7, 0xde, 0xfb, 0x63, 0x0c, 0x18, 0xe3, 0xc6, 0x38, 0x94, 0xb2, 0x00, 0x20, 0x8c, 0x71, 0xef, 0x5d, 0x4a, 0x49, 0x00, 0x00, 0x00, 0x00, 0x10, 0xa2, 0xc6, 0x38, 0x52, 0x8a, 0x52, 0xaa, 0xef, 0x5d, 0x4a, 0x49, 0x00, 0x00, 0x00, 0x20, 0x63, 0x4d, 0xf7, 0xdf, 0xf5, 0x75, 0xd0, 0x40, 0xec, 0x50, 0xf6, 0x9a, 0xd9, 0xa6, 0xe2, 0x69, 0xff, 0x5c, 0xe4, 0xb2, 0xc8, 0x61, 0xd1, 0x64, 0xff, 0x3c, 0xe3, 0x6d, 0xd0, 0x61, 0xec, 0xb2, 0xfe, 0xda, 0xd8, 0xc2, 0xd9, 0xe6, 0xfe, 0xba, 0xff, 0xbe, 0xf5, 0xf7, 0xf6, 0xba, 0xff, 0x3c, 0xed, 0x95, 0xf6, 0x59, 0xe3, 0x0b, 0xd0, 0x40, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xb0, 0x81, 0xb8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xd8, 0x81,
-    0xd8, 0x81, 0xd8, 0x81, 0xe0, 0xa1, 0xe0, 0xa1, 0xa0, 0x60, 0x40, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x14, 0xe7, 0x3c, 0x63, 0x2c, 0x94, 0xb2, 0xd6, 0x9a, 0x29, 0x65, 0x00, 0x00, 0xc6, 0x18, 0x8c, 0x51, 0x42, 0x28, 0xce, 0x59, 0x9c, 0xf3, 0x00, 0x00, 0x29, 0x45, 0xce, 0x79, 0xc6, 0x38, 0xa5, 0x34, 0xff, 0xff, 0x8c, 0x71, 0x08, 0x61, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x4d, 0xe7, 0x1c, 0x8c, 0x71, 0xde, 0xdb, 0x63, 0x0c, 0x00, 0x00, 0x08, 0x41, 0x6b, 0x8e, 0xff, 0x5c, 0xff, 0x5d, 0xe2, 0xaa, 0xd0, 0x00, 0xec, 0x91, 0xff, 0x3c, 0xed, 0x13, 0xff, 0x1b, 0xfe, 0xfb, 0xd9, 0xc6, 0xd0, 0x00, 0xe2, 0xa9, 0xfe, 0xfb, 0xe2, 0x48, 0xec, 0x2f, 0xff, 0x1c, 0xe2, 0x48, 0xd0, 0x81, 0xf5, 0x75, 0xff, 0x3c, 0xe4, 0x0f, 0xe3, 0x6d, 0xf6, 0x38, 0xe3, 0x4c, 0xec, 0xd2,
-    0xec, 0xd2, 0xd0, 0xc2, 0xd0, 0x60, 0xd0, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0x58, 0x40, 0x28, 0x20, 0x60, 0x40, 0x70, 0x40, 0x68, 0x40, 0x78, 0x40, 0x88, 0x60, 0x88, 0x60, 0x90, 0x60, 0x90, 0x60, 0x90, 0x60, 0xa0, 0x60, 0xb0, 0x81, 0xb0, 0x80, 0x60, 0x40, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xc7, 0xd6, 0xba, 0xd6, 0x9a, 0xce, 0x59, 0xb5, 0x96, 0x31, 0x86, 0x00, 0x00, 0x00, 0x00, 0xa5, 0x34, 0xef, 0x5d, 0xd6, 0xba, 0x94, 0xb2, 0x08, 0x41, 0x00, 0x00, 0x08, 0x61, 0x63, 0x2c, 0xa5, 0x14, 0xce, 0x79, 0xd6, 0x9a, 0x31, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xaa, 0xce, 0x59, 0xc6, 0x18, 0x4a, 0x69, 0x00, 0x00, 0x00, 0x20, 0x6b, 0x6d, 0xf5, 0xf7, 0xf5, 0x54, 0xf5, 0xd6, 0xd0, 0xa1, 0xd0, 0x40, 0xda, 0x48, 0xec, 0xf3, 0xf5, 0xb6, 0xff, 0x7d, 0xe3, 0xce, 0xd0, 0x80, 0xd8, 0x20,
-    0xe2, 0x27, 0xff, 0x1b, 0xff, 0x1b, 0xfe, 0x9a, 0xe2, 0xca, 0xd0, 0x20, 0xd0, 0xc2, 0xe3, 0x2b, 0xd2, 0x48, 0xc8, 0x40, 0xd9, 0x23, 0xd9, 0x03, 0xd9, 0x24, 0xe3, 0xae, 0xc9, 0xc6, 0xc8, 0x40, 0xd8, 0xa1, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0xa1, 0xb8, 0x81, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x20, 0x20, 0x40, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xf3, 0xc6, 0x38, 0x31, 0xa6, 0x18, 0xc3, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xa6, 0x73, 0xae, 0x4a, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x82, 0x94, 0xb2, 0x7b, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x24, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00,
-    0x5b, 0x0c, 0xed, 0xf7, 0xea, 0xca, 0xf6, 0x18, 0xe3, 0x0b, 0xd0, 0x00, 0xd0, 0xa1, 0xd8, 0x60, 0xd0, 0x00, 0xeb, 0x6d, 0xfd, 0x75, 0xe1, 0x64, 0xe0, 0x60, 0xb8, 0x60, 0xa8, 0xa1, 0x9b, 0x0b, 0xdb, 0xce, 0xd9, 0x85, 0xd0, 0x20, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x20, 0xc0, 0x20, 0xd0, 0x80, 0xd0, 0x60, 0xd0, 0x40, 0xd0, 0xa1, 0xd8, 0x60, 0xc0, 0x60, 0xc0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xe0, 0xa1, 0x58, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x28, 0xe7, 0x1c, 0x6b, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x10, 0x82, 0x39, 0xe7, 0x18, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x08, 0xe6, 0x58, 0xea, 0x27, 0xec, 0x0f, 0xfd, 0xd6, 0xe0, 0x60, 0xe0, 0x80, 0xd8, 0xa1, 0xd0, 0x81, 0xd0, 0x60, 0xc1, 0xe7, 0xb9, 0xa6, 0xa8, 0x60, 0x88, 0x60, 0x40, 0x20, 0x20, 0x00, 0x30, 0x00, 0xc8, 0x00, 0xd0, 0x40, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xc8, 0x81, 0xc8, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0xd0, 0xa1, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xc0, 0x81, 0xc8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0xa1, 0x80, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x41, 0xa5, 0x34,
-    0xc6, 0x38, 0x21, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x58, 0xe3, 0xee, 0x38, 0xeb, 0x4c, 0xd1, 0x85, 0xf6, 0xba, 0xb2, 0x07, 0xa8, 0x00, 0x98, 0x60, 0x78, 0x40, 0x60, 0x40, 0x58, 0x40, 0x38, 0x00, 0x28, 0x00, 0x20, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x40, 0xd8, 0xa1, 0xd0, 0xa1, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xc8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0xc0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xb0, 0x80, 0x28, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xaa, 0xe7, 0x3c, 0x6b, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x70, 0x20, 0xed, 0x13, 0xc5, 0x13, 0x68, 0x41, 0xdd, 0x75, 0x94, 0x71, 0x20, 0x00, 0x20, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x60, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xc8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0xc0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xe0, 0xa1, 0x60, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc3, 0xbd, 0xd7, 0xb5, 0xb6, 0x18, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x8a, 0x89, 0xe6, 0xdb, 0x28, 0xc3, 0x63, 0x2c, 0xc6, 0x38, 0x10, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x98, 0x60, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xc8, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xb0, 0x80,
-    0x80, 0x60, 0xc8, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0xc8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0xa1, 0x90, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xae, 0xe7, 0x3c, 0x52, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xbe, 0x18, 0x5b, 0x0c, 0x29, 0x86, 0xd6, 0xba, 0x39, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x38, 0x20, 0xc8, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xc8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xe0, 0xa1, 0x80, 0x60, 0x10, 0x00, 0x70, 0x40, 0xc8, 0x81, 0xd8, 0xa1, 0xd0, 0x81, 0xc8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0x98, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x65, 0xce, 0x79, 0x9c, 0xd3, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x28, 0xe7, 0x3c,
-    0x52, 0x8a, 0xce, 0x59, 0x6b, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x40, 0xd0, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xc8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xb0, 0x81, 0x40, 0x20, 0x00, 0x00, 0x38, 0x20, 0xb8, 0x81, 0xe0, 0xa1, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xb0, 0x81, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc3, 0x42, 0x28, 0x18, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x6d, 0xf7, 0xbe, 0xe7, 0x3c, 0x73, 0xae, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x40, 0xd0, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xc8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0x70, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x40, 0xd0, 0x81, 0xd8, 0xa1, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0x30, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x04, 0x7b, 0xef, 0x4a, 0x49, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x20, 0xc8, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0xa1, 0xc8, 0x81, 0x50, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x78, 0x40, 0xc8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0x38, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x40, 0xd0, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xd8, 0xa1, 0x90, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x40, 0xd8, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0xa1, 0x60, 0x40,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0xd8, 0xa1, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xb0, 0x61, 0x20, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x98, 0x60, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0xa1, 0x78, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x40, 0xc8, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xb8, 0x81, 0x30, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x98, 0x60, 0xd8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0xa1, 0x98, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x60, 0xd8, 0xa1, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0x80, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xa8, 0x61, 0xd8, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0x90, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x60, 0xd8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0x80, 0x60, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0xb0, 0x81, 0xd8, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x60, 0xd8, 0x81, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xb8, 0x81, 0x28, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x20, 0xb8, 0x81, 0xd8, 0x81, 0xd0, 0x81, 0x30, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x60, 0xd0, 0x81, 0xd0, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0x48, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x20,
-    0xb8, 0x81, 0xd8, 0x81, 0x48, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x60, 0xd8, 0x81, 0xd8, 0x81, 0xc8, 0x81, 0x68, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x20, 0xd8, 0x81, 0x90, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x60, 0xd8, 0x81, 0xe0, 0xa1, 0x88, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x40, 0xa8, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x60, 0xd8, 0x81, 0xb0, 0x80, 0x28, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x80, 0x40, 0x28, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0xb0, 0x80, 0xd8, 0x81, 0x38, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xc8, 0x81, 0x88, 0x60, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x20, 0xb0, 0x60, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x40, 0x50, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-static const uint8_t image_data_splash_girl_sat[12288] = {
-    // ██▓▓░▓██▓▓█████████████▓▓▓▓▓▒▓▓███▓█▓██▓░█▓▓▓▒▓▓▒▒▓▓███▓▓██████▓▓▓▓▓▓▓▒██▓▓▓▓▓▓▓▓█████████████▓░
-    // ███▓░▒███▒█████████████▓▓▓▓▒▓▓████▓█▓█▓▒██▓▓▒▓▓▓▒▓▓▓███▓▒▓████████▓▒▓███▓▓▓▓▓▓▓▓▓████████████▓░▒
-    // ███▓░▒███▓▓███████████▓▓▓▓▓▓▓█████▓█▓▓▒███▓▓▒▓▓▓▒██▓▒████▓████████▓▓▓█████▓▓▓▓▓▓████████████▓░▒▒
-    // ███▓▒▒███▓▓██████████▓▓▓▓▓▓████▓▓▒█▓▓▓████▓▒▓▓▓▓▓███▓█████▓▒▓█████▒██▓▓█████▓▓▓████████████▓░▒▒▓
-    // ███▓▓░▓██▓▒██████████▓▓▓██████▓▒▒▓█▒▓█████▒▓▓█▓▒█████▓██████▓▒███▒▓████▓▓█████████████████▓▒▒▒▓▓
-    // ▒███▓░▓██▓▒▒█████████████████░▒▒░█▒▓█████▒▓███▒██████▓████████▒▒▒░░░▒▒▓▓▓▒███████████████▒▒▒▓▓▓█
-    // ▒███▓▒▓██▓▓▒▓██████████▓▓▓▒▓▓▓█▒█▓▒█████▓▓███▒████████▓▓▓▒▒▒░▒▒▒▒▒░░▒▒▒▒░▒░▒▓██████████▓▒▒▒▓▓▓██
-    // ▒███▓▒▒██▓▓▓▓▓▓████▓▒▒▓▓▒▒▓███▒██▒██████████▓▓██████████░▒▒▒░▒▒▒▒▒░░▒▒▒░▒▒▒▒▒▒▒▒▓▓▓▓▓▒▒▒▒▒▓▓▓██▒
-    // ▒▓███▒░██▓▓▓██▓▓▓▒▒▒▒▓▓▓▒▒███▓▓█▒██████████████████████▓░▒▒▒░▒▒▒▒▒░▒▒▒▒░▒▒▒▒▒▒▒▒▒▒░░▒▒▒▒▒▓▓██▓▒█
-    // ▓▒███▓░▓█▓▓▓████▓▓▓▒▒█▓▒░███▓▓█▒▓██████████▓███████████▓░▒▒░▒▒▒▒▒░░▒▒▒░▒▒▒▒▒▒▒▒▒▒░░▒▒▒▒▒▓▓██▓▓██
-    // ▓▒███▓░▓█▓▓▓████▓▓▓▒▓▓▓░▓███▒█▓▓██████████▓████████████▓░▒▒░▒▒▒▒▒░░▒▒▒░▒▒▒▒▒▒▒▒▒▒░▒▒▒▒▒▓███▒▓██▓
-    // ▓▓▓██▓▒▒█▓▓▒████▓▓▓▒█▓▒▒███▓█▓▓██████████▓████████████▓▓∙░▒░▒░▒▒▒░▒▒▒░▒▒▒▒▒▒▒▒▒░░▒▒▒▒▒▓██▓▒███▓█
-    // ▓▓▒██▓▒▒██▓▒███▓▓▓▒▒▓▓░████▒▓▒▓▓██▓▓███▓███████████▓▒░░░▒▒░∙░░▒▒▒▒▓▓▒░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▓▓██▓▓██▓▓█▓
-    // █▓▒▓██▒▒██▓▒███▓▓▓▒▓▓▒▓████▓▒█▓▓█▓▓███▓█████████▓▓░░▒▓▓████▓░∙▒▒▒▒██▓▒▒▒▒▒▒▒▒▒▒░▒▒▒▒▓██▒▓█▓▓█▓▓█
-    // █▓▓▓██▓░▓█▓▒███▓▓▒▒█▓▒█████▒█▓▓█▓▒▓█▓▓████████▓▒░▒▓██████████▓░░▒▓██▓▒▒▒▒▒▒▒▒▒▒▒▒▒▓██▓▒█▓▓▓█▓▓█▓
-    // ▓█▓▒██▓░▓█▓▒███▓▓▒▓▓▒▓████▒▓▒▒▓▓▒▓█▓▒▓███████▓▒▓██████████████▓▒∙▒▓▓▒▒▒▒▒▒▒▒▒▓▓▓▒▓██▓▒█▓▓██▓█▓██
-    // ▓█▓▒██▓░▓██▒██▓▓▓▒█▓▒████▒▓▓▒▓▓▒▓▓▓░▓████████▓██████████████████▓∙▒▒▒▒▒▒▒▒▒▒▓██▓▓▓█▓▓▓▒▓█▓▓█▓███
-    // █▓▓▓▓█▓▒▒██▓▓█▓▓▒▒█▒▓███▓▓▓▒▓▓▒▓▓▒▒▒█████████████████████████████▓∙▒▒▒▒▒▒▒▒▒▓████▓▓▒▓▒██▓▓▓▓████
-    // █▓▓▓▒██▒░██▓▓█▓▓▒▒▓▒███▓▓█▒▓▓▒▒▓▒▒▓▓██████████████████████████████▓∙▒▒▒▒▒▒░▒▓█▓█▓▓▓▒▓██▒▓▓▓█████
-    // ██▓▓▒██▓░██▓▓█▓▓▒▓▓▒██▓▓█▓▒▓▒▒▓▒▒▓▓████████████████████████████████▓░▒▒▒▒▒░▒▓▒▓▓▓▓▒▓▓▓▒▓▓▓██████
-    // ██▓▓▒▓█▓∙▓██▓█▓▓▒█▓▒█▓▓▓█▒▓▒▒▒░▒▓▒▓█████████████████████████████████▒░▒▒▒▒░▒▒▒▓▓▓▒▓▓▓▒▓▒████████
-    // ███▓▓▓█▓░▓██▓█▓▒▓█▓▓█▓▓█▓▓▓▒▒░▒▓▓▓███████████████████████████████████▒░▒▒▒▒▒▒▒▒▒▒▓▓▒▒▓▒█████▓███
-    // ███▓▓▓██▒▓██▓█▓▓▓█▓██▓▓█▓█▓▓▒▒▒▓▓▓███████████████████████████████████▓░▒▒░▒▒▒▒▒▒▒▓▒▒▓▒▓███▓▓████
-    // ████▓▓▓█▓▒██▓█▓▓▓█▒██▓█████▒▓▒▓▓▓█████████████████████████████████████▒▒░▒▒▒▒▒▒▒▒▒▒▒▒▓██▓▒▓█████
-    // ████▓▓▓██▒██▓██▓██▓██▓█▓██▓▓▒▓▓▒██████████████████████████████████████▓░░▒▒▒▒▒▒▒▒▒▒▒▓▓█▓░▓████▓▓
-    // █████▓▓██▒███▓█▓██▓████▓██▓▓▒▓▓▓██████████████████████████████████████▓░▒▒▒▒▒░▒▒▒▒▒▓▓▓▒▒▓███▓▓▓▓
-    // █████▓▓██▓▓██▓▓▓██▓███▓▓▓▓▓▓▒▓▒████████████████████████████████▓██████▓▒░▒▒▒▒▒▒▒▒▒▓▓▓▒▒▓███▓▓▓▒▒
-    // ███████▓█▓▓███▓▓██▓███▓▓▒▓▒▒▒▓▓▓▓███████████████████████████████▓▓████▓▒▒▒▒▒▒▒▒▒▒▒▓▓░▒▓▓█▓▓▓▒░▒▒
-    // ▓██████▓██▓███▓▓██▓███▒▒▒▓▒▒▒▒▒▓▓▒▒██████████████████████████▓▓▓█████▓▓▒░░▒▒▒▒▒▒▒▒▓░▒▓▓█▓▓▓▒▓▓▓▓
-    // ▓██████▓██▓███▓▓█████▓▒▒▒▒▒░▒▒▓███▒████████████████████████████████▓▓▓▓▒░▒▒▒▒▒░▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓█
-    // ▒▓████████▓████▓█████▓▒░▒▒░░▒▒████████████████████████████████████▒▓▒░▓░▒▒▒▒▒▒▒▒▒▒░▒▓▓▒▓▓▓▓▓▓▓▓▓
-    // ▒▒▓████████████▓█████▓▒░▒▒▒▒▒▓██▓█████████████████████████████████▒▒▒▒▓░░░▒▒▒▒▒▒▒░▒▓▓▒▒▒░▓▓▓████
-    // ▓▒▒▓█████████████████▓▒▒▒▒▒░▒▓▓█▒▒█████████████████████████████████▒▒▒▓▒▒░▒▒▒▒▒▒░▒▒▒▒▒▒░░▒▓▓████
-    // ▓▒▒▒█████████████▓███▓░▒▒▒░░█▓▓▒▒▓█████████████████████████████████▓▒∙▒▒░▒▒▒▒▒▒░▒▒▒▒▒▒░░░▓▓▓████
-    // ▓▓▒▒▓████████████████▒▒▒▒▒▒██▓▒▒█████▓█████████████████████████████▒▒∙▒░░▒▒░▒▒▒▒▒▒▒▒▒░░░▒▓▓▓████
-    // ▓▓▓▓▓████████████▓▓██▒▒▒▒▒▓██▓▒▓███████▓██████████████████████████▒█▒▒░∙▒▒▒▒▒▒░▒▒▒░▒░░░▒▓▓▓█████
-    // ▒▒▒▓▒▓████████████▓█▓▒▒▒▒▒███▓▒▓██▓███▓▓█████▓███████████████████▓▓█▒▒∙∙▓▒▒▒▒░▒▒▒░▒▒░░▒▓▓▓▓▓████
-    // ▓▒▒▓▓▓████████████▓█▓▓▒▒▒▒█▓██▓▒▓█▓███▓████████████████████████▓█▓▓▓▓∙∙▒█▒▒▒▒▒▒▒▒▒▒░░▒▓▒▒▒▒▓▓▓█▓
-    // ▓▓▒▒▓▓▓████████████▓▓▒▒▒▒▒▓▓██▓▒▓▓▓███▓█████████████████▓█████████▒∙∙∙▒▓█▓▒▒▒▒▒▒▒▒░░▒▓▒▒▒▒▒▒▓▓▓▓
-    // ░▒▒▓▓▓▓▓███████████▓▓▒▒░▒▒▒▓▓█▓░█▒▓▓▓████████████▓▓▒▒▓▒▒██████████▓▓░░▓██▓▒▒▒▒░▒▒▒▒▒▒▒░░░▒▒▒▓▒▒▓
-    // ▒▒▓▓▓▓▓▓███████████▓▒▒▒▒▒▒▒▒▒▒░▓▒░▓▓█▓█████████▓▓█▒██▓▓▓▓██████████▓████▓▒▒▓▒▒▒░▒▒▒▒▒▒▒▓▒▒▒▓▓▓▓▓
-    // ▓▒▓▓▓▓▓██████████▓█▓▒▒▒▒▒▒▒▒▒▓█▒▒░▒▓██████████████▒██∙▓▓▒██████████▓███▓▒▓▓▓▒▒▒▒▒▒▒▒▒▒▒▒░▒▒▓▓▓▓▓
-    // ▓▓▓▓▓▓▓▓███████▓██▓▓▒░▒▒▒▒▒▓▓▓▓▒▒▒▒▓██████████████▒▓▓∙▒∙░█████████████▒▒▓▓▓▓▒▒▒▒▒▓▒▓▓▒▒▒▒▓▓▓█▓▓▓
-    // ▓▓▓▓▓▓▓▓███████▓██▓▓▒▒▒▒▒▒▒▓▓▓█▓▒▒▒▓████████▓▓████▒▒▓▒∙▒▒████████████▒▒▓█▒▓▓▒▒▒▓▓▓▒▓▓▒▒▒▒▒▒▓█▓▓▓
-    // ▓█▓▓▓▓▓▓████████▓█▓▒▒▒░▒▒▒▓▓▓▓▓█▒▒▒▓███████▓░▓████▓▒▒░░█▒▓▓██████████████▒▓▒▒▒▒▓██▓▓▓▓▒▒▒▒▓▓▓▓█▓
-    // ▓▓▓▓▓▓▓▓▓███▓███▓▓▓▒▒▒▒░▒▓▓▓▓▓▓█▓▒▒▓██████▓∙∙▒▓▓▓▓▓∙∙∙▓▒∙░▓██████████████▒▓▒▒▓▒████▓▓▓▒▒▒▒▓▓▓▓▓▓
-    // ▓▓▓▓▓▓▓▓▓▓▓▓▓█▓██▓▓▓▒▓▓▒▒▒▓▓▓▓███▓▒▓███████▒∙∙∙∙∙░░░∙∙∙∙∙░███████▓▓█████▓▓▓▒▒▓▓█████▓▓▒▒▓▒▒▒▒▒▓▓
-    // ▓▓▓▓▓▓▓▓▓▓▓▓▓▓█▓█▓▓▓▒▓▓▓▒▒▒▓▓████▓▓▒▓████████▒░░∙∙∙∙∙∙∙░░▓██████▓▒▒█████▓▓▓▒▒▓▓█████▓▓▒▓▒▒▒▒▒▒▒▓
-    // ▓▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓█▓█▓▒▓▓▓▓▓▓▓████▓▓▓▒▓█████████▓▒▒▒▒▒▒▒▒▓███▓▒▓█▓▒▒█████▓▓▓▒▓▒▓████▓▓▓▒▓▒▒▒▒▒▒▒▒
-    // ▒▒▒▒▓▓▓▓███▓▓▓▓▓▓▓███▓▓███▓▓▓▓▓███▓▓▓▒▓███████████████████▓▒▒▓███▒▒▓███▓▓█▓▒▓▓██▓▓▓▓▓▓▒▓▒▒▒▓▒▒▒▒
-    // ▒▒▒▓▓▓▓▓██▓▓▓▓▓▒▓▓████▓█████▓▓█▓███▓▓▓▓█████████████████▓▒▒▓██▒██▒▓▒███▒▓█▒▓▓▓▓▓▓▓▓▓▓▒▓▓▒▒▓▓▒▒▒▒
-    // ▓▓▓▓▓▓▓▓█▓▓▓▓▓▓▒▓█▓████▓██████▓██▓▓▓▓▓▓████████████▓▓▒▒▒▒▓████▒▓█▒▓▒██▓▓██░▓▓▓█▒▓▓▒▓▓▒▓▒▒▓▓▒▒▓▒░
-    // █▓▓▓▓▓▓▓█▓▓█▓▓░▒▒▓█████████████████▓▓▓▓████████▓▓▒▒░░▒▒▓█████▓▓▓█▒▓▒██▓██▒▓▓▓█▒▓▓▓▓▓▓▓▓░▓▓▒▒▓▓▒▒
-    // █▓▓▓▓▓▓██▓█▓▓░▒▒▒▒███████████████▓▓█▒▒▓████▓▒▒▒▒▒▒▒▒▓▓▓▒████▓▓▓▓█▓▓▒█▓▓█▓▒█▓▓▓▓█▓▓▓▓▒▓▒▒▓▓▒▓▓▒░▒
-    // ▓█▓▓▓█████▓▓░▒▒▒▒▒▓████████████████▓▓▒▒████▓▓▓▓▓▓▓▓▒▓▓▓▓▓███▓▓▓▒█▓▓▒█▒██▒▓█▓▓▒█▓▓▓█▓▓▓▒▓▓▒▓▓▓▒▒▒
-    // ▓█████████▓▒▒▒▒▒▒▒▒█████████████████▓▒▒████▓███▓▓▓▓▓▓▓▓▓▓███▒▓▓▓█▓▓▓▓▓█▒▓█▓▓▒██▒▓█▓▓▓░▓▓▒▓▓▓▓▒▓▒
-    // ▓███▓▓▓▓▓▓▒▒▒▒▒▒▓▒▒▓█████████████████▓▓▓██████████▓█▓▓██▓▓██▓██▓▓▒█▓▓█▓▓█▓▓▓██▓▓▓█▒█▒▓▓▒▒▓▓▓▒▓▓▓
-    // ██▓▓▓▓▓▓▒▒▓▓▓▓▓▓▓▓▒▓▓████████████████▓▓▓█████████████▓███▓██▓██▓▓▓▓▓▓▓▒██▓▓▓█▓▓▓█▒█▓▓█▒▓▓▓▓▓▓▓▒▓
-    // ██▓▓▓▓▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓█████████████████▓▓▓█████████████▓██▓██▓███▓▓▓▒█▒██▒▓▓██▓▓███▓▒█▒▓██▓▓▓▓▒▒▓
-    // ███▓▒▒▓▓▓▓▓███████▓▓▒▓████████████████▓▓▓█████████████▓██▓▓█▓███▓▓▓▓▓██▒▓▓██▓▓▓██▓▒█▒▓█████▓▒▓▓▓
-    // ▓▓█▓▓▓▓▓▓▓▓███████▓▒▒▓▓████████████████▓▓▓████████████▓███▓█████▓█▓█████████▓████▒▓▓██████▓▒▓▓▓▓
-    // ▓▓▓██▓▓▓▓▓██▓▓▓▓▓█▓▒▒▒▓▓████████████▓▓█▓▓▓███▓████████████▓█████▓█▓▓████████▓███▓▓▓███████▓▓▓▓▓▓
-    // ▓▓▓▓██▓▓▓██▓▓▓▓▓▓▓▓▒░▒▓▓▓▓█████▓██████▓▓▓▓██████████████████████▓██████████████▓▓██████████▓▓▓▓▓
-    // ▓▓▓▓▓█▓▓██▓▓▓▓▓▓▓▓▓▒▒▒▓▓▓▓▓██▓███▓▓█████▓▒▓██████████████████████████████████▓▓████████▓▓██▓▓▓▓█
-    0xfe, 0x97, 0xfe, 0x76, 0xfd, 0xb4, 0xfb, 0xad, 0xc9, 0x45, 0xf3, 0x93, 0xfe, 0xb8, 0xfe, 0x96, 0xfd, 0x73, 0xfb, 0x73, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x9f, 0xfc, 0xfd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xbd, 0xfa, 0xf5, 0xf9, 0xd0, 0xfc, 0xdd, 0xfc, 0xdd, 0xfd, 0x9e, 0xfe, 0xdf, 0xfe, 0xdf, 0xec, 0xd7, 0xff, 0xdf, 0xd4, 0xb7, 0xfd, 0x5a, 0xfe, 0x7f, 0xfc, 0x56, 0xc1, 0x28, 0xfd, 0xb4, 0xfd, 0x94, 0xfc, 0xb1, 0xfb, 0xae, 0xf8, 0xe8, 0xfb, 0x4d, 0xfb, 0x2c, 0xfb, 0x0d, 0xf9, 0xf4, 0xfb, 0xb9, 0xfc, 0x7c, 0xff, 0x5f, 0xfe, 0xbf, 0xfe, 0x3f, 0xfb, 0x15, 0xfc, 0xf9, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x3f, 0xfd, 0x9e, 0xfc, 0xfd, 0xfc, 0x5d, 0xfa, 0xf7, 0xfb, 0x13, 0xe4, 0x35, 0xfd, 0x1a, 0xfb, 0xb5, 0xda, 0x2e, 0xfd, 0x7c, 0xfd, 0x3e, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfe, 0x1e,
-    0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xbf, 0xfe, 0x9f, 0xfd, 0xdf, 0xfb, 0x14, 0xa8, 0x46, 0xfe, 0xb8, 0xfe, 0x76, 0xfd, 0xb4, 0xfc, 0x91, 0x98, 0xc6, 0xfa, 0xad, 0xfe, 0xd8, 0xfe, 0x96, 0xfd, 0xf4, 0xfa, 0xce, 0xfe, 0xbf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfd, 0x3d, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfb, 0xf9, 0xf9, 0xd3, 0xfc, 0xbe, 0xfc, 0xdd, 0xfd, 0x1e, 0xfe, 0xbf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfc, 0x95, 0xfe, 0xb9, 0xfb, 0x35, 0xfe, 0x3f, 0xfb, 0x78, 0xfa, 0x32, 0xfd, 0xd7, 0xfe, 0x35, 0xfd, 0x73, 0xfd, 0x11, 0xf9, 0x8b, 0xfb, 0x6d, 0xfb, 0xef, 0xfb, 0xcf, 0xfa, 0x4b, 0xfc, 0x16, 0xfc, 0x9a, 0xfa, 0x76, 0xfd, 0x3c, 0xfe, 0xbf, 0xfd, 0xff, 0xfc, 0xdc, 0xf9, 0xaf, 0xfc, 0x77, 0xfe, 0xff, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x9f, 0xfe, 0x1f, 0xfd, 0xbe, 0xfd, 0x1e, 0xfd, 0x1e, 0xfc, 0x3c, 0xf9, 0x50,
-    0xfc, 0x56, 0xfd, 0xdc, 0xfe, 0x1f, 0xfd, 0x1e, 0xfc, 0xbd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xfd, 0xfe, 0xbf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x9f, 0xfd, 0xff, 0xfc, 0x39, 0xd0, 0x88, 0xf8, 0xa9, 0xff, 0x1a, 0xfe, 0x76, 0xfe, 0x35, 0xfd, 0x72, 0xb9, 0x47, 0xf8, 0xcb, 0xfe, 0xd9, 0xfe, 0x96, 0xfe, 0x35, 0xfb, 0xaf, 0xfc, 0x97, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfd, 0xde, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfd, 0x5e, 0xfe, 0x9f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfd, 0xbd, 0xfc, 0x92, 0xfe, 0x38, 0xfb, 0x37, 0xfb, 0x5a, 0xfa, 0x17, 0xfe, 0x7b, 0xfe, 0x98, 0xfe, 0x15, 0xfd, 0x73, 0xfb, 0x2e, 0xfa, 0xcd, 0xfc, 0xb1, 0xfc, 0xb0, 0xfc, 0x90, 0xfa, 0x0d, 0xfe, 0x3e, 0xfe, 0x3f, 0xfa, 0xf4, 0xfa, 0x2f, 0xfe, 0xbf,
-    0xfe, 0xbf, 0xfd, 0xbe, 0xfc, 0xfe, 0xfb, 0x16, 0xfd, 0x7b, 0xfd, 0xbb, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x7f, 0xfe, 0x1f, 0xfd, 0xfe, 0xfd, 0x9e, 0xfc, 0x9b, 0xfa, 0xf4, 0xec, 0x35, 0xfd, 0xdd, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0x3e, 0xfd, 0x3e, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfd, 0x7e, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x1f, 0xfc, 0x59, 0xd8, 0x49, 0xf8, 0x89, 0xf9, 0xcb, 0xff, 0x3b, 0xfe, 0x97, 0xfe, 0x36, 0xfd, 0x53, 0xe2, 0x69, 0xf9, 0x28, 0xfe, 0x18, 0xfe, 0x96, 0xfe, 0x15, 0xfc, 0xb1, 0xfa, 0xef, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x9f, 0xfc, 0xde, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfd, 0x3e, 0xfe, 0x5f, 0xfe, 0xff, 0xfe, 0xdf, 0xfc, 0x98, 0xfb, 0xb6, 0xfa, 0x32, 0xfe, 0x38, 0xfb, 0x5a, 0xfc, 0xdc, 0xfb, 0xdd, 0xfe, 0xff, 0xfe, 0xff,
-    0xfe, 0x5a, 0xfe, 0x76, 0xfc, 0xf3, 0xe9, 0xcc, 0xfd, 0x53, 0xfd, 0x53, 0xfd, 0x32, 0xfa, 0xee, 0xfc, 0xd9, 0xfe, 0x9f, 0xfe, 0x5f, 0xfe, 0x3e, 0xfb, 0x33, 0xfe, 0x3e, 0xfe, 0xdf, 0xfe, 0x7f, 0xfd, 0xbf, 0xfd, 0x5e, 0xfc, 0xbc, 0xfa, 0x53, 0xfb, 0x33, 0xfe, 0x9f, 0xfe, 0xdf, 0xfe, 0xbf, 0xfe, 0x5f, 0xfd, 0xfe, 0xfa, 0x91, 0xfe, 0x7f, 0xfe, 0x7e, 0xfc, 0x57, 0xfb, 0x12, 0xfd, 0xbb, 0xfe, 0xdf, 0xfe, 0xbf, 0xfd, 0xff, 0xfd, 0x3e, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xdd, 0xfd, 0x5e, 0xfe, 0xbf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xbf, 0xfe, 0x7f, 0xfc, 0x39, 0xf8, 0x49, 0xf8, 0x4a, 0xfa, 0x6b, 0xfc, 0x2f, 0xfe, 0x5a, 0xfe, 0xb8, 0xfe, 0x15, 0xfd, 0x73, 0xfb, 0x2d, 0xe8, 0xa7, 0xf4, 0xd2, 0xfe, 0x96, 0xfe, 0x36, 0xfc, 0xd1, 0xf9, 0xca, 0xfd, 0x3a, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x1f, 0xfc, 0xdd, 0xfc, 0xdd, 0xfc, 0xfd, 0xfd, 0x1d, 0xfd, 0x9e,
-    0xfe, 0x5f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x5e, 0xfa, 0xb4, 0xf9, 0x11, 0xf9, 0x31, 0xfc, 0x53, 0xfd, 0xdd, 0xf9, 0x1a, 0xfc, 0x1f, 0xff, 0x5f, 0xff, 0x3f, 0xfe, 0xdf, 0xfe, 0x5e, 0xfe, 0x58, 0xf1, 0x6b, 0xfd, 0x73, 0xfd, 0xb4, 0xfd, 0xb4, 0xfc, 0x51, 0xfa, 0xb1, 0xfe, 0xff, 0xfe, 0x3f, 0xfe, 0x1f, 0xfe, 0x1f, 0xfd, 0x9c, 0xfc, 0x36, 0xfe, 0xdf, 0xfe, 0xbf, 0xfe, 0x5f, 0xfe, 0x1f, 0xfd, 0x9e, 0xfd, 0x1e, 0xfb, 0x77, 0xf9, 0xf0, 0xfd, 0xbc, 0xfe, 0xdf, 0xfe, 0x5d, 0xf9, 0xcf, 0xfc, 0x79, 0xfe, 0x7f, 0xfe, 0x9f, 0xfe, 0x9f, 0xfe, 0x5e, 0xfb, 0x33, 0xfb, 0x54, 0xfe, 0xbf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x9f, 0xfe, 0x1f, 0xfe, 0x3f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xbf, 0xfe, 0x5f, 0xfb, 0xd6, 0xf8, 0x8b, 0xf8, 0xa9, 0xfa, 0xac, 0xfc, 0x0f, 0xfd, 0x53, 0xbc, 0x12, 0xfe, 0xf9, 0xfe, 0x76, 0xfd, 0xd5, 0xfc, 0x0f, 0xd0, 0xa6, 0xeb, 0x90, 0xfe, 0x96, 0xfe, 0x76, 0xfc, 0xd1, 0xfa, 0xab, 0xe1, 0xac,
-    0xfe, 0xbf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xff, 0xfe, 0x1f, 0xfe, 0x5f, 0xfe, 0xbf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfd, 0x7b, 0xa0, 0xe8, 0xf2, 0x0e, 0xd9, 0xaa, 0xa1, 0xa9, 0xfe, 0x79, 0xfa, 0x55, 0xf9, 0xde, 0xff, 0x7f, 0xff, 0xbf, 0xff, 0x9f, 0xfe, 0xff, 0xfe, 0x7f, 0xfa, 0x34, 0xfd, 0x95, 0xfe, 0x96, 0xfe, 0x96, 0xfe, 0x56, 0xfa, 0x8f, 0xfe, 0x5f, 0xfe, 0xbf, 0xfe, 0x1f, 0xfe, 0x1f, 0xfe, 0x1f, 0xfe, 0x1e, 0xfa, 0xd2, 0xfe, 0x1d, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xbf, 0xfe, 0x9f, 0xfe, 0x7f, 0xfe, 0x5f, 0xfd, 0xfe, 0xfa, 0x51, 0xe9, 0xcd, 0xf8, 0x2b, 0xf8, 0x09, 0xe0, 0x08, 0xb8, 0xea, 0xf9, 0xae, 0xba, 0x6e, 0xf3, 0xb4, 0xfc, 0x98, 0xfc, 0x98, 0xfa, 0x30, 0xfd, 0x5a, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x5f, 0xfa, 0x91, 0xf8, 0x0b, 0xf8, 0xa9, 0xfb, 0x4c, 0xfb, 0xee,
-    0xfd, 0x53, 0xfe, 0x97, 0xca, 0x0d, 0xfe, 0xf9, 0xfe, 0x76, 0xfe, 0x55, 0xfd, 0x53, 0xf9, 0x29, 0xfb, 0x4f, 0xfe, 0x96, 0xfe, 0x77, 0xfd, 0x12, 0xfb, 0xae, 0xfa, 0x8d, 0xfb, 0x75, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfd, 0xdd, 0xe5, 0x18, 0xfb, 0x53, 0xf3, 0x71, 0xbb, 0x53, 0xfc, 0x13, 0xfc, 0x11, 0xfd, 0x94, 0xfd, 0xf5, 0xe1, 0xec, 0xfd, 0xd7, 0xfc, 0x39, 0xf8, 0xf4, 0xfe, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x5f, 0xfe, 0xff, 0xfc, 0x7f, 0xfc, 0xd7, 0xfe, 0x77, 0xfe, 0x97, 0xfe, 0x56, 0xfa, 0x4e, 0xfd, 0x9c, 0xfe, 0xdf, 0xfe, 0x3f, 0xfd, 0xde, 0xfd, 0xde, 0xfd, 0xde, 0xfd, 0xde, 0xfd, 0x9d, 0xfa, 0xb2, 0xfb, 0x54, 0xfb, 0x54, 0xfa, 0xb1, 0xf9, 0x6f, 0xf9, 0x4f, 0xa1, 0x6b, 0xf9, 0x4f, 0xf8, 0x0c, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x0b, 0xf8, 0x09, 0xf8, 0x0f, 0xf8, 0x11, 0xf8, 0x0f, 0xf8, 0x0b, 0xd0, 0x08, 0xf8, 0x8d, 0xe8, 0x09, 0xca, 0x6f, 0xfc, 0xd8, 0xfe, 0xbf, 0xfe, 0xdf, 0xfe, 0xdf,
-    0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x9e, 0xfc, 0x76, 0xf9, 0xae, 0xf8, 0x4b, 0xf9, 0x09, 0xfb, 0x6d, 0xfc, 0x50, 0xfd, 0x93, 0xfe, 0x97, 0xfe, 0x7b, 0xf9, 0xa9, 0xfe, 0x19, 0xfe, 0x96, 0xfe, 0x35, 0xfd, 0x53, 0xd9, 0xa8, 0xfa, 0x4c, 0xfe, 0x77, 0xfe, 0x76, 0xfc, 0xf1, 0xfb, 0xce, 0xfb, 0xad, 0xfc, 0x72, 0xfb, 0x11, 0xfd, 0x1a, 0xfe, 0xff, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x9f, 0xfd, 0x59, 0xe2, 0x8f, 0xb1, 0xec, 0xfb, 0x8e, 0xfb, 0x4f, 0xfa, 0xec, 0xf8, 0xa9, 0xfc, 0x57, 0xfe, 0xb8, 0xfe, 0x76, 0xfe, 0x76, 0xfa, 0x6d, 0xfd, 0x98, 0xfd, 0xbb, 0xe0, 0xaf, 0xfe, 0x7d, 0xff, 0xdf, 0xff, 0x9f, 0xff, 0x7f, 0xfe, 0xff, 0xfd, 0xdf, 0xfe, 0x3f, 0xfe, 0xdb, 0xfe, 0xb9, 0xfe, 0xb8, 0xfd, 0x96, 0xfc, 0x98, 0xfe, 0xdf, 0xfe, 0xbf, 0xfd, 0xde, 0xfd, 0xdf, 0xfd, 0xde, 0xfd, 0xdf, 0xfd, 0xde, 0xfd, 0xde, 0xfd, 0xde, 0xfd, 0x5c, 0xb8, 0x89, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x0f, 0xf8, 0x09, 0xf8, 0x10, 0xf8, 0x0f, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11,
-    0xf8, 0x0a, 0xf8, 0x0a, 0xf8, 0x10, 0xf8, 0x11, 0xf8, 0x11, 0xd0, 0x07, 0xf8, 0x0f, 0xf8, 0x11, 0xf8, 0x10, 0xf8, 0x10, 0xf8, 0x0c, 0xf8, 0x0c, 0xf8, 0xed, 0xf9, 0x6f, 0xf3, 0x13, 0xec, 0x15, 0xed, 0x9a, 0xed, 0x9a, 0xfb, 0xf5, 0xfa, 0x30, 0xf8, 0xab, 0xf8, 0xcc, 0xf8, 0x6a, 0xf9, 0xa9, 0xfb, 0x6d, 0xfc, 0xf1, 0xfd, 0xb3, 0xfe, 0xb8, 0xfe, 0x18, 0xda, 0x53, 0xfa, 0xcc, 0xf3, 0xd4, 0xfe, 0xb7, 0xfe, 0x76, 0xfe, 0x15, 0xfa, 0xeb, 0xd0, 0xc8, 0xfe, 0x76, 0xfe, 0x76, 0xfd, 0x32, 0xfb, 0xae, 0xfb, 0xcd, 0xfe, 0x76, 0xfe, 0x56, 0xfd, 0x33, 0xfb, 0xcf, 0xfb, 0x0f, 0xfa, 0x0d, 0xfa, 0x0a, 0xfa, 0x6b, 0xf9, 0x89, 0xfc, 0xb2, 0xfd, 0x12, 0xfc, 0x2f, 0xf9, 0xca, 0xb3, 0x74, 0xff, 0xde, 0xff, 0x3b, 0xfe, 0xb8, 0xfb, 0x91, 0xfc, 0x36, 0xff, 0x5f, 0xaa, 0x31, 0xfd, 0xdb, 0xff, 0x7d, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x5f, 0xfe, 0x1f, 0xff, 0x3f, 0xff, 0x5d, 0xfe, 0xfc, 0xff, 0x3b, 0xfd, 0x98, 0xfd, 0xbc, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x9f, 0xfd, 0x9e, 0xfd, 0x9e, 0xfd, 0x9e, 0xfd, 0x9e,
-    0xfd, 0x9e, 0xfd, 0x9e, 0xfd, 0x9e, 0xfc, 0xfc, 0xf0, 0x09, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x0d, 0xf8, 0x08, 0xf8, 0x11, 0xf8, 0x0d, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x0d, 0xe8, 0x08, 0xf8, 0x0c, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x0c, 0xf8, 0x08, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x0d, 0xc8, 0x08, 0xc0, 0x08, 0xf8, 0x0d, 0xf8, 0xee, 0xf9, 0x2d, 0xf8, 0x6a, 0xfa, 0x0b, 0xfc, 0x2f, 0xfd, 0xb4, 0xfe, 0x76, 0xfe, 0x97, 0xfc, 0xf5, 0xfa, 0xb0, 0xff, 0x5d, 0xfb, 0xce, 0xfa, 0x90, 0xfe, 0xb8, 0xfe, 0x76, 0xfd, 0xf5, 0xfb, 0xd0, 0xc0, 0xa5, 0xfd, 0x56, 0xfe, 0x76, 0xfd, 0x73, 0xfb, 0xce, 0xfb, 0xcd, 0xfe, 0x96, 0xfe, 0x96, 0xfe, 0x96, 0xfe, 0x36, 0xfd, 0x53, 0xfc, 0x70, 0xfb, 0xae, 0xfb, 0x0c, 0xfa, 0x4b, 0xfe, 0x14, 0xfc, 0x70, 0xfa, 0x2a, 0x79, 0x69, 0xff, 0x7d, 0xff, 0xff, 0xff, 0x9d, 0xfd, 0x36, 0xeb, 0x55, 0xff, 0xbf, 0xaa, 0x72, 0xfc, 0x96, 0xfe, 0xfa, 0xff, 0x5d, 0xff, 0xbf, 0xff, 0x7f, 0xfe, 0xfe,
-    0xff, 0x1e, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7d, 0xfd, 0x99, 0xfc, 0x59, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfd, 0xde, 0xfd, 0x9e, 0xfd, 0x9e, 0xfd, 0x7e, 0xfd, 0x7e, 0xfd, 0x7e, 0xfd, 0x7e, 0xfd, 0x5e, 0xfc, 0x5a, 0xf8, 0x08, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x0a, 0xf8, 0x0c, 0xf8, 0x0d, 0xf8, 0x0f, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x0a, 0xf8, 0x0a, 0xf8, 0x10, 0xf8, 0x11, 0xf8, 0x11, 0xf0, 0x08, 0xf8, 0x0d, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x0d, 0xe8, 0x09, 0xf8, 0x0b, 0xf8, 0x0d, 0xf8, 0xee, 0xf9, 0x0d, 0xf8, 0x6a, 0xfa, 0x0b, 0xfc, 0x2f, 0xfd, 0xb3, 0xfe, 0x76, 0xfe, 0x76, 0xfb, 0xd1, 0xfb, 0xd3, 0xff, 0x9d, 0xff, 0x9d, 0xfc, 0x2f, 0xf9, 0xa9, 0xfd, 0xb5, 0xfe, 0x76, 0xfe, 0x15, 0xfc, 0xd1, 0xd8, 0xe8, 0xf4, 0xd1, 0xfe, 0x76, 0xfd, 0x94, 0xfb, 0xee, 0xfb, 0xac, 0xfe, 0x96, 0xfe, 0x96, 0xfe, 0x96, 0xfe, 0x15, 0xfd, 0x31, 0xfc, 0x2f, 0xfb, 0x8d, 0xf9, 0xea, 0xfc, 0x31, 0xfd, 0x32, 0xfb, 0xce, 0xa0, 0x85,
-    0xfc, 0xd4, 0xff, 0x3b, 0xff, 0xde, 0xff, 0xbf, 0xea, 0xd4, 0xfe, 0xfb, 0xeb, 0x74, 0xfb, 0xf5, 0xfe, 0xb7, 0xff, 0x1a, 0xff, 0x7d, 0xff, 0xdf, 0xfe, 0x9e, 0xff, 0x1d, 0xff, 0x7d, 0xff, 0xbf, 0xff, 0xdf, 0xfe, 0x99, 0xfc, 0xb8, 0xfe, 0xbf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xbf, 0xfd, 0x3e, 0xfd, 0x3e, 0xfd, 0x5e, 0xfd, 0x5e, 0xfd, 0x5e, 0xfd, 0x5e, 0xfd, 0x5e, 0xfd, 0x3e, 0xfc, 0x59, 0xf8, 0x08, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x0a, 0xf8, 0x0d, 0xf8, 0x0d, 0xf8, 0x10, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x0b, 0xf8, 0x09, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x10, 0xe8, 0x07, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x0f, 0xf8, 0x0b, 0xf8, 0x0a, 0xf8, 0x0c, 0xf8, 0xee, 0xf9, 0x0d, 0xf8, 0x69, 0xfa, 0x4b, 0xfc, 0x4f, 0xfd, 0xd5, 0xfe, 0x76, 0xfe, 0x36, 0xfa, 0x8f, 0xfc, 0xf6, 0xff, 0x7b, 0xff, 0x5d, 0xfc, 0x55, 0xfc, 0xd1, 0xfb, 0x4c, 0xfb, 0xf2, 0xfe, 0x76, 0xfe, 0x56, 0xfd, 0x12, 0xf9, 0x48, 0xf2, 0xee, 0xfe, 0x76, 0xfd, 0x73,
-    0xfc, 0x0f, 0xfa, 0x8b, 0xfe, 0x96, 0xfe, 0x96, 0xfe, 0x76, 0xfe, 0x15, 0xfc, 0xf2, 0xfb, 0xae, 0xfb, 0x4d, 0xf9, 0xaa, 0xfe, 0x15, 0xfc, 0x70, 0xf9, 0xe9, 0xd2, 0xad, 0xfe, 0x97, 0xff, 0x1a, 0xff, 0x9c, 0xfb, 0x97, 0xfd, 0xb7, 0xfc, 0x77, 0xfb, 0xd4, 0xfd, 0xf5, 0xfe, 0x97, 0xff, 0x1a, 0xff, 0x7c, 0xfe, 0x1a, 0xfe, 0x59, 0xfe, 0xb9, 0xff, 0x7c, 0xff, 0xff, 0xfe, 0xfc, 0xfc, 0xf8, 0xfe, 0x7f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x5f, 0xfd, 0x5e, 0xfd, 0x5e, 0xfd, 0x3e, 0xfd, 0x3e, 0xfd, 0x3e, 0xfd, 0x1e, 0xfd, 0x1e, 0xfc, 0x5c, 0xfa, 0xf4, 0x78, 0x04, 0xf8, 0x0a, 0xf8, 0x0c, 0xc0, 0x06, 0xf8, 0x0f, 0xf8, 0x0a, 0xf8, 0x10, 0xf8, 0x11, 0xf8, 0x10, 0xf8, 0x0a, 0xf8, 0x2e, 0xf9, 0x14, 0xf8, 0x93, 0xf8, 0x0a, 0xf8, 0x0d, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x0f, 0xd8, 0x09, 0xf8, 0x0b, 0xf8, 0x0c, 0xf9, 0x0e, 0xf9, 0x0d, 0xf8, 0x69, 0xfa, 0xcb, 0xfc, 0x70, 0xfe, 0x15, 0xfe, 0x76, 0xfc, 0xf3, 0xfa, 0x8f, 0xfd, 0xf6,
-    0xff, 0x1c, 0xfd, 0x78, 0xfb, 0xb3, 0xfe, 0x3b, 0xfd, 0x73, 0xfb, 0xef, 0xfa, 0x6e, 0xfe, 0x76, 0xfe, 0x76, 0xfd, 0x53, 0xfa, 0x09, 0xfa, 0xcc, 0xfe, 0x76, 0xfd, 0xf4, 0xfc, 0x0f, 0xfa, 0xca, 0xfe, 0x76, 0xfe, 0x96, 0xfe, 0x76, 0xfd, 0x74, 0xfc, 0xb1, 0xfb, 0xce, 0xfa, 0xcc, 0xe2, 0xad, 0xfd, 0xb3, 0xfb, 0x6d, 0xa8, 0xe6, 0xfd, 0xb5, 0xfe, 0x96, 0xfe, 0xd8, 0xfe, 0x39, 0xeb, 0x2e, 0xfc, 0x11, 0xf9, 0xed, 0xfd, 0x94, 0xfc, 0xd1, 0xfe, 0x76, 0xff, 0x1a, 0xfc, 0x94, 0xfd, 0x53, 0xfe, 0x36, 0xfe, 0xf9, 0xff, 0x5c, 0xfc, 0xfa, 0xfd, 0x3c, 0xfe, 0x1f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfd, 0xbf, 0xfd, 0x1e, 0xfd, 0x1d, 0xfd, 0x1e, 0xfd, 0x1e, 0xfb, 0xd9, 0xea, 0x71, 0x89, 0x08, 0x90, 0x46, 0xa0, 0xa7, 0xf9, 0x6e, 0xf9, 0x6e, 0x90, 0xc7, 0x18, 0x01, 0xe0, 0x07, 0xc8, 0x06, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x0f, 0xf8, 0x52, 0xfb, 0x5b, 0xfb, 0x9c, 0xf9, 0xd7, 0xf8, 0x09, 0xf8, 0x10, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x10,
-    0xf8, 0x0c, 0xf8, 0x0c, 0xf8, 0x0c, 0xf8, 0x8f, 0xf8, 0xee, 0xf8, 0x69, 0xfb, 0x2d, 0xfc, 0xf2, 0xfe, 0x76, 0xfe, 0x76, 0xfb, 0xf0, 0xfa, 0xef, 0xfe, 0x78, 0xfe, 0x7a, 0xfb, 0x95, 0xfc, 0x95, 0xfe, 0xdb, 0xfc, 0x5c, 0xfd, 0xf6, 0xfc, 0xb1, 0xfa, 0x0c, 0xfd, 0x55, 0xfe, 0x76, 0xfe, 0x15, 0xfa, 0x6b, 0xc9, 0x4a, 0xfe, 0x76, 0xfe, 0x36, 0xfc, 0xd1, 0xfb, 0x0b, 0xfe, 0x76, 0xfe, 0x96, 0xfe, 0x15, 0xfd, 0x33, 0xfc, 0x2f, 0xfb, 0x6d, 0xf9, 0x26, 0xfd, 0x33, 0xfc, 0xf1, 0xf9, 0xa8, 0xfb, 0xf0, 0xfe, 0x76, 0xfe, 0x96, 0xfe, 0xb8, 0xfe, 0x57, 0xfc, 0xd3, 0xfa, 0xaf, 0xfd, 0xf5, 0xfc, 0x70, 0xfd, 0x94, 0xfe, 0x76, 0xfc, 0xd6, 0xfb, 0x92, 0xfe, 0x15, 0xfe, 0x76, 0xfe, 0x78, 0xfc, 0x17, 0xfd, 0x1d, 0xfe, 0x1f, 0xfe, 0x7f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfd, 0x3e, 0xfc, 0xfe, 0xfc, 0x9d, 0xfa, 0xb3, 0x81, 0x08, 0xa9, 0x0a, 0xfa, 0x92, 0xfb, 0x99, 0xfc, 0xfc, 0xfd, 0x1e, 0xfd, 0x1e, 0xfd, 0x5e, 0xfd, 0x7e, 0xfc, 0x38, 0xa9, 0xab, 0x30, 0x22, 0xf8, 0x0d, 0xf8, 0x11,
-    0xf8, 0x51, 0xf9, 0x9d, 0xfd, 0x9f, 0xfd, 0xbf, 0xfb, 0xde, 0xf8, 0x0e, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x31, 0xf8, 0x0c, 0xf8, 0x0d, 0xf8, 0x09, 0xf8, 0xaf, 0xf8, 0xce, 0xf8, 0x69, 0xfa, 0xcc, 0xfd, 0xb4, 0xfe, 0x76, 0xfe, 0x16, 0xfa, 0xae, 0xfc, 0x73, 0xfe, 0x98, 0xfb, 0xf4, 0xfb, 0xd3, 0xfe, 0x18, 0xfd, 0x39, 0xfb, 0xbb, 0xfe, 0x3c, 0xfe, 0xd9, 0xfd, 0x53, 0xfb, 0xae, 0xfb, 0xd1, 0xfe, 0x76, 0xfe, 0x15, 0xfb, 0x2d, 0xb0, 0x66, 0xfd, 0x94, 0xfe, 0x76, 0xfc, 0xb1, 0xfa, 0xab, 0xfe, 0x56, 0xfe, 0x96, 0xfe, 0x15, 0xfc, 0xf2, 0xfc, 0x2f, 0xfb, 0x0c, 0xfa, 0x0b, 0xfd, 0xf5, 0xfb, 0x6d, 0xc9, 0x49, 0xfe, 0x76, 0xfe, 0x96, 0xfe, 0x77, 0xfe, 0xf9, 0xfe, 0x15, 0xf1, 0x4a, 0xfd, 0xd5, 0xfb, 0x8d, 0xfc, 0xb1, 0xfd, 0xd5, 0xfc, 0x52, 0xfa, 0x8e, 0xfd, 0x32, 0xfe, 0x76, 0xfd, 0x53, 0xfb, 0xf5, 0xfd, 0x1d, 0xfd, 0xbe, 0xfd, 0xff, 0xfe, 0x7f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x3f, 0xfc, 0x7c, 0xfa, 0x92, 0xc1, 0x0a, 0xf2, 0x70,
-    0xfc, 0x5a, 0xfd, 0x3e, 0xfd, 0x5e, 0xfd, 0x9e, 0xfd, 0x9e, 0xfd, 0xde, 0xfe, 0x1f, 0xfe, 0x3f, 0xfe, 0x7f, 0xfe, 0x1f, 0xfd, 0xde, 0xfb, 0x96, 0x68, 0x85, 0xf8, 0x09, 0xf8, 0x70, 0xfa, 0x1d, 0xfd, 0xdf, 0xfd, 0xdf, 0xfb, 0x5c, 0xf8, 0x93, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0xb3, 0xf8, 0xb2, 0xf8, 0x52, 0xf8, 0x75, 0xf9, 0xd7, 0xf9, 0xd2, 0xf8, 0x8b, 0xfb, 0x0d, 0xfe, 0x55, 0xfe, 0x76, 0xfd, 0x13, 0xfa, 0xaf, 0xfd, 0xb5, 0xfd, 0x74, 0xfb, 0x33, 0xfd, 0x15, 0xfe, 0x79, 0xfc, 0x5b, 0xfc, 0x7a, 0xfe, 0x1d, 0xfb, 0xba, 0xfc, 0xb7, 0xfd, 0xf6, 0xfc, 0x2f, 0xfa, 0xac, 0xfe, 0x96, 0xfe, 0x76, 0xfc, 0x90, 0x90, 0x26, 0xfd, 0x12, 0xfe, 0x96, 0xfd, 0x53, 0xfa, 0x4a, 0xfd, 0xf4, 0xfe, 0x96, 0xfe, 0x35, 0xfc, 0xd1, 0xfb, 0xee, 0xfa, 0x0a, 0xec, 0x30, 0xfd, 0x32, 0xf9, 0xa8, 0xfc, 0xf3, 0xfe, 0x96, 0xfe, 0x96, 0xfe, 0x97, 0xfd, 0xd5, 0xe2, 0x2c, 0xfd, 0x95, 0xfa, 0x0d, 0xfa, 0xac, 0xfd, 0x53, 0xfb, 0x2f, 0xf9, 0x68, 0xfc, 0x2f, 0xfe, 0x15, 0xfc, 0x51,
-    0xf9, 0xd0, 0xfd, 0x1d, 0xfd, 0x5e, 0xfe, 0x1f, 0xfe, 0x3e, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfb, 0x96, 0xd1, 0x6c, 0xfb, 0x15, 0xfd, 0x3d, 0xfd, 0x9e, 0xfd, 0xff, 0xfe, 0x1e, 0xfe, 0x5f, 0xfe, 0x9f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x9f, 0xfe, 0x5f, 0xfd, 0xde, 0xfc, 0xfc, 0xd9, 0xcd, 0x68, 0x04, 0xf8, 0xf3, 0xfc, 0x7d, 0xfc, 0x5d, 0xf9, 0x75, 0xf8, 0x92, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf9, 0x55, 0xf9, 0x79, 0xfa, 0x7d, 0xfc, 0xbf, 0xfc, 0x7d, 0xf9, 0xf4, 0xfb, 0xd0, 0xfe, 0x15, 0xfe, 0x76, 0xfc, 0x72, 0xfa, 0x8e, 0xfe, 0x16, 0xfb, 0xd2, 0xfb, 0x91, 0xfe, 0x56, 0xfe, 0x19, 0xfb, 0xb9, 0xfd, 0x9e, 0xfc, 0xdc, 0xfd, 0x3c, 0xff, 0x1f, 0xfb, 0x51, 0xfe, 0x57, 0xfc, 0xb0, 0xf9, 0xc9, 0xfd, 0xb5, 0xfe, 0x76, 0xfd, 0x32, 0x98, 0xe6, 0xfc, 0x90, 0xfe, 0x76, 0xfd, 0xf4, 0xfa, 0xca, 0xfd, 0xd4, 0xfe, 0x76, 0xfd, 0x94, 0xfc, 0xd1, 0xfb, 0x6d, 0xf9, 0x27, 0xfd, 0xb5, 0xfc, 0xb1, 0xfa, 0x4b, 0xfe, 0x96,
-    0xfe, 0x96, 0xfe, 0x96, 0xfe, 0x15, 0xf9, 0xcc, 0xfc, 0x93, 0xfb, 0x50, 0xf9, 0x89, 0xfc, 0xb1, 0xfb, 0xb0, 0xe1, 0x08, 0xfb, 0xcf, 0xfd, 0x12, 0xfb, 0x0f, 0xe8, 0x67, 0xfc, 0x39, 0xfd, 0x7e, 0xfd, 0xfe, 0xfe, 0x1f, 0xfe, 0x5f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xbf, 0xfd, 0xbd, 0xfa, 0xd3, 0xfd, 0x3d, 0xfe, 0x1f, 0xfe, 0x3f, 0xfe, 0xbf, 0xfe, 0xdf, 0xfe, 0xbf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xbf, 0xfe, 0x5f, 0xfd, 0xff, 0xfd, 0xbe, 0xfd, 0x5e, 0xfb, 0x14, 0x70, 0x24, 0xf8, 0xd1, 0xf9, 0x56, 0xf8, 0x0c, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x92, 0xf8, 0xd5, 0xfa, 0x3f, 0xfd, 0x5f, 0xfe, 0x7f, 0xfc, 0x7f, 0xfb, 0xfa, 0xfd, 0x74, 0xfd, 0xf4, 0xfb, 0xf1, 0xfa, 0xef, 0xfc, 0xd3, 0xfa, 0xaf, 0xfd, 0x13, 0xfe, 0x76, 0xfc, 0xb7, 0xfb, 0x98, 0xfd, 0xdd, 0xfc, 0x3c, 0xfe, 0x3e, 0xfe, 0xff, 0xff, 0x3f, 0xfd, 0xb7, 0xfb, 0xb2, 0xfd, 0x53, 0xfb, 0x4d, 0xfb, 0xd0, 0xfe, 0x76, 0xfd, 0x93, 0xc1, 0xe8,
-    0xd2, 0xac, 0xfe, 0x76, 0xfd, 0xf5, 0xfb, 0xed, 0xfd, 0x53, 0xfe, 0x96, 0xfd, 0x73, 0xfc, 0xd1, 0xfb, 0x0c, 0xca, 0x2a, 0xfd, 0xf4, 0xfa, 0xcb, 0xfc, 0x71, 0xfe, 0x76, 0xfe, 0x76, 0xfd, 0xf4, 0xfb, 0x0d, 0xfb, 0x8f, 0xfc, 0x51, 0xf9, 0x08, 0xfb, 0xee, 0xfb, 0xce, 0xf8, 0x87, 0xfb, 0x2d, 0xfc, 0x91, 0xf9, 0x6a, 0xf9, 0xc9, 0xf9, 0xcd, 0xfd, 0x7e, 0xfd, 0x9e, 0xfd, 0xfe, 0xfe, 0x1f, 0xfe, 0x7f, 0xfe, 0xdf, 0xfe, 0x3f, 0xfd, 0x3e, 0xfd, 0xbe, 0xfe, 0x3e, 0xfe, 0xbf, 0xfe, 0xbf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xbf, 0xfe, 0x3f, 0xfd, 0xff, 0xfd, 0xbe, 0xfd, 0x5e, 0xfb, 0x97, 0x60, 0x04, 0xf8, 0x0c, 0xf8, 0x0b, 0xf8, 0x10, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x0b, 0xf8, 0x94, 0xfa, 0xdc, 0xfd, 0xdf, 0xfe, 0x5f, 0xfc, 0xdf, 0xfd, 0x3b, 0xfd, 0x54, 0xfb, 0x0f, 0xfa, 0x4d, 0xfb, 0x90, 0xfa, 0xce, 0xfd, 0xf7, 0xfe, 0x75, 0xfc, 0x14, 0xfc, 0x56,
-    0xfc, 0xb9, 0xfc, 0x1a, 0xfe, 0xff, 0xff, 0x1f, 0xff, 0x3f, 0xff, 0x7f, 0xfe, 0xd8, 0xfb, 0xf2, 0xfd, 0x13, 0xfb, 0xee, 0xfa, 0x2b, 0xfe, 0x76, 0xfe, 0x15, 0xfa, 0xcc, 0xc9, 0x28, 0xfe, 0x76, 0xfe, 0x35, 0xfc, 0x71, 0xf4, 0x70, 0xfe, 0x76, 0xfd, 0x94, 0xfc, 0x30, 0xf9, 0x88, 0xd3, 0xad, 0xfd, 0xb4, 0xfa, 0x6a, 0xfe, 0x15, 0xfe, 0x76, 0xfd, 0xf4, 0xfc, 0x30, 0xfb, 0x8f, 0xfd, 0xf5, 0xf9, 0x69, 0xfb, 0x2d, 0xfc, 0x10, 0xf1, 0x09, 0xfb, 0x0c, 0xfb, 0x8e, 0xf9, 0xab, 0xfa, 0x0a, 0xfb, 0x6f, 0xfb, 0x76, 0xfd, 0x7e, 0xfd, 0xbe, 0xfe, 0x1f, 0xfe, 0x1f, 0xfe, 0x9f, 0xfd, 0xde, 0xfd, 0xdf, 0xfe, 0xbf, 0xfe, 0xbf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x9f, 0xfe, 0x1e, 0xfe, 0x1e, 0xfd, 0xbe, 0xfd, 0x5e, 0xfb, 0x56, 0x50, 0x03, 0xf8, 0x0c, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x10, 0xf8, 0x0b, 0xf8, 0x6f,
-    0xfb, 0x7b, 0xfd, 0x3f, 0xfb, 0x9f, 0xfd, 0x9e, 0xfc, 0xf8, 0xfb, 0x30, 0xfb, 0x4e, 0xfa, 0x6e, 0xfb, 0x70, 0xfe, 0x15, 0xfe, 0x15, 0xfa, 0xb0, 0xfc, 0xb5, 0xfb, 0xf6, 0xfc, 0x9a, 0xfe, 0xdf, 0xff, 0x1f, 0xff, 0x3f, 0xff, 0xbf, 0xff, 0xbf, 0xfe, 0xf9, 0xfe, 0x98, 0xfb, 0x10, 0xfc, 0xb1, 0xfa, 0x2a, 0xfd, 0xf5, 0xfe, 0x56, 0xfb, 0xcf, 0x80, 0x45, 0xfd, 0xf4, 0xfe, 0x76, 0xfd, 0x33, 0xfc, 0x91, 0xfe, 0x76, 0xfd, 0x53, 0xfc, 0x10, 0xf9, 0x28, 0xfd, 0x94, 0xfc, 0xf2, 0xfa, 0xed, 0xfe, 0x76, 0xfe, 0x15, 0xfc, 0x71, 0xfb, 0x2d, 0xfd, 0xf4, 0xfb, 0x70, 0xfa, 0x4c, 0xfc, 0x72, 0xf9, 0x2a, 0xf9, 0xea, 0xfb, 0x0d, 0xf0, 0xa8, 0xfa, 0x4b, 0xfc, 0xb2, 0xfa, 0xd2, 0xfd, 0x5e, 0xfd, 0x9e, 0xfd, 0xde, 0xfe, 0x3f, 0xfe, 0x5f, 0xfe, 0xbf, 0xfe, 0xbf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf,
-    0xfe, 0x9f, 0xfe, 0x1f, 0xfd, 0xff, 0xfd, 0xbf, 0xfd, 0x9e, 0xfb, 0x56, 0x80, 0x04, 0xf8, 0x10, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x0c, 0xf8, 0x0a, 0xf8, 0x50, 0xfa, 0x57, 0xf9, 0xb7, 0xfb, 0x7a, 0xfc, 0x56, 0xfb, 0xcf, 0xfc, 0x10, 0xfa, 0x0c, 0xfb, 0x4f, 0xfd, 0x53, 0xfb, 0xf1, 0xfa, 0x8f, 0xfc, 0xb3, 0xfb, 0x75, 0xfd, 0x18, 0xfe, 0xbe, 0xfe, 0xdf, 0xff, 0x3f, 0xff, 0x5f, 0xff, 0xbf, 0xff, 0x9f, 0xfe, 0xf9, 0xff, 0x1a, 0xfb, 0xd3, 0xfc, 0xb2, 0xfb, 0x0c, 0xfc, 0x92, 0xfe, 0x76, 0xfd, 0x53, 0x58, 0x84, 0xfd, 0x53, 0xfe, 0x96, 0xfd, 0xd4, 0xfc, 0x93, 0xfe, 0x76, 0xfd, 0x33, 0xfb, 0xee, 0xfa, 0x30, 0xfe, 0x77, 0xfc, 0x70, 0xfa, 0xce, 0xfe, 0x56, 0xfd, 0x13, 0xfb, 0x90, 0xfc, 0xd3, 0xfd, 0xf6, 0xf9, 0xf3, 0xfc, 0x75, 0xf9, 0xef, 0xf9, 0xea, 0xfb, 0x0c, 0xa8, 0x45, 0xf9, 0xc8, 0xfc, 0x6f, 0xfa, 0x8f, 0xfc, 0x5b, 0xfd, 0xbf, 0xfd, 0xde, 0xfe, 0x1f, 0xfe, 0x9f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf,
-    0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x9f, 0xfe, 0x1f, 0xfd, 0xde, 0xfd, 0xbe, 0xfd, 0x9e, 0xf9, 0xd1, 0xf0, 0x08, 0xf8, 0x10, 0xf8, 0x11, 0xf8, 0x10, 0xf8, 0x0c, 0xf8, 0x09, 0xf8, 0x6f, 0xf8, 0xea, 0xf9, 0x4c, 0xfb, 0x0f, 0xfb, 0x6d, 0xfb, 0xaf, 0xf8, 0xeb, 0xfb, 0xaf, 0xfc, 0xd1, 0xfb, 0xcf, 0xf9, 0x8d, 0xfc, 0x92, 0xfa, 0x70, 0xfd, 0xf6, 0xfe, 0x5a, 0xfe, 0xde, 0xfe, 0xff, 0xff, 0x1f, 0xfd, 0x7f, 0xfe, 0x7f, 0xff, 0xbf, 0xfe, 0xd8, 0xff, 0x1a, 0xfe, 0xda, 0xfb, 0x31, 0xfc, 0xf2, 0xfb, 0x0d, 0xfe, 0x76, 0xfd, 0x73, 0x71, 0x45, 0xf3, 0xae, 0xfe, 0x96, 0xfe, 0x15, 0xfc, 0x13, 0xfe, 0x76, 0xfd, 0x53, 0xfa, 0xed, 0xfb, 0xf3, 0xfd, 0xf4, 0xfb, 0x4e, 0xfc, 0x90, 0xfe, 0x35, 0xfc, 0xd4, 0xfb, 0x96, 0xfe, 0x1c, 0xfb, 0xd9, 0xfc, 0x5d, 0xfa, 0xfa, 0xf9, 0xf7, 0xfa, 0x71, 0x78, 0x26, 0xf9, 0x48, 0xfb, 0xcf, 0xfc, 0x11, 0xfb, 0x16,
-    0xfd, 0x5e, 0xfd, 0xbe, 0xfe, 0x1e, 0xfe, 0xbf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x9f, 0xfe, 0x3f, 0xfd, 0xde, 0xfd, 0xbe, 0xfd, 0x5e, 0xe9, 0xad, 0xf8, 0x0b, 0xf8, 0x11, 0xf8, 0x0d, 0xf8, 0x0c, 0xf8, 0x0e, 0xf8, 0xee, 0xf8, 0xa8, 0xfa, 0x8a, 0xfa, 0xab, 0xfb, 0x0c, 0xf9, 0x6a, 0xfb, 0x2d, 0xfc, 0x0f, 0xfa, 0xee, 0xfa, 0xef, 0xfc, 0x32, 0xfa, 0x4e, 0xfe, 0x15, 0xfe, 0x97, 0xfe, 0x99, 0xfe, 0xde, 0xfd, 0xbd, 0xfc, 0x5e, 0xfe, 0x9f, 0xff, 0x5f, 0xff, 0x9f, 0xfe, 0xf9, 0xff, 0x1a, 0xff, 0x1a, 0xfc, 0x12, 0xfc, 0xd1, 0xfb, 0x0d, 0xfe, 0x96, 0xfe, 0x15, 0xfa, 0x4c, 0xf3, 0x8f, 0xfe, 0x96, 0xfe, 0x76, 0xfc, 0xd4, 0xfe, 0x76, 0xfd, 0x73, 0xfb, 0x10, 0xfd, 0x34, 0xfd, 0xf4, 0xfb, 0x6d, 0xfd, 0xf4,
-    0xfe, 0x36, 0xfc, 0xd5, 0xfd, 0x1b, 0xfe, 0xdf, 0xfb, 0xdf, 0xfd, 0x9f, 0xfb, 0x3f, 0xfb, 0x5c, 0xf8, 0xb2, 0xf8, 0xed, 0xfa, 0xec, 0xfc, 0xd1, 0xfa, 0xf1, 0xfc, 0xfd, 0xfd, 0x5e, 0xfe, 0x1f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xbf, 0xfe, 0x9f, 0xfe, 0x3e, 0xfd, 0xbf, 0xfd, 0x7e, 0xfc, 0xbd, 0xe0, 0x49, 0xf8, 0x10, 0xf8, 0x0d, 0xf8, 0x0a, 0xf8, 0x30, 0xf8, 0x2a, 0xf8, 0xca, 0xfa, 0x8a, 0xfa, 0xab, 0xf9, 0x8b, 0xf9, 0xca, 0xfb, 0xce, 0xfa, 0x8c, 0xfa, 0x6e, 0xfb, 0x70, 0xfa, 0x8d, 0xfd, 0x53, 0xfe, 0x15, 0xfe, 0x76, 0xfe, 0x59, 0xfb, 0x37, 0xfb, 0x18, 0xfe, 0xdf, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x5f, 0xff, 0x1a, 0xfe, 0xfa, 0xff, 0x1a, 0xff, 0x1b, 0xfc, 0xb4, 0xfc, 0x92,
-    0xfd, 0x15, 0xfe, 0x76, 0xfc, 0xd2, 0xf9, 0xd1, 0xfe, 0x76, 0xfe, 0x96, 0xfc, 0x54, 0xfe, 0x76, 0xfd, 0x73, 0xfb, 0x32, 0xfc, 0xf4, 0xfe, 0x15, 0xfa, 0xae, 0xfe, 0x36, 0xfe, 0x14, 0xfc, 0x59, 0xfe, 0x3e, 0xfe, 0x3f, 0xfd, 0x9f, 0xfd, 0xbf, 0xfd, 0x9f, 0xf9, 0x5e, 0xfa, 0x7a, 0xfa, 0x12, 0xfb, 0x8e, 0xfc, 0x30, 0xfb, 0x77, 0xfd, 0x5e, 0xfd, 0xff, 0xfe, 0xbf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xbf, 0xfe, 0x9f, 0xfe, 0x7f, 0xfe, 0x1f, 0xfd, 0x9e, 0xfc, 0xfe, 0xfa, 0x52, 0xf8, 0x0e, 0xf8, 0x0b, 0xf8, 0x0c, 0xf8, 0x6f, 0xf8, 0x2a, 0xf9, 0x6c, 0xfa, 0x6a, 0xf9, 0x89, 0xf9, 0x89, 0xfa, 0xeb, 0xfa, 0xac, 0xf9, 0xcc, 0xfa, 0xae, 0xfa, 0x8d, 0xfd, 0x52, 0xfd, 0xd4, 0xfe, 0x76,
-    0xfd, 0x55, 0xf9, 0x2e, 0xfc, 0x77, 0xfe, 0xdd, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0x1f, 0xfe, 0xbf, 0xfe, 0xf9, 0xff, 0x1a, 0xff, 0x1a, 0xff, 0x3b, 0xfd, 0x17, 0xfd, 0x73, 0xfc, 0x93, 0xfe, 0x76, 0xfd, 0xf4, 0xf9, 0x71, 0xfe, 0x76, 0xfe, 0x96, 0xfd, 0x96, 0xfd, 0xf6, 0xfd, 0xf4, 0xfb, 0x54, 0xfd, 0xd5, 0xfe, 0x36, 0xfb, 0xf3, 0xfe, 0x76, 0xfd, 0xd6, 0xfc, 0xdb, 0xfe, 0xbf, 0xfc, 0xbf, 0xfe, 0xdf, 0xff, 0x5f, 0xfc, 0xbf, 0xfb, 0x1f, 0xf9, 0xd9, 0xfb, 0x98, 0xfc, 0xd3, 0xfa, 0x90, 0xfd, 0x1d, 0xfd, 0xbf, 0xfe, 0x9f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x9f, 0xfe, 0x9f, 0xfe, 0x1f, 0xfd, 0xbe, 0xfd, 0x3e, 0xfb, 0x96, 0xf8, 0x09, 0xf8, 0x0a, 0xf8, 0x10,
-    0xf8, 0x0b, 0xf8, 0x0d, 0xf9, 0xac, 0xf9, 0x2a, 0xf8, 0xc9, 0xfa, 0xcb, 0xfa, 0x8c, 0xf9, 0x0b, 0xf9, 0xac, 0xf9, 0xab, 0xfc, 0xd1, 0xfd, 0x73, 0xfd, 0xf5, 0xfc, 0x11, 0xb1, 0x69, 0xfd, 0x74, 0xfe, 0x78, 0xfe, 0xbb, 0xfe, 0xdd, 0xfe, 0xbf, 0xfc, 0x9b, 0xfc, 0x9c, 0xfe, 0xfa, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x3b, 0xfe, 0xfb, 0xfc, 0xf4, 0xfc, 0x52, 0xfe, 0x76, 0xfe, 0x36, 0xfa, 0x31, 0xfe, 0x76, 0xfe, 0x97, 0xfd, 0xb5, 0xfd, 0x75, 0xfd, 0xd5, 0xfb, 0x33, 0xfd, 0xb5, 0xfe, 0x15, 0xfc, 0x93, 0xfe, 0x76, 0xfd, 0xd6, 0xfd, 0x78, 0xfe, 0x9e, 0xfb, 0x7f, 0xfd, 0xbf, 0xfd, 0x5f, 0xfc, 0x9f, 0xfb, 0x5f, 0xfa, 0x17, 0xfc, 0x36, 0xfb, 0xef, 0xfb, 0x77, 0xfd, 0x5e, 0xfd, 0xde, 0xfe, 0xbf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf,
-    0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x9f, 0xfd, 0xde, 0xfe, 0xff, 0xfe, 0x9f, 0xfe, 0x9f, 0xfe, 0x1f, 0xfd, 0xbe, 0xfd, 0x5e, 0xfc, 0x1b, 0xf8, 0x09, 0xf8, 0x0c, 0xf8, 0x30, 0xf8, 0x0c, 0xf8, 0xaf, 0xf9, 0x2d, 0xf8, 0x0b, 0xfa, 0x6a, 0xfa, 0xcb, 0xf9, 0x2a, 0xf9, 0x8b, 0xf9, 0xaa, 0xfc, 0x0f, 0xfc, 0xb1, 0xfd, 0x72, 0xfa, 0x2c, 0xd9, 0x07, 0xfc, 0xd3, 0xfe, 0x96, 0xfe, 0x77, 0xfe, 0x78, 0xfc, 0xb8, 0xfb, 0x99, 0xfd, 0x3b, 0xfa, 0x9f, 0xff, 0x1a, 0xff, 0x1a, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x9d, 0xfc, 0xf7, 0xfc, 0xb4, 0xfd, 0xf6, 0xfe, 0x76, 0xfc, 0x54, 0xfd, 0x55, 0xfe, 0xb8, 0xfe, 0x98, 0xfd, 0x35, 0xfd, 0x72, 0xfc, 0x52, 0xfd, 0xd6, 0xfe, 0x15, 0xfc, 0xd4, 0xfe, 0x96, 0xfd, 0xf5, 0xfe, 0x16, 0xfc, 0x38, 0xfb, 0x5b, 0xfb, 0xbe, 0xfa, 0xff, 0xfb, 0x5b, 0xfa, 0x7a, 0xfa, 0x15, 0xfc, 0x54, 0xfa, 0xaf, 0xfd, 0x1d, 0xfd, 0x9d, 0xfe, 0x1f, 0xfe, 0xff, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf,
-    0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x3f, 0xfc, 0x9d, 0xfe, 0xdf, 0xfd, 0xfd, 0xfe, 0x9f, 0xfe, 0x3f, 0xfd, 0xde, 0xfd, 0x5e, 0xfb, 0xd9, 0xf8, 0x0b, 0xf8, 0x0b, 0xf8, 0x0d, 0xf8, 0x10, 0xf8, 0x90, 0xf8, 0x2a, 0xf8, 0xcb, 0xfa, 0x6a, 0xf9, 0x09, 0xf9, 0x29, 0xf9, 0x6a, 0xfb, 0x8d, 0xfc, 0x0f, 0xfc, 0x92, 0xf9, 0x69, 0xf9, 0x08, 0xfd, 0x33, 0xfe, 0x15, 0xfe, 0x76, 0xfe, 0x37, 0xfb, 0x52, 0xfc, 0xb7, 0xfb, 0xba, 0xc2, 0x7f, 0xba, 0xff, 0xfe, 0xfa, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x7c, 0xff, 0x7c, 0xfe, 0x3b, 0xfd, 0xb6, 0xfc, 0xd5, 0xfe, 0x76, 0xfd, 0x35, 0xfc, 0xb4, 0xfe, 0xb8, 0xfe, 0xf9, 0xfd, 0xf6, 0xfd, 0x74, 0xfd, 0x12, 0xfe, 0x77, 0xfe, 0x76, 0xfc, 0x93, 0xfe, 0x76, 0xfe, 0x15, 0xfe, 0x76, 0xfb, 0x32, 0xfa, 0x57, 0xf9, 0xda, 0xfb, 0xbd, 0xf9, 0xd6, 0xf9, 0xb5, 0xfa, 0x72, 0xfb, 0xb0, 0xfa, 0xd3, 0xfc, 0x5a,
-    0xfc, 0x58, 0xfd, 0xde, 0xfe, 0x9f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xff, 0xfe, 0x1c, 0xfc, 0xd8, 0xfc, 0x99, 0xfe, 0x9f, 0xfe, 0x5f, 0xfd, 0xde, 0xfc, 0xfe, 0xfb, 0x56, 0xf8, 0x0c, 0xf8, 0x0c, 0xf8, 0x0c, 0xf8, 0x0c, 0xf8, 0x0c, 0xf8, 0x0c, 0xf9, 0x2d, 0xf8, 0xca, 0xf8, 0xc9, 0xf8, 0xc9, 0xfb, 0x2b, 0xfb, 0x8e, 0xfb, 0xee, 0xa1, 0x07, 0xf1, 0x08, 0xfc, 0x70, 0xfd, 0x73, 0xfe, 0x76, 0xfd, 0x95, 0xfb, 0x11, 0xfc, 0x31, 0xc2, 0xb9, 0x32, 0x7f, 0x7a, 0xff, 0xbb, 0x1f, 0xfc, 0x56, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x5b, 0xff, 0x5c, 0xff, 0x7d, 0xfd, 0x79, 0xfc, 0x95, 0xfe, 0xb8, 0xfd, 0xf6, 0xfb, 0x93, 0xfe, 0xb8, 0xff, 0x3b, 0xfe, 0xb8, 0xfd, 0x73, 0xfc, 0x70, 0xff, 0x19, 0xfe, 0x56,
-    0xfc, 0xd4, 0xfe, 0x96, 0xfe, 0x76, 0xfe, 0x15, 0xfa, 0x0b, 0xf9, 0x2e, 0xf8, 0xf0, 0xfb, 0x59, 0xf9, 0xb1, 0xf0, 0xe9, 0xfa, 0x8c, 0xf9, 0x89, 0xf9, 0xd0, 0xfb, 0xb4, 0xfc, 0xd9, 0xca, 0x6f, 0xf2, 0x2f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfd, 0x7a, 0xf3, 0xd5, 0xfb, 0x73, 0xfb, 0xf6, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x9f, 0xfe, 0x7f, 0xfd, 0x1f, 0xfc, 0x1d, 0xfb, 0x15, 0xf8, 0x0c, 0xf8, 0x0a, 0xf8, 0x0b, 0xf8, 0x0c, 0xf8, 0x0c, 0xf8, 0x4f, 0xf8, 0x6b, 0xf8, 0x4a, 0xf8, 0xa8, 0xfa, 0x8b, 0xfb, 0x2b, 0xfb, 0x4d, 0x90, 0xe6, 0xf0, 0xc7, 0xfb, 0xef, 0xfd, 0x32, 0xfd, 0xd5, 0xfc, 0x92, 0xfa, 0xf1, 0xfc, 0x53, 0xd2, 0x5d, 0xfb, 0x9f, 0xfc, 0x3f, 0xfc, 0x7f, 0xec, 0x7f, 0xfa, 0x5f, 0xfd, 0x79, 0xff, 0x5b, 0xff, 0x5c,
-    0xff, 0x7c, 0xff, 0x9d, 0xfd, 0xba, 0xfd, 0x36, 0xfe, 0x79, 0xfe, 0xd8, 0xfb, 0xd3, 0xfe, 0xb8, 0xff, 0x3b, 0xfe, 0xf9, 0xfd, 0x94, 0xfc, 0x51, 0xfe, 0xf9, 0xfe, 0x96, 0xfd, 0xf5, 0xfe, 0x96, 0xfe, 0x76, 0xfd, 0x93, 0xfa, 0x2a, 0xf8, 0x88, 0xf9, 0x4a, 0xfa, 0x8e, 0xf9, 0x49, 0xc0, 0x66, 0xfa, 0x8a, 0xf9, 0x6b, 0xfb, 0xd5, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xca, 0xd0, 0xfe, 0x9e, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x7f, 0xfe, 0xdf, 0xfe, 0xff, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x5f, 0xfc, 0x9f, 0xfb, 0xbe, 0xfb, 0x56, 0xfb, 0x15, 0xf8, 0x0b, 0xf8, 0x0a, 0xf8, 0x0c, 0xf8, 0x0b, 0xf8, 0x10, 0xf8, 0x50, 0xf8, 0x8c, 0xf8, 0x0b, 0xf9, 0x6b, 0xfa, 0x6b, 0xfa, 0xaa, 0xf0, 0xa6, 0xe8, 0xe7, 0xfb, 0x4c, 0xfc, 0x0f,
-    0xfd, 0xb4, 0xfb, 0x0f, 0xfb, 0x70, 0xfb, 0x72, 0xca, 0xdf, 0xfb, 0xff, 0xfb, 0xbf, 0xfb, 0xff, 0xfc, 0x7f, 0xfc, 0xdf, 0x82, 0xff, 0xfa, 0x7d, 0xfe, 0xba, 0xff, 0x7b, 0xff, 0x7c, 0xff, 0x9c, 0xfe, 0x7c, 0xfd, 0x78, 0xfd, 0xd8, 0xff, 0x1a, 0xfb, 0xf5, 0xfe, 0xb9, 0xff, 0x3b, 0xff, 0x3b, 0xfd, 0xd6, 0xfc, 0x70, 0xff, 0x3b, 0xfe, 0x96, 0xfe, 0x96, 0xfe, 0x96, 0xfe, 0x76, 0xfd, 0x31, 0xf9, 0xc8, 0x88, 0x44, 0xf9, 0xe9, 0xfa, 0x69, 0xe0, 0xe5, 0xd8, 0xc5, 0xfa, 0x8a, 0xe1, 0x4a, 0xfe, 0x5f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfa, 0x53, 0xfc, 0x1f, 0xf9, 0xcf, 0x88, 0x89, 0xf4, 0xb7, 0xd8, 0x07,
-    0xf8, 0x0c, 0xf8, 0x0e, 0xf8, 0x0c, 0xf8, 0x11, 0xf8, 0x50, 0xf8, 0x2b, 0xf8, 0x0c, 0xf9, 0xcc, 0xfa, 0x0c, 0xf8, 0xe7, 0xe0, 0x86, 0xfa, 0xcb, 0xfb, 0xae, 0xfc, 0xf2, 0xfa, 0xcf, 0xfb, 0x70, 0xfa, 0xf4, 0xd2, 0xdf, 0xfb, 0x9f, 0xf3, 0x7f, 0xfb, 0xbf, 0xfc, 0xbf, 0xfc, 0x9f, 0xfc, 0x9f, 0x92, 0xff, 0x6a, 0xff, 0xfb, 0xd7, 0xff, 0x3b, 0xff, 0x7c, 0xff, 0x9c, 0xff, 0xbf, 0xfd, 0xd7, 0xfd, 0xb7, 0xff, 0x1b, 0xfe, 0x18, 0xfe, 0x38, 0xff, 0x9d, 0xff, 0x9c, 0xff, 0x1a, 0xfc, 0x31, 0xff, 0x3b, 0xfe, 0x97, 0xfe, 0x96, 0xfe, 0x96, 0xfe, 0x55, 0xfc, 0x6f, 0xf9, 0x47, 0xd8, 0xa6, 0xfa, 0x8a, 0xfa, 0x6a, 0xe1, 0x24, 0xf9, 0x07, 0xf9, 0x88, 0xfd, 0x1a, 0xfe, 0xdf, 0xfe, 0xdf, 0xfb, 0xb9, 0xfd, 0x1c, 0xfe, 0xff, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf,
-    0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfa, 0x15, 0xf9, 0x2f, 0xf9, 0x71, 0xf9, 0x74, 0xfc, 0x59, 0xd8, 0x29, 0xf8, 0x0b, 0xf8, 0x0b, 0xf8, 0x11, 0xf8, 0x30, 0xf8, 0x0d, 0xf8, 0x0c, 0xf8, 0x6f, 0xf9, 0x6d, 0xf8, 0xaa, 0xc8, 0x47, 0xfa, 0x6a, 0xfb, 0x2c, 0xfb, 0xce, 0xfa, 0x0d, 0xfa, 0x8e, 0x8a, 0x1b, 0x1a, 0xbf, 0xbb, 0x9f, 0xfb, 0x7f, 0xfb, 0xbf, 0xfd, 0x1f, 0xfd, 0x7f, 0xfd, 0x9f, 0xfd, 0x5f, 0xca, 0xff, 0x9b, 0x1f, 0x8b, 0x1f, 0xfc, 0x97, 0xff, 0x9c, 0xff, 0x9d, 0xff, 0xbe, 0xfe, 0x5a, 0xfd, 0x97, 0xfe, 0xfa, 0xff, 0x5c, 0xfd, 0xb6, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xfd, 0x5d, 0xff, 0x7c, 0xfe, 0xb8, 0xfe, 0x96, 0xfe, 0x96, 0xfe, 0x35, 0xfb, 0x8c, 0xf8, 0xe7, 0xf8, 0xe6, 0xfa, 0x8a, 0xfa, 0x6a, 0xf9, 0x05, 0xd8, 0xa6, 0xfa, 0xb1, 0xfc, 0xbb, 0xfc, 0xbb, 0xfe, 0xbf, 0xf9, 0xf6, 0xf9, 0xb6, 0xfe, 0x9f, 0xfe, 0x5e, 0xfe, 0x1d, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf,
-    0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfd, 0xfe, 0xf9, 0x50, 0xd9, 0x8f, 0xb9, 0xf1, 0xfb, 0x97, 0xf9, 0x70, 0xf8, 0x0d, 0xf8, 0x0a, 0xf8, 0x11, 0xf8, 0x10, 0xf8, 0x0b, 0xf8, 0x11, 0xf8, 0x70, 0xf8, 0xac, 0xd8, 0x08, 0xf9, 0x2b, 0xfa, 0x8b, 0xfa, 0xec, 0xf9, 0x2a, 0xfa, 0x4c, 0x89, 0xf8, 0x1a, 0xdf, 0x22, 0xdf, 0xab, 0x3f, 0xfb, 0xdf, 0xfc, 0x7f, 0xfd, 0x9f, 0xfe, 0x1f, 0xfe, 0xdf, 0xfd, 0xff, 0xfb, 0x1f, 0xab, 0x1f, 0x5a, 0xff, 0xb3, 0x3f, 0xfd, 0x97, 0xff, 0x7c, 0xff, 0x9f, 0xff, 0x7f, 0xfe, 0x7a, 0xfe, 0xfa, 0xff, 0x5d, 0xfe, 0x5b, 0xff, 0x5d, 0xff, 0x9e, 0xff, 0xbf, 0xfe, 0x1e, 0xff, 0x7e, 0xfd, 0x57, 0xfe, 0x76, 0xfe, 0x96, 0xfe, 0x15, 0xfb, 0x4c, 0xe1, 0x04, 0xf9, 0x67, 0xfa, 0x8a, 0xfa, 0x6a, 0xc8, 0x86, 0xa1, 0x09, 0xfe, 0x1d, 0xfc, 0x3a,
-    0xfb, 0xfb, 0xf9, 0xb5, 0xf9, 0x95, 0xfc, 0xfb, 0xfe, 0x9f, 0xfe, 0x5f, 0xfd, 0xdb, 0xfe, 0x1d, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfb, 0x76, 0xa3, 0x2f, 0x48, 0x65, 0xca, 0xd1, 0xf9, 0x4e, 0xf8, 0x09, 0xf8, 0x0e, 0xf8, 0x11, 0xf8, 0x0d, 0xf8, 0x0d, 0xf8, 0x11, 0xf8, 0x6f, 0xd8, 0x07, 0xf8, 0x0c, 0xf9, 0x8d, 0xfa, 0x0b, 0xf9, 0x68, 0xf9, 0x89, 0xf9, 0x91, 0x22, 0x7f, 0x1a, 0xdf, 0x22, 0xdf, 0xbb, 0x5f, 0xfb, 0xdf, 0xfc, 0x9f, 0xfd, 0x9f, 0xfe, 0xdf, 0xff, 0x7f, 0xfe, 0xdf, 0xf3, 0x3f, 0xbb, 0x3f, 0x9a, 0xff, 0x8a, 0xdf, 0xfb, 0x5f, 0xff, 0x1c, 0xff, 0x7e, 0xff, 0xbf, 0xfe, 0x7c, 0xff, 0x5c, 0xff, 0x5d, 0xfe, 0xdc, 0xff, 0x1d, 0xff, 0xbf, 0xff, 0xbf, 0xfd, 0xfe,
-    0xff, 0x5f, 0xfd, 0xd8, 0xfe, 0x96, 0xfe, 0x96, 0xfd, 0xf5, 0xfa, 0x29, 0xf1, 0x04, 0xfa, 0x6a, 0xfa, 0x8a, 0xfa, 0xaa, 0xf1, 0x89, 0xfe, 0x3e, 0xfd, 0x9e, 0xfc, 0xfd, 0xfa, 0x18, 0xfa, 0x74, 0xfe, 0x1d, 0xfe, 0xdf, 0xfe, 0x1f, 0xfd, 0xde, 0xfe, 0xdf, 0xfd, 0x19, 0xfe, 0xdf, 0xfd, 0x9c, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfd, 0xdd, 0xf2, 0x94, 0xf9, 0x13, 0x10, 0x01, 0xa9, 0x74, 0xb8, 0xca, 0xc8, 0x07, 0xf8, 0x0f, 0xf8, 0xac, 0xf8, 0x0b, 0xf8, 0x10, 0xf8, 0x11, 0xf8, 0x2a, 0xf8, 0x0b, 0xf8, 0x8f, 0xf9, 0x0e, 0xf8, 0xca, 0xf8, 0xa9, 0xf9, 0x8b, 0x32, 0x5f, 0x1a, 0xdf, 0x1a, 0xff, 0x3b, 0x1f, 0xf3, 0xdf, 0xfc, 0x7f, 0xfc, 0x9f, 0xfd, 0x9f, 0xfe, 0x1f, 0xfe, 0xdf, 0xfd, 0xff, 0xfc, 0xdf, 0xfc, 0x7f,
-    0xfc, 0x1f, 0xfb, 0xff, 0xfb, 0xdf, 0xfd, 0xdf, 0xff, 0x7e, 0xff, 0xbf, 0xff, 0x5f, 0xff, 0x5e, 0xff, 0x5d, 0xff, 0xbf, 0xff, 0x5f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x1f, 0xfe, 0xff, 0xfd, 0x77, 0xfd, 0x95, 0xfe, 0x76, 0xfd, 0xb4, 0xfa, 0x2a, 0xf8, 0xe6, 0xfa, 0x6a, 0xfa, 0x8a, 0xfa, 0x4a, 0xf4, 0x35, 0xfe, 0xbf, 0xfd, 0x5e, 0xfc, 0x5b, 0xf9, 0xf8, 0xfc, 0xbb, 0xfe, 0xdf, 0xfe, 0xdf, 0xfd, 0x9e, 0xfd, 0xbe, 0xfe, 0xdf, 0xfe, 0x5d, 0xfd, 0x3c, 0xfc, 0xf9, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x7f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xbf, 0xfe, 0x9f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x5f, 0xfe, 0xbf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x5f, 0xfe, 0x1f, 0xfe, 0x5f, 0xfe, 0xdf, 0xfe, 0x3f, 0xfe, 0xdf, 0xd2, 0xb0, 0xfe, 0xbf, 0xf9, 0xb3, 0xb9, 0x4d, 0xa1, 0x70, 0x10, 0x01, 0xf9, 0x4e, 0xf8, 0x0d, 0xf8, 0xe8, 0xf8, 0x49, 0xf8, 0x11, 0xf8, 0x0d, 0xf8, 0x0a, 0xf8, 0x10, 0xf8, 0x8f, 0xf8, 0xed, 0xf8, 0x0a, 0xf8, 0xcc,
-    0x59, 0xbe, 0x1a, 0xdf, 0x1a, 0xdf, 0x2a, 0xff, 0xc3, 0x5f, 0xfc, 0x1f, 0xfc, 0x9f, 0xfd, 0x3f, 0xfd, 0xbf, 0xfd, 0xdf, 0xfe, 0x3f, 0xfe, 0x7f, 0xa2, 0x1f, 0xab, 0x1f, 0x92, 0xff, 0xc2, 0xff, 0xaa, 0xff, 0xd3, 0x3f, 0xfe, 0xbf, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0x5f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0x1e, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x5f, 0xfe, 0xff, 0xfe, 0xda, 0xfc, 0xf4, 0xfe, 0x76, 0xfd, 0x73, 0xfa, 0x8b, 0xf1, 0x06, 0xf9, 0xa8, 0xfa, 0x8a, 0xf9, 0x87, 0xfd, 0x9b, 0xfd, 0xbf, 0xfe, 0x1f, 0xfc, 0x5b, 0xf9, 0xd8, 0xfa, 0x77, 0xfe, 0xdf, 0xfe, 0x9f, 0xfc, 0xbb, 0xfd, 0x9d, 0xfe, 0xbf, 0xfe, 0xff, 0xfd, 0x19, 0xfc, 0xf9, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfc, 0xbf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfd, 0xff, 0xfd, 0x7f, 0xfe, 0xdf, 0xfe, 0x5f, 0xfd, 0x9f, 0xfe, 0xff, 0xfd, 0x3f, 0xfd, 0x7f, 0xfe, 0xff, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xbf, 0xfc, 0xdf, 0xfe, 0x1f, 0xfd, 0x3f, 0xfe, 0x9f, 0xfd, 0x3f, 0xfb, 0x59, 0xf4, 0xb8, 0xff, 0x9f, 0xa9, 0xd4, 0xe2, 0xd5,
-    0x30, 0x23, 0x78, 0x04, 0xfc, 0x18, 0xf8, 0x4c, 0xf8, 0xc8, 0xf9, 0xc8, 0xf8, 0x4f, 0xf8, 0x0a, 0xf8, 0x10, 0xf8, 0x11, 0xf8, 0x8f, 0xf8, 0x0a, 0xf8, 0x6d, 0xd8, 0xf2, 0x1a, 0xdf, 0x1a, 0xdf, 0x4a, 0xff, 0xe3, 0x5f, 0xfb, 0x9f, 0xfc, 0x1f, 0xfc, 0x7f, 0xfc, 0x7f, 0xfd, 0xdf, 0xfe, 0x5f, 0xfe, 0x7f, 0xfd, 0x3f, 0xbb, 0x3f, 0xa9, 0xfc, 0xb2, 0x9f, 0xeb, 0x9f, 0xe3, 0x5f, 0xf3, 0x7f, 0xfc, 0xff, 0xff, 0x5f, 0xff, 0xbf, 0xff, 0x5f, 0xff, 0x7f, 0xff, 0xbf, 0xff, 0x5f, 0xfe, 0xff, 0xff, 0x9f, 0xff, 0x3d, 0xfd, 0xbb, 0xfe, 0xda, 0xfc, 0x94, 0xfe, 0x15, 0xfc, 0xf1, 0xfb, 0x4c, 0xf9, 0x07, 0xf9, 0x27, 0xfa, 0x8a, 0xf9, 0x88, 0xfd, 0x5a, 0xfc, 0xfd, 0xfe, 0x9f, 0xfd, 0x9e, 0xfa, 0xb8, 0xf9, 0xf8, 0xfd, 0x1b, 0xfd, 0x9d, 0xfa, 0xf5, 0xfd, 0x3e, 0xfe, 0xbf, 0xfe, 0xff, 0xfc, 0x57, 0xfe, 0x5e, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfd, 0x1f, 0xfe, 0x9f, 0xfe, 0xdf, 0xfd, 0x1f, 0xfe, 0x9f, 0xfe, 0x5f, 0xfc, 0xff, 0xfe, 0x1f, 0xfc, 0xff, 0xfe, 0x5f, 0xfe, 0xdf,
-    0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfc, 0xdf, 0xfe, 0x1f, 0xfd, 0x5f, 0xfe, 0xdf, 0xfc, 0xbf, 0xfd, 0x9f, 0xfd, 0x1c, 0xdb, 0xd4, 0xe2, 0xfe, 0xf2, 0x7f, 0x58, 0x05, 0x30, 0x01, 0xf8, 0xec, 0xfd, 0x3e, 0xf9, 0xd0, 0xf9, 0x68, 0xf9, 0xa9, 0xf8, 0x88, 0xf8, 0x0c, 0xf8, 0x11, 0xf8, 0x11, 0xf8, 0x0d, 0xf8, 0x0d, 0xf8, 0x2d, 0x1a, 0x7f, 0x1a, 0xdf, 0x72, 0xff, 0xfb, 0x1f, 0xb3, 0x3f, 0xab, 0x1f, 0xab, 0x1f, 0x93, 0x1f, 0xc2, 0xff, 0xe3, 0x1f, 0xfc, 0x7f, 0xfc, 0xdf, 0xec, 0xff, 0xb3, 0x5f, 0xc3, 0x7f, 0xda, 0x5f, 0xf9, 0x9e, 0xf9, 0xff, 0xfa, 0x9f, 0xfb, 0x3f, 0xfd, 0x5f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x1f, 0xff, 0xbf, 0xff, 0x9f, 0xfe, 0xff, 0xff, 0x7f, 0xff, 0x3f, 0xfd, 0xba, 0xfe, 0xfb, 0xfd, 0xd5, 0xfc, 0xb3, 0xfc, 0xb0, 0xfa, 0xeb, 0xf9, 0x28, 0xf0, 0xa7, 0xfa, 0x8a, 0xfa, 0x8a, 0xfb, 0xb4, 0xfc, 0x19, 0xfe, 0x1f, 0xfd, 0xbe, 0xfc, 0xdd, 0xf9, 0x73, 0xfc, 0x17, 0xfb, 0x94, 0xfc, 0x5b, 0xfd, 0x7e, 0xfe, 0xbe, 0xfd, 0xd9, 0xfc, 0x57, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf,
-    0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfd, 0xff, 0xfd, 0xff, 0xfe, 0xdf, 0xfc, 0xdf, 0xfe, 0x9f, 0xfc, 0xff, 0xfe, 0xdf, 0xfe, 0x1f, 0xfe, 0x3e, 0xfd, 0x9a, 0xf5, 0xba, 0xfd, 0x18, 0xfd, 0x9a, 0xfe, 0x1f, 0xfe, 0x1f, 0xfd, 0x7f, 0xfe, 0xbf, 0xfe, 0xbf, 0xfe, 0x1f, 0xfe, 0x9f, 0xfe, 0xdf, 0xf1, 0xee, 0x48, 0x23, 0x48, 0x68, 0x00, 0x00, 0xf0, 0x8a, 0xfc, 0x39, 0xfd, 0x3e, 0xfb, 0x56, 0xf9, 0xa7, 0xf9, 0x69, 0xf8, 0xc6, 0xf9, 0x29, 0xf8, 0x10, 0xf8, 0x10, 0xf8, 0x0b, 0xf8, 0x10, 0x79, 0x3c, 0x1a, 0xdf, 0x82, 0xff, 0xd3, 0x1f, 0x4a, 0xff, 0x32, 0xff, 0x52, 0xff, 0x5a, 0xff, 0x6a, 0x7f, 0x72, 0x5f, 0xda, 0xdf, 0xfa, 0xdf, 0xbb, 0x3f, 0xcb, 0x1f, 0x3a, 0x7f, 0x5a, 0x9f, 0xaa, 0xdf, 0xdb, 0x1f, 0xfa, 0xff, 0xfa, 0x1f, 0xf9, 0xdf, 0xfa, 0x9f, 0xfd, 0xdf, 0xff, 0xbf, 0xff, 0x5f, 0xff, 0x9f, 0xff, 0x7f, 0xfe, 0xff, 0xff, 0x1f, 0xff, 0x1f, 0xfe, 0x5c, 0xfe, 0x3a, 0xfe, 0x97, 0xfc, 0x12, 0xfc, 0x71, 0xfa, 0xcb, 0xfa, 0x6a, 0xb0, 0x46, 0xfa, 0x29, 0xfa, 0xaa, 0xf9, 0x6b, 0xfb, 0xd8,
-    0xfb, 0xba, 0xfd, 0x1e, 0xfb, 0xdb, 0xc0, 0x8b, 0xfd, 0x5b, 0xf9, 0x8e, 0xfc, 0x37, 0xfc, 0x99, 0xfc, 0xf9, 0xfd, 0xbc, 0xfd, 0x3a, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xbf, 0xfd, 0x7f, 0xfe, 0xdf, 0xfe, 0x9f, 0xfd, 0x39, 0xe3, 0x95, 0xda, 0x0f, 0xf2, 0x92, 0xfb, 0x54, 0xf8, 0xf0, 0xc9, 0x10, 0xee, 0x5c, 0xfd, 0xfb, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfb, 0xb5, 0xfc, 0x77, 0xa8, 0xa8, 0xc0, 0x27, 0xfa, 0x94, 0xfd, 0x5e, 0xfd, 0x5e, 0xfc, 0x5b, 0xf9, 0xe8, 0xfa, 0x4a, 0xf9, 0x28, 0xf9, 0x47, 0xf8, 0x0a, 0xf8, 0x0b, 0xf8, 0x0e, 0xf8, 0x0b, 0xf9, 0x69, 0xf9, 0xeb, 0xfa, 0x93, 0xda, 0x3b, 0x1a, 0x7f, 0x2a, 0x3f, 0x42, 0x3f, 0x72, 0x5f, 0x7a, 0x7f, 0x8b, 0x3f, 0xe3, 0x7f, 0x6a, 0xff, 0xba, 0xff, 0xd3, 0x1f, 0x7a, 0xbf, 0x62, 0x9f, 0xca, 0xff, 0xf2, 0x1f, 0xfa, 0x5f, 0xfa, 0x7f, 0xfb, 0x7f, 0xfc, 0x5f, 0xfd, 0x5f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x3f, 0xff, 0x5f, 0xff, 0x1f,
-    0xfe, 0x9f, 0xfe, 0xff, 0xfe, 0x9e, 0xfd, 0x79, 0xfe, 0x98, 0xfc, 0x71, 0xfa, 0x6d, 0xfa, 0x8b, 0xfa, 0x8a, 0xf9, 0x47, 0xf9, 0x07, 0xfa, 0x8a, 0xfa, 0x6a, 0xf9, 0x6d, 0xf9, 0x0e, 0xf9, 0xb3, 0xc8, 0xec, 0xfc, 0x37, 0xfa, 0x30, 0xc0, 0xe8, 0xfb, 0xb2, 0xfc, 0xda, 0xfd, 0xfc, 0xfc, 0xf9, 0xfe, 0xbf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfd, 0xbc, 0xfc, 0x57, 0xed, 0x58, 0xe5, 0xfb, 0xe2, 0x74, 0xfd, 0xbd, 0xfe, 0xff, 0xfb, 0x97, 0xfa, 0xda, 0xfb, 0xbc, 0xf4, 0x38, 0xff, 0x7f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfd, 0xdc, 0xfb, 0xd5, 0xfd, 0xbc, 0xfd, 0x7c, 0xfd, 0xde, 0xfd, 0xbe, 0xfb, 0xb8, 0xfa, 0x31, 0xf9, 0xca, 0xfb, 0x4d, 0xf9, 0xa8, 0xf9, 0xa6, 0xf8, 0xc9, 0xf8, 0x0a, 0xf8, 0x10, 0xf8, 0xa9, 0xf9, 0x48, 0xf9, 0xe8, 0xfa, 0xaa, 0xfa, 0x6a, 0xf9, 0x09, 0xe2, 0x7e, 0x4a, 0xdf, 0x4a, 0xff, 0x42, 0xff, 0xc3, 0x9f, 0xc3, 0x7f, 0xbb, 0x1f, 0xfb, 0x1f, 0xfb, 0x3f,
-    0xd3, 0x1f, 0x8a, 0xff, 0xd3, 0x1f, 0xfb, 0x1f, 0xfb, 0x9f, 0xfc, 0xbf, 0xfc, 0xdf, 0xfc, 0xff, 0xfd, 0x3f, 0xfe, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x5f, 0xff, 0x3f, 0xfe, 0x7f, 0xfe, 0xdf, 0xfe, 0x7e, 0xfc, 0xf9, 0xfe, 0x18, 0xfd, 0x35, 0xfa, 0x0d, 0xfa, 0x09, 0xfa, 0x8a, 0xfa, 0x8a, 0xf8, 0xe8, 0xfa, 0x0a, 0xfa, 0xaa, 0xfa, 0x6b, 0xfa, 0x4f, 0xfb, 0x52, 0xfd, 0x5c, 0xfa, 0x30, 0xf9, 0x4c, 0xf8, 0x08, 0xf9, 0x0b, 0xfb, 0xf9, 0xfd, 0x5d, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfd, 0x9a, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xdf, 0xfa, 0x36, 0xfe, 0xff, 0xfe, 0x3e, 0x78, 0x05, 0xf4, 0x39, 0xfb, 0xd9, 0xc2, 0xf1, 0xff, 0x5f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfb, 0x54, 0xfe, 0x1d, 0xfe, 0x7f, 0xfe, 0x1e, 0xfb, 0xb6, 0xf9, 0x0d, 0xfb, 0x55, 0xfb, 0x2d, 0xfb, 0xae, 0xf9, 0xc7, 0xf9, 0xa7, 0xf9, 0x86, 0xf8, 0x0e, 0xf8, 0x0b, 0xfa, 0x09,
-    0xf9, 0x89, 0xfa, 0x8b, 0xfb, 0x2b, 0xfa, 0xcb, 0xf9, 0x47, 0xfa, 0x0a, 0x61, 0x77, 0x7b, 0x1f, 0xa3, 0x5f, 0xfc, 0x1f, 0xfc, 0x1f, 0xf3, 0x3f, 0xfb, 0x3f, 0xfb, 0x3f, 0xd3, 0x1f, 0xbb, 0x1f, 0xcb, 0x1f, 0xfb, 0xdf, 0xfc, 0x1f, 0xfb, 0xbf, 0xfc, 0x5f, 0xfc, 0xdf, 0xfe, 0x3f, 0xff, 0x1f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x3f, 0xff, 0x1f, 0xfe, 0xff, 0xfc, 0xde, 0xfe, 0xbc, 0xfd, 0x9b, 0xfb, 0x74, 0xfc, 0x74, 0xfa, 0x8e, 0xe8, 0x87, 0xfa, 0x8b, 0xfa, 0x8a, 0xf9, 0xe9, 0xf8, 0xa9, 0xfa, 0x8b, 0xfb, 0xee, 0xfc, 0xb0, 0xfc, 0x30, 0xfb, 0x8f, 0xf9, 0x8c, 0xfa, 0xac, 0xfa, 0x2d, 0xf8, 0xca, 0xfc, 0x77, 0xfe, 0x7f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xe0, 0xef, 0xfc, 0x1c, 0xfb, 0xfc, 0x48, 0x03, 0xc1, 0x31, 0x60, 0x25, 0x62, 0xab, 0xff, 0x5f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf,
-    0xfe, 0xbf, 0xfd, 0x7c, 0xfa, 0x51, 0xf8, 0x6c, 0xfc, 0x5a, 0xfa, 0xb3, 0xfb, 0xcf, 0xfb, 0xce, 0xf9, 0x88, 0xf9, 0x88, 0xf9, 0xa7, 0xf9, 0x71, 0xf9, 0x6f, 0xfb, 0xb1, 0xf9, 0xca, 0xfb, 0x6c, 0xfb, 0x2c, 0xfb, 0x0b, 0xf9, 0xc9, 0xfa, 0x6a, 0xe9, 0x0a, 0xcb, 0x7f, 0xe3, 0x9f, 0xfc, 0x9f, 0xfc, 0xdf, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x3f, 0xf3, 0xff, 0xfc, 0x5f, 0xfc, 0x7f, 0xfb, 0xff, 0xfb, 0x3f, 0xfb, 0xbf, 0xfc, 0x5f, 0xfc, 0xbf, 0xfe, 0x1f, 0xfe, 0xdf, 0xff, 0x5f, 0xff, 0x9f, 0xff, 0x1f, 0xfe, 0x3f, 0xfe, 0xff, 0xfc, 0x7b, 0xfe, 0x5c, 0xfd, 0xfb, 0xfa, 0x94, 0xfb, 0xd3, 0xfa, 0xce, 0xf8, 0xe7, 0xf8, 0xc9, 0xfa, 0x8a, 0xfa, 0x8a, 0xfa, 0x4a, 0xfa, 0xeb, 0xfc, 0x2f, 0xfc, 0xd1, 0xfd, 0x74, 0xfe, 0x76, 0xfb, 0xb0, 0xf9, 0x4a, 0xf9, 0x8d, 0xfa, 0x2d, 0xfc, 0xf9, 0xfe, 0x5f, 0xfe, 0x9f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfc, 0x17, 0xfc, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa9, 0xae, 0xfa, 0x19, 0xfa, 0x7a, 0xf0, 0x6c,
-    0x00, 0x00, 0xb1, 0xaf, 0x99, 0xb1, 0xfc, 0xff, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xbf, 0xea, 0x6f, 0xfa, 0x6f, 0xfc, 0xbb, 0xfd, 0x7e, 0xfa, 0x91, 0xfc, 0x50, 0xfb, 0x8d, 0xfa, 0x2a, 0xfa, 0x2a, 0xf9, 0xcd, 0xfa, 0x76, 0xfb, 0x17, 0xfc, 0x58, 0xfa, 0x52, 0xfb, 0xf2, 0xfb, 0xae, 0xfb, 0x2b, 0xfa, 0x28, 0xfa, 0x69, 0xfa, 0x09, 0x6a, 0xbf, 0xaa, 0xff, 0xeb, 0x9f, 0xfd, 0x1f, 0xfc, 0x7f, 0xfb, 0x5f, 0xfb, 0x3f, 0xfc, 0xbf, 0xfd, 0x1f, 0xfc, 0xbf, 0xfb, 0xdf, 0xfb, 0x5f, 0xfb, 0xbf, 0xfc, 0x1f, 0xfc, 0xbf, 0xfd, 0x7f, 0xfe, 0x1f, 0xfe, 0x7f, 0xfe, 0xff, 0xff, 0x3f, 0xfd, 0x3f, 0xfe, 0xdf, 0xfe, 0xbf, 0xfb, 0xdb, 0xfd, 0x7a, 0xfb, 0xb4, 0xf9, 0xf0, 0xfa, 0xce, 0xfa, 0x4a, 0xd0, 0x67, 0xf9, 0x49, 0xfa, 0x8a, 0xfa, 0xcb, 0xfb, 0x4d, 0xfc, 0x2f, 0xfc, 0xd1, 0xfd, 0x53, 0xfd, 0x94, 0xfe, 0x15, 0xfa, 0x6e, 0xf9, 0xad, 0xfa, 0xaf, 0xfd, 0x1a, 0xfe, 0x3f, 0xfe, 0xbf, 0xfe, 0xdf, 0xfe, 0xdf,
-    0xfe, 0xdf, 0xfe, 0x7e, 0xfe, 0x7e, 0xfb, 0x77, 0x98, 0x28, 0xfb, 0xff, 0xfe, 0x5f, 0xff, 0x3f, 0xff, 0xbf, 0xff, 0xff, 0xdc, 0x17, 0xf0, 0xad, 0xf9, 0x76, 0xa8, 0x29, 0x69, 0xa9, 0xfe, 0x5d, 0xd1, 0xdb, 0xfc, 0x1c, 0xfc, 0xb8, 0xfe, 0x3d, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x7f, 0xfe, 0x3f, 0xfd, 0xbe, 0xfd, 0x5e, 0xfa, 0x0e, 0xfc, 0x70, 0xfa, 0x4c, 0xf9, 0xa9, 0xfa, 0xb0, 0xf9, 0x74, 0xfb, 0xbb, 0xfd, 0x3e, 0xfd, 0x9e, 0xfa, 0xf9, 0xfc, 0x98, 0xfb, 0xd1, 0xfb, 0x6d, 0xfa, 0x27, 0xfa, 0x69, 0xfa, 0x49, 0x71, 0xff, 0xc2, 0xff, 0xf2, 0xff, 0xfb, 0x5f, 0xfc, 0x1f, 0xfc, 0xff, 0xfb, 0xdf, 0xfb, 0x5f, 0xdb, 0xdf, 0xfc, 0x3f, 0xfb, 0xff, 0xfb, 0x5f, 0xfb, 0x7f, 0xfb, 0x9f, 0xfc, 0x5f, 0xfc, 0xbf, 0xfc, 0xff, 0xfd, 0x5f, 0xfd, 0x3f, 0xfc, 0x7f, 0xfe, 0x5f, 0xfd, 0x1d, 0xfe, 0xde, 0xfc, 0x3a, 0xfc, 0x57, 0xfc, 0x75, 0xf9, 0xed, 0xfa, 0x8c, 0xfa, 0xcb, 0xf9, 0xc9, 0xc8, 0x29, 0xf9, 0x89, 0xfb, 0x6d,
-    0xfb, 0xee, 0xfc, 0x30, 0xfc, 0x71, 0xfd, 0x53, 0xfd, 0xb4, 0xfe, 0x77, 0xfd, 0x32, 0xf9, 0x0c, 0xf8, 0xab, 0xfc, 0xd9, 0xfd, 0xff, 0xfe, 0x7f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x1c, 0xfb, 0x53, 0x78, 0x05, 0x28, 0x02, 0xa9, 0xb8, 0xfa, 0x7f, 0xfb, 0x1f, 0xfb, 0x3f, 0xfc, 0x1f, 0xfb, 0xff, 0x58, 0x48, 0x30, 0x02, 0x20, 0x01, 0xec, 0xb8, 0x9a, 0x0d, 0x58, 0x07, 0x98, 0x06, 0xf3, 0xb4, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xbf, 0xfe, 0x7f, 0xfe, 0x1f, 0xfd, 0xbe, 0xfd, 0x1d, 0xfa, 0xad, 0xfc, 0xb1, 0xfa, 0x8b, 0xfa, 0x2c, 0xfb, 0xb6, 0xfa, 0x37, 0xfd, 0x9e, 0xfe, 0x7f, 0xfd, 0x9f, 0xfd, 0x1f, 0xfc, 0xfc, 0xfc, 0x76, 0xfb, 0x6e, 0xfa, 0x8a, 0xfa, 0x49, 0xfa, 0xcb, 0xa1, 0x79, 0xbb, 0x3f, 0xeb, 0x1f, 0xfb, 0x1f, 0xfb, 0x1f, 0xfb, 0x5f, 0xfc, 0xbf, 0xfb, 0x3f, 0xdb, 0x5f, 0xd3, 0x3f, 0xfb, 0xdf, 0xfb, 0xdf, 0xfb, 0x1f, 0xfb, 0x9f, 0xfb, 0xbf, 0xfc, 0x5f, 0xfc, 0xbf, 0xfc, 0x5f, 0xfb, 0xbf,
-    0xfb, 0x5f, 0xfc, 0xff, 0xfc, 0x9a, 0xfe, 0x7e, 0xfe, 0x9c, 0xfa, 0xf4, 0xfd, 0x36, 0xfb, 0x51, 0xfa, 0x4c, 0xfb, 0xce, 0xfb, 0x4d, 0xfa, 0x4c, 0xe9, 0x2c, 0xf9, 0xab, 0xfc, 0x10, 0xfc, 0xd1, 0xfc, 0xd1, 0xfd, 0xb4, 0xfd, 0xf4, 0xfe, 0x16, 0xfe, 0x36, 0xfc, 0xb1, 0xfa, 0x4d, 0xfc, 0x52, 0xfd, 0x7c, 0xfe, 0x3f, 0xfe, 0xbf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xed, 0xb9, 0xe2, 0xf1, 0x48, 0x83, 0x00, 0x00, 0x00, 0x00, 0x30, 0x02, 0x48, 0x68, 0x90, 0xaf, 0x90, 0xaf, 0x88, 0x4c, 0x10, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xe9, 0xfe, 0xbf, 0xfe, 0xbf, 0xfe, 0x3f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xbe, 0xfb, 0xd1, 0xfc, 0x37, 0xfe, 0xdf, 0xfe, 0xbf, 0xfe, 0x7f, 0xfe, 0x3f, 0xfd, 0xbe, 0xfc, 0x79, 0xfb, 0x8e, 0xfc, 0xf2, 0xfa, 0x6b, 0xfa, 0xd0, 0xfc, 0x59, 0xfb, 0x9a, 0xfe, 0xbf, 0xff, 0x9f, 0xfe, 0x5f, 0xfe, 0x5f, 0xfd, 0x5d, 0xfc, 0xb7, 0xfb, 0xf0, 0xfa, 0x2a, 0xfb, 0x0c, 0xfb, 0x2d, 0xa9, 0x78, 0xa2, 0xff, 0xb2, 0xdf, 0xe0, 0xf1, 0xf9, 0x88,
-    0xfa, 0x9b, 0xfb, 0x3f, 0xfb, 0x3f, 0xdb, 0x3f, 0xd3, 0x3f, 0xfb, 0x7f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfb, 0x5f, 0xfb, 0x9f, 0xfb, 0x3f, 0xfa, 0x1f, 0xfa, 0xbf, 0xfb, 0xdf, 0xfb, 0x7f, 0xfa, 0xff, 0xfd, 0x3c, 0xfb, 0x99, 0xfe, 0x79, 0xfd, 0x15, 0xfb, 0xb2, 0xfd, 0x74, 0xfa, 0x4d, 0xfc, 0x50, 0xfc, 0x70, 0xfc, 0x2f, 0xfa, 0xce, 0xf9, 0xad, 0xf9, 0xeb, 0xfc, 0x91, 0xfd, 0xb4, 0xfe, 0x15, 0xfe, 0x15, 0xfe, 0x97, 0xfe, 0x76, 0xfd, 0xb4, 0xfb, 0x90, 0xf9, 0xac, 0xfc, 0x55, 0xfd, 0xde, 0xfe, 0x9f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x1d, 0xc9, 0xec, 0x80, 0xc7, 0x78, 0x45, 0x48, 0x63, 0x10, 0x00, 0x00, 0x00, 0x00, 0x20, 0x08, 0x00, 0x50, 0x23, 0x40, 0xc4, 0xa0, 0xe9, 0xd8, 0xaa, 0xfb, 0x57, 0xfe, 0xdf, 0xfe, 0x9f, 0xfd, 0xbe, 0xfd, 0xbd, 0xfe, 0x7e, 0xfe, 0xdf, 0xfb, 0x92, 0xfa, 0x8b, 0xfa, 0x0c, 0xfe, 0xbf, 0xfe, 0xbf, 0xfe, 0x3e, 0xfd, 0xdf, 0xfd, 0x5e, 0xfb, 0x54, 0xfd, 0x53, 0xfd, 0x73, 0xfa, 0x0b, 0xfa, 0x6e, 0xfb, 0x56, 0xfc, 0x3d, 0xfe, 0xbf,
-    0xff, 0x5f, 0xfe, 0x9f, 0xfe, 0x9f, 0xfd, 0x9e, 0xfc, 0xd7, 0xfb, 0xf1, 0xfa, 0x0a, 0xfb, 0x4c, 0xfa, 0xcb, 0x69, 0xff, 0x82, 0x9f, 0xf9, 0x2e, 0xfa, 0xab, 0xfa, 0xaa, 0xf8, 0xe8, 0xfa, 0x9c, 0xc3, 0x1f, 0xba, 0xff, 0xb2, 0xff, 0xeb, 0xbf, 0xfc, 0x1f, 0xfb, 0xff, 0xfb, 0x1f, 0xfb, 0x1f, 0xfb, 0x5e, 0xfc, 0xbf, 0xfc, 0xdf, 0xfb, 0xdf, 0xfb, 0xbf, 0xfb, 0xbf, 0xfa, 0x7e, 0xfc, 0x97, 0xfc, 0x75, 0xfe, 0x56, 0xfa, 0xf0, 0xfd, 0xb5, 0xfd, 0x33, 0xfa, 0xef, 0xfd, 0x93, 0xfd, 0x53, 0xfd, 0x53, 0xfc, 0x71, 0xfc, 0x53, 0xfc, 0x72, 0xfc, 0x33, 0xfe, 0x15, 0xfe, 0x76, 0xfe, 0x97, 0xfe, 0xb7, 0xfd, 0xb4, 0xfd, 0x52, 0xfb, 0x6e, 0xf9, 0x0b, 0xfc, 0x38, 0xfe, 0x3f, 0xfe, 0xff, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfd, 0x9b, 0xe4, 0x76, 0xfa, 0xb2, 0xd3, 0x32, 0xd2, 0xb1, 0xe2, 0x50, 0xe2, 0x51, 0xfa, 0x31, 0xca, 0x70, 0xfa, 0x31, 0xfc, 0x18, 0xfe, 0x9f, 0xfe, 0xbf, 0xfd, 0xbe, 0xfb, 0x98, 0xf9, 0x0c, 0xfd, 0x59, 0xfe, 0xdf, 0xe4, 0x75, 0xfa, 0x6b,
-    0xfa, 0x09, 0xfd, 0x5b, 0xfe, 0x9f, 0xfd, 0xff, 0xfd, 0xde, 0xfd, 0x5e, 0xfb, 0x51, 0xfd, 0x94, 0xfd, 0x12, 0xf1, 0xa9, 0xfb, 0x4f, 0xfa, 0x74, 0xfc, 0xfc, 0xfe, 0x5f, 0xfd, 0x5f, 0xfe, 0x3f, 0xfe, 0x1e, 0xfb, 0x59, 0xfd, 0x17, 0xfc, 0x2f, 0xfa, 0x2b, 0xfb, 0xee, 0xfa, 0x8b, 0x7a, 0x3f, 0xe8, 0xf1, 0xfb, 0x0c, 0xfb, 0x2b, 0xf9, 0xca, 0xf9, 0x68, 0xfa, 0x29, 0x82, 0xff, 0x72, 0xff, 0x6a, 0x7f, 0xca, 0x9f, 0xf9, 0xff, 0xea, 0x7f, 0xf2, 0xff, 0xf3, 0xff, 0xfd, 0xdf, 0xfe, 0x3f, 0xfc, 0xdf, 0xfb, 0xff, 0xfb, 0x9f, 0xfb, 0xdf, 0xfb, 0x7f, 0xfb, 0x17, 0xfb, 0x74, 0xfd, 0x76, 0xfd, 0xf6, 0xfd, 0xf4, 0xfe, 0x76, 0xfc, 0x11, 0xfd, 0x12, 0xfe, 0x36, 0xfe, 0x15, 0xfd, 0xd4, 0xfd, 0x94, 0xfc, 0x74, 0xfd, 0x95, 0xfc, 0x94, 0xfd, 0x36, 0xfe, 0xb8, 0xfe, 0xb8, 0xfe, 0x36, 0xfd, 0x94, 0xfc, 0xd1, 0xfb, 0xef, 0xf9, 0x4a, 0xfb, 0x12, 0xfe, 0x7f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf,
-    0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x3e, 0xfc, 0x38, 0xf9, 0xf0, 0xea, 0x0c, 0xfb, 0xd3, 0xfe, 0x3c, 0xfe, 0xff, 0xfd, 0x7b, 0xf9, 0x88, 0xfb, 0x0d, 0xf3, 0x93, 0xfe, 0x1f, 0xfd, 0xde, 0xfd, 0x7e, 0xfc, 0x3a, 0xfb, 0xcf, 0xfe, 0x15, 0xfb, 0xef, 0xfa, 0x6d, 0xfc, 0x70, 0xfb, 0x30, 0xfd, 0x98, 0xfd, 0xdd, 0xfc, 0x1c, 0xfd, 0x1c, 0xfc, 0xba, 0xfb, 0x13, 0xfc, 0x92, 0xfc, 0x30, 0xfa, 0x0a, 0xfb, 0xee, 0xfa, 0x6e, 0xd9, 0xb7, 0xfa, 0xab, 0xfb, 0x6d, 0xfa, 0x8c, 0xf9, 0x29, 0xfa, 0xcb, 0xf9, 0x48, 0x92, 0x9f, 0xb2, 0x9d, 0xba, 0x7f, 0xc3, 0x1f, 0xd3, 0x3f, 0xdb, 0x7f, 0xd3, 0x9f, 0xdb, 0x9f, 0xfc, 0xff, 0xfd, 0x1f, 0xd3, 0x5f, 0xd3, 0x5f, 0xdb, 0x3f, 0xfc, 0x7f, 0xfc, 0x1f, 0xf9, 0xb8, 0xfd, 0x16, 0xfa, 0xf3, 0xfe, 0x78, 0xfe, 0x97, 0xfe, 0x96, 0xfe, 0x76, 0xfd, 0x15, 0xfe, 0x76, 0xfe, 0x96, 0xfe, 0x77, 0xfe, 0x76, 0xfe, 0x76, 0xfd, 0x77, 0xfd, 0x37, 0xfe, 0x38, 0xfd, 0x16, 0xfe, 0x18, 0xfe, 0x96, 0xfd, 0xd4, 0xfc, 0xf1, 0xfc, 0x0e, 0xfb, 0x4d,
-    0xfb, 0xf3, 0xfe, 0x1e, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xff, 0xfe, 0x9e, 0xfd, 0xdc, 0xfe, 0xdf, 0xfe, 0xbf, 0xfc, 0x17, 0xf1, 0xee, 0xf9, 0x4c, 0xfb, 0x94, 0xfe, 0x7f, 0xfe, 0xdf, 0xfa, 0x8e, 0xfe, 0x7d, 0xfe, 0x5e, 0xf9, 0x69, 0xfc, 0x0f, 0xfa, 0xb1, 0xfd, 0xdf, 0xfd, 0xbf, 0xfd, 0x9e, 0xfa, 0xb1, 0xfd, 0x95, 0xfe, 0x35, 0xfa, 0x0d, 0xfb, 0x0d, 0xfc, 0xd1, 0xfb, 0x0d, 0xfd, 0x94, 0xfb, 0xb3, 0xfb, 0xd4, 0xfb, 0x54, 0xfb, 0x72, 0xfb, 0xf1, 0xfc, 0xb1, 0xfa, 0xcc, 0xfb, 0xcf, 0xfb, 0xef, 0xc1, 0x0e, 0xfa, 0x2d, 0xfb, 0xae, 0xfb, 0xae, 0xf9, 0x8a, 0xfa, 0xac, 0xfa, 0xeb, 0xf9, 0x47, 0xfc, 0x9f, 0xe3, 0x7f, 0xdb, 0x1f, 0xf3, 0x1f, 0xfb, 0x1f, 0xfb, 0x7f, 0xfb, 0x7f, 0xfb, 0x7f, 0xfd, 0x1f, 0xf4, 0x1f, 0xdb, 0x9f, 0xdb, 0xdf, 0xfc, 0xbf, 0xfc, 0x7f, 0xfb, 0x9f, 0x91, 0x5c, 0xbb, 0x5f, 0xfd, 0xfa, 0xfd, 0x36, 0xff, 0x1a, 0xfe, 0xf9, 0xfe, 0x78, 0xfe, 0x77, 0xfd, 0x17,
-    0xfe, 0x78, 0xfe, 0x78, 0xfe, 0x99, 0xfe, 0x9a, 0xfe, 0xb9, 0xfe, 0x79, 0xfd, 0x38, 0xfe, 0x59, 0xfe, 0x18, 0xfd, 0x17, 0xfd, 0x34, 0xfd, 0x53, 0xfc, 0x2f, 0xfb, 0x6c, 0xfc, 0xd8, 0xfe, 0x1f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x7e, 0xfd, 0xd9, 0xfc, 0x52, 0xfb, 0x0c, 0xf8, 0xe9, 0xfa, 0xd1, 0xd1, 0x6b, 0xda, 0x0e, 0xfc, 0x97, 0xfe, 0x7f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfd, 0xfa, 0xfa, 0x2b, 0xfc, 0x97, 0xfe, 0xbf, 0xfa, 0x8c, 0xfc, 0x2f, 0xfa, 0xcf, 0xfd, 0xde, 0xfd, 0x9e, 0xfc, 0x39, 0xfb, 0x4f, 0xfe, 0x36, 0xfd, 0xd5, 0xd8, 0xc9, 0xfd, 0x53, 0xfb, 0x2e, 0xfc, 0xb1, 0xfd, 0xb5, 0xfa, 0xcf, 0xfd, 0x32, 0xfb, 0x4f, 0xfa, 0xac, 0xfc, 0xd2, 0xfc, 0xd1, 0xfa, 0x2c, 0xfc, 0xb1, 0xfa, 0x4e, 0xc9, 0x31, 0xfc, 0x2f, 0xfc, 0x0f, 0xfa, 0x2c, 0xfa, 0xac, 0xfb, 0xae, 0xfa, 0xeb, 0xd0, 0x88, 0xfd, 0x5f, 0xfb, 0x7f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x5f, 0xfb, 0xdf, 0xfd, 0x5f, 0xfb, 0x9f,
-    0xfb, 0xbf, 0xfd, 0x3f, 0xfc, 0x7f, 0xcb, 0x9f, 0x4a, 0x5f, 0x3a, 0xdf, 0x3a, 0xbf, 0xfc, 0x9c, 0xfd, 0xf9, 0xfe, 0x3b, 0xfe, 0xdb, 0xfe, 0xb9, 0xfe, 0xba, 0xfe, 0x7b, 0xfe, 0x1d, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xde, 0xfe, 0xdc, 0xfe, 0xda, 0xfe, 0xdb, 0xfd, 0xf8, 0xfd, 0x77, 0xff, 0x1b, 0xfd, 0xb6, 0xfb, 0xd1, 0xfc, 0x10, 0xfb, 0x8d, 0xfc, 0x77, 0xfe, 0x1f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xbe, 0xfe, 0xbe, 0xfd, 0xfb, 0xfd, 0x77, 0xfc, 0x53, 0xfb, 0x4f, 0xf9, 0xab, 0xf9, 0x46, 0xb0, 0xe5, 0xc0, 0x66, 0xd9, 0x69, 0xf8, 0xe9, 0xfc, 0xd9, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0x9e, 0xfc, 0x30, 0xfb, 0xef, 0xfb, 0x11, 0xfe, 0x9f, 0xfa, 0x8f, 0xfc, 0x90, 0xfa, 0x4d, 0xfd, 0xdf, 0xfd, 0x7e, 0xfa, 0xf3, 0xfe, 0x15, 0xfe, 0x76, 0xf2, 0xcd, 0xfb, 0x8f, 0xfd, 0x73, 0xfa, 0xee, 0xfe, 0x76, 0xfa, 0xcf, 0xfd, 0x54, 0xfc, 0x30, 0xfb, 0x2f, 0xfb, 0x2d, 0xfd, 0x53, 0xfb, 0x6f, 0xfb, 0x8e, 0xfc, 0x30, 0x69, 0x73, 0xfb, 0x4f, 0xfc, 0x70, 0xfa, 0xed, 0xfa, 0x6e,
-    0xfc, 0x2f, 0xfb, 0x8e, 0xf9, 0x4a, 0xf9, 0x49, 0xfd, 0x5f, 0xfc, 0x7f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x7f, 0xfd, 0x1f, 0xfd, 0x5f, 0xfb, 0xdf, 0xfc, 0xdf, 0xfc, 0x9f, 0xc3, 0x7f, 0x32, 0x5f, 0x52, 0x9f, 0x4a, 0xff, 0x4a, 0xdf, 0x9a, 0xdf, 0xfe, 0x5a, 0xfd, 0xba, 0xfe, 0xfb, 0xff, 0x1b, 0xff, 0x1d, 0xfe, 0xfe, 0xfe, 0x9f, 0xfe, 0xdf, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x3d, 0xfe, 0xfb, 0xfe, 0xfb, 0xfe, 0xbb, 0xfd, 0x38, 0xfd, 0x76, 0xfe, 0x55, 0xfa, 0xee, 0xf9, 0xaa, 0xfc, 0x14, 0xfe, 0x1f, 0xfe, 0x9f, 0xfe, 0xdf, 0xfe, 0xdf, 0xe3, 0xd0, 0xfa, 0x2a, 0xfa, 0x29, 0xfa, 0x27, 0xf9, 0xc7, 0xc1, 0xe7, 0xf9, 0xea, 0xfb, 0x0b, 0xfa, 0x0c, 0xfb, 0xef, 0xfc, 0x0f, 0xfb, 0xef, 0xfa, 0x0f, 0xfe, 0xbf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfc, 0x97, 0xfb, 0x6d, 0xfc, 0x70, 0xfb, 0x2f, 0xfe, 0x7f, 0xfc, 0x74, 0xfc, 0xf2, 0xfa, 0x8d, 0xfd, 0xde, 0xfc, 0x5a, 0xfb, 0x50, 0xfe, 0x96, 0xfc, 0xd3, 0xc1, 0x68, 0xfe, 0x35, 0xfb, 0xaf, 0xfc, 0xd2, 0xfc, 0x52,
-    0xfc, 0x51, 0xfe, 0x15, 0xfb, 0x50, 0xfb, 0xaf, 0xfc, 0xb2, 0xfd, 0x54, 0xfa, 0x8d, 0xfd, 0x32, 0xe2, 0x0f, 0xfa, 0x90, 0xfc, 0xb1, 0xfc, 0x50, 0xf9, 0x4b, 0xfc, 0x0f, 0xfc, 0x2f, 0xfa, 0xac, 0xe8, 0x49, 0xfa, 0x8c, 0xfc, 0x5f, 0xfd, 0x5f, 0xfb, 0xff, 0xfb, 0xbf, 0xfc, 0x1f, 0xfc, 0xff, 0xfd, 0x3f, 0xfd, 0x5f, 0xfd, 0x5f, 0xfd, 0x1f, 0xfc, 0xdf, 0xd3, 0xff, 0x2a, 0x1f, 0x6a, 0x7f, 0x6a, 0xff, 0x62, 0xff, 0x62, 0xff, 0x4a, 0xdf, 0xfb, 0xbf, 0xff, 0x3d, 0xfd, 0xbb, 0xff, 0x5e, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x1f, 0xff, 0x3f, 0xff, 0x5f, 0xff, 0x7f, 0xff, 0x9f, 0xff, 0x5d, 0xff, 0x3d, 0xff, 0x1c, 0xff, 0x3c, 0xfe, 0xbb, 0xfc, 0x93, 0xfb, 0x4e, 0xfa, 0x8d, 0xfa, 0x2d, 0xfd, 0xbe, 0xfe, 0x5f, 0xfe, 0x9f, 0xfe, 0x9f, 0xfb, 0x74, 0xfd, 0x17, 0xfc, 0xb7, 0xfc, 0xb5, 0xfc, 0x52, 0xfc, 0x2f, 0xfc, 0x50, 0xfc, 0x50, 0xfb, 0x0d, 0xfb, 0x0e, 0xfc, 0x90, 0xfc, 0xb1, 0xfb, 0x6e, 0xfc, 0x56, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfb, 0x92, 0xfd, 0x11, 0xfc, 0xf1, 0xfa, 0x0d,
-    0xfe, 0x3f, 0xfc, 0x54, 0xfd, 0x73, 0xfa, 0xce, 0xfd, 0x9e, 0xfa, 0x92, 0xfe, 0x16, 0xfd, 0xf5, 0xd9, 0x69, 0xfd, 0x74, 0xfd, 0xd5, 0xfa, 0xef, 0xfd, 0x54, 0xfa, 0xcf, 0xfe, 0x76, 0xfc, 0xf3, 0xfb, 0x0e, 0xfa, 0xee, 0xfd, 0xf4, 0xfb, 0x2f, 0xfc, 0xb3, 0xfb, 0x4e, 0xd1, 0xad, 0xfc, 0xd2, 0xfc, 0xf2, 0xfa, 0x0d, 0xfc, 0x2f, 0xfc, 0x70, 0xfc, 0x50, 0xf8, 0xab, 0xf9, 0xab, 0xfa, 0xec, 0xfb, 0xdf, 0xfd, 0x5f, 0xfd, 0x5f, 0xfd, 0x5f, 0xfd, 0x5f, 0xfd, 0x1f, 0xfd, 0x1f, 0xfd, 0x1f, 0xfd, 0x5f, 0xfc, 0xff, 0xfb, 0xff, 0x4a, 0x7f, 0x5a, 0x9f, 0x8a, 0xff, 0x92, 0xff, 0x7a, 0xff, 0x7a, 0xff, 0x7a, 0xff, 0x82, 0xff, 0xfd, 0x5f, 0xff, 0x7f, 0xff, 0x1f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x7f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9e, 0xff, 0x7e, 0xff, 0x5d, 0xff, 0x5d, 0xff, 0x9c, 0xfe, 0xd7, 0xfc, 0xd2, 0xf9, 0xea, 0xfa, 0x4d, 0xfd, 0x3c, 0xfd, 0xfe, 0xfe, 0x7f, 0xfe, 0x9f, 0xfb, 0x99, 0xfd, 0xde, 0xfd, 0xbe, 0xfd, 0x5c, 0xfd, 0x35, 0xfc, 0xf2, 0xfd, 0x12,
-    0xfd, 0x32, 0xfd, 0x33, 0xfb, 0x8f, 0xfd, 0x53, 0xfd, 0x12, 0xfd, 0x53, 0xfa, 0xf0, 0xfe, 0x9f, 0xfe, 0xbf, 0xfe, 0xbf, 0xfa, 0xd0, 0xfd, 0x93, 0xfd, 0x73, 0xfb, 0x8e, 0xfd, 0xfe, 0xfc, 0x74, 0xfd, 0x73, 0xfb, 0xb2, 0xfc, 0x9b, 0xfb, 0x90, 0xfe, 0x36, 0xd9, 0xca, 0xfb, 0xef, 0xfe, 0x76, 0xfb, 0x0f, 0xfd, 0x14, 0xfa, 0x6e, 0xfe, 0x16, 0xfe, 0x76, 0xfa, 0xae, 0xfb, 0x2f, 0xfd, 0xb5, 0xfc, 0xd3, 0xfb, 0x0e, 0xfd, 0x74, 0xb1, 0x27, 0xfc, 0xb2, 0xfd, 0x12, 0xfa, 0x2d, 0xfb, 0x4f, 0xfc, 0xf2, 0xfc, 0xb1, 0xfb, 0xcf, 0xfa, 0x0d, 0xfc, 0x30, 0xfa, 0x30, 0xfc, 0x9f, 0xfd, 0x5f, 0xfd, 0x5f, 0xfc, 0xdf, 0xfb, 0x9f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x7f, 0xfc, 0x7f, 0xf2, 0xff, 0xd1, 0xd8, 0x9a, 0xff, 0xb2, 0xff, 0xb3, 0x1f, 0xba, 0xff, 0xb3, 0x1f, 0xc2, 0xff, 0xbb, 0x1f, 0x82, 0xff, 0xb3, 0x7f, 0xff, 0x3f, 0xff, 0xbf, 0xff, 0x7f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x5f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x7e, 0xff, 0x9d, 0xff, 0x5b,
-    0xfe, 0x36, 0xfd, 0x53, 0xfb, 0xad, 0xfc, 0x37, 0xfd, 0xde, 0xfe, 0x9f, 0xff, 0x1f, 0xfd, 0xff, 0xfe, 0x9f, 0xff, 0x1f, 0xfe, 0x3f, 0xfe, 0x1c, 0xfd, 0xf5, 0xfd, 0xf4, 0xfd, 0xb3, 0xfd, 0xb4, 0xfd, 0x93, 0xfc, 0x30, 0xfd, 0xd5, 0xfd, 0xf4, 0xfd, 0x54, 0xfc, 0x97, 0xfe, 0xbf, 0xfe, 0x7f, 0xf3, 0xf0, 0xfd, 0xf5, 0xfe, 0x15, 0xfc, 0x50, 0xfc, 0xfb, 0xfa, 0xb0, 0xfe, 0x15, 0xfa, 0xd2, 0xfa, 0xb2, 0xfe, 0x36, 0xfb, 0x6e, 0xfb, 0x0e, 0xfe, 0x76, 0xfc, 0x93, 0xfb, 0xf1, 0xfa, 0xf0, 0xfd, 0xd5, 0xfe, 0x97, 0xfb, 0xf1, 0xfb, 0x50, 0xfb, 0xd1, 0xfe, 0x15, 0xfa, 0xcf, 0xfe, 0x15, 0xf9, 0xcb, 0xfc, 0x31, 0xfd, 0x73, 0xfa, 0x0c, 0xfa, 0xcd, 0xfd, 0x53, 0xfd, 0x12, 0xfc, 0x71, 0xf9, 0xcd, 0xfc, 0x50, 0xfb, 0x2e, 0xfb, 0x3f, 0xfd, 0x3f, 0xfd, 0x5f, 0xfc, 0x5f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x3f, 0xd2, 0xff, 0x72, 0x3f, 0xc2, 0x5f, 0xfc, 0x9f, 0xdb, 0x9f, 0xcb, 0x1f, 0xd3, 0x1f, 0xcb, 0x1f, 0xd3, 0x1f, 0xe3, 0x3f, 0xd3, 0x1f, 0xb3, 0x3f, 0xfb, 0xff, 0xfc, 0x1f, 0xff, 0x7f,
-    0xff, 0x5f, 0xff, 0x5f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0x7f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x9e, 0xff, 0xfe, 0xff, 0xbe, 0xfe, 0xb8, 0xfd, 0x93, 0xfc, 0x70, 0xfb, 0xcf, 0xfd, 0x3c, 0xfe, 0x7f, 0xff, 0x7f, 0xff, 0x5f, 0xfe, 0xdf, 0xff, 0x5f, 0xfe, 0xff, 0xfe, 0x5e, 0xfe, 0x96, 0xfe, 0x76, 0xfe, 0x35, 0xfe, 0x35, 0xfe, 0x35, 0xfb, 0x6f, 0xfd, 0xb5, 0xfe, 0x76, 0xfe, 0x76, 0xfb, 0x72, 0xfe, 0x9f, 0xfd, 0xbc, 0xfb, 0xf0, 0xfe, 0x76, 0xfe, 0x76, 0xfd, 0x93, 0xfc, 0xb9, 0xfb, 0xb1, 0xfd, 0x54, 0xfa, 0xb3, 0xfb, 0xd0, 0xfc, 0x92, 0xfa, 0x0c, 0xfe, 0x77, 0xfd, 0xb5, 0xfa, 0xf2, 0xfb, 0xb5, 0xfc, 0xb5, 0xfe, 0xd7, 0xfd, 0x75, 0xfb, 0x10, 0xfa, 0xcf, 0xfe, 0x97, 0xfa, 0x6f, 0xfd, 0xb5, 0xfb, 0xd0, 0xfb, 0x0e, 0xfe, 0x15, 0xfa, 0x6f, 0xfb, 0x4f, 0xfd, 0x73, 0xfd, 0x73, 0xfd, 0x73, 0xfb, 0x4f, 0xfc, 0xb2, 0xfc, 0x2f, 0xf9, 0x55, 0xf3, 0xbf, 0xfd, 0x5f, 0xfd, 0x5f, 0xfb, 0xdf, 0xfb, 0x3f, 0xfb, 0x3f, 0xea, 0xff, 0xa9, 0xdd, 0x6a, 0x3f,
-    0xc2, 0xff, 0xc3, 0x1f, 0xf3, 0xbf, 0xfc, 0x7f, 0xeb, 0x5f, 0xfb, 0x1f, 0xf3, 0x3f, 0xfb, 0x1f, 0xfb, 0x3f, 0xf3, 0x9f, 0xfc, 0x7f, 0xfc, 0x5f, 0xfa, 0x5f, 0xfd, 0x1f, 0xff, 0x5f, 0xff, 0x1f, 0xff, 0x5f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0x9f, 0xff, 0x5f, 0xff, 0x5f, 0xfe, 0xbf, 0xfe, 0x7d, 0xff, 0x5d, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xfe, 0x15, 0xfd, 0x12, 0xfc, 0x0f, 0xfc, 0x55, 0xfe, 0x5f, 0xff, 0x7f, 0xff, 0xbf, 0xfe, 0xbf, 0xff, 0x5f, 0xfe, 0xff, 0xfe, 0x5e, 0xfe, 0x77, 0xfe, 0x96, 0xfe, 0x96, 0xfe, 0x96, 0xfe, 0x96, 0xfe, 0x16, 0xfc, 0x30, 0xfe, 0x76, 0xfe, 0x76, 0xfb, 0xf1, 0xfe, 0x1e, 0xfd, 0xbc, 0xfd, 0x53, 0xfe, 0x97, 0xfe, 0x97, 0xfd, 0xf4, 0xfc, 0x38, 0xfb, 0x70, 0xfc, 0x71, 0xfa, 0x70, 0xfe, 0x17, 0xe9, 0x4c, 0xfe, 0x77, 0xfe, 0x79, 0xfa, 0x90, 0xfc, 0x34, 0xfb, 0xf3, 0xfe, 0xd9, 0xfe, 0x99, 0xfa, 0xf3, 0xfb, 0x33, 0xfd, 0xf8, 0xfe, 0xf9, 0xfe, 0x78, 0xfc, 0xb5, 0xfa, 0x0d, 0xfe, 0x36, 0xfa, 0x73, 0xfb, 0x11, 0xfd, 0xd5, 0xfd, 0xf4, 0xfd, 0xb3,
-    0xfd, 0x73, 0xfd, 0x93, 0xfd, 0x53, 0xe9, 0xb2, 0xc2, 0xff, 0xc2, 0xff, 0xfc, 0xff, 0xfd, 0x5f, 0xfd, 0x5f, 0xfb, 0x9f, 0xc1, 0xdc, 0x89, 0xff, 0xc2, 0xff, 0xd3, 0x1f, 0xe3, 0x1f, 0xeb, 0x1f, 0xf3, 0x3f, 0xfd, 0x1f, 0xfd, 0x3f, 0xfd, 0x3f, 0xfd, 0x3f, 0xfd, 0x3f, 0xfd, 0x5f, 0xfd, 0x5f, 0xfc, 0xdf, 0xcb, 0x7f, 0xd2, 0x1f, 0xfb, 0x5f, 0xfd, 0x1f, 0xff, 0x3f, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x3f, 0xff, 0x1f, 0xfe, 0xbc, 0xfd, 0x79, 0xfe, 0x9c, 0xff, 0xde, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb7, 0xfd, 0x73, 0xfc, 0x70, 0xfb, 0x6d, 0xfd, 0xbc, 0xfe, 0xff, 0xff, 0xbf, 0xfd, 0xdf, 0xfe, 0xff, 0xfe, 0xdf, 0xfe, 0xbc, 0xfe, 0x77, 0xfe, 0x76, 0xfe, 0x96, 0xfe, 0x96, 0xfe, 0x96, 0xfe, 0x96, 0xfb, 0xb0, 0xfe, 0x98, 0xfe, 0x98, 0xfd, 0x74, 0xfc, 0x78, 0xfd, 0x7b, 0xfd, 0x93, 0xfe, 0xb8, 0xfe, 0xb8, 0xfe, 0x36, 0xfc, 0x19, 0xfd, 0x54, 0xfc, 0x54, 0xfc, 0xb5, 0xf3, 0x92, 0xfe, 0x5a, 0xfe, 0xfa, 0xfa, 0xd0, 0xfc, 0xd5, 0xfb, 0x93, 0xff, 0x1b, 0xff, 0x3b,
-    0xf5, 0x35, 0xfd, 0x18, 0xfd, 0x76, 0xff, 0x1a, 0xfe, 0xd9, 0xfd, 0x58, 0xfa, 0x14, 0xfd, 0x79, 0xfa, 0x15, 0xfc, 0xda, 0xfe, 0x9c, 0xfe, 0x38, 0xfe, 0x57, 0xfe, 0x36, 0xfe, 0x15, 0xfd, 0x94, 0xf9, 0xd3, 0xdb, 0x1f, 0xf3, 0x1f, 0xf3, 0x1f, 0xfb, 0x7f, 0xfc, 0x7f, 0xfc, 0xff, 0xfc, 0x5f, 0xdb, 0x5f, 0xe2, 0xff, 0xe3, 0x1f, 0xeb, 0x3f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0xff, 0xfd, 0x5f, 0xfd, 0x5f, 0xfd, 0x5f, 0xfd, 0x5f, 0xfd, 0x5f, 0xfd, 0x5f, 0xfd, 0x5f, 0xfc, 0x9f, 0x8b, 0x1f, 0x82, 0x1f, 0xc2, 0xff, 0xfb, 0xbf, 0xfd, 0x3f, 0xff, 0x1f, 0xfe, 0x9f, 0xfe, 0xff, 0xfe, 0x9f, 0xfe, 0xdf, 0xff, 0x1f, 0xfe, 0xfc, 0xfe, 0xda, 0xfe, 0xdb, 0xfd, 0xfa, 0xfd, 0x7a, 0xfe, 0x9b, 0xff, 0xdf, 0xff, 0x5c, 0xfe, 0x35, 0xfc, 0xd2, 0xfc, 0x30, 0xfb, 0xd1, 0xfe, 0x5f, 0xfe, 0x9f, 0xfd, 0x5e, 0xfd, 0x5d, 0xfe, 0xdd, 0xfe, 0xba, 0xfe, 0xd9, 0xfe, 0xd8, 0xfe, 0xb8, 0xfe, 0xb8, 0xfe, 0x98, 0xfe, 0x98, 0xfc, 0x97, 0xfe, 0x19, 0xfe, 0xda, 0xfe, 0xd9, 0xfc, 0x78, 0xfd, 0x3c, 0xfd, 0x96, 0xff, 0x1a,
-    0xff, 0x1a, 0xfe, 0x79, 0xfb, 0x37, 0xfe, 0xb9, 0xfa, 0xf5, 0xfd, 0x78, 0xfd, 0xf9, 0xff, 0x3b, 0xff, 0x3b, 0xfe, 0x3a, 0xfd, 0xf9, 0xff, 0x5c, 0xff, 0x3b, 0xfe, 0x5a, 0xfd, 0x78, 0xfd, 0xf9, 0xff, 0x3b, 0xff, 0x3b, 0xfd, 0x77, 0xfa, 0x35, 0xfb, 0x99, 0xfa, 0xb8, 0xfe, 0x3f, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xdf, 0xfe, 0xbd, 0xfe, 0x99, 0xfc, 0xf5, 0xf9, 0x75, 0xfa, 0xff, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x7f, 0xe3, 0x1f, 0xfc, 0x1f, 0xfd, 0x1f, 0xfc, 0xdf, 0xfb, 0x5f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x9f, 0xfd, 0x3f, 0xfd, 0x5f, 0xfc, 0x7f, 0xfb, 0xbf, 0xfb, 0x9f, 0xfb, 0xff, 0xfc, 0x7f, 0xfd, 0x5f, 0xfc, 0x9f, 0x62, 0xff, 0x52, 0x1f, 0xab, 0x1f, 0xcb, 0x3f, 0xfb, 0xdf, 0xfd, 0x5f, 0xfe, 0xff, 0xfe, 0xbf, 0xfe, 0x5e, 0xfe, 0x5e, 0xfd, 0x5d, 0xfd, 0xd8, 0xfe, 0xb9, 0xfe, 0xb9, 0xff, 0x3b, 0xff, 0x1a, 0xfd, 0xb8, 0xfb, 0xd4, 0xdd, 0x37, 0xfd, 0xf5, 0xfd, 0x73, 0xfc, 0x50, 0xfb, 0xaf, 0xfd, 0x5b, 0xfe, 0x7f, 0xfe, 0x9f, 0xfc, 0x59, 0xfe, 0xda, 0xfe, 0xfb,
-    0xff, 0x1b, 0xff, 0x1b, 0xff, 0x1a, 0xfe, 0xd8, 0xfe, 0x99, 0xfe, 0xdb, 0xfe, 0xfd, 0xfd, 0x5e, 0xff, 0x1e, 0xff, 0x1c, 0xfc, 0x99, 0xfd, 0x1c, 0xfd, 0xd9, 0xff, 0x3b, 0xff, 0x5b, 0xfe, 0x9a, 0xfb, 0xb8, 0xfd, 0xb8, 0xfc, 0x97, 0xfc, 0xf8, 0xff, 0x3b, 0xff, 0x5c, 0xfe, 0x1a, 0xfe, 0x19, 0xff, 0x7c, 0xff, 0x7c, 0xfe, 0x19, 0xfe, 0x1a, 0xfd, 0x77, 0xff, 0x5c, 0xff, 0x7c, 0xfe, 0x7a, 0xfc, 0x36, 0xfb, 0x98, 0xfc, 0x3c, 0xfe, 0xff, 0xff, 0x1f, 0xff, 0x1f, 0xfe, 0xff, 0xfe, 0xff, 0xfe, 0xdf, 0xfc, 0xfe, 0xfb, 0xbf, 0xfb, 0x1f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x9f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0xff, 0xfd, 0x5f, 0xfc, 0xdf, 0xfb, 0x3f, 0xfb, 0x3f, 0xfc, 0x3f, 0xfd, 0x3f, 0xfc, 0xdf, 0xfb, 0x7f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x5f, 0xfc, 0x3f, 0x92, 0xbf, 0x3a, 0xbf, 0xab, 0x1f, 0xdb, 0x7f, 0xdb, 0x5f, 0xdb, 0x7f, 0xfb, 0xdf, 0xfe, 0x5d, 0xfe, 0x1d, 0xfd, 0x5a, 0xfe, 0xba, 0xfd, 0x97, 0xfc, 0x95, 0xfd, 0xb6, 0xfe, 0xd8,
-    0xfe, 0xb8, 0xfe, 0xd9, 0xfe, 0xfa, 0xfe, 0x9b, 0xfc, 0x11, 0xfb, 0x0d, 0xfb, 0x4e, 0xfc, 0x12, 0xfd, 0x9d, 0xfe, 0x3e, 0xfe, 0x7f, 0xfd, 0x1d, 0xfe, 0xdc, 0xff, 0x7d, 0xff, 0x9c, 0xff, 0x3b, 0xff, 0x3b, 0xff, 0x1b, 0xff, 0x1b, 0xff, 0x5f, 0xff, 0x5f, 0xfe, 0xdf, 0xff, 0x5f, 0xff, 0x5f, 0xfd, 0xdd, 0xfd, 0x3d, 0xfe, 0xfc, 0xff, 0x7d, 0xff, 0x7d, 0xfe, 0x9c, 0xfc, 0xb9, 0xfd, 0xbb, 0xfe, 0x1b, 0xff, 0x9d, 0xff, 0x9d, 0xfd, 0x9a, 0xfe, 0xfc, 0xff, 0xbd, 0xff, 0x9d, 0xfd, 0x9a, 0xfe, 0x3b, 0xfd, 0x79, 0xff, 0x9e, 0xff, 0x9d, 0xfe, 0x3c, 0xfb, 0x36, 0xfc, 0x18, 0xfe, 0xde, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x5f, 0xff, 0x9f, 0xff, 0x5f, 0xfe, 0x5f, 0xfc, 0xff, 0xfe, 0x3f, 0xfd, 0x5f, 0xfb, 0x7f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x5f, 0xfb, 0x9f, 0xfb, 0x5f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfc, 0x1f, 0xfd, 0x3f, 0xfc, 0x9f, 0xfc, 0x1f, 0xfd, 0x3f, 0xfc, 0xff, 0xfb, 0x5f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x3f, 0xfb, 0x3f, 0xe3, 0x3f, 0xca, 0x1d,
-    0x6a, 0xff, 0xa3, 0x1f, 0xf3, 0x7f, 0xfb, 0xbf, 0xe3, 0x9f, 0xcb, 0x3f, 0xfb, 0x5f, 0xfe, 0x58, 0xfe, 0x37, 0xfc, 0x94, 0xfe, 0x17, 0xfe, 0x97, 0xfe, 0x16, 0xfd, 0x56, 0xfd, 0x75, 0xfe, 0x98, 0xfe, 0xb8, 0xfe, 0xd8, 0xfe, 0xb7, 0xfe, 0x15, 0xfc, 0xb1, 0xfa, 0x8b, 0xfb, 0x4f, 0xfd, 0x5e, 0xfd, 0xfe, 0xfe, 0x9f, 0xfd, 0xdb, 0xff, 0xbe, 0xff, 0xde, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0x7e, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x1f, 0xff, 0xbf, 0xff, 0x9f, 0xfe, 0xbe, 0xfd, 0x3e, 0xff, 0x9e, 0xff, 0xbe, 0xff, 0xdf, 0xfd, 0xb9, 0xfe, 0x3a, 0xfe, 0x3b, 0xff, 0x9e, 0xff, 0x1c, 0xfd, 0xf9, 0xff, 0x9e, 0xff, 0xff, 0xff, 0x1c, 0xfd, 0xfa, 0xfe, 0xdb, 0xfe, 0x9c, 0xff, 0xdf, 0xff, 0xbe, 0xfc, 0xb9, 0xfc, 0x18, 0xfe, 0xfd, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0xbf, 0xff, 0xbf, 0xff, 0x3f, 0xfc, 0xbf, 0xfc, 0x9f, 0xfd, 0x9f, 0xfd, 0x5f, 0xfc, 0x3f, 0xfb, 0xbf, 0xfb, 0xbf, 0xfb, 0xff, 0xfc, 0xff};
-
-static const uint8_t maple_img[12288] = {
-    // ░░░░▒▒▒▒▒▒▒▒▒▒▒▒▒▒░░░░░░░░░░░░░░░░▒▒▒▒▒▒▒▒▒▒▒▒▒▒░∙∙∙∙∙∙∙░▒▒▒▒▒▒▒▒∙░▒▒▒▒▒▒▒▒▒▒░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ░░░▒▒▒▒▒▒▒▒▒▒▒▒▒▒░░░░░░░░░░░░░░░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒∙∙∙∙∙∙∙∙░▒▒▒▒▒▒░░▒▒▒▒▒▒▒▒▒▒▒▒▒░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ░░░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░░░░░░░░░░░░░░░░░░░░░░░░░░░░░▒▒░∙∙∙∙∙∙░▒▒▒▒▒░∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ░░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░░░░░░░░░░░░░░░░░░░∙∙∙∙∙∙∙∙░░▒░∙∙∙∙∙░▒▒▒▒∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░░░░░░░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙░░░∙∙∙∙∙▒▒▒∙░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░░░░░░░░░░░░░░░░░░∙∙∙░░∙∙░░∙∙∙∙∙∙∙∙░▒░░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░░░░░░░░░░░░░░░░░░░░░░░∙∙∙∙∙∙∙∙░∙▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ▒▒▒▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▒▒▒▒▒▒▒▒▒▒▒▒▒░░░░░░░░░░░░░░░░░░░░░∙░∙∙∙∙∙░∙░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ▒▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▒▒▒▒▒▒▒▒▒▒▒▒░░░░░░░░░░░░░░░░░∙∙∙∙∙∙∙∙∙░░░░░▒▒▒▒▒▓▒▒▒▒▒▒▒▒▒▒░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░░░░░░░░░░░░░∙∙∙░░░∙░░░░∙░░░░░░░▒▒▒▒▒▒▒▒▒▒░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▒▒▒▒▒▒▒▒▒▒▒▒▒▓▓▒▒▒▒▒▒▒▒░░░∙∙∙∙∙░░░░░∙∙░░░░▒░░░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒▒▒▒▒▒▒▒▒▒▒▒▓▓▓▒▒░░░∙░░░∙∙∙∙∙∙∙░░░░∙░░░░░░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒▒▒▒▒▒▒▒▓▓▒▒░░░░░░░░∙∙∙∙∙∙∙∙∙∙░░∙∙░░░▒░░▒░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒▒░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░▒░░▒▒░░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒▒░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░▒░░░▒░░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒▒░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░▒░░░▒▒▒▒░░░░░░▒░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒▒░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░░▒▒▒▒░░░░░░░▒░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒▒▒░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░▒▒▒▒▒░░░░░░░▒▒░∙∙∙∙∙∙∙∙∙∙∙∙∙∙░
-    // ▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒░░░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░░░▒▒▒▒░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙░░
-    // ▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒░░░░░░░░░░░░░░░░░░░░░░░░░▒░░░░░░░░░░░░▒░░░░░░▒▒▒▒▒░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙░░
-    // ▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒▒░░░░░░░░░░░░░░░░░░▒░░░░▒▒░∙░░░░░░░░░░░▒▒░░░░░░▒▒▒▒░░░░░░░░░░░░∙∙∙∙∙∙∙∙∙░░∙
-    // ▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▒░░░░░░░░░░░░░░░░░░░░░░░░▒▒░░░░░░░░░░░░░░▒▒▒░░░░░▒▒▒▒▒░░░░∙░∙░░░░░∙∙∙∙∙∙∙∙░░∙
-    // ▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▒▒░░░░░░░░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░▒░░░░░▒▒▒▒▒░░∙∙∙∙∙∙∙░░∙∙∙░∙∙∙∙░░∙
-    // ▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▒▒░░░░░░░░░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙▒░░░░░▒▒▒▒▒░∙∙∙∙∙∙∙∙∙░░∙░░░∙∙░░░∙
-    // ▒▒▒▒▒▒▓▓▓▓▓▓▓▓░░░░░▒░░░░░░░░░░░░░░░░∙∙░███░∙∙███∙∙█∙∙∙█∙░███░∙∙▒▒░░░░░▒▒▒▒▒░∙∙∙∙∙∙∙∙∙░∙░░∙∙∙░░∙∙
-    // ▒▒▒▒▒▒▒▓▓▓▓▓▒░░▒▒▒▓▓▒▒░▒▒░░░░░░░░░░░∙∙█░░░█∙█∙∙∙█∙∙█░█∙∙█∙∙∙█∙∙░░░░░░░▒▒▒░▒▒░∙∙∙∙∙∙∙∙░░░░∙∙∙░∙∙░
-    // ▒▒▒▒▒▒▒▓▓▓▓▒░░▒▓▓▓▓▓▓▓▓▓▒▒▒▒▒▒▒▒▒▒▒▓░░█░░∙█∙█∙∙∙█∙∙∙█∙∙∙█∙∙∙█∙∙▒░░░░░▒▒▒▒▒░▒░∙∙∙∙∙∙∙░░░░∙∙∙∙░∙░░
-    // ▒▒▒▒▒▒▒▓▓▒░░▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓░░█░∙∙█∙█∙█∙█∙∙∙█∙∙∙█∙█∙█∙∙▒░∙░░░▒▒▒▒▒▒▒░∙∙∙∙∙∙∙░░░░∙∙∙░░░░░
-    // ▒▒▒▒▒▒▒▓▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓░░░███∙∙█∙█∙█∙∙█∙█∙∙█∙█∙█∙∙▒░∙░░░░▒░░░░▒░∙∙∙∙∙∙∙░░░░∙∙░░░░░∙
-    // ▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓░░█∙∙∙█∙█∙∙∙█∙█∙∙∙█∙█∙∙∙█∙∙░▒∙∙░░░▒░░░░▒░∙∙∙░░∙∙░░░∙∙∙░░░░∙∙
-    // ▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓░░█∙∙∙█∙█∙∙∙█∙∙∙∙∙∙∙█∙∙∙█∙∙░░▒∙░░░░▒░▒▒▒░∙∙░░░∙░░░░░∙░░░∙░∙∙
-    // ▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓░∙∙███∙∙∙███░∙∙∙∙∙∙∙░███░∙∙░░▓░░░░░░░░▒░▒∙∙░░░░░░▒▒░░░∙∙∙░░∙
-    // ▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙▒░▒▒░░░░░░░░░░∙░░░░░░▒▒▒░░∙∙∙░░░∙
-    // ▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░▒▓▒░░░░░░░░▒░░░░░░▒▒▒▒░∙∙∙∙░░░∙
-    // ▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒░░░░∙∙░░░░▒░░▒░∙░░░░░░▒▒░░░░▒▓▓▒░░░░░░░░░░░░▒▒▒▒▒▒░∙∙∙∙░░░∙
-    // ▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒░░░░░∙░░░░▒▒▒░▒░∙░░░░░░▒░░░░░▓▓▓▓▒░░░░░░░░░░▒▒▒▒▒▒▒░░∙∙∙░░∙∙
-    // ▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓░░░░░░░░░░░▒▒░░▒∙░░░░░░▒▒░▒░░▒▓▓▓▓▓▒░░░░░░░▒▒▒▓▓▒▒▒▒▒░∙∙∙░∙∙∙
-    // ▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░▒▓▓▓▓▓▓▒░░░░░▒▒▓▓▓▒▒▒▒▒▒░∙∙∙∙∙∙∙
-    // ▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓░░░░∙∙∙∙∙∙∙∙∙∙∙∙░∙∙∙∙∙∙∙∙∙∙░▒░▒▓▓▓▓▓▒░░░░░░▒▓▓▓▒▒▒▒▒▒▒░∙∙∙∙∙∙∙
-    // ▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒░░░░░∙∙∙∙∙∙∙∙∙∙∙░∙∙∙∙∙∙∙∙░░▒▒░▒▓▓▓▓▒▒░▒▒▒░░░▒▓▓▒▒▒▒▒▒▒░∙∙∙∙∙∙∙
-    // ▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓░░░░░░░░∙∙∙∙∙∙∙∙░░∙∙∙∙∙∙∙░▒░▒░░▒▓▓▓▒▒░▒▒▓▓▒░░░▓▓▒▒▒▒▒▒░░∙∙∙∙∙∙∙
-    // ▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓░░░░░▒░░░∙∙∙∙∙∙░░░∙∙∙∙∙∙░▒▒░▒░░▓▓▓▒▒▒▒▓▓▓▓▓▒░░▒▓▒▒▒▒▒░∙∙∙∙∙∙∙∙∙
-    // ▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒░░░░░▒░░░░░∙∙∙░░░░∙∙∙∙░░░▒░░▒░▒▓▓▓▒▒▒▓▓▓▓▓▓▓▒░░▓▒▒▒░░∙∙∙∙∙∙∙∙∙∙
-    // ▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒░░░░░░░░░░░░░░░░░░∙∙∙░░░░▒▒░░░▒▓▓▒▒▒▓▓▓▓▓▓▓▓▓▒░▒▒▒░░∙∙∙∙∙∙∙∙∙∙∙
-    // ▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒░░░░░░░░░░▒▒▓░░░░░░∙░░░░░░▒░░▒▓▓▓▒▒▓▓▓▓▓▓▒▒▒▒▒░▒▒░░∙∙∙∙∙∙∙∙∙∙∙∙
-    // ▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒░░░░░░░░░░▒▓▓▓▓░░░░░░░░░░░░░░░▒▓▓▓▓▓▓▓▓▓▓▒▒▒▒▒▒▒░░░░░∙∙∙∙∙∙∙∙∙∙∙
-    // ▒▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒░░░░░░░▒▒▒▓▓▓▓▓▓▒░▒▓░░░░░░░░░░▓▓▓▓▓▓▓▓▓▓▓▒▒▒▒▒▒▒░░░░░░░░░∙∙∙∙∙∙∙
-    // ▒▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒░░░░░▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▒░░░░░░░░▒▓▓▓▓▓▓▓▓▓▓▓▒▒▒▒▒▒▒▒░▒▒▒▒▒▒▒░░░░░░░
-    // ▒▒▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓░░░░▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒░░░░░░░▒▒▓▓▓▓▓▒▒▒▒▒▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░░░▒░░
-    // ▒▒▒▒▒▒▒▒▒▒▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▒░░░▒▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓▓░░░░░░░▒▓▓▓▓▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░▒▒░░
-    // ▒▒░∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░░░░░∙∙∙∙░░░░░░░░░░░░░░░░░░░∙∙∙∙∙∙∙░░░░░░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░∙
-    // ▒▒∙∙∙∙∙∙∙∙∙░░░░░░░░░░░░██░░░░∙∙∙∙░░░░░░░░░░░░░░░░░░░░∙∙∙∙∙∙∙░░░░░░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░∙
-    // ▒▒∙∙∙∙∙∙∙∙∙∙░░░░░░░░░░█░░░░░∙∙∙∙░░░░░░░░░░░░░░░░░░░░░░∙∙∙∙∙∙░░░░░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙
-    // ▒▒∙∙█░∙∙∙░████░█░██░░░█░░░░█∙██░░█░░░█░░░░░░░████░░█░░∙█∙∙███░░█████░█░██░░████░∙████░∙░████∙∙∙∙
-    // ▒▒∙∙∙█░∙∙█∙∙∙∙░██░░█░░█░░░░██∙░█░█░░░█░░░░░░░░░░░█░█∙░∙█∙█∙░∙█∙∙∙░█░░██░∙█∙█∙∙∙█∙░░░░█∙█∙∙∙█∙∙∙∙
-    // ▒▒∙∙∙█░∙∙█∙∙∙∙░█∙∙∙█∙░█░░░░█░░░█░█░░░█∙∙∙∙∙∙░█████░█∙∙∙█∙█∙∙∙█∙∙∙█∙∙∙█░∙∙█∙█∙∙∙█∙█████∙█∙∙∙█∙∙∙∙
-    // ░▒∙∙∙█∙∙∙░███░∙█∙∙∙█∙∙█∙∙∙░█░∙∙█░█████∙∙∙∙∙∙░█░░░█∙█∙∙░█∙█∙∙∙█∙∙░█∙∙∙█░∙∙█∙████░∙█∙∙∙█∙█∙∙∙█∙∙∙∙
-    // ░░∙∙∙█∙∙∙∙∙∙∙█∙█∙∙∙█∙∙█∙∙∙░██░∙█∙█∙∙∙█∙∙∙∙∙∙∙█∙∙∙█∙█∙░██∙█∙∙∙█∙░█∙∙∙∙██∙∙█∙█∙∙∙∙∙█∙∙∙█∙█∙∙∙█∙∙∙∙
-    // ░░∙∙███∙∙████░∙█∙∙∙█∙∙███∙∙█∙██░∙█∙∙∙█∙∙∙∙∙∙∙░███░∙░██░█∙░███░∙█████∙█∙██░∙░███∙∙░███░∙█∙∙∙█∙∙∙∙
-    // ░░∙∙∙█∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█∙∙∙∙∙█∙∙∙█∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█∙∙∙█∙∙∙∙
-    // ░░∙∙∙█∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█∙∙∙∙█∙∙∙∙∙░███░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙█∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░████∙∙∙∙
-    // ░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░
-    // ░░░∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙∙░░░
-    // ░░░░░░░░░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░░▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒▒░░░░░░░░░░░░░░░∙░░░░░░
-    0x43, 0x0f, 0x43, 0x10, 0x43, 0x30, 0x4b, 0x51, 0x4b, 0x51, 0x53, 0x72, 0x4b, 0x92, 0x53, 0xb3, 0x53, 0xb3, 0x53, 0xb3, 0x4b, 0xb4, 0x4b, 0xb4, 0x4b, 0xb5, 0x4b, 0xb5, 0x4b, 0x95, 0x4b, 0x94, 0x4b, 0x93, 0x4b, 0x52, 0x52, 0xcf, 0x5a, 0xcd, 0x52, 0xcd, 0x4a, 0xed, 0x42, 0xeb, 0x42, 0xcb, 0x3a, 0xcc, 0x3a, 0xcd, 0x3a, 0xef, 0x32, 0xef, 0x32, 0xef, 0x3b, 0x10, 0x3b, 0x30, 0x3b, 0x32, 0x3b, 0x53, 0x43, 0x54, 0x43, 0x74, 0x3b, 0x95, 0x3b, 0x74, 0x43, 0x95, 0x43, 0x95, 0x43, 0x95, 0x43, 0x95, 0x43, 0x95, 0x43, 0x95, 0x43, 0x74, 0x43, 0x74, 0x43, 0x73, 0x43, 0x74, 0x53, 0x52, 0x68, 0xc6, 0x68, 0x00, 0x68, 0x00, 0x70, 0x00, 0x70, 0x20, 0x70, 0x00, 0x68, 0x00, 0x70, 0x00, 0x69, 0xa9, 0x4c, 0x16, 0x4b, 0xf6, 0x4b, 0xd6, 0x4b, 0xd6, 0x4b, 0xd6, 0x43, 0xd6, 0x4b, 0xf7, 0x4b, 0x93, 0x30, 0xc5, 0x4b, 0x52, 0x43, 0xf7, 0x43, 0xd7, 0x43, 0xb7, 0x43, 0x97, 0x43, 0x77, 0x3b, 0x76, 0x43, 0x97, 0x43, 0x97, 0x43, 0x96, 0x43, 0x56, 0x43, 0x14, 0x42, 0x91, 0x39, 0xac, 0x30, 0x85, 0x28, 0x22,
-    0x28, 0x63, 0x20, 0x64, 0x18, 0x42, 0x18, 0x21, 0x20, 0x00, 0x20, 0x01, 0x20, 0x00, 0x18, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x20, 0x10, 0x00, 0x10, 0x00, 0x42, 0xf0, 0x43, 0x10, 0x4b, 0x51, 0x4b, 0x71, 0x53, 0x72, 0x53, 0x93, 0x53, 0xb3, 0x53, 0xb3, 0x53, 0xd4, 0x53, 0xd4, 0x4b, 0xd5, 0x53, 0xd5, 0x53, 0xd5, 0x53, 0xd6, 0x53, 0xd6, 0x53, 0xd5, 0x53, 0xd5, 0x52, 0xd0, 0x70, 0xa5, 0x88, 0x22, 0x98, 0x02, 0x98, 0x63, 0x90, 0x84, 0x90, 0x84, 0x79, 0x87, 0x71, 0x88, 0x71, 0x88, 0x5a, 0x4c, 0x52, 0x6c, 0x5a, 0x6e, 0x6a, 0x2d, 0x6a, 0x4e, 0x5b, 0x32, 0x5b, 0x13, 0x62, 0xf2, 0x5b, 0x33, 0x53, 0x54, 0x5b, 0x13, 0x53, 0x75, 0x53, 0xb6, 0x4b, 0xd6, 0x4b, 0xf7, 0x4b, 0xf7, 0x4b, 0xd7, 0x4b, 0xd6, 0x4b, 0xf6, 0x4b, 0xd6, 0x4b, 0xf7, 0x63, 0x12, 0x70, 0x22, 0x78, 0x00, 0x70, 0x00, 0x78, 0x20, 0x78, 0x20, 0x78, 0x20, 0x78, 0x00, 0x78, 0x00, 0x62, 0xd0, 0x54, 0x58, 0x4c, 0x17, 0x4b, 0xf7, 0x4b, 0xf7, 0x4c, 0x17, 0x54, 0x37, 0x39, 0x67, 0x42, 0x4d, 0x4c, 0x57, 0x43, 0xf7,
-    0x43, 0xf8, 0x43, 0xd7, 0x43, 0xd8, 0x43, 0xd8, 0x43, 0xd8, 0x43, 0xd8, 0x43, 0xd7, 0x4b, 0xb7, 0x4b, 0xb7, 0x4b, 0xb7, 0x4b, 0x76, 0x4a, 0xb3, 0x49, 0x8b, 0x40, 0x64, 0x40, 0x64, 0x40, 0x85, 0x30, 0x63, 0x18, 0x21, 0x20, 0x00, 0x20, 0x01, 0x20, 0x01, 0x18, 0x20, 0x10, 0x20, 0x10, 0x20, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x20, 0x43, 0x10, 0x43, 0x31, 0x4b, 0x51, 0x4b, 0x92, 0x4b, 0x93, 0x53, 0xb3, 0x53, 0xd3, 0x53, 0xd4, 0x53, 0xf5, 0x53, 0xf5, 0x53, 0xf6, 0x53, 0xf6, 0x54, 0x17, 0x54, 0x17, 0x54, 0x17, 0x53, 0xf7, 0x53, 0xf6, 0x53, 0xf6, 0x5b, 0x92, 0x6a, 0xcf, 0x79, 0xeb, 0x90, 0xe5, 0xa8, 0x42, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xa0, 0x00, 0xa0, 0x01, 0xb8, 0x22, 0xb0, 0x00, 0xa8, 0x00, 0xa8, 0x42, 0xa0, 0x83, 0x98, 0x21, 0x90, 0x21, 0x90, 0x62, 0x90, 0x21, 0x90, 0x83, 0x88, 0xe5, 0x81, 0x07, 0x82, 0x0c, 0x72, 0x4d, 0x69, 0xec, 0x61, 0xab, 0x61, 0x8a, 0x69, 0xcb, 0x6a, 0x0d, 0x63, 0x54, 0x7b, 0x12, 0x79, 0x47, 0x78, 0x21, 0x80, 0x00, 0x80, 0x20,
-    0x80, 0x40, 0x88, 0x20, 0x88, 0x00, 0x78, 0xa4, 0x5c, 0x17, 0x54, 0x59, 0x4c, 0x38, 0x4c, 0x38, 0x54, 0x79, 0x4a, 0xae, 0x31, 0x26, 0x54, 0x58, 0x4c, 0x19, 0x4c, 0x18, 0x4c, 0x18, 0x4b, 0xf9, 0x4b, 0xf9, 0x4c, 0x19, 0x4b, 0xf9, 0x4b, 0xf9, 0x4b, 0xf8, 0x43, 0xf8, 0x43, 0xf8, 0x43, 0xf9, 0x4b, 0xd8, 0x53, 0x57, 0x5a, 0x52, 0x58, 0xe9, 0x50, 0x44, 0x58, 0x44, 0x40, 0x23, 0x28, 0x01, 0x18, 0x00, 0x18, 0x00, 0x18, 0x20, 0x18, 0x20, 0x18, 0x20, 0x18, 0x00, 0x18, 0x00, 0x10, 0x00, 0x10, 0x20, 0x18, 0x20, 0x43, 0x31, 0x43, 0x51, 0x4b, 0x72, 0x4b, 0x92, 0x4b, 0xb3, 0x53, 0xd4, 0x53, 0xf4, 0x54, 0x15, 0x54, 0x16, 0x54, 0x16, 0x5c, 0x37, 0x5c, 0x37, 0x5c, 0x38, 0x5c, 0x58, 0x5c, 0x38, 0x5c, 0x38, 0x5c, 0x37, 0x54, 0x17, 0x54, 0x16, 0x54, 0x15, 0x4b, 0xf3, 0x4b, 0xd2, 0x53, 0x4f, 0x62, 0xad, 0x98, 0xe6, 0xa0, 0x22, 0xa8, 0x21, 0xa0, 0x00, 0xa8, 0x00, 0xb0, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xb0, 0x00, 0xa8, 0x00, 0xa0, 0x00, 0xa0, 0x20, 0x98, 0x00, 0xa0, 0x00, 0x98, 0x00, 0x98, 0x00,
-    0x98, 0x00, 0x88, 0x00, 0x78, 0x00, 0x68, 0x00, 0x68, 0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0x00, 0x78, 0x20, 0x71, 0x06, 0x7a, 0x8d, 0x82, 0xad, 0x89, 0x25, 0x80, 0x40, 0x78, 0x20, 0x80, 0x20, 0x80, 0x40, 0x70, 0x00, 0x62, 0x6d, 0x54, 0xba, 0x54, 0x79, 0x54, 0x9a, 0x53, 0xd5, 0x28, 0xc4, 0x4b, 0xd4, 0x54, 0x9a, 0x4c, 0x3a, 0x4c, 0x3a, 0x4c, 0x3a, 0x4c, 0x39, 0x4c, 0x3a, 0x4c, 0x3a, 0x4c, 0x1a, 0x4c, 0x39, 0x4c, 0x39, 0x4c, 0x19, 0x4c, 0x19, 0x44, 0x19, 0x4c, 0x19, 0x4b, 0xf9, 0x5a, 0xf6, 0x59, 0x6c, 0x58, 0x02, 0x58, 0x00, 0x48, 0x00, 0x28, 0x00, 0x18, 0x00, 0x10, 0x20, 0x18, 0x20, 0x18, 0x20, 0x18, 0x20, 0x18, 0x00, 0x18, 0x21, 0x18, 0x21, 0x18, 0x20, 0x20, 0x00, 0x43, 0x51, 0x4b, 0x72, 0x4b, 0x93, 0x4b, 0xb3, 0x4b, 0xd4, 0x53, 0xf5, 0x54, 0x15, 0x54, 0x36, 0x5c, 0x36, 0x5c, 0x57, 0x5c, 0x57, 0x64, 0x98, 0x64, 0x98, 0x64, 0x78, 0x64, 0x79, 0x64, 0x79, 0x64, 0x78, 0x5c, 0x58, 0x5c, 0x37, 0x54, 0x16, 0x53, 0xf4, 0x53, 0xd2, 0x4b, 0x91, 0x4b, 0x70, 0x53, 0x4e, 0x5b, 0x2d,
-    0x6a, 0x6b, 0x98, 0x21, 0xb0, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa0, 0x20, 0xa0, 0x20, 0xa0, 0x40, 0xa0, 0x20, 0x98, 0x20, 0x98, 0x20, 0x88, 0x20, 0x78, 0x00, 0x70, 0x00, 0x68, 0x00, 0x80, 0x20, 0x80, 0x20, 0x78, 0x00, 0x80, 0x20, 0x80, 0x00, 0x88, 0x00, 0x80, 0x00, 0x78, 0xa3, 0x91, 0xa9, 0x98, 0xa4, 0x78, 0x00, 0x80, 0x20, 0x80, 0x20, 0x78, 0x00, 0x70, 0x82, 0x6b, 0xd4, 0x5c, 0xfb, 0x5c, 0xb9, 0x31, 0x67, 0x42, 0xae, 0x5c, 0xdb, 0x54, 0x7a, 0x54, 0x7a, 0x54, 0x5b, 0x4c, 0x5a, 0x4c, 0x5a, 0x4c, 0x5a, 0x4c, 0x5a, 0x4c, 0x5a, 0x4c, 0x5a, 0x4c, 0x5a, 0x4c, 0x3a, 0x4c, 0x3a, 0x4c, 0x5a, 0x4c, 0x3a, 0x4c, 0x3a, 0x53, 0x57, 0x51, 0x8d, 0x50, 0x23, 0x50, 0x00, 0x48, 0x00, 0x20, 0x20, 0x18, 0x20, 0x10, 0x00, 0x18, 0x00, 0x18, 0x20, 0x18, 0x20, 0x20, 0x21, 0x20, 0x22, 0x20, 0x22, 0x20, 0x20, 0x20, 0x00, 0x4b, 0x72, 0x4b, 0x93, 0x4b, 0xb3, 0x4b, 0xd4, 0x53, 0xf5, 0x54, 0x16, 0x5c, 0x36, 0x5c, 0x57, 0x5c, 0x57, 0x64, 0x78, 0x64, 0x98, 0x6c, 0xb8,
-    0x64, 0xb9, 0x6c, 0xb9, 0x6c, 0xb9, 0x6c, 0xba, 0x64, 0x9a, 0x64, 0x99, 0x64, 0x79, 0x5c, 0x58, 0x5c, 0x36, 0x53, 0xf4, 0x53, 0xb2, 0x4b, 0x90, 0x4b, 0x8f, 0x43, 0x8f, 0x4b, 0x6f, 0x72, 0x4a, 0x91, 0x46, 0xa0, 0xa3, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xa8, 0x00, 0xa0, 0x20, 0xa0, 0x20, 0x98, 0x20, 0x98, 0x20, 0x98, 0x20, 0x98, 0x40, 0x90, 0x20, 0x88, 0x20, 0x88, 0x20, 0x88, 0x20, 0x90, 0x40, 0x88, 0x40, 0x88, 0x20, 0x88, 0x00, 0x90, 0x00, 0x90, 0x20, 0x88, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x88, 0x00, 0x88, 0x00, 0x90, 0xe5, 0x74, 0x97, 0x3a, 0xce, 0x31, 0x68, 0x64, 0xfb, 0x54, 0xdc, 0x54, 0x9c, 0x54, 0x9b, 0x54, 0x9b, 0x54, 0x9c, 0x54, 0x9b, 0x54, 0x9c, 0x54, 0x9c, 0x54, 0x7b, 0x4c, 0x7b, 0x54, 0x7b, 0x4c, 0x7b, 0x4c, 0x7b, 0x4c, 0x7b, 0x54, 0x5b, 0x4b, 0xfa, 0x4a, 0xd4, 0x41, 0x29, 0x48, 0x01, 0x48, 0x00, 0x38, 0x00, 0x20, 0x00, 0x18, 0x00, 0x20, 0x00, 0x20, 0x00, 0x28, 0x00, 0x28, 0x00, 0x20, 0x22, 0x28, 0x22, 0x20, 0x21,
-    0x20, 0x00, 0x20, 0x00, 0x4b, 0x92, 0x4b, 0xb3, 0x4b, 0xd4, 0x53, 0xf5, 0x54, 0x15, 0x5c, 0x36, 0x5c, 0x57, 0x64, 0x78, 0x64, 0x98, 0x64, 0xb8, 0x6c, 0xd9, 0x6c, 0xd9, 0x6c, 0xf9, 0x6c, 0xfa, 0x6c, 0xfa, 0x6c, 0xfa, 0x6c, 0xdb, 0x6c, 0xdb, 0x6c, 0xbb, 0x64, 0x79, 0x5c, 0x77, 0x5c, 0x35, 0x53, 0xf3, 0x53, 0xd1, 0x53, 0xb0, 0x53, 0x90, 0x4b, 0xb0, 0x4b, 0xd1, 0x53, 0xf3, 0x7a, 0x4c, 0xa8, 0x01, 0xb0, 0x00, 0xb0, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa0, 0x20, 0xa0, 0x20, 0xa0, 0x40, 0xa0, 0x40, 0x98, 0x20, 0xa0, 0x40, 0x98, 0x20, 0xa0, 0x40, 0x98, 0x40, 0x90, 0x20, 0x90, 0x00, 0x90, 0x20, 0x90, 0x20, 0x88, 0x20, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x78, 0x20, 0x80, 0x40, 0x88, 0x00, 0x88, 0x00, 0x90, 0x00, 0x89, 0x05, 0x30, 0xc3, 0x5c, 0x77, 0x5d, 0x3d, 0x5c, 0xdd, 0x54, 0xdc, 0x54, 0xbc, 0x54, 0xbc, 0x54, 0xbc, 0x54, 0xbc, 0x54, 0xbd, 0x54, 0xbc, 0x54, 0xbc, 0x54, 0x9c, 0x54, 0x9c, 0x54, 0x9c, 0x54, 0x9c, 0x54, 0x9c, 0x54, 0x5c, 0x53, 0x59,
-    0x41, 0xad, 0x38, 0x42, 0x38, 0x00, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x38, 0x20, 0x40, 0x20, 0x40, 0x00, 0x30, 0x00, 0x28, 0x01, 0x28, 0x21, 0x28, 0x20, 0x20, 0x00, 0x20, 0x00, 0x4b, 0xb3, 0x4b, 0xd3, 0x53, 0xf4, 0x53, 0xf5, 0x5c, 0x36, 0x5c, 0x57, 0x5c, 0x77, 0x64, 0x98, 0x64, 0xb8, 0x6c, 0xd9, 0x6c, 0xf9, 0x75, 0x1a, 0x75, 0x1a, 0x75, 0x1b, 0x75, 0x1b, 0x75, 0x1b, 0x75, 0x1c, 0x75, 0x1c, 0x6c, 0xfc, 0x6c, 0xba, 0x64, 0xb9, 0x64, 0x77, 0x5c, 0x35, 0x54, 0x13, 0x53, 0xf2, 0x53, 0xd1, 0x53, 0xd1, 0x53, 0xd2, 0x53, 0xf3, 0x5b, 0xf4, 0x7a, 0xf0, 0x99, 0x69, 0xa8, 0x01, 0xa8, 0x00, 0xb0, 0x00, 0xa8, 0x00, 0xb0, 0x00, 0xa8, 0x00, 0xa8, 0x20, 0xa8, 0x00, 0xb0, 0x00, 0xa8, 0x20, 0xa8, 0x20, 0xa8, 0x20, 0xa8, 0x20, 0xa8, 0x40, 0xa0, 0x20, 0xa0, 0x00, 0xa0, 0x20, 0x98, 0x40, 0x90, 0x40, 0x90, 0x20, 0x88, 0x20, 0x88, 0x20, 0x88, 0x20, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x90, 0x20, 0x90, 0x00, 0xa0, 0x43, 0x8b, 0xf4, 0x6c, 0xda, 0x5d, 0x1d, 0x5d, 0x1d,
-    0x5d, 0x1d, 0x5c, 0xfe, 0x5c, 0xdd, 0x5c, 0xdd, 0x5c, 0xdd, 0x54, 0xdd, 0x54, 0xdd, 0x54, 0xdd, 0x54, 0xdd, 0x54, 0xdd, 0x54, 0xbd, 0x5c, 0x9d, 0x5b, 0xfb, 0x52, 0x93, 0x40, 0xa7, 0x38, 0x00, 0x40, 0x20, 0x40, 0x00, 0x40, 0x20, 0x40, 0x00, 0x50, 0x00, 0x50, 0x20, 0x50, 0x20, 0x48, 0x00, 0x40, 0x00, 0x38, 0x00, 0x28, 0x00, 0x28, 0x00, 0x20, 0x00, 0x20, 0x00, 0x4b, 0xb3, 0x4b, 0xd4, 0x53, 0xf5, 0x5c, 0x16, 0x5c, 0x36, 0x5c, 0x77, 0x64, 0x97, 0x6c, 0xb8, 0x6c, 0xd9, 0x6c, 0xf9, 0x75, 0x1a, 0x75, 0x3a, 0x75, 0x3b, 0x75, 0x3b, 0x75, 0x5c, 0x75, 0x5c, 0x75, 0x3c, 0x75, 0x3d, 0x6d, 0x1d, 0x6c, 0xfc, 0x6c, 0xda, 0x64, 0xb9, 0x64, 0x77, 0x5c, 0x35, 0x5c, 0x34, 0x54, 0x13, 0x5c, 0x14, 0x54, 0x14, 0x53, 0xf4, 0x54, 0x34, 0x54, 0x77, 0x64, 0x37, 0x91, 0xaa, 0xa0, 0xa4, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x00, 0xb0, 0x20, 0xb8, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xb8, 0x00, 0xb8, 0x00, 0xb8, 0x40, 0xc0, 0x61, 0xb0, 0x20, 0xa0, 0x20, 0x98, 0x20, 0x90, 0x00, 0x88, 0x00, 0x88, 0x00,
-    0x88, 0x00, 0x88, 0x00, 0x80, 0x00, 0x80, 0x20, 0x80, 0x20, 0x80, 0x20, 0x90, 0x40, 0x98, 0x21, 0xa8, 0x42, 0xd8, 0x62, 0xe0, 0xa3, 0xc1, 0x88, 0x8b, 0x31, 0x6c, 0x58, 0x64, 0xfc, 0x5d, 0x3e, 0x5d, 0x3f, 0x55, 0x3f, 0x5d, 0x3f, 0x5c, 0xfe, 0x5c, 0xde, 0x5c, 0xde, 0x64, 0xbe, 0x64, 0x7e, 0x64, 0x3d, 0x63, 0xbb, 0x5a, 0xd5, 0x51, 0x4b, 0x48, 0x21, 0x48, 0x00, 0x48, 0x00, 0x50, 0x00, 0x50, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x50, 0x00, 0x50, 0x00, 0x48, 0x20, 0x40, 0x00, 0x38, 0x00, 0x30, 0x00, 0x28, 0x00, 0x30, 0x00, 0x53, 0xd3, 0x53, 0xf4, 0x54, 0x15, 0x5c, 0x36, 0x5c, 0x57, 0x64, 0x97, 0x6c, 0xb8, 0x6c, 0xd9, 0x6c, 0xf9, 0x75, 0x1a, 0x75, 0x3a, 0x75, 0x5b, 0x75, 0x5c, 0x7d, 0x5c, 0x7d, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x75, 0x5d, 0x75, 0x3e, 0x75, 0x3d, 0x6c, 0xfc, 0x6c, 0xda, 0x64, 0x98, 0x64, 0x77, 0x5c, 0x56, 0x5c, 0x56, 0x5c, 0x55, 0x5c, 0x35, 0x5c, 0x35, 0x5c, 0x55, 0x5c, 0x57, 0x5c, 0x79, 0x6c, 0x9a, 0x7c, 0x37, 0x92, 0x2d, 0xa1, 0x68, 0xb0, 0xa4, 0xa8, 0x21,
-    0xa8, 0x41, 0xc0, 0x82, 0xc8, 0xa3, 0xc0, 0xe4, 0xc1, 0x25, 0xb9, 0x26, 0xb9, 0x06, 0xc0, 0xa3, 0xb0, 0x20, 0x98, 0x00, 0x80, 0x00, 0x40, 0x00, 0x70, 0x00, 0x90, 0x00, 0x90, 0x20, 0x90, 0x20, 0x88, 0x20, 0x88, 0x40, 0x98, 0x40, 0x98, 0x40, 0x88, 0x40, 0x78, 0x20, 0xb0, 0x40, 0xc8, 0x81, 0xd8, 0xa1, 0xe0, 0x60, 0xb0, 0x00, 0xa0, 0xe3, 0x82, 0x2a, 0x73, 0x92, 0x6c, 0x18, 0x6c, 0x7b, 0x64, 0x7d, 0x6c, 0x3d, 0x6b, 0xdb, 0x6b, 0x99, 0x73, 0x58, 0x6b, 0x17, 0x62, 0xb4, 0x61, 0xef, 0x61, 0x09, 0x58, 0x22, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x50, 0x00, 0x48, 0x00, 0x48, 0x00, 0x40, 0x00, 0x48, 0x00, 0x50, 0x00, 0x50, 0x00, 0x48, 0x00, 0x53, 0xd4, 0x53, 0xf5, 0x5c, 0x36, 0x5c, 0x57, 0x64, 0x77, 0x64, 0x98, 0x6c, 0xd8, 0x74, 0xf9, 0x75, 0x1a, 0x75, 0x3b, 0x75, 0x5b, 0x7d, 0x5c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x9d, 0x7d, 0x9e, 0x7d, 0x9e, 0x7d, 0x7e, 0x75, 0x7e, 0x75, 0x5e, 0x6d, 0x3d, 0x6c, 0xfb, 0x6c, 0xda, 0x64, 0xb9,
-    0x64, 0x98, 0x64, 0x98, 0x64, 0x97, 0x5c, 0x77, 0x5c, 0x56, 0x5c, 0x77, 0x5c, 0x98, 0x64, 0x99, 0x64, 0xba, 0x5d, 0x1c, 0x6d, 0x3e, 0x75, 0x3e, 0x84, 0x79, 0x93, 0x73, 0x9a, 0xcf, 0xa2, 0xcf, 0xaa, 0xf0, 0xa2, 0xcf, 0x9a, 0xae, 0x9a, 0x4c, 0xa9, 0xa9, 0xb8, 0xc4, 0xa8, 0x20, 0x60, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x60, 0x20, 0x98, 0x40, 0x98, 0x60, 0x98, 0x40, 0xa8, 0x40, 0xa8, 0x40, 0x88, 0x20, 0x68, 0x00, 0xa0, 0x81, 0xa8, 0x40, 0xd0, 0xe1, 0xb0, 0x80, 0xe1, 0x42, 0xb0, 0x40, 0xa8, 0x20, 0xb8, 0x60, 0xa8, 0x80, 0xa0, 0xc3, 0x99, 0x06, 0x91, 0xab, 0x92, 0x0d, 0x89, 0xcd, 0x79, 0x6b, 0x71, 0x2a, 0x70, 0xe8, 0x68, 0x86, 0x68, 0x43, 0x68, 0x00, 0x68, 0x00, 0x68, 0x00, 0x68, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x58, 0x00, 0x58, 0x00, 0x50, 0x00, 0x48, 0x00, 0x40, 0x00, 0x48, 0x00, 0x50, 0x00, 0x60, 0x00, 0x58, 0x00, 0x50, 0x00, 0x53, 0xd4, 0x54, 0x15, 0x5c, 0x36, 0x5c, 0x77, 0x64, 0x98, 0x6c, 0xb8, 0x6c, 0xd9, 0x75, 0x1a, 0x75, 0x3b, 0x75, 0x5b,
-    0x7d, 0x5c, 0x7d, 0x7c, 0x7d, 0x9d, 0x7d, 0x9d, 0x7d, 0xbe, 0x85, 0xbe, 0x7d, 0xbe, 0x7d, 0xbe, 0x7d, 0x9f, 0x75, 0x7f, 0x75, 0x5e, 0x6d, 0x3e, 0x6d, 0x1c, 0x6c, 0xfb, 0x64, 0xdb, 0x64, 0xda, 0x64, 0xb9, 0x64, 0xb9, 0x64, 0x99, 0x64, 0xb9, 0x64, 0xb9, 0x64, 0xba, 0x64, 0xfb, 0x65, 0x1d, 0x65, 0x5f, 0x6d, 0x7f, 0x75, 0x1d, 0x84, 0x37, 0x8b, 0x11, 0x91, 0xca, 0x98, 0xe5, 0x90, 0x63, 0x90, 0x00, 0x98, 0x00, 0xa8, 0x00, 0xa8, 0x20, 0x58, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x20, 0x38, 0x20, 0x30, 0x20, 0x48, 0x20, 0xa8, 0x41, 0xc0, 0x40, 0xb0, 0x20, 0x88, 0x20, 0x68, 0x00, 0x90, 0x60, 0xb8, 0x60, 0x98, 0x40, 0xe1, 0x21, 0x98, 0x40, 0xd9, 0x41, 0xe0, 0xe1, 0x98, 0x20, 0xa0, 0x40, 0xc8, 0xc0, 0xd8, 0xc0, 0xd0, 0x40, 0xc8, 0x40, 0xc0, 0x60, 0xc0, 0x81, 0xa0, 0x21, 0x90, 0x00, 0x78, 0x00, 0x70, 0x00, 0x78, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x68, 0x00, 0x68, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x58, 0x00, 0x58, 0x00, 0x50, 0x00, 0x48, 0x00, 0x58, 0x00,
-    0x60, 0x00, 0x60, 0x20, 0x60, 0x20, 0x60, 0x60, 0x53, 0xf5, 0x54, 0x16, 0x5c, 0x36, 0x64, 0x77, 0x64, 0x98, 0x6c, 0xb9, 0x6c, 0xfa, 0x6d, 0x1a, 0x75, 0x3b, 0x7d, 0x5c, 0x7d, 0x7c, 0x7d, 0x9d, 0x7d, 0x9d, 0x7d, 0xbe, 0x85, 0xde, 0x85, 0xde, 0x7d, 0xdf, 0x7d, 0xdf, 0x7d, 0xbf, 0x7d, 0x9f, 0x75, 0x7f, 0x75, 0x5f, 0x6d, 0x3d, 0x6d, 0x3d, 0x6d, 0x1d, 0x6d, 0x1c, 0x6c, 0xfb, 0x64, 0xdb, 0x64, 0xdb, 0x64, 0xdb, 0x6c, 0xfb, 0x65, 0x1d, 0x6d, 0x5e, 0x74, 0xfd, 0x8b, 0xf7, 0x9a, 0xf1, 0xa1, 0x47, 0x98, 0x01, 0x98, 0x00, 0xa0, 0x00, 0xa8, 0x00, 0xa0, 0x00, 0xa8, 0x00, 0xb0, 0x00, 0x88, 0x00, 0x48, 0x00, 0x40, 0x20, 0x40, 0x20, 0x38, 0x20, 0x38, 0x20, 0x38, 0x00, 0x38, 0x00, 0x40, 0x00, 0x48, 0x20, 0x90, 0x20, 0x90, 0x20, 0x78, 0x20, 0x80, 0x20, 0xc8, 0xc1, 0xa0, 0x20, 0x98, 0x80, 0xf1, 0x42, 0xb0, 0x60, 0xb0, 0xc0, 0xf9, 0xa1, 0xd8, 0x81, 0xa0, 0x20, 0xa8, 0xa0, 0xc0, 0xe0, 0xc9, 0x20, 0xe1, 0x00, 0xd0, 0xc0, 0xd0, 0xa0, 0xd0, 0x60, 0xd0, 0x61, 0xb0, 0x82, 0x88, 0x00, 0x80, 0x00,
-    0x80, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x70, 0x00, 0x68, 0x00, 0x68, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x50, 0x00, 0x50, 0x00, 0x58, 0x00, 0x68, 0x00, 0x70, 0x20, 0x78, 0x40, 0x78, 0x40, 0x70, 0x60, 0x53, 0xf5, 0x54, 0x16, 0x5c, 0x57, 0x64, 0x78, 0x64, 0xb8, 0x6c, 0xd9, 0x6c, 0xfa, 0x75, 0x3b, 0x75, 0x5b, 0x7d, 0x7c, 0x7d, 0x7d, 0x7d, 0x9d, 0x85, 0xbe, 0x85, 0xde, 0x85, 0xde, 0x85, 0xff, 0x85, 0xff, 0x85, 0xff, 0x7d, 0xdf, 0x7d, 0xbf, 0x75, 0x9f, 0x75, 0x7f, 0x75, 0x7f, 0x6d, 0x5e, 0x6d, 0x3e, 0x6d, 0x3e, 0x6d, 0x1d, 0x6d, 0x1d, 0x65, 0x1d, 0x65, 0x5e, 0x65, 0x7f, 0x7d, 0x1e, 0x93, 0x96, 0xaa, 0x0d, 0xb8, 0x82, 0xb8, 0x00, 0xa8, 0x00, 0x98, 0x00, 0xa0, 0x00, 0xa0, 0x00, 0xb0, 0x20, 0xb8, 0x20, 0xb8, 0x20, 0x70, 0x20, 0x40, 0x20, 0x40, 0x20, 0x40, 0x20, 0x40, 0x20, 0x38, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x38, 0x00, 0x38, 0x00, 0x58, 0x00, 0x88, 0x20, 0xb8, 0x81, 0xd0, 0x81, 0xa0, 0x20, 0xb0, 0x80, 0xf9, 0x61, 0xc0, 0x80, 0xa8, 0x80,
-    0xe9, 0x60, 0xf1, 0x20, 0xd8, 0x80, 0xc8, 0x61, 0xb0, 0x60, 0xa0, 0xc0, 0xc0, 0xe0, 0xe1, 0x01, 0xd9, 0x00, 0xd8, 0xc0, 0xd8, 0xe0, 0xe0, 0xe2, 0xc0, 0x81, 0x98, 0x40, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x78, 0x00, 0x70, 0x00, 0x70, 0x00, 0x68, 0x00, 0x60, 0x00, 0x58, 0x00, 0x40, 0x00, 0x50, 0x00, 0x58, 0x00, 0x60, 0x00, 0x68, 0x20, 0x80, 0x20, 0x78, 0x20, 0x70, 0x20, 0x54, 0x15, 0x5c, 0x36, 0x5c, 0x57, 0x64, 0x78, 0x64, 0xb9, 0x6c, 0xda, 0x6c, 0xfa, 0x75, 0x3b, 0x75, 0x5c, 0x7d, 0x7d, 0x7d, 0x9d, 0x7d, 0xbe, 0x85, 0xde, 0x85, 0xde, 0x85, 0xff, 0x85, 0xff, 0x85, 0xff, 0x85, 0xff, 0x7d, 0xdf, 0x7d, 0xbf, 0x75, 0xbf, 0x75, 0x9f, 0x75, 0x7f, 0x75, 0x7f, 0x6d, 0x5f, 0x6d, 0x5f, 0x6d, 0x5f, 0x65, 0x9f, 0x65, 0xbf, 0x7d, 0x5e, 0x9b, 0xb6, 0xba, 0x2d, 0xc0, 0x63, 0xb8, 0x00, 0xb0, 0x20, 0xb8, 0x00, 0xa8, 0x00, 0xa0, 0x20, 0xa8, 0x00, 0xb0, 0x00, 0xb8, 0x20, 0xa8, 0x40, 0x50, 0x20, 0x40, 0x20, 0x40, 0x20, 0x40, 0x20, 0x40, 0x20, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00,
-    0x40, 0x20, 0x40, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x48, 0x20, 0xc8, 0x81, 0xc0, 0x40, 0xa8, 0x80, 0xc0, 0xe0, 0xf1, 0x41, 0xc8, 0xa0, 0xb0, 0x80, 0xd9, 0x20, 0xf1, 0x80, 0xe0, 0xe0, 0xe1, 0x03, 0xd1, 0x02, 0xa8, 0x60, 0xa0, 0x80, 0xd0, 0xc0, 0xd9, 0x00, 0xe1, 0x40, 0xe1, 0x00, 0xe0, 0xc0, 0xe8, 0xc0, 0xd0, 0xc3, 0x88, 0x01, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x80, 0x00, 0x78, 0x00, 0x70, 0x00, 0x68, 0x00, 0x68, 0x00, 0x50, 0x00, 0x40, 0x00, 0x58, 0x00, 0x50, 0x00, 0x48, 0x00, 0x58, 0x00, 0x70, 0x20, 0x68, 0x20, 0x60, 0x00, 0x54, 0x15, 0x5c, 0x36, 0x5c, 0x57, 0x64, 0x98, 0x64, 0xb9, 0x6c, 0xfa, 0x6d, 0x1b, 0x75, 0x3b, 0x75, 0x5c, 0x7d, 0x9d, 0x7d, 0x9d, 0x7d, 0xde, 0x85, 0xde, 0x85, 0xdf, 0x85, 0xff, 0x86, 0x1f, 0x85, 0xff, 0x85, 0xff, 0x7d, 0xff, 0x7d, 0xdf, 0x7d, 0xdf, 0x75, 0xbf, 0x75, 0x9f, 0x75, 0x7f, 0x6d, 0x9f, 0x6d, 0xdf, 0x6d, 0xbf, 0x85, 0x3f, 0xab, 0xd6, 0xca, 0x6e, 0xe0, 0x63, 0xd8, 0x00, 0xc0, 0x00, 0xa8, 0x20, 0xa8, 0x20, 0xb0, 0x20,
-    0xb8, 0x20, 0xb0, 0x20, 0xb8, 0x60, 0xc0, 0x80, 0x90, 0x60, 0x48, 0x20, 0x40, 0x20, 0x40, 0x20, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x20, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x20, 0x30, 0x20, 0x40, 0x20, 0x50, 0x20, 0x88, 0x20, 0xa8, 0xa0, 0xd1, 0x20, 0xf1, 0x40, 0xd0, 0xc0, 0xc0, 0x80, 0xc8, 0xc0, 0xe9, 0x61, 0xf1, 0x40, 0xe9, 0x84, 0xba, 0xcb, 0xc9, 0x23, 0xd0, 0x40, 0xd8, 0x60, 0xd8, 0xa0, 0xc8, 0xe1, 0xd9, 0x20, 0xe9, 0x40, 0xe0, 0xe0, 0xe8, 0xc2, 0xc8, 0x82, 0x98, 0x20, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x78, 0x00, 0x70, 0x00, 0x68, 0x00, 0x68, 0x00, 0x58, 0x00, 0x58, 0x00, 0x58, 0x00, 0x50, 0x00, 0x48, 0x00, 0x60, 0x00, 0x70, 0x20, 0x68, 0x00, 0x60, 0x00, 0x54, 0x15, 0x5c, 0x36, 0x5c, 0x77, 0x64, 0x98, 0x64, 0xb9, 0x6c, 0xfa, 0x6d, 0x1b, 0x75, 0x5b, 0x75, 0x7c, 0x7d, 0x9d, 0x75, 0xbe, 0x7d, 0xbe, 0x7d, 0xdf, 0x7d, 0xdf, 0x85, 0xff, 0x86, 0x1f, 0x86, 0x1f, 0x86, 0x1f, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xdf, 0x7d, 0xdf,
-    0x75, 0xdf, 0x75, 0xff, 0x75, 0xff, 0x85, 0x9f, 0xac, 0x18, 0xe2, 0x0c, 0xf8, 0xa3, 0xf8, 0x40, 0xe0, 0x00, 0xc8, 0x20, 0xb8, 0x20, 0xa0, 0x00, 0xa8, 0x00, 0xb0, 0x20, 0xb8, 0x40, 0xb8, 0x80, 0xb8, 0x80, 0x68, 0x40, 0x40, 0x20, 0x48, 0x20, 0x48, 0x00, 0x48, 0x20, 0x48, 0x00, 0x48, 0x00, 0x48, 0x20, 0x40, 0x00, 0x40, 0x00, 0x40, 0x00, 0x40, 0x20, 0x38, 0x00, 0x38, 0x00, 0x40, 0x20, 0x38, 0x20, 0x38, 0x20, 0x48, 0x40, 0x40, 0x20, 0x40, 0x20, 0x68, 0x60, 0xd9, 0x00, 0xf1, 0x00, 0xd8, 0xe1, 0xc8, 0xa0, 0xc8, 0xa0, 0xe1, 0x20, 0xf9, 0x41, 0xf9, 0x00, 0xca, 0x68, 0xba, 0xcb, 0xd8, 0xa2, 0xe0, 0x60, 0xe8, 0x80, 0xd8, 0x60, 0xc8, 0xe0, 0xd9, 0x40, 0xd1, 0x80, 0xf1, 0x20, 0xf8, 0xe1, 0xd8, 0xa2, 0x90, 0x00, 0x80, 0x00, 0x78, 0x00, 0x70, 0x00, 0x70, 0x00, 0x68, 0x00, 0x68, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x50, 0x00, 0x50, 0x00, 0x60, 0x00, 0x70, 0x20, 0x70, 0x00, 0x78, 0x20, 0x54, 0x16, 0x5c, 0x36, 0x5c, 0x77, 0x64, 0xb8, 0x64, 0xd9, 0x6c, 0xfa, 0x6d, 0x3b, 0x6d, 0x3c,
-    0x75, 0x7d, 0x75, 0x9d, 0x7d, 0xbe, 0x7d, 0xbf, 0x7d, 0xdf, 0x7d, 0xdf, 0x7d, 0xff, 0x7d, 0xff, 0x7e, 0x1f, 0x7e, 0x1f, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x76, 0x1f, 0x76, 0x7f, 0x85, 0x9f, 0xc3, 0x53, 0xe2, 0x0b, 0xf8, 0xc5, 0xf8, 0x00, 0xf8, 0x00, 0xe0, 0x40, 0xc8, 0x20, 0xb8, 0x00, 0xa8, 0x00, 0xa0, 0x00, 0xa0, 0x20, 0xb0, 0x60, 0xb0, 0x80, 0xa8, 0x60, 0x58, 0x20, 0x48, 0x20, 0x48, 0x20, 0x48, 0x20, 0x48, 0x00, 0x48, 0x20, 0x48, 0x20, 0x48, 0x20, 0x48, 0x20, 0x48, 0x00, 0x40, 0x61, 0x40, 0xa3, 0x40, 0x20, 0x38, 0x20, 0x40, 0x20, 0x40, 0x20, 0x38, 0x20, 0x40, 0x40, 0x40, 0x40, 0x40, 0x20, 0x40, 0x20, 0x38, 0x40, 0x68, 0x80, 0xd8, 0xe0, 0xe0, 0xa0, 0xd0, 0x80, 0xd0, 0x80, 0xc8, 0xe0, 0xf9, 0x61, 0xf9, 0x00, 0xf9, 0x20, 0xda, 0x47, 0xba, 0x4b, 0xd8, 0xa2, 0xe0, 0x40, 0xe0, 0x80, 0xd8, 0xc0, 0xd8, 0xc0, 0xc1, 0x00, 0xe1, 0x60, 0xf1, 0x20, 0xf8, 0xe1, 0xb8, 0x62, 0x78, 0x00, 0x70, 0x00, 0x70, 0x00, 0x68, 0x00, 0x68, 0x00, 0x68, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,
-    0x58, 0x00, 0x50, 0x00, 0x60, 0x00, 0x70, 0x20, 0x80, 0x20, 0x88, 0x60, 0x54, 0x16, 0x5c, 0x57, 0x5c, 0x78, 0x64, 0xb8, 0x64, 0xd9, 0x6c, 0xfa, 0x6d, 0x1b, 0x75, 0x3c, 0x75, 0x7d, 0x75, 0x9e, 0x75, 0x9e, 0x7d, 0xbf, 0x7d, 0xbf, 0x7d, 0xdf, 0x7d, 0xff, 0x7d, 0xff, 0x7e, 0x1f, 0x7e, 0x1f, 0x7e, 0x1f, 0x7e, 0x1f, 0x7e, 0x3f, 0x86, 0x1f, 0xb4, 0x16, 0xea, 0x0d, 0xf8, 0x63, 0xf8, 0x20, 0xf8, 0x20, 0xf8, 0x20, 0xe8, 0x20, 0xc8, 0x20, 0xb0, 0x20, 0xb0, 0x20, 0xa8, 0x20, 0xa8, 0x20, 0xb8, 0x80, 0xc8, 0x80, 0x90, 0x60, 0x50, 0x20, 0x48, 0x00, 0x50, 0x00, 0x48, 0x20, 0x48, 0x20, 0x50, 0x20, 0x50, 0x20, 0x50, 0x40, 0x50, 0x20, 0x48, 0x20, 0x40, 0x82, 0x39, 0x46, 0x38, 0x82, 0x40, 0x20, 0x40, 0x20, 0x40, 0x20, 0x38, 0x20, 0x40, 0x20, 0x48, 0x20, 0x40, 0x20, 0x48, 0x20, 0x48, 0x20, 0x40, 0x40, 0x50, 0x60, 0x58, 0x40, 0xa8, 0x60, 0xd0, 0x60, 0xd0, 0x80, 0xc8, 0xc0, 0xd9, 0x01, 0xf9, 0x61, 0xf9, 0x20, 0xf9, 0x41, 0xd1, 0xe8, 0xc9, 0x28, 0xd8, 0x82, 0xd8, 0x80, 0xe0, 0x80, 0xf0, 0xa1,
-    0xe0, 0x80, 0xd8, 0xe0, 0xd8, 0xe0, 0xf1, 0x01, 0xe0, 0xa2, 0x98, 0x00, 0x70, 0x00, 0x68, 0x00, 0x68, 0x00, 0x68, 0x00, 0x68, 0x00, 0x68, 0x00, 0x68, 0x00, 0x60, 0x00, 0x58, 0x00, 0x50, 0x00, 0x60, 0x00, 0x70, 0x00, 0x90, 0x81, 0x80, 0x80, 0x54, 0x36, 0x5c, 0x57, 0x64, 0x78, 0x64, 0xb9, 0x64, 0xd9, 0x6c, 0xfa, 0x6d, 0x1b, 0x75, 0x3c, 0x75, 0x7d, 0x75, 0x7e, 0x75, 0x9f, 0x7d, 0xbf, 0x7d, 0xdf, 0x7d, 0xdf, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7e, 0x1f, 0x7e, 0x1f, 0x76, 0x7f, 0x7e, 0x1f, 0xca, 0xf0, 0xf8, 0x84, 0xf8, 0x01, 0xf8, 0x00, 0xf8, 0x41, 0xf8, 0x61, 0xf8, 0x60, 0xe0, 0x20, 0xc0, 0x20, 0xb0, 0x20, 0xc0, 0x40, 0xd0, 0x60, 0xd8, 0x60, 0xe0, 0x60, 0xe8, 0x60, 0xf0, 0x60, 0xf8, 0x60, 0xf8, 0x60, 0xf0, 0x40, 0xe8, 0xa1, 0xe8, 0x80, 0xe8, 0x60, 0xe8, 0x80, 0xf8, 0xa0, 0xe8, 0x40, 0xc1, 0xa5, 0x9c, 0x12, 0x81, 0xe9, 0xa0, 0x20, 0xb0, 0x40, 0xb8, 0x40, 0xb8, 0x80, 0xb8, 0x60, 0xd0, 0xa1, 0xd0, 0x60, 0xc8, 0x80, 0xd0, 0xa0, 0xd0, 0x80, 0xb8, 0xa0, 0xf1, 0x41, 0xf9, 0x00,
-    0xe8, 0xc0, 0xc8, 0x80, 0xd0, 0x80, 0xd8, 0xa0, 0xd0, 0xc0, 0xf1, 0x61, 0xf9, 0x20, 0xf9, 0x61, 0xf9, 0x41, 0xe9, 0x25, 0xc8, 0x42, 0xc8, 0x61, 0xd8, 0x61, 0xe0, 0x62, 0xf0, 0xa1, 0xf0, 0xa1, 0xe0, 0xa0, 0xf0, 0xa1, 0xf8, 0x81, 0xe0, 0x61, 0xb0, 0x41, 0x60, 0x00, 0x60, 0x00, 0x68, 0x00, 0x68, 0x00, 0x68, 0x00, 0x68, 0x00, 0x60, 0x00, 0x58, 0x00, 0x50, 0x00, 0x60, 0x00, 0x78, 0x00, 0x98, 0x61, 0x80, 0x60, 0x5c, 0x16, 0x5c, 0x57, 0x64, 0x77, 0x64, 0xb9, 0x64, 0xda, 0x6c, 0xfa, 0x6d, 0x1b, 0x6d, 0x3c, 0x75, 0x7d, 0x75, 0x7e, 0x75, 0x9f, 0x75, 0xbf, 0x7d, 0xdf, 0x7d, 0xdf, 0x7d, 0xff, 0x7d, 0xff, 0x7e, 0x1f, 0x7e, 0x1f, 0x7e, 0x7f, 0x8d, 0xff, 0xb3, 0xf5, 0xf8, 0xc6, 0xf8, 0x00, 0xf8, 0x40, 0xf8, 0x41, 0xf8, 0x61, 0xf8, 0x40, 0xe8, 0x40, 0xe0, 0x40, 0xd8, 0x60, 0xe0, 0x40, 0xe8, 0x40, 0xf0, 0x40, 0xf0, 0x40, 0xf0, 0x80, 0xf8, 0x60, 0xf8, 0x40, 0xf8, 0x60, 0xf8, 0x81, 0xf8, 0x61, 0xf8, 0xe2, 0xf0, 0x80, 0xe8, 0x40, 0xe8, 0x40, 0xf0, 0x20, 0xd9, 0xc6, 0xab, 0x4f, 0x89, 0xa8,
-    0x88, 0x00, 0xa0, 0x00, 0xb0, 0x40, 0xb8, 0x40, 0xb8, 0x60, 0xc8, 0xa1, 0xd8, 0x61, 0xd0, 0x60, 0xd0, 0x60, 0xd0, 0xc0, 0xc8, 0x80, 0xc8, 0xc0, 0xf9, 0x21, 0xf1, 0x41, 0xe9, 0x21, 0xd0, 0xa0, 0xd0, 0x80, 0xd8, 0xa0, 0xd0, 0xa0, 0xe0, 0xe0, 0xf9, 0x00, 0xf9, 0x00, 0xf9, 0x20, 0xf9, 0x21, 0xd8, 0xa2, 0xb0, 0x00, 0xb8, 0x21, 0xa8, 0x00, 0xb8, 0x41, 0xc8, 0x82, 0xd8, 0xa2, 0xd8, 0x41, 0xf0, 0x81, 0xf8, 0x81, 0xf8, 0x82, 0xa8, 0x21, 0x60, 0x00, 0x68, 0x00, 0x70, 0x00, 0x70, 0x00, 0x68, 0x00, 0x58, 0x00, 0x50, 0x00, 0x50, 0x00, 0x68, 0x00, 0x90, 0x20, 0x88, 0x40, 0x80, 0x20, 0x54, 0x36, 0x5c, 0x57, 0x5c, 0x78, 0x64, 0xb9, 0x64, 0xda, 0x6c, 0xfa, 0x6d, 0x1b, 0x6d, 0x3d, 0x75, 0x5d, 0x75, 0x9e, 0x75, 0x9f, 0x75, 0xbf, 0x7d, 0xdf, 0x7d, 0xdf, 0x7d, 0xff, 0x7d, 0xff, 0x7e, 0x5f, 0x7e, 0xdf, 0x95, 0x7b, 0xe1, 0x8b, 0xf8, 0x84, 0xf8, 0x22, 0xf8, 0x21, 0xf8, 0x41, 0xf8, 0x61, 0xf8, 0x40, 0xf0, 0x20, 0xf0, 0x20, 0xe8, 0x60, 0xf0, 0x60, 0xf8, 0x40, 0xf8, 0x41, 0xf8, 0x20, 0xf8, 0x40,
-    0xf8, 0x81, 0xf8, 0x61, 0xf8, 0x61, 0xf8, 0x40, 0xf8, 0xa1, 0xf8, 0xa1, 0xf8, 0xa1, 0xf8, 0xc1, 0xf0, 0x60, 0xf0, 0x00, 0xe1, 0x86, 0xb2, 0xcd, 0x91, 0x05, 0x90, 0x00, 0xa8, 0x20, 0xa8, 0x40, 0xa8, 0x40, 0xc0, 0x81, 0xc0, 0x80, 0xd0, 0xa1, 0xd8, 0x60, 0xd0, 0x60, 0xd8, 0x60, 0xd8, 0xa0, 0xc0, 0x80, 0xc8, 0xa0, 0xf9, 0x01, 0xf9, 0x01, 0xf9, 0x01, 0xe0, 0xa0, 0xd8, 0x61, 0xd8, 0x80, 0xd0, 0x40, 0xd0, 0xc0, 0xf9, 0x40, 0xf8, 0xe0, 0xf9, 0x00, 0xf9, 0x00, 0xf9, 0x02, 0xc0, 0x42, 0xa0, 0x00, 0x98, 0x00, 0x90, 0x00, 0x90, 0x00, 0x90, 0x20, 0x88, 0x01, 0x98, 0x21, 0xb0, 0x41, 0xd0, 0x82, 0xf8, 0x63, 0xa8, 0x21, 0x70, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x01, 0x60, 0x01, 0x50, 0x00, 0x48, 0x00, 0x70, 0x00, 0xa0, 0x60, 0x88, 0x40, 0x78, 0x20, 0x54, 0x36, 0x5c, 0x57, 0x64, 0x78, 0x64, 0x99, 0x64, 0xda, 0x64, 0xfa, 0x6d, 0x3b, 0x6d, 0x3d, 0x75, 0x7d, 0x75, 0x9e, 0x75, 0x9f, 0x75, 0xbf, 0x75, 0xdf, 0x75, 0xff, 0x76, 0x5f, 0x76, 0xbf, 0x95, 0x7c, 0xbb, 0x52, 0xe1, 0xaa, 0xf8, 0x00,
-    0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x01, 0xf0, 0x20, 0xf8, 0x40, 0xf8, 0x20, 0xf8, 0x00, 0xf8, 0x00, 0xf0, 0x40, 0xf8, 0x60, 0xf8, 0x60, 0xf8, 0x61, 0xf8, 0x61, 0xf8, 0xa1, 0xf8, 0x40, 0xf8, 0x40, 0xb8, 0x61, 0x60, 0x20, 0x58, 0x40, 0x58, 0x20, 0x58, 0x00, 0x58, 0x00, 0x50, 0x00, 0x50, 0xa3, 0x40, 0xc3, 0x30, 0x21, 0x30, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x20, 0x40, 0x20, 0x48, 0x20, 0x48, 0x20, 0x48, 0x20, 0x48, 0x20, 0x48, 0x20, 0x48, 0x20, 0x40, 0x20, 0x40, 0x40, 0x58, 0x40, 0x60, 0x40, 0xb8, 0xa0, 0xe9, 0x24, 0xe0, 0xa2, 0xd0, 0x60, 0xc8, 0x40, 0xd0, 0xc0, 0xe9, 0x00, 0xf9, 0x00, 0xf9, 0x21, 0xf9, 0x00, 0xf9, 0x00, 0xf8, 0xe3, 0xa0, 0x00, 0x90, 0x00, 0x88, 0x00, 0x80, 0x00, 0x78, 0x00, 0x70, 0x00, 0x68, 0x00, 0x68, 0x00, 0x68, 0x20, 0xb0, 0x21, 0xe0, 0x23, 0x90, 0x00, 0x80, 0x00, 0x80, 0x21, 0x80, 0x85, 0x68, 0x64, 0x50, 0x01, 0x48, 0x00, 0x80, 0x20, 0x90, 0x40, 0x88, 0x40, 0x78, 0x40, 0x54, 0x36, 0x5c, 0x57, 0x64, 0x78, 0x64, 0x99, 0x64, 0xba, 0x6c, 0xfb,
-    0x6d, 0x1c, 0x6d, 0x3d, 0x75, 0x5e, 0x75, 0x9e, 0x75, 0x9f, 0x7d, 0xbf, 0x75, 0xff, 0x76, 0x1f, 0x9c, 0xda, 0xb3, 0x92, 0xd9, 0xca, 0xf8, 0x02, 0xf8, 0x00, 0xf8, 0x00, 0xf0, 0x00, 0xf8, 0x00, 0xf8, 0x01, 0xf8, 0x21, 0xf8, 0x21, 0xf8, 0x00, 0xf0, 0x00, 0xf0, 0x20, 0xf0, 0x41, 0xf8, 0x20, 0xf8, 0x21, 0xf8, 0x61, 0xf8, 0x81, 0xf8, 0xa2, 0xf8, 0x40, 0xf8, 0x40, 0x60, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x00, 0x58, 0x00, 0x50, 0x20, 0x41, 0x25, 0x39, 0x25, 0x30, 0x20, 0x30, 0x00, 0x30, 0x00, 0x38, 0x00, 0x38, 0x00, 0x40, 0x00, 0x40, 0x20, 0x40, 0x20, 0x48, 0x20, 0x48, 0x20, 0x40, 0x20, 0x48, 0x20, 0x48, 0x20, 0x48, 0x00, 0x40, 0x20, 0x48, 0x40, 0x50, 0x40, 0x58, 0x60, 0x60, 0x40, 0xd2, 0x07, 0xd1, 0x45, 0xc8, 0x60, 0xd0, 0x80, 0xe0, 0xc0, 0xe0, 0xe0, 0xf9, 0x20, 0xf9, 0x20, 0xf9, 0x01, 0xf9, 0x00, 0xf9, 0x02, 0xd0, 0x83, 0x80, 0x00, 0x78, 0x00, 0x70, 0x00, 0x68, 0x00, 0x70, 0x00, 0x68, 0x00, 0x60, 0x00, 0x58, 0x00, 0x70, 0x00, 0xb0, 0x01, 0xa8, 0x01, 0x88, 0x00, 0x80, 0x84,
-    0x71, 0x0a, 0x60, 0xc7, 0x50, 0x01, 0x48, 0x00, 0x90, 0x41, 0x98, 0x40, 0x88, 0x20, 0x60, 0x00, 0x54, 0x36, 0x5c, 0x57, 0x5c, 0x78, 0x64, 0x99, 0x64, 0xba, 0x64, 0xfb, 0x6d, 0x1c, 0x6d, 0x3d, 0x6d, 0x5e, 0x75, 0x7e, 0x75, 0x9e, 0x75, 0xff, 0x7e, 0x5f, 0x9c, 0x98, 0xe8, 0xa6, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xf9, 0x06, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xe8, 0x01, 0xe8, 0x00, 0xe8, 0x21, 0xf0, 0x41, 0xf0, 0x01, 0xf0, 0x20, 0xf0, 0x21, 0xf0, 0x20, 0xf8, 0xa1, 0xf8, 0x41, 0xf8, 0x00, 0x58, 0x00, 0x50, 0x00, 0x68, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a, 0x09, 0x30, 0x21, 0x40, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0xc2, 0x40, 0x20, 0xff, 0xff, 0x48, 0x60, 0x40, 0x20, 0x48, 0x20, 0xff, 0xff, 0x48, 0x20, 0x59, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xe3, 0x50, 0x60, 0x58, 0x60, 0xc9, 0xc6, 0xd1, 0x87, 0xc8, 0x40, 0xd8, 0xa1, 0xf0, 0xa0, 0xe9, 0x00, 0xe9, 0x20, 0xf9, 0x20, 0xf9, 0x61, 0xf9, 0x62, 0xf8, 0xe0,
-    0xf0, 0xe4, 0x80, 0x43, 0x78, 0x42, 0x68, 0x00, 0x60, 0x00, 0x68, 0x00, 0x68, 0x00, 0x68, 0x00, 0x70, 0x00, 0x78, 0x00, 0x88, 0x00, 0xa8, 0x21, 0x88, 0x00, 0x80, 0xc7, 0x61, 0x2b, 0x48, 0xa6, 0x38, 0x00, 0x40, 0x00, 0xa0, 0x41, 0x98, 0x40, 0x70, 0x00, 0x70, 0x60, 0x54, 0x16, 0x5c, 0x37, 0x5c, 0x78, 0x64, 0x99, 0x64, 0xba, 0x64, 0xfb, 0x6d, 0x1c, 0x6d, 0x3d, 0x6d, 0x5d, 0x75, 0x9e, 0x6d, 0xff, 0x7d, 0xbd, 0xba, 0x6e, 0xe8, 0x43, 0xf8, 0x00, 0xe1, 0x26, 0xc9, 0xeb, 0xca, 0x0b, 0xac, 0xd8, 0xa4, 0x97, 0xca, 0x6e, 0xd2, 0x4d, 0xd8, 0xe7, 0xd1, 0xc9, 0xd9, 0x47, 0xd8, 0x00, 0xe0, 0x00, 0xe8, 0x00, 0xe8, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xf0, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xe8, 0x61, 0x48, 0xa3, 0x48, 0xc3, 0xff, 0xff, 0x39, 0x88, 0x2a, 0x2b, 0x2a, 0x0a, 0xff, 0xff, 0x28, 0x20, 0xff, 0xff, 0x38, 0x00, 0x38, 0x00, 0x38, 0x20, 0xff, 0xff, 0x40, 0x20, 0x50, 0xa2, 0xff, 0xff, 0x59, 0x03, 0xff, 0xff, 0x50, 0x61, 0x48, 0x40, 0xff, 0xff, 0x40, 0x20, 0x40, 0x20, 0x48, 0x40,
-    0xff, 0xff, 0x58, 0x40, 0x58, 0x60, 0xe1, 0x22, 0xb8, 0xe5, 0xd0, 0x80, 0xd0, 0x80, 0xf8, 0x80, 0xf8, 0xe0, 0xe1, 0x00, 0xf9, 0x00, 0xf9, 0x00, 0xf9, 0x61, 0xf8, 0xe0, 0xf8, 0xe2, 0xb1, 0xcc, 0x71, 0x4c, 0x68, 0x24, 0x68, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x80, 0x00, 0x88, 0x00, 0x90, 0x00, 0x98, 0x00, 0x90, 0x21, 0x80, 0xa7, 0x58, 0xe9, 0x40, 0x43, 0x28, 0x00, 0x68, 0x41, 0xa8, 0x40, 0x78, 0x00, 0x78, 0x20, 0x98, 0xa0, 0x54, 0x16, 0x5c, 0x37, 0x5c, 0x78, 0x64, 0x99, 0x64, 0xba, 0x64, 0xfb, 0x6d, 0x1c, 0x6d, 0x3d, 0x6d, 0x5d, 0x75, 0xbf, 0x8c, 0xd9, 0xc1, 0xaa, 0xf0, 0x00, 0xe8, 0x02, 0xc2, 0x4d, 0x95, 0x9c, 0x85, 0xde, 0x85, 0xff, 0x7e, 0x5f, 0x7e, 0x3f, 0x7e, 0x3f, 0x85, 0xff, 0x8d, 0xde, 0x86, 0x1f, 0x94, 0x96, 0xb3, 0x10, 0xb3, 0x71, 0xba, 0xcf, 0xc9, 0xca, 0xd2, 0x2c, 0xc3, 0x51, 0xd1, 0xe9, 0xd1, 0xea, 0xbb, 0x92, 0xb3, 0xd3, 0x9c, 0xd9, 0x2a, 0x2b, 0x2a, 0x0b, 0xff, 0xff, 0x2a, 0x2b, 0x2a, 0x2a, 0x28, 0x83, 0xff, 0xff, 0x30, 0x20, 0xff, 0xff, 0x38, 0x00,
-    0x40, 0x20, 0x40, 0x20, 0xff, 0xff, 0x40, 0x20, 0x48, 0x20, 0x48, 0x20, 0xff, 0xff, 0x48, 0x40, 0x48, 0x41, 0x48, 0x40, 0xff, 0xff, 0x38, 0x00, 0x40, 0x40, 0x50, 0x40, 0xff, 0xff, 0x58, 0x40, 0x58, 0x40, 0xf9, 0x02, 0x90, 0x62, 0xb8, 0x80, 0xe0, 0x61, 0xf8, 0x60, 0xf8, 0xc0, 0xe9, 0x41, 0xf1, 0x20, 0xf8, 0xe0, 0xf9, 0x01, 0xf9, 0x00, 0xf8, 0xc0, 0xc2, 0x70, 0x6a, 0x52, 0x68, 0x64, 0x68, 0x00, 0x70, 0x00, 0x78, 0x00, 0x80, 0x00, 0x88, 0x00, 0x90, 0x00, 0x98, 0x00, 0x98, 0x00, 0xa0, 0x42, 0x88, 0x85, 0x58, 0x65, 0x48, 0x00, 0x38, 0x00, 0x70, 0x21, 0x98, 0x00, 0x80, 0x00, 0x98, 0x60, 0xa8, 0x40, 0x5c, 0x16, 0x5c, 0x37, 0x5c, 0x78, 0x64, 0x99, 0x64, 0xba, 0x64, 0xdb, 0x6d, 0x1c, 0x6d, 0x3d, 0x6d, 0x7e, 0x8c, 0x16, 0xc8, 0x44, 0xd0, 0x43, 0xb3, 0x31, 0x8d, 0x1a, 0x7d, 0xff, 0x7e, 0x1f, 0x7e, 0x1f, 0x7e, 0x1f, 0x7e, 0x1f, 0x7e, 0x3f, 0x76, 0x3f, 0x7e, 0x3f, 0x7e, 0x3f, 0x7e, 0x3f, 0x7e, 0x5f, 0x7e, 0x3f, 0x7e, 0x5f, 0x7e, 0x3f, 0x86, 0x1f, 0x86, 0x1f, 0x7e, 0x3f, 0x86, 0x1f,
-    0x7e, 0x1f, 0x76, 0x5f, 0x76, 0x3f, 0x76, 0x1f, 0x2a, 0x2b, 0x2a, 0x2b, 0xff, 0xff, 0x3a, 0x8c, 0x39, 0x25, 0x38, 0x82, 0xff, 0xff, 0x38, 0x20, 0xff, 0xff, 0x38, 0x20, 0xff, 0xff, 0x40, 0x40, 0xff, 0xff, 0x48, 0x40, 0x48, 0x20, 0x48, 0x41, 0xff, 0xff, 0x48, 0x82, 0x48, 0xa2, 0x48, 0x40, 0xff, 0xff, 0x38, 0x20, 0xff, 0xff, 0x50, 0x61, 0xff, 0xff, 0x58, 0x40, 0x58, 0x40, 0xf9, 0x02, 0xa8, 0x81, 0x70, 0x20, 0xe8, 0x41, 0xf0, 0x81, 0xf8, 0xc1, 0xf1, 0x01, 0xf1, 0x20, 0xf9, 0x20, 0xf9, 0x00, 0xf9, 0x01, 0xf9, 0x01, 0xd2, 0x0d, 0x61, 0xae, 0x60, 0x01, 0x78, 0x00, 0x78, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x90, 0x00, 0x98, 0x00, 0xa0, 0x20, 0xa8, 0x63, 0x88, 0x65, 0x58, 0x43, 0x48, 0x00, 0x68, 0x00, 0xa0, 0x01, 0x90, 0x00, 0xa0, 0x40, 0xa0, 0x40, 0xa0, 0x40, 0x5c, 0x16, 0x54, 0x37, 0x5c, 0x58, 0x5c, 0x99, 0x64, 0xba, 0x64, 0xdb, 0x65, 0x1c, 0x6d, 0x3d, 0x6c, 0xfb, 0x7b, 0x32, 0x9b, 0x93, 0x8d, 0x1b, 0x75, 0xff, 0x76, 0x1f, 0x75, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff,
-    0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7e, 0x1f, 0x7e, 0x1f, 0x7d, 0xff, 0x7e, 0x1f, 0x76, 0x1f, 0x7e, 0x1f, 0x76, 0x1f, 0x76, 0x1f, 0x76, 0x1f, 0x76, 0x1f, 0x76, 0x1f, 0x76, 0x1f, 0x76, 0x1f, 0x76, 0x1f, 0x76, 0x1f, 0x2a, 0x0b, 0x22, 0x2b, 0x32, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0x61, 0x38, 0x20, 0xff, 0xff, 0x40, 0x20, 0xff, 0xff, 0x40, 0x20, 0xff, 0xff, 0x48, 0x40, 0x50, 0x82, 0xff, 0xff, 0x50, 0x61, 0xff, 0xff, 0x48, 0xa2, 0x48, 0x40, 0xff, 0xff, 0x40, 0x20, 0xff, 0xff, 0x50, 0x40, 0xff, 0xff, 0x58, 0x60, 0x58, 0x40, 0xf8, 0xe2, 0xe0, 0xe2, 0x40, 0x00, 0xc8, 0x61, 0xf0, 0x40, 0xf8, 0xa1, 0xf8, 0xc1, 0xf9, 0x21, 0xf1, 0x00, 0xf8, 0xc0, 0xf8, 0xc0, 0xf8, 0xc0, 0xf9, 0x04, 0x78, 0x65, 0x68, 0x00, 0x78, 0x00, 0x80, 0x00, 0x90, 0x00, 0x90, 0x00, 0x88, 0x00, 0x90, 0x00, 0xa0, 0x00, 0xb0, 0x00, 0xa8, 0x43, 0x78, 0x24, 0x50, 0x22, 0x48, 0x00, 0xa0, 0x21, 0xa0, 0x00, 0xa0, 0x20, 0xb0, 0x81, 0xa8, 0x61, 0x60, 0x21, 0x53, 0xf6, 0x54, 0x37, 0x5c, 0x58, 0x5c, 0x99,
-    0x5c, 0xba, 0x64, 0xdb, 0x64, 0xfc, 0x6d, 0x3d, 0x6d, 0x5d, 0x75, 0x7e, 0x6d, 0xbf, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xdf, 0x7d, 0xdf, 0x7d, 0xdf, 0x7d, 0xff, 0x75, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x7e, 0x1f, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x76, 0x1f, 0x75, 0xff, 0x2a, 0x0b, 0x2a, 0x4b, 0xff, 0xff, 0x28, 0x20, 0x30, 0x20, 0x30, 0x20, 0xff, 0xff, 0x38, 0x20, 0xff, 0xff, 0x40, 0x00, 0x40, 0x40, 0x48, 0x40, 0xff, 0xff, 0x50, 0x40, 0xff, 0xff, 0x50, 0x61, 0x48, 0x00, 0x38, 0x82, 0xff, 0xff, 0x48, 0x40, 0xff, 0xff, 0x48, 0x20, 0x48, 0x40, 0x50, 0x40, 0xff, 0xff, 0x58, 0x61, 0x58, 0x40, 0xf8, 0xc1, 0xf8, 0xc3, 0x50, 0xa4, 0x78, 0x21, 0xf0, 0x61, 0xf8, 0xa1, 0xf8, 0x81, 0xf8, 0xe1, 0xf0, 0xe0, 0xf8, 0xc0, 0xf8, 0xa0, 0xf8, 0xa0, 0xf8, 0xe2, 0x90, 0x62, 0x68, 0x00, 0x78, 0x00, 0x88, 0x00, 0x98, 0x00, 0x90, 0x00, 0x88, 0x00, 0x88, 0x00, 0xa0, 0x00, 0xb8, 0x22,
-    0x98, 0x86, 0x68, 0x43, 0x40, 0x20, 0x60, 0x00, 0xa8, 0x00, 0xa8, 0x00, 0xa8, 0x20, 0x90, 0x20, 0x78, 0x20, 0x40, 0x00, 0x53, 0xf6, 0x5c, 0x37, 0x5c, 0x58, 0x5c, 0x79, 0x5c, 0xba, 0x64, 0xdb, 0x64, 0xfc, 0x6d, 0x1d, 0x6d, 0x5e, 0x6d, 0x7f, 0x6d, 0x7f, 0x75, 0x9f, 0x75, 0x9f, 0x75, 0xbf, 0x75, 0xdf, 0x7d, 0xdf, 0x75, 0xdf, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x2a, 0x0b, 0x32, 0x4b, 0xff, 0xff, 0x20, 0x00, 0x28, 0x00, 0x28, 0x00, 0xff, 0xff, 0x40, 0x20, 0xff, 0xff, 0x40, 0x20, 0x40, 0x40, 0x50, 0x40, 0xff, 0xff, 0x50, 0x20, 0x50, 0x40, 0x50, 0x00, 0x40, 0x20, 0x28, 0x00, 0x38, 0x00, 0x48, 0x40, 0xff, 0xff, 0x48, 0x00, 0x48, 0x20, 0x50, 0x40, 0xff, 0xff, 0x58, 0x40, 0x58, 0x40, 0xf8, 0xc1, 0xf8, 0x62, 0x8a, 0xed, 0x48, 0x21, 0xe0, 0x20, 0xf8, 0x61, 0xf8, 0xa1, 0xf8, 0xa0, 0xf9, 0x00,
-    0xf8, 0xe0, 0xf8, 0xe0, 0xf8, 0xc1, 0xf8, 0xc1, 0xd0, 0xc3, 0x70, 0x00, 0x80, 0x00, 0x98, 0x00, 0xa0, 0x00, 0x98, 0x00, 0x90, 0x00, 0x90, 0x00, 0xa0, 0x43, 0xa1, 0x6c, 0x81, 0xf0, 0x51, 0x0a, 0x58, 0x00, 0xa8, 0x00, 0xb0, 0x00, 0xa0, 0x00, 0x88, 0x00, 0x90, 0x20, 0x80, 0x20, 0x58, 0x00, 0x53, 0xf6, 0x54, 0x37, 0x54, 0x58, 0x5c, 0x79, 0x5c, 0x9a, 0x64, 0xdb, 0x64, 0xfc, 0x6d, 0x1d, 0x6d, 0x3e, 0x6d, 0x5f, 0x6d, 0x7f, 0x75, 0x9f, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xdf, 0x7d, 0xdf, 0x75, 0xdf, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x76, 0x1f, 0x2a, 0x2b, 0x31, 0x68, 0x40, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40, 0xc3, 0x38, 0x00, 0x50, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0xc2, 0x50, 0x20, 0x50, 0x40, 0x50, 0x20, 0x30, 0x00, 0x20, 0x00, 0x40, 0x20, 0x48, 0x20, 0x60, 0xe3, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x60, 0xe2, 0x58, 0x20, 0x58, 0x40, 0xf8, 0xa1, 0xf8, 0x41, 0xac, 0x96, 0x4a, 0x6c, 0xc8, 0x00, 0xf0, 0x41, 0xf8, 0x60, 0xf8, 0x80, 0xf0, 0xc0, 0xe8, 0xc0, 0xf8, 0xa0, 0xf9, 0x01, 0xf8, 0xa1, 0xf8, 0xe4, 0x88, 0x00, 0x88, 0x00, 0x98, 0x00, 0xa0, 0x00, 0x98, 0x00, 0x98, 0x00, 0x98, 0x01, 0x99, 0x6b, 0x83, 0x38, 0x6b, 0x9a, 0x51, 0xef, 0x90, 0x01, 0xa8, 0x00, 0x78, 0x00, 0x70, 0x00, 0x88, 0x20, 0x98, 0x00, 0x90, 0x20, 0x70, 0x00, 0x54, 0x17, 0x54, 0x37, 0x5c, 0x58, 0x5c, 0x79, 0x5c, 0x9a, 0x64, 0xdb, 0x64, 0xfc, 0x6d, 0x1d, 0x6d, 0x3e, 0x6d, 0x5e, 0x6d, 0x7f, 0x6d, 0x9f, 0x75, 0x9f, 0x75, 0x9f, 0x75, 0xbf, 0x7d, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x32, 0x6c, 0x38, 0xc4, 0x30, 0x00, 0x28, 0x00, 0x20, 0x00, 0x28, 0x00, 0x28, 0x00, 0x30, 0x00,
-    0x38, 0x20, 0x50, 0x40, 0x50, 0x40, 0x58, 0x40, 0x58, 0x20, 0x58, 0x20, 0x58, 0x40, 0x58, 0x20, 0x20, 0x00, 0x28, 0x00, 0x40, 0x00, 0x48, 0x20, 0x50, 0x20, 0x48, 0x40, 0x48, 0x60, 0x58, 0x40, 0x58, 0x20, 0x58, 0x20, 0x60, 0x60, 0xf9, 0x02, 0xf8, 0x20, 0xb3, 0xd4, 0x6c, 0xf9, 0xc8, 0x00, 0xf0, 0x40, 0xf8, 0x40, 0xf8, 0x81, 0xe8, 0x60, 0xf0, 0xa0, 0xf8, 0xa0, 0xf8, 0x80, 0xf8, 0xa1, 0xf0, 0xc3, 0x90, 0x00, 0x98, 0x00, 0xa0, 0x00, 0xa0, 0x00, 0x98, 0x00, 0x98, 0x42, 0x91, 0x6b, 0x83, 0x16, 0x6c, 0x5e, 0x5c, 0x7f, 0x69, 0xad, 0xa0, 0x00, 0x70, 0x00, 0x58, 0x00, 0x78, 0x00, 0x98, 0x20, 0xa0, 0x20, 0xa0, 0x00, 0x80, 0x00, 0x53, 0xf7, 0x54, 0x17, 0x54, 0x38, 0x5c, 0x79, 0x5c, 0x9a, 0x64, 0xdb, 0x64, 0xfc, 0x65, 0x1d, 0x6d, 0x3e, 0x6d, 0x5e, 0x6d, 0x7f, 0x6d, 0x9f, 0x75, 0x9f, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff,
-    0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x76, 0x5f, 0x73, 0xb4, 0x48, 0x01, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x28, 0x00, 0x20, 0x00, 0x28, 0x00, 0x40, 0x20, 0x50, 0x40, 0x50, 0x40, 0x58, 0x60, 0x58, 0x40, 0x58, 0x40, 0x58, 0x40, 0x50, 0x20, 0x10, 0x00, 0x30, 0x00, 0x48, 0x00, 0x48, 0x20, 0x50, 0x40, 0x50, 0x20, 0x50, 0x40, 0x58, 0x60, 0x58, 0x20, 0x60, 0x20, 0xc0, 0x81, 0xf8, 0x81, 0xf8, 0x20, 0xab, 0xf5, 0x6e, 0x5f, 0xba, 0xb0, 0xe8, 0x00, 0xf0, 0x20, 0xf8, 0x81, 0xd0, 0x40, 0xf8, 0x40, 0xf0, 0xa0, 0xf8, 0x80, 0xf8, 0x60, 0xf8, 0xc2, 0xb0, 0x21, 0x98, 0x00, 0xa0, 0x00, 0xa0, 0x00, 0x98, 0x65, 0x91, 0xce, 0x7b, 0x59, 0x6c, 0x5f, 0x5c, 0xdf, 0x5c, 0x5e, 0x80, 0xc7, 0x80, 0x01, 0x48, 0x00, 0x60, 0x00, 0x78, 0x00, 0x98, 0x20, 0xa8, 0x20, 0xa0, 0x20, 0x88, 0x20, 0x53, 0xf7, 0x54, 0x17, 0x54, 0x38, 0x5c, 0x79, 0x5c, 0x9a, 0x64, 0xbb, 0x64, 0xfc, 0x65, 0x1d, 0x6d, 0x3e, 0x6d, 0x5e, 0x6d, 0x7f, 0x75, 0x9f, 0x75, 0x9f, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xbf,
-    0x75, 0xdf, 0x75, 0xdf, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x76, 0x1f, 0x76, 0x7f, 0xb2, 0x8e, 0xc0, 0x00, 0xa8, 0x21, 0xa0, 0x00, 0x90, 0x00, 0x78, 0x00, 0x80, 0x20, 0xa8, 0x61, 0xe0, 0xa1, 0xf8, 0x80, 0xf8, 0xc1, 0xf8, 0xe2, 0xf8, 0x81, 0xf8, 0xa1, 0xf9, 0x02, 0xc0, 0xa3, 0x30, 0x21, 0xb8, 0x40, 0xd8, 0x40, 0xe0, 0x61, 0xf0, 0x40, 0xf0, 0xa0, 0xe8, 0xc1, 0xf9, 0x01, 0xf8, 0xc1, 0xf8, 0x80, 0xf8, 0x60, 0xf8, 0x81, 0xf8, 0x20, 0xab, 0xf6, 0x66, 0x1f, 0x75, 0xff, 0xca, 0x6e, 0xf0, 0x00, 0xf0, 0x60, 0xe8, 0x00, 0xf8, 0x40, 0xf8, 0xa0, 0xf8, 0x80, 0xf8, 0x60, 0xf8, 0x62, 0xc8, 0x42, 0x98, 0x00, 0xa0, 0x00, 0xa0, 0xc7, 0x92, 0x32, 0x7b, 0xbb, 0x6c, 0xbf, 0x54, 0xff, 0x54, 0xff, 0x5c, 0x7e, 0x69, 0x4a, 0x58, 0x64, 0x48, 0x00, 0x60, 0x00, 0x80, 0x00, 0xa0, 0x20, 0xa8, 0x20, 0xa0, 0x20, 0x78, 0x20, 0x53, 0xf6, 0x54, 0x17,
-    0x54, 0x58, 0x5c, 0x79, 0x5c, 0x9a, 0x64, 0xbb, 0x64, 0xfc, 0x65, 0x1d, 0x6d, 0x3e, 0x6d, 0x5f, 0x6d, 0x7f, 0x6d, 0x7f, 0x75, 0x9f, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xdf, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x76, 0x5f, 0x94, 0x57, 0xb0, 0x22, 0xb0, 0x20, 0x98, 0x00, 0x98, 0x00, 0x98, 0x20, 0x88, 0x20, 0xa0, 0x40, 0xd8, 0x61, 0xf0, 0x81, 0xf8, 0x60, 0xf8, 0xc1, 0xf9, 0x02, 0xf8, 0xc2, 0xf8, 0xa1, 0xf8, 0xe2, 0x80, 0x61, 0x60, 0x00, 0xc8, 0x80, 0xd8, 0x81, 0xe8, 0x20, 0xf8, 0x41, 0xe8, 0xc0, 0xf1, 0x01, 0xf8, 0xe1, 0xf8, 0xa1, 0xf8, 0x81, 0xf8, 0x60, 0xf8, 0x81, 0xf8, 0x82, 0x84, 0xfb, 0x6d, 0xdf, 0x5d, 0xdf, 0x85, 0x7f, 0xd1, 0xcb, 0xe8, 0x00, 0xf0, 0x00, 0xf0, 0x20, 0xf8, 0x80, 0xf8, 0x60, 0xf8, 0x60, 0xf8, 0x21, 0xe0, 0x23, 0x98, 0x44, 0x99, 0x4b, 0x8a, 0xd5, 0x7c, 0x1d, 0x64, 0xdf, 0x55, 0x1f,
-    0x54, 0xff, 0x54, 0xdf, 0x5c, 0x7e, 0x5a, 0x95, 0x48, 0xe9, 0x50, 0x00, 0x68, 0x00, 0x88, 0x00, 0xa0, 0x00, 0xa8, 0x20, 0x88, 0x00, 0x60, 0x00, 0x53, 0xf6, 0x54, 0x17, 0x54, 0x38, 0x5c, 0x59, 0x5c, 0x9a, 0x64, 0xbb, 0x64, 0xdc, 0x65, 0x1d, 0x6d, 0x3e, 0x6d, 0x5f, 0x6d, 0x7f, 0x6d, 0x7f, 0x75, 0x9f, 0x75, 0x9f, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x76, 0x1f, 0x85, 0xbe, 0x88, 0xa4, 0x98, 0x00, 0x98, 0x00, 0x98, 0x00, 0xa8, 0x00, 0xa0, 0x00, 0xa0, 0x20, 0xc8, 0xa1, 0xe8, 0x40, 0xf8, 0x41, 0xf8, 0x81, 0xf8, 0xc1, 0xf8, 0xe2, 0xf8, 0x81, 0xf8, 0xa1, 0xf8, 0xc2, 0x70, 0x41, 0x88, 0x20, 0xd0, 0x40, 0xd8, 0x00, 0xf0, 0x40, 0xf0, 0x60, 0xe8, 0xe0, 0xf9, 0x41, 0xf9, 0x01, 0xf8, 0xa1, 0xf8, 0xc1, 0xf8, 0xa1, 0xf8, 0x81, 0xf8, 0xa3, 0x7d, 0x5e, 0x65, 0xbf, 0x6d, 0x9f, 0x65, 0xdf, 0x7d, 0x9f,
-    0xd1, 0xed, 0xe8, 0x01, 0xe0, 0x40, 0xf8, 0x20, 0xf8, 0x40, 0xf8, 0x40, 0xf8, 0x20, 0xf8, 0x64, 0xa2, 0x32, 0x7b, 0xba, 0x6c, 0x9f, 0x65, 0x1f, 0x5d, 0x3f, 0x5c, 0xff, 0x54, 0xdf, 0x54, 0xdf, 0x54, 0x9f, 0x5b, 0x9a, 0x51, 0x6c, 0x50, 0x00, 0x60, 0x00, 0x88, 0x00, 0x98, 0x00, 0x80, 0x00, 0x58, 0x00, 0x38, 0x01, 0x53, 0xf6, 0x54, 0x17, 0x54, 0x38, 0x5c, 0x59, 0x5c, 0x7a, 0x5c, 0x9b, 0x64, 0xdc, 0x65, 0x1d, 0x6d, 0x3e, 0x6d, 0x5f, 0x6d, 0x5f, 0x6d, 0x7f, 0x6d, 0x9f, 0x75, 0x9f, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x7e, 0x5f, 0x8b, 0x32, 0x80, 0x00, 0x68, 0x00, 0x38, 0x00, 0x40, 0x00, 0x40, 0x00, 0x38, 0x20, 0x40, 0x00, 0x48, 0x20, 0x50, 0x00, 0x58, 0x00, 0x58, 0x20, 0x58, 0x40, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x50, 0x41, 0x20, 0x20, 0x30, 0x00, 0x40, 0x00, 0x50, 0x00, 0x50, 0x00,
-    0x58, 0x20, 0x50, 0x40, 0x50, 0x60, 0x58, 0x60, 0x58, 0x40, 0x58, 0x20, 0xb0, 0x81, 0xf8, 0x60, 0xf8, 0xc4, 0x7d, 0x5f, 0x65, 0xbf, 0x6d, 0x9f, 0x65, 0x9f, 0x65, 0xdf, 0x8c, 0xbf, 0xd1, 0x6b, 0xe8, 0x00, 0xf8, 0x00, 0xf8, 0x40, 0xf8, 0x40, 0xf8, 0x20, 0xf8, 0x85, 0x9b, 0xba, 0x65, 0x3f, 0x5d, 0x5f, 0x5d, 0x3f, 0x55, 0x1f, 0x5c, 0xff, 0x54, 0xdf, 0x54, 0xdf, 0x4c, 0xbf, 0x54, 0x1d, 0x5a, 0x32, 0x50, 0x44, 0x60, 0x00, 0x78, 0x00, 0x70, 0x00, 0x50, 0x00, 0x28, 0x00, 0x20, 0x00, 0x53, 0xf6, 0x54, 0x17, 0x54, 0x38, 0x5c, 0x59, 0x5c, 0x7a, 0x5c, 0x9b, 0x64, 0xdc, 0x64, 0xfd, 0x65, 0x3e, 0x6d, 0x5f, 0x6d, 0x5f, 0x6d, 0x7f, 0x6d, 0x9f, 0x75, 0x9f, 0x75, 0x9f, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x76, 0x1f, 0x8d, 0x9d, 0x80, 0x83, 0x98, 0x00, 0xa8, 0x00, 0xa8, 0x20, 0x60, 0x00, 0x48, 0x00, 0x48, 0x00, 0x50, 0x20,
-    0x50, 0x00, 0x50, 0x00, 0x58, 0x20, 0x58, 0x20, 0x58, 0x40, 0x58, 0x20, 0x58, 0x00, 0x58, 0x20, 0x39, 0x66, 0x28, 0x41, 0x38, 0x00, 0x40, 0x00, 0x50, 0x20, 0x58, 0x20, 0x58, 0x40, 0x50, 0x40, 0x58, 0x40, 0x58, 0x40, 0x70, 0x60, 0xe0, 0xa1, 0xf8, 0xc2, 0xf8, 0x60, 0xe1, 0xcb, 0x6d, 0xdf, 0x65, 0xbf, 0x65, 0x9f, 0x6d, 0x9f, 0x75, 0x1f, 0x83, 0x9b, 0xa9, 0x6d, 0xe8, 0x65, 0xf8, 0x85, 0xf8, 0x21, 0xf8, 0x40, 0xf8, 0x00, 0xf8, 0x85, 0x9c, 0x5a, 0x55, 0x9f, 0x5d, 0x3f, 0x5d, 0x1f, 0x54, 0xff, 0x54, 0xff, 0x54, 0xdf, 0x54, 0xdf, 0x54, 0xbf, 0x5c, 0x3e, 0x62, 0xb5, 0x58, 0xa6, 0x50, 0x00, 0x48, 0x00, 0x38, 0x00, 0x20, 0x00, 0x20, 0x00, 0x28, 0x00, 0x4b, 0xd6, 0x54, 0x17, 0x54, 0x38, 0x54, 0x59, 0x5c, 0x7a, 0x5c, 0x9b, 0x64, 0xdc, 0x64, 0xfd, 0x65, 0x1e, 0x6d, 0x5f, 0x6d, 0x5f, 0x6d, 0x5f, 0x75, 0x7f, 0x75, 0x9f, 0x75, 0x9f, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff,
-    0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x76, 0x5f, 0x93, 0xf5, 0x90, 0x00, 0xa8, 0x00, 0xb8, 0x21, 0xd0, 0x61, 0xd0, 0x40, 0x78, 0x20, 0x50, 0x20, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x58, 0x20, 0x58, 0x20, 0x58, 0x20, 0x58, 0x00, 0x58, 0x00, 0x48, 0xc4, 0x2a, 0x0a, 0x28, 0x21, 0x38, 0x00, 0x40, 0x00, 0x48, 0x00, 0x50, 0x20, 0x58, 0x40, 0x50, 0x40, 0x58, 0x40, 0x90, 0x60, 0xf8, 0xc1, 0xf9, 0x02, 0xf8, 0xe2, 0xf8, 0x80, 0xc3, 0x31, 0x65, 0xff, 0x65, 0x9f, 0x65, 0x9f, 0x75, 0x1f, 0x8b, 0xbc, 0xa1, 0xf2, 0xb0, 0xcb, 0xa9, 0xf0, 0xb3, 0x37, 0xe1, 0x8c, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0xd1, 0xcc, 0x65, 0x5f, 0x5d, 0x3f, 0x5d, 0x1f, 0x55, 0x1f, 0x54, 0xff, 0x54, 0xdf, 0x5c, 0xbf, 0x5c, 0x3e, 0x6b, 0x59, 0x69, 0xf1, 0x50, 0x65, 0x38, 0x00, 0x28, 0x00, 0x18, 0x00, 0x18, 0x20, 0x20, 0x20, 0x28, 0x00, 0x4b, 0xd6, 0x54, 0x17, 0x54, 0x38, 0x54, 0x59, 0x5c, 0x7b, 0x64, 0xbb, 0x64, 0xdc, 0x64, 0xfd, 0x65, 0x1e, 0x65, 0x3f, 0x6d, 0x5f, 0x6d, 0x7f, 0x6d, 0x7f, 0x6d, 0x9f,
-    0x75, 0x9f, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x75, 0xff, 0x7e, 0x3f, 0x99, 0xeb, 0xa8, 0x00, 0xc0, 0x21, 0xc8, 0x20, 0xd0, 0x20, 0xd8, 0x60, 0xf0, 0x61, 0xb8, 0x21, 0x60, 0x00, 0x58, 0x00, 0x50, 0x00, 0x58, 0x00, 0x58, 0x20, 0x58, 0x00, 0x58, 0x00, 0x50, 0x82, 0x2a, 0x0a, 0x29, 0xea, 0x30, 0x21, 0x38, 0x00, 0x48, 0x00, 0x48, 0x00, 0x50, 0x20, 0x58, 0x20, 0x58, 0x40, 0xb8, 0xa1, 0xf8, 0xc1, 0xf8, 0xa1, 0xf8, 0xe2, 0xf8, 0xa1, 0xf8, 0x40, 0xb3, 0x74, 0x5d, 0xff, 0x65, 0x9f, 0x6d, 0x3f, 0x83, 0xfd, 0x9a, 0x54, 0xa9, 0x8f, 0x9a, 0x94, 0x8c, 0x1d, 0x6d, 0x5f, 0x94, 0xbd, 0xf1, 0x4a, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x23, 0x7c, 0xbd, 0x55, 0x5f, 0x5d, 0x1f, 0x54, 0xff, 0x5c, 0xff, 0x5c, 0xbf, 0x6b, 0xfd, 0x72, 0xf7, 0x71, 0xcf, 0x68, 0x86, 0x50, 0x01, 0x28, 0x00, 0x18, 0x20, 0x18, 0x20, 0x20, 0x20, 0x30, 0x00, 0x30, 0x00,
-    0x4b, 0xd6, 0x54, 0x17, 0x54, 0x38, 0x54, 0x59, 0x5c, 0x7a, 0x5c, 0x9b, 0x64, 0xbc, 0x64, 0xfd, 0x65, 0x1e, 0x65, 0x3e, 0x6d, 0x5f, 0x6d, 0x5f, 0x6d, 0x7f, 0x6d, 0x9f, 0x6d, 0x9f, 0x75, 0x9f, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x6d, 0xdf, 0x75, 0xdf, 0x6d, 0xff, 0x85, 0xbe, 0xb8, 0xa4, 0xd0, 0x00, 0xd0, 0x20, 0xd0, 0x00, 0xd8, 0x20, 0xf8, 0xc2, 0xf8, 0x61, 0xf8, 0x01, 0xe0, 0x01, 0x70, 0x20, 0x58, 0x00, 0x50, 0x00, 0x58, 0x00, 0x58, 0x00, 0x48, 0xa3, 0x31, 0xa9, 0x22, 0x2b, 0x29, 0xea, 0x38, 0x21, 0x38, 0x00, 0x40, 0x20, 0x48, 0x00, 0x50, 0x00, 0x70, 0x20, 0xd8, 0xa0, 0xf8, 0xc1, 0xf8, 0xc1, 0xf8, 0xc1, 0xf8, 0xe2, 0xf8, 0x81, 0xf8, 0x83, 0x94, 0xbb, 0x5d, 0xdf, 0x6d, 0x7f, 0x7c, 0x5f, 0x92, 0xd6, 0x9a, 0x32, 0x93, 0x17, 0x84, 0x7f, 0x6d, 0x5f, 0x65, 0x7f, 0x5d, 0xbf, 0x8d, 0x1f, 0xe1, 0x4a, 0xf8, 0x03, 0xf8, 0x00, 0xab, 0x76, 0x5d, 0x5f, 0x5d, 0x1f,
-    0x5d, 0x1f, 0x64, 0xbf, 0x73, 0xbc, 0x7a, 0x74, 0x89, 0x0b, 0x78, 0x23, 0x68, 0x00, 0x50, 0x00, 0x30, 0x00, 0x28, 0x20, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x4b, 0xd6, 0x53, 0xf7, 0x54, 0x38, 0x54, 0x59, 0x5c, 0x7a, 0x5c, 0x9b, 0x5c, 0xbc, 0x64, 0xdd, 0x65, 0x1e, 0x65, 0x3f, 0x6d, 0x3f, 0x6d, 0x5f, 0x6d, 0x7f, 0x6d, 0x7f, 0x6d, 0x9f, 0x6d, 0x9f, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x75, 0xdf, 0x76, 0x3f, 0xa3, 0xd4, 0xd8, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe8, 0x20, 0xf8, 0x61, 0xf8, 0xa2, 0xf8, 0x82, 0xf8, 0x21, 0xf8, 0x21, 0xf8, 0x42, 0x98, 0x00, 0x58, 0x00, 0x58, 0x00, 0x40, 0xc4, 0x2a, 0x0b, 0x22, 0x2b, 0x22, 0x0b, 0x29, 0xeb, 0x38, 0x62, 0x40, 0x00, 0x40, 0x00, 0x48, 0x00, 0x88, 0x20, 0xf8, 0xa0, 0xf8, 0xe1, 0xf8, 0xe2, 0xf8, 0xa1, 0xf8, 0x82, 0xf8, 0xe1, 0xf8, 0x60, 0xe9, 0xa9, 0x75, 0x9f, 0x65, 0x9f, 0x74, 0xbf, 0x8b, 0x59,
-    0x92, 0x95, 0x8b, 0x79, 0x7c, 0xdf, 0x65, 0x7f, 0x65, 0x7f, 0x65, 0x5f, 0x65, 0x5f, 0x5d, 0xbf, 0x84, 0x9d, 0xc2, 0xd4, 0xf8, 0x00, 0xf0, 0x84, 0x7c, 0xbe, 0x5d, 0x3f, 0x64, 0xbf, 0x73, 0xbb, 0x82, 0x12, 0x88, 0xa8, 0x80, 0x01, 0x78, 0x00, 0x60, 0x00, 0x58, 0x00, 0x58, 0x00, 0x60, 0x00, 0x58, 0x00, 0x40, 0x00, 0x30, 0x00, 0x28, 0x20, 0x4b, 0xd6, 0x53, 0xf7, 0x54, 0x38, 0x54, 0x59, 0x5c, 0x7a, 0x5c, 0x9b, 0x5c, 0xbc, 0x64, 0xfd, 0x65, 0x1e, 0x65, 0x3e, 0x65, 0x3f, 0x6d, 0x5f, 0x6d, 0x7f, 0x6d, 0x7f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0x9f, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xbf, 0x75, 0xdf, 0x6d, 0xdf, 0x6d, 0xdf, 0x6d, 0xdf, 0x6d, 0xdf, 0x6d, 0xdf, 0x6d, 0xdf, 0x6d, 0xdf, 0x6d, 0xdf, 0x75, 0xdf, 0x6d, 0xff, 0x76, 0x1f, 0xc9, 0x8a, 0xe0, 0x00, 0xe8, 0x00, 0xf0, 0x00, 0xf8, 0x41, 0xf8, 0x62, 0xf8, 0x42, 0xf8, 0x82, 0xf8, 0x22, 0xf8, 0x21, 0xf8, 0x00, 0xf8, 0x00, 0xc0, 0x84, 0x41, 0x47, 0x29, 0xeb, 0x22, 0x0b, 0x21, 0xeb, 0x21, 0xeb, 0x22, 0x0b, 0x39, 0x06, 0x40, 0x00, 0x48, 0x00,
-    0x98, 0x00, 0xe0, 0x40, 0xf8, 0x81, 0xf0, 0xa0, 0xf9, 0x02, 0xf8, 0xc1, 0xf8, 0x82, 0xf8, 0xa1, 0xf8, 0x62, 0xab, 0xb5, 0x65, 0xdf, 0x6d, 0x5f, 0x7c, 0x3e, 0x83, 0x38, 0x83, 0x7a, 0x74, 0xbf, 0x65, 0x7f, 0x65, 0x7f, 0x65, 0x5f, 0x65, 0x5f, 0x65, 0x5f, 0x65, 0x5f, 0x5d, 0x7f, 0x6d, 0x7f, 0xf1, 0x29, 0xf8, 0x00, 0xab, 0x16, 0x64, 0x9f, 0x73, 0x79, 0x8a, 0x12, 0x88, 0xa7, 0x88, 0x00, 0x78, 0x00, 0x68, 0x00, 0x58, 0x00, 0x58, 0x00, 0x68, 0x00, 0x80, 0x00, 0x78, 0x00, 0x50, 0x00, 0x30, 0x00, 0x20, 0x20, 0x4b, 0xd6, 0x4b, 0xf7, 0x54, 0x18, 0x54, 0x39, 0x5c, 0x7a, 0x5c, 0x9b, 0x5c, 0xbc, 0x5c, 0xdd, 0x65, 0x1d, 0x65, 0x1e, 0x65, 0x3f, 0x6d, 0x5f, 0x6d, 0x7f, 0x6d, 0x7f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0xbf, 0x6d, 0xbf, 0x6d, 0xbf, 0x6d, 0xbf, 0x6d, 0xbf, 0x6d, 0xdf, 0x6d, 0xbf, 0x6d, 0xdf, 0x6d, 0xbf, 0x6d, 0xdf, 0x6d, 0xbf, 0x6d, 0xbf, 0x75, 0xbf, 0x6d, 0xff, 0x8d, 0x5e, 0xf0, 0xc6, 0xf8, 0x00, 0xf8, 0x01, 0xf8, 0x21, 0xf8, 0x62, 0xf8, 0x22, 0xf8, 0x21, 0xf8, 0x42,
-    0xf8, 0x01, 0xf8, 0x00, 0xf8, 0x43, 0xe9, 0x48, 0xa3, 0xf6, 0x5d, 0xbd, 0x2a, 0xcf, 0x21, 0xeb, 0x21, 0xeb, 0x21, 0xeb, 0x22, 0x0b, 0x39, 0x68, 0x60, 0x00, 0xb8, 0x00, 0xc8, 0x00, 0xd8, 0x00, 0xe8, 0x40, 0xf8, 0x80, 0xf8, 0xa1, 0xf8, 0xc2, 0xf8, 0x82, 0xf8, 0x81, 0xf9, 0x48, 0x75, 0x7f, 0x65, 0x9f, 0x6d, 0x3f, 0x74, 0x7f, 0x7b, 0xfe, 0x6c, 0xdf, 0x65, 0x7f, 0x65, 0x5f, 0x65, 0x5f, 0x65, 0x5f, 0x65, 0x3f, 0x64, 0xff, 0x6c, 0x7f, 0x6c, 0x5f, 0x64, 0xbf, 0xba, 0xb5, 0xf8, 0x01, 0xe8, 0xe9, 0x8a, 0x74, 0x89, 0x6d, 0x90, 0x65, 0x88, 0x00, 0x78, 0x00, 0x68, 0x00, 0x60, 0x00, 0x50, 0x00, 0x50, 0x00, 0x68, 0x00, 0x88, 0x00, 0x80, 0x00, 0x50, 0x00, 0x30, 0x00, 0x28, 0x00, 0x4b, 0xd6, 0x4b, 0xf7, 0x54, 0x18, 0x54, 0x39, 0x5c, 0x5a, 0x5c, 0x9b, 0x5c, 0xbc, 0x5c, 0xdc, 0x64, 0xfd, 0x65, 0x1e, 0x65, 0x3f, 0x6d, 0x5f, 0x6d, 0x5f, 0x6d, 0x7f, 0x6d, 0x7f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0xbf, 0x6d, 0xbf, 0x6d, 0xbf, 0x6d, 0xbf, 0x6d, 0xbf, 0x6d, 0xbf, 0x6d, 0xbf,
-    0x6d, 0xbf, 0x6d, 0xbf, 0x6d, 0xbf, 0x6d, 0xbf, 0x6d, 0xff, 0xbb, 0x95, 0xf8, 0x02, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x62, 0xf8, 0x42, 0xf8, 0x42, 0xf8, 0x41, 0xf8, 0x01, 0xf8, 0x00, 0xf8, 0x84, 0xbb, 0x12, 0x7d, 0x3c, 0x65, 0xff, 0x65, 0xbf, 0x6d, 0x7f, 0x43, 0x73, 0x21, 0xeb, 0x21, 0xeb, 0x22, 0x0b, 0x5a, 0xf1, 0xd0, 0x42, 0xd0, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xd8, 0x20, 0xf8, 0x81, 0xf8, 0x81, 0xf8, 0x82, 0xf8, 0x61, 0xf8, 0x40, 0xca, 0xb1, 0x5d, 0xbf, 0x65, 0x5f, 0x65, 0x3f, 0x6c, 0xff, 0x6c, 0xff, 0x65, 0x5f, 0x5d, 0x5f, 0x65, 0x5f, 0x65, 0x5f, 0x5d, 0x3f, 0x64, 0xdf, 0x74, 0x1d, 0x7b, 0x5a, 0x7a, 0xf7, 0x7a, 0xd7, 0x8a, 0x94, 0xe0, 0xca, 0xf8, 0x00, 0xd0, 0x46, 0x88, 0x46, 0x88, 0x02, 0x80, 0x02, 0x70, 0x02, 0x68, 0x01, 0x58, 0x01, 0x48, 0x00, 0x48, 0x00, 0x60, 0x00, 0x80, 0x00, 0x80, 0x00, 0x50, 0x00, 0x38, 0x00, 0x30, 0x21, 0x4b, 0xb6, 0x4b, 0xf7, 0x4c, 0x18, 0x54, 0x39, 0x54, 0x5a, 0x5c, 0x9b, 0x5c, 0xbb, 0x5c, 0xbc, 0x5c, 0xdd, 0x64, 0xfe, 0x65, 0x1e, 0x65, 0x3f,
-    0x65, 0x5f, 0x6d, 0x5f, 0x6d, 0x7f, 0x6d, 0x7f, 0x6d, 0x7f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0xbf, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0xbf, 0x6d, 0xbf, 0x6d, 0xbf, 0x6d, 0xbf, 0x6d, 0xff, 0xc2, 0xd2, 0xf8, 0x02, 0xf8, 0x00, 0xf8, 0x21, 0xf8, 0x62, 0xf8, 0x02, 0xf8, 0x01, 0xf8, 0x63, 0xf9, 0x28, 0xda, 0x0c, 0xa3, 0xf7, 0x6d, 0xdf, 0x65, 0xff, 0x6d, 0x9f, 0x6d, 0x9f, 0x65, 0x9f, 0x65, 0x7f, 0x54, 0x59, 0x2a, 0x6e, 0x54, 0x79, 0x7d, 0x5f, 0xc9, 0x07, 0xc8, 0x00, 0xc8, 0x00, 0xd0, 0x00, 0xe0, 0x20, 0xf8, 0x81, 0xf8, 0x81, 0xf8, 0x61, 0xf8, 0x61, 0xf8, 0x42, 0x94, 0x7a, 0x5d, 0x9f, 0x65, 0x5f, 0x65, 0x5f, 0x65, 0x3f, 0x65, 0x5f, 0x5d, 0x5f, 0x5d, 0x3f, 0x65, 0x3f, 0x65, 0x3f, 0x5d, 0x3f, 0x64, 0xdf, 0x6c, 0x1e, 0x7b, 0x5a, 0x7a, 0xf7, 0x82, 0x95, 0x82, 0x52, 0x91, 0xf1, 0xf8, 0x25, 0xf8, 0x02, 0x89, 0x8e, 0x71, 0xcf, 0x79, 0xae, 0x71, 0xad, 0x61, 0x4c, 0x51, 0x2b, 0x49, 0x09, 0x48, 0xc7, 0x60, 0x43, 0x88, 0x01, 0x70, 0x22, 0x50, 0x64,
-    0x40, 0xa6, 0x39, 0x07, 0x4b, 0xb6, 0x4b, 0xd7, 0x54, 0x18, 0x54, 0x38, 0x54, 0x59, 0x5c, 0x7b, 0x5c, 0x9b, 0x5c, 0xbc, 0x5c, 0xdd, 0x64, 0xfd, 0x65, 0x1e, 0x65, 0x3f, 0x65, 0x5f, 0x65, 0x5f, 0x6d, 0x5f, 0x6d, 0x7f, 0x6d, 0x7f, 0x6d, 0x7f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0xbf, 0x75, 0xdf, 0xca, 0xf2, 0xf8, 0x22, 0xf8, 0x01, 0xf8, 0x21, 0xf8, 0x02, 0xf8, 0x22, 0xf9, 0x49, 0xbb, 0x53, 0x94, 0x7a, 0x75, 0x7f, 0x65, 0xff, 0x65, 0xbf, 0x6d, 0x7f, 0x6d, 0x7f, 0x6d, 0x7f, 0x6d, 0x7f, 0x65, 0x7f, 0x65, 0x7f, 0x65, 0x7f, 0x65, 0x7f, 0x75, 0xdf, 0xc1, 0xac, 0xc8, 0x00, 0xc8, 0x20, 0xd8, 0x00, 0xe8, 0x20, 0xf8, 0xa1, 0xf8, 0x82, 0xf8, 0x41, 0xf8, 0x42, 0xe9, 0x6b, 0x6d, 0x7f, 0x5d, 0x5f, 0x65, 0x5f, 0x65, 0x3f, 0x5d, 0x3f, 0x5d, 0x3f, 0x5d, 0x3f, 0x5d, 0x3f, 0x5d, 0x3f, 0x5d, 0x3f, 0x5d, 0x3f, 0x5d, 0x1f, 0x64, 0xdf, 0x6c, 0x9f, 0x6c, 0x5e, 0x74, 0x1e, 0x73, 0xbc, 0x6b, 0xbb,
-    0xa2, 0xd5, 0xf8, 0x25, 0xba, 0x11, 0x64, 0x1d, 0x63, 0xbb, 0x63, 0x9a, 0x5b, 0x59, 0x53, 0x38, 0x4a, 0xf7, 0x52, 0x73, 0x69, 0x4c, 0x80, 0x86, 0x69, 0x2a, 0x49, 0xef, 0x4a, 0x31, 0x41, 0xef, 0x4b, 0xb6, 0x4b, 0xd6, 0x4b, 0xf7, 0x54, 0x18, 0x54, 0x59, 0x54, 0x7a, 0x5c, 0x9b, 0x5c, 0xbc, 0x5c, 0xdd, 0x64, 0xfd, 0x65, 0x1e, 0x65, 0x3f, 0x65, 0x3f, 0x65, 0x5f, 0x6d, 0x5f, 0x6d, 0x7f, 0x6d, 0x7f, 0x6d, 0x7f, 0x6d, 0x7f, 0x6d, 0x7f, 0x6d, 0x9f, 0x6d, 0x7f, 0x6d, 0x7f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0x9f, 0x6d, 0x7f, 0x6d, 0x9f, 0x65, 0xdf, 0x9c, 0x3a, 0xf8, 0x65, 0xf8, 0x00, 0xf8, 0x01, 0xf8, 0x02, 0xe9, 0xac, 0xca, 0xd1, 0x8c, 0x9b, 0x65, 0xdf, 0x65, 0xdf, 0x65, 0xbf, 0x65, 0x7f, 0x6d, 0x7f, 0x65, 0x7f, 0x65, 0x7f, 0x65, 0x7f, 0x6d, 0x5f, 0x65, 0x5f, 0x65, 0x5f, 0x65, 0x7f, 0x65, 0x7f, 0x65, 0xbf, 0xa3, 0x13, 0xc8, 0x22, 0xd8, 0x00, 0xe8, 0x00, 0xe8, 0x40, 0xf8, 0x61, 0xf8, 0x42, 0xf8, 0x01, 0xe1, 0xac, 0x8c, 0x19, 0x5d, 0x9f, 0x65, 0x3f, 0x65, 0x3f, 0x5d, 0x3f,
-    0x5d, 0x3f, 0x5d, 0x1f, 0x5d, 0x1f, 0x5d, 0x1f, 0x5d, 0x1f, 0x5d, 0x1f, 0x5d, 0x1f, 0x5d, 0x1f, 0x5d, 0x1f, 0x5d, 0x1f, 0x5d, 0x1f, 0x5c, 0xff, 0x5c, 0xdf, 0x54, 0xdf, 0x54, 0xff, 0xb2, 0xb3, 0xd1, 0x2a, 0x5c, 0xbf, 0x4c, 0x9f, 0x54, 0x7f, 0x54, 0x5e, 0x54, 0x3d, 0x4c, 0x1d, 0x53, 0xba, 0x6a, 0x52, 0x79, 0x6d, 0x62, 0x52, 0x43, 0x37, 0x42, 0xf6, 0x3a, 0x10, 0x4b, 0xb6, 0x4b, 0xb7, 0x4b, 0xf7, 0x54, 0x18, 0x54, 0x39, 0x54, 0x5a, 0x5c, 0x7b, 0x5c, 0xbc, 0x5c, 0xbc, 0x5c, 0xdd, 0x64, 0xfe, 0x65, 0x1f, 0x65, 0x1f, 0x65, 0x3f, 0x65, 0x5f, 0x65, 0x5f, 0x6d, 0x5f, 0x6d, 0x7f, 0x6d, 0x7f, 0x6d, 0x7f, 0x6d, 0x7f, 0x65, 0x7f, 0x6d, 0x7f, 0x6d, 0x7f, 0x6d, 0x7f, 0x6d, 0x7f, 0x6d, 0x7f, 0x65, 0x9f, 0x65, 0x9f, 0x65, 0xff, 0xc2, 0xd4, 0xf8, 0x01, 0xf8, 0x00, 0xf8, 0x01, 0xd9, 0xcc, 0x7d, 0x1d, 0x6d, 0x9f, 0x65, 0xdf, 0x65, 0x9f, 0x65, 0x7f, 0x6d, 0x5f, 0x6d, 0x5f, 0x65, 0x5f, 0x65, 0x5f, 0x65, 0x5f, 0x65, 0x5f, 0x65, 0x5f, 0x65, 0x5f, 0x65, 0x5f, 0x65, 0x5f, 0x65, 0x5f, 0x65, 0x7f,
-    0x7c, 0xfe, 0xd1, 0x09, 0xe0, 0x00, 0xe0, 0x00, 0xf0, 0x40, 0xf8, 0x61, 0xf8, 0x21, 0xf8, 0x01, 0xa3, 0x97, 0x55, 0x9f, 0x5d, 0x3f, 0x65, 0x3f, 0x5d, 0x1f, 0x5d, 0x1f, 0x5d, 0x1f, 0x5d, 0x1f, 0x5d, 0x1f, 0x5d, 0x1f, 0x5d, 0x1f, 0x5d, 0x1f, 0x5d, 0x1f, 0x5c, 0xff, 0x5c, 0xff, 0x54, 0xff, 0x54, 0xff, 0x54, 0xff, 0x54, 0xff, 0x54, 0xdf, 0x4c, 0xff, 0x64, 0xbe, 0xb2, 0x10, 0x64, 0x5d, 0x4c, 0x9f, 0x4c, 0x7e, 0x4c, 0x5e, 0x4c, 0x3d, 0x4c, 0x1c, 0x4b, 0xdb, 0x62, 0xb5, 0x62, 0x31, 0x53, 0x15, 0x3b, 0x98, 0x3a, 0xd4, 0x31, 0x6c, 0x43, 0x95, 0x4b, 0xb6, 0x3a, 0xf1, 0x19, 0x89, 0x19, 0x68, 0x19, 0x69, 0x19, 0x89, 0x19, 0x89, 0x19, 0x89, 0x21, 0xaa, 0x21, 0xaa, 0x21, 0xaa, 0x21, 0xca, 0x21, 0xca, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x2a, 0x0b, 0x2a, 0x0b, 0x21, 0xeb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xeb, 0x31, 0x89, 0x50, 0x43, 0x58, 0x00, 0x58, 0x22, 0x48, 0xa4, 0x29, 0xaa, 0x21, 0xeb, 0x21, 0xeb, 0x21, 0xcb,
-    0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xeb, 0x40, 0xa4, 0x50, 0x00, 0x50, 0x00, 0x50, 0x00, 0x58, 0x00, 0x58, 0x00, 0x50, 0x43, 0x29, 0xaa, 0x19, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0x8b, 0x19, 0xab, 0x21, 0x6a, 0x19, 0x6a, 0x19, 0x8a, 0x19, 0x6a, 0x19, 0x6a, 0x19, 0x6a, 0x19, 0x69, 0x19, 0x49, 0x19, 0x08, 0x18, 0xe7, 0x19, 0x49, 0x32, 0x51, 0x3a, 0x30, 0x28, 0xa6, 0x43, 0x95, 0x4b, 0xb6, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x69, 0x19, 0x89, 0x19, 0x89, 0x19, 0x89, 0x21, 0xaa, 0x21, 0xaa, 0x21, 0xaa, 0x21, 0xaa, 0x21, 0xaa, 0x21, 0xca, 0x21, 0xca, 0x21, 0xca, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x2a, 0x0b, 0xff, 0xff,
-    0xff, 0xff, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xeb, 0x21, 0xeb, 0x48, 0xa5, 0x58, 0x00, 0x58, 0x00, 0x39, 0x27, 0x21, 0xca, 0x21, 0xeb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xeb, 0x39, 0x27, 0x50, 0x01, 0x50, 0x00, 0x50, 0x00, 0x58, 0x00, 0x58, 0x00, 0x40, 0xe6, 0x19, 0xcb, 0x21, 0xcb, 0x21, 0xab, 0x21, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0x8b, 0x19, 0x8b, 0x19, 0x8b, 0x19, 0x8b, 0x19, 0x8b, 0x19, 0x8a, 0x19, 0x8a, 0x19, 0x6a, 0x19, 0x6a, 0x19, 0x6a, 0x11, 0x49, 0x11, 0x49, 0x19, 0x28, 0x19, 0x28, 0x11, 0x28, 0x19, 0x07, 0x39, 0x4b, 0x28, 0x22, 0x43, 0x95, 0x4b, 0xb6, 0x19, 0x47, 0x19, 0x48, 0x19, 0x68, 0x19, 0x68, 0x19, 0x69, 0x19, 0x89, 0x19, 0x89, 0x19, 0x89,
-    0x21, 0xaa, 0x21, 0xaa, 0x21, 0xaa, 0x21, 0xaa, 0x21, 0xca, 0x21, 0xca, 0x21, 0xca, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0xff, 0xff, 0x2a, 0x0c, 0x2a, 0x0c, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xeb, 0x39, 0x07, 0x58, 0x01, 0x58, 0x01, 0x40, 0xa5, 0x21, 0xca, 0x21, 0xeb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xab, 0x21, 0xab, 0x21, 0xab, 0x21, 0xab, 0x21, 0xab, 0x21, 0xcb, 0x21, 0xab, 0x21, 0xcb, 0x29, 0xaa, 0x40, 0xa5, 0x50, 0x00, 0x50, 0x00, 0x58, 0x00, 0x50, 0x42, 0x31, 0x48, 0x19, 0xcb, 0x19, 0xab, 0x21, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0xab, 0x19, 0x8b, 0x19, 0x8b, 0x19, 0x8b, 0x19, 0x8b, 0x19, 0x8b, 0x19, 0x8a, 0x19, 0x8a, 0x19, 0x8a, 0x19, 0x6a, 0x19, 0x6a, 0x19, 0x6a, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x29, 0x11, 0x28,
-    0x11, 0x07, 0x10, 0xa5, 0x30, 0x85, 0x28, 0x00, 0x43, 0x74, 0x43, 0x95, 0x19, 0x47, 0x19, 0x48, 0xff, 0xff, 0x21, 0xa9, 0x19, 0x68, 0x19, 0x89, 0x19, 0x89, 0x32, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xca, 0xff, 0xff, 0x21, 0xca, 0xff, 0xff, 0xff, 0xff, 0x2a, 0x2c, 0x21, 0xca, 0x21, 0xca, 0xff, 0xff, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xeb, 0xff, 0xff, 0x60, 0x63, 0xff, 0xff, 0xff, 0xff, 0x3a, 0x4c, 0x21, 0xeb, 0xff, 0xff, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xab, 0xff, 0xff, 0x21, 0xcb, 0x21, 0xab, 0x21, 0xab, 0x21, 0xab, 0x21, 0xab, 0x21, 0xab, 0x21, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0x0c, 0x21, 0xcb, 0xff, 0xff, 0x21, 0xab, 0x19, 0xcb, 0x38, 0xe6, 0xff, 0xff, 0x50, 0x00, 0x60, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0x0c, 0x21, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xab, 0xff, 0xff, 0x21, 0xec, 0xff, 0xff, 0xff, 0xff, 0x32, 0x2c, 0x19, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x29, 0xec, 0x19, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xcb, 0x19, 0x49, 0x2a, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0xe6, 0x10, 0x63, 0x28, 0x22, 0x28, 0x00, 0x43, 0x74, 0x43, 0x95, 0x19, 0x27, 0x19, 0x47, 0x21, 0x88, 0xff, 0xff, 0x21, 0xa9, 0x19, 0x68, 0x21, 0x89, 0xff, 0xff, 0x19, 0x89, 0x21, 0x89, 0x21, 0xaa, 0x21, 0xaa, 0x21, 0xca, 0xff, 0xff, 0xff, 0xff, 0x21, 0xca, 0x21, 0xaa, 0xff, 0xff, 0x21, 0xaa, 0x21, 0xaa, 0xff, 0xff, 0x21, 0xaa, 0x21, 0xca, 0x21, 0xcb, 0x29, 0xca, 0xff, 0xff, 0xff, 0xff, 0x41, 0x06, 0x21, 0xca, 0xff, 0xff, 0x21, 0xcb, 0xff, 0xff, 0x21, 0xaa, 0x21, 0xaa, 0x21, 0xaa, 0xff, 0xff, 0x21, 0xaa, 0x21, 0xaa, 0x21, 0xaa, 0x21, 0xaa, 0x21, 0xab, 0x21, 0xab, 0x21, 0xab, 0x2a, 0x0c, 0x2a, 0x0c, 0x2a, 0x0c, 0x2a, 0x0c, 0xff, 0xff, 0x21, 0xcb, 0xff, 0xff, 0x19, 0xaa, 0x19, 0xab, 0x31, 0x28, 0xff, 0xff, 0x50, 0x20, 0xff, 0xff, 0x31, 0x07, 0x19, 0xcb, 0x19, 0xaa, 0xff, 0xff, 0x19, 0xaa, 0x19, 0xaa,
-    0x19, 0xaa, 0x32, 0x2c, 0xff, 0xff, 0x21, 0xcb, 0x21, 0xab, 0xff, 0xff, 0xff, 0xff, 0x21, 0xab, 0x19, 0x8a, 0xff, 0xff, 0x19, 0xab, 0xff, 0xff, 0x19, 0x8a, 0x19, 0x8a, 0x19, 0x8a, 0xff, 0xff, 0x19, 0x8a, 0x29, 0xeb, 0x21, 0xcb, 0x21, 0xcb, 0x21, 0xcb, 0xff, 0xff, 0x19, 0x69, 0xff, 0xff, 0x11, 0x49, 0x11, 0x49, 0x11, 0x28, 0xff, 0xff, 0x10, 0xa5, 0x10, 0x22, 0x30, 0x00, 0x28, 0x00, 0x43, 0x54, 0x43, 0x75, 0x19, 0x47, 0x19, 0x47, 0x21, 0x88, 0xff, 0xff, 0x21, 0xa9, 0x19, 0x68, 0x21, 0x89, 0xff, 0xff, 0x19, 0x89, 0x19, 0x89, 0x19, 0x89, 0x19, 0x89, 0x21, 0xaa, 0xff, 0xff, 0x21, 0xaa, 0x21, 0xaa, 0x21, 0xaa, 0xff, 0xff, 0x21, 0xaa, 0x21, 0xaa, 0xff, 0xff, 0x21, 0xaa, 0x21, 0xaa, 0x19, 0xca, 0x29, 0x89, 0xff, 0xff, 0x39, 0x68, 0x21, 0xaa, 0x19, 0xca, 0xff, 0xff, 0x21, 0xca, 0xff, 0xff, 0x21, 0xca, 0x21, 0xca, 0x21, 0xca, 0xff, 0xff, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0x21, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x21, 0xab, 0xff, 0xff, 0x19, 0xaa, 0x19, 0xaa, 0x21, 0x8a, 0xff, 0xff, 0x58, 0x20, 0xff, 0xff, 0x29, 0x48, 0x19, 0xab, 0x19, 0x8a, 0xff, 0xff, 0x19, 0x8a, 0x19, 0x8a, 0x19, 0x8a, 0xff, 0xff, 0x19, 0x8a, 0x19, 0x8a, 0x19, 0xaa, 0xff, 0xff, 0x21, 0xab, 0x19, 0x8a, 0x19, 0x8a, 0xff, 0xff, 0x19, 0x8a, 0xff, 0xff, 0x19, 0x8a, 0x19, 0x8a, 0x19, 0x6a, 0xff, 0xff, 0x19, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0x69, 0xff, 0xff, 0x11, 0x49, 0x11, 0x28, 0x11, 0x28, 0xff, 0xff, 0x10, 0x84, 0x10, 0x00, 0x30, 0x00, 0x30, 0x00, 0x43, 0x33, 0x43, 0x74, 0x19, 0x27, 0x19, 0x47, 0x21, 0x88, 0xff, 0xff, 0x21, 0xa9, 0x19, 0x68, 0x19, 0x68, 0x29, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x32, 0x0b, 0x21, 0xaa, 0xff, 0xff, 0x19, 0xaa, 0x19, 0xaa, 0x19, 0xaa, 0xff, 0xff, 0x21, 0xaa, 0x21, 0xaa, 0xff, 0xff, 0x21, 0xaa, 0x21, 0xaa, 0x19, 0xaa, 0x21, 0xa9, 0xff, 0xff, 0x2a, 0x0b, 0x19, 0xaa, 0x19, 0xaa, 0xff, 0xff, 0x21, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x19, 0x8a, 0x19, 0x8a, 0x19, 0xaa, 0x19, 0x8a, 0x19, 0x8a, 0x19, 0x8a, 0x21, 0xaa, 0xff, 0xff, 0x21, 0xaa, 0x21, 0xaa, 0x21, 0xaa, 0xff, 0xff, 0x21, 0xaa, 0xff, 0xff, 0x19, 0x8a, 0x19, 0xaa, 0x21, 0xcb, 0xff, 0xff, 0x58, 0x20, 0xff, 0xff, 0x21, 0x8a, 0x19, 0x8a, 0x19, 0x8a, 0xff, 0xff, 0x19, 0x8a, 0x19, 0x8a, 0x21, 0xab, 0xff, 0xff, 0x19, 0x8a, 0x19, 0x8a, 0x19, 0x8a, 0xff, 0xff, 0x29, 0xeb, 0x19, 0x8a, 0x19, 0x6a, 0xff, 0xff, 0x19, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xcb, 0x19, 0x8a, 0xff, 0xff, 0x19, 0x6a, 0x19, 0x69, 0x19, 0x69, 0xff, 0xff, 0x19, 0x69, 0xff, 0xff, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0xff, 0xff, 0x10, 0x43, 0x10, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3b, 0x33, 0x43, 0x53, 0x19, 0x27, 0x19, 0x27, 0x21, 0x68, 0xff, 0xff, 0x21, 0xa9, 0x19, 0x48, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x69, 0x19, 0x89, 0xff, 0xff, 0x21, 0xa9, 0xff, 0xff, 0x19, 0x89, 0x19, 0x89, 0x19, 0x89, 0xff, 0xff, 0x19, 0x89, 0x19, 0x89,
-    0xff, 0xff, 0x19, 0x89, 0x21, 0x8a, 0x19, 0x8a, 0x21, 0xaa, 0xff, 0xff, 0xff, 0xff, 0x21, 0xaa, 0x19, 0x8a, 0xff, 0xff, 0x21, 0xaa, 0xff, 0xff, 0x19, 0x89, 0x19, 0x89, 0x19, 0x89, 0xff, 0xff, 0x19, 0x8a, 0x19, 0x8a, 0x19, 0x89, 0x19, 0x8a, 0x19, 0x8a, 0x19, 0x8a, 0x21, 0xaa, 0xff, 0xff, 0x19, 0x8a, 0x19, 0x89, 0x19, 0x8a, 0xff, 0xff, 0x19, 0xaa, 0xff, 0xff, 0x19, 0x8a, 0x21, 0xca, 0xff, 0xff, 0xff, 0xff, 0x50, 0x20, 0xff, 0xff, 0x19, 0x8a, 0x19, 0x8a, 0x19, 0x8a, 0xff, 0xff, 0x19, 0x8a, 0x29, 0xeb, 0xff, 0xff, 0x19, 0x8a, 0x19, 0x6a, 0x19, 0x6a, 0x19, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x19, 0x8a, 0x19, 0x6a, 0xff, 0xff, 0x19, 0x8a, 0xff, 0xff, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0xff, 0xff, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0xff, 0xff, 0x19, 0x49, 0xff, 0xff, 0x11, 0x28, 0x11, 0x28, 0x11, 0x07, 0xff, 0xff, 0x10, 0x21, 0x10, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3b, 0x32, 0x43, 0x53, 0x11, 0x27, 0x19, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0x48,
-    0x19, 0x68, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x32, 0x0b, 0x21, 0x89, 0xff, 0xff, 0x19, 0x89, 0x19, 0x89, 0x19, 0x89, 0xff, 0xff, 0x19, 0x89, 0x19, 0x89, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0x89, 0x21, 0xa9, 0xff, 0xff, 0x21, 0xa9, 0xff, 0xff, 0xff, 0xff, 0x29, 0xeb, 0x21, 0xa9, 0xff, 0xff, 0x19, 0x89, 0x19, 0x89, 0x19, 0x89, 0xff, 0xff, 0x19, 0x89, 0x19, 0x89, 0x19, 0x89, 0x19, 0x89, 0x19, 0x89, 0x19, 0x89, 0x19, 0x89, 0x32, 0x2c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x32, 0x0b, 0x19, 0x69, 0x32, 0x2c, 0xff, 0xff, 0xff, 0xff, 0x21, 0xca, 0xff, 0xff, 0x50, 0x00, 0x49, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x2a, 0x0b, 0x19, 0x8a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x19, 0x8a, 0xff, 0xff, 0x19, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x21, 0xcb, 0x19, 0x69, 0x32, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xaa, 0x11, 0x49, 0x2a, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0xca, 0x19, 0x48, 0xff, 0xff, 0x11, 0x28, 0x11, 0x28,
-    0x10, 0xe7, 0xff, 0xff, 0x10, 0x00, 0x10, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3b, 0x12, 0x43, 0x32, 0x11, 0x26, 0x11, 0x27, 0x19, 0x68, 0xff, 0xff, 0x21, 0x88, 0x19, 0x47, 0x19, 0x48, 0x19, 0x48, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x69, 0x19, 0x69, 0x19, 0x89, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x89, 0x19, 0x89, 0x19, 0x89, 0x19, 0x89, 0x19, 0x89, 0xff, 0xff, 0x19, 0x89, 0x19, 0x89, 0x19, 0x69, 0x19, 0x69, 0x19, 0x89, 0xff, 0xff, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0xff, 0xff, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x21, 0x68, 0x40, 0x01, 0x48, 0x00, 0x29, 0x07, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x69, 0xff, 0xff, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x11, 0x49, 0x19, 0x49,
-    0x19, 0x49, 0x11, 0x49, 0x19, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x48, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x48, 0xff, 0xff, 0x11, 0x28, 0x11, 0x07, 0x10, 0xc6, 0xff, 0xff, 0x18, 0x00, 0x18, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3b, 0x11, 0x3b, 0x12, 0x11, 0x06, 0x11, 0x26, 0x19, 0x47, 0xff, 0xff, 0x21, 0x88, 0x19, 0x47, 0x19, 0x47, 0x19, 0x47, 0x19, 0x48, 0x19, 0x48, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x69, 0xff, 0xff, 0x19, 0x69, 0x19, 0x69, 0x19, 0x68, 0x19, 0x89, 0xff, 0xff, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x68, 0x32, 0x0b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0xea, 0x19, 0x68, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x49, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x49, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x19, 0x69, 0x21, 0x27, 0x48, 0x01, 0x38, 0x63, 0x19, 0x48, 0x19, 0x68, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49,
-    0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x49, 0x19, 0x69, 0xff, 0xff, 0x19, 0x49, 0x19, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x49, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x29, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0x00, 0x18, 0x00, 0x40, 0x65, 0x38, 0xc7, 0x3a, 0xd1, 0x3b, 0x11, 0x19, 0x27, 0x11, 0x06, 0x11, 0x26, 0x11, 0x26, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x47, 0x19, 0x47, 0x19, 0x47, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x48, 0x19, 0x48, 0x19, 0x68, 0x19, 0x48, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x68, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48,
-    0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x11, 0x69, 0x28, 0xc5, 0x38, 0x22, 0x21, 0x27, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x28, 0x11, 0x48, 0x11, 0x48, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x10, 0xe7, 0x10, 0xa5, 0x18, 0x43, 0x18, 0x01, 0x18, 0x01, 0x18, 0x43, 0x39, 0x8c, 0x31, 0xcf, 0x3a, 0xd0, 0x3a, 0xd1, 0x2a, 0x4d, 0x19, 0x26, 0x11, 0x06, 0x11, 0x06, 0x11, 0x26, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x27, 0x19, 0x47, 0x19, 0x47, 0x19, 0x47, 0x19, 0x47, 0x19, 0x47, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48,
-    0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x48, 0x19, 0x28, 0x28, 0x64, 0x20, 0xe6, 0x11, 0x48, 0x11, 0x48, 0x19, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x48, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x28, 0x11, 0x08, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x11, 0x07, 0x10, 0xe7, 0x10, 0xa5, 0x10, 0x63, 0x10, 0x22, 0x10, 0x42, 0x18, 0x64, 0x29, 0x6b, 0x2a, 0x30, 0x22, 0x71, 0x3a, 0xb0, 0x3a, 0xd0, 0x3a, 0xf0, 0x3a, 0xf1, 0x3b, 0x12, 0x3b, 0x32, 0x43, 0x32, 0x43, 0x33, 0x43, 0x54, 0x43, 0x74, 0x43, 0x74, 0x43, 0x95, 0x43, 0x95, 0x43, 0x95, 0x4b, 0x96, 0x4b, 0xb6, 0x4b, 0xb6, 0x4b, 0xb6, 0x4b, 0xb6, 0x4b, 0xb6,
-    0x4b, 0xb6, 0x4b, 0xb7, 0x4b, 0xb7, 0x4b, 0xb7, 0x4b, 0xb7, 0x4b, 0xb7, 0x4b, 0xb7, 0x43, 0xb7, 0x4b, 0xb7, 0x43, 0xb6, 0x43, 0xb6, 0x43, 0xb7, 0x43, 0xb7, 0x43, 0xb7, 0x43, 0xb6, 0x43, 0xb7, 0x43, 0xb7, 0x43, 0x97, 0x43, 0x97, 0x43, 0xb7, 0x43, 0x97, 0x43, 0x97, 0x43, 0x96, 0x43, 0x97, 0x43, 0x97, 0x43, 0x97, 0x43, 0x97, 0x43, 0x97, 0x43, 0x97, 0x43, 0x97, 0x43, 0x97, 0x43, 0x97, 0x43, 0x97, 0x52, 0xd4, 0x62, 0x30, 0x43, 0x77, 0x43, 0x77, 0x43, 0x97, 0x43, 0x77, 0x43, 0x77, 0x3b, 0x77, 0x43, 0x77, 0x43, 0x77, 0x3b, 0x77, 0x3b, 0x77, 0x3b, 0x77, 0x3b, 0x77, 0x3b, 0x77, 0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x57, 0x3b, 0x37, 0x3b, 0x36, 0x3b, 0x36, 0x3b, 0x36, 0x3b, 0x36, 0x33, 0x16, 0x3b, 0x16, 0x33, 0x15, 0x32, 0xd4, 0x3a, 0x52, 0x39, 0xce, 0x39, 0x2b, 0x38, 0xe8, 0x39, 0x2a, 0x41, 0xad, 0x3a, 0x30, 0x32, 0x51, 0x22, 0x71, 0x2a, 0x70};
+static const PackedImage image_data_maplepad_logo_9664 = {96, 64, 2, sizeof(image_data_maplepad_logo_9664_data), image_data_maplepad_logo_9664_data};
 
 void ssd1331WriteCommand(const uint8_t data) {
   // gpio_put(DC, 0);
@@ -857,28 +253,87 @@ bool getPixelSSD1331(const uint8_t x, const uint8_t y) {
     return true;
 }
 
-void updateSSD1331() {
+// Swaps the buffers and sends rows [y0, y1) of what was just drawn. Only
+// those rows can differ between the two, so copying them back brings the
+// new back buffer up to date
+static void ssd1331StartFrame(int y0, int y1) {
+  uint8_t *drawn = oledFB;
+  oledFB = oledFront;
+  oledFront = drawn;
+  memcpy(&oledFB[y0 * OLED_W * 2], &oledFront[y0 * OLED_W * 2], (y1 - y0) * OLED_W * 2);
+
+  while (spi_is_busy(SSD1331_SPI)) // DC can't drop while pixel data is still going out
+    ;
+
   gpio_put(DC, 0);
 
   ssd1331WriteCommand(0x15);
   ssd1331WriteCommand(0);
   ssd1331WriteCommand(95);
   ssd1331WriteCommand(0x75);
-  ssd1331WriteCommand(0);
-  ssd1331WriteCommand(63);
+  ssd1331WriteCommand(y0);
+  ssd1331WriteCommand(y1 - 1);
 
   gpio_put(DC, 1);
 
-  if (!(dma_channel_is_busy(dma_tx)))
-    dma_channel_configure(dma_tx, &c,
-                          &spi_get_hw(SSD1331_SPI)->dr, // write address
-                          oledFB,                       // read address
-                          sizeof(oledFB),               // element count (each element is of size transfer_data_size)
-                          true);                        // start
+  dmaActive = true;
+  dma_channel_configure(dma_tx, &c,
+                        &spi_get_hw(SSD1331_SPI)->dr, // write address
+                        &oledFront[y0 * OLED_W * 2],  // read address
+                        (y1 - y0) * OLED_W * 2,       // element count (each element is of size transfer_data_size)
+                        true);                        // start
 
   // spi_write_blocking(SSD1331_SPI, oledFB, sizeof(oledFB));
 }
 
+// DMA done. Any frame that queued up behind it goes out from ssd1331Poll()
+// in the main loop, the buffer swap and window commands are too slow for here
+static void ssd1331DmaIrq() {
+  if (!dma_channel_get_irq1_status(dma_tx))
+    return;
+  dma_channel_acknowledge_irq1(dma_tx);
+
+  dmaActive = false;
+}
+
+// Sends a queued frame if the DMA is idle. Does nothing between
+// ssd1331BeginDraw() and the update, since the frame may be half drawn
+void ssd1331Poll() {
+  if (!drawing && framePending && !dmaActive) { // no DMA running, so no IRQ to race
+    framePending = false;
+    ssd1331StartFrame(pendingY0, pendingY1);
+  }
+}
+
+// A frame is already queued behind the one going out
+bool ssd1331FramePending() { return framePending; }
+
+// Call before drawing into oledFB, so a queued frame isn't sent half drawn.
+// The next update releases it
+void ssd1331BeginDraw() { drawing = true; }
+
+// Queues rows [y0, y1) of the back buffer. Goes out straight away if the
+// DMA is idle, otherwise it's merged with any frame already waiting (latest
+// contents win) and sent from ssd1331Poll()
+void updateSSD1331Rows(int y0, int y1) {
+  drawing = true;
+
+  if (framePending) {
+    pendingY0 = MIN(pendingY0, y0);
+    pendingY1 = MAX(pendingY1, y1);
+    displayStats.coalesced++;
+  } else {
+    pendingY0 = y0;
+    pendingY1 = y1;
+    framePending = true;
+  }
+
+  drawing = false;
+  ssd1331Poll(); // goes now if the DMA is idle
+}
+
+void updateSSD1331() { updateSSD1331Rows(0, OLED_H); }
+
 void splashSSD1331() {
   gpio_put(DC, 0);
 
@@ -891,22 +346,34 @@ void splashSSD1331() {
 
   gpio_put(DC, 1);
 
-  dma_tx = dma_claim_unused_channel(true);
-  c = dma_channel_get_default_config(dma_tx);
-  channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
-  channel_config_set_dreq(&c, spi_get_index(SSD1331_SPI) ? DREQ_SPI1_TX : DREQ_SPI0_TX);
-  dma_channel_configure(dma_tx, &c,
-                        &spi_get_hw(SSD1331_SPI)->dr,          // write address
-                        image_data_maplepad_logo_9664,         // read address
-                        sizeof(image_data_maplepad_logo_9664), // element count (each element is of size transfer_data_size)
-                        true);                                 // start
+  // Unpacked into the front buffer, nothing's been drawn yet
+  unpackImage(&image_data_maplepad_logo_9664, oledFront, OLED_W * 2);
 
-  // spi_write_blocking(SSD1331_SPI, oledFB, sizeof(oledFB));
+  // uses the channel ssd1331_init() claimed
+  dmaActive = true;
+  dma_channel_configure(dma_tx, &c,
+                        &spi_get_hw(SSD1331_SPI)->dr, // write address
+                        oledFront,                    // read address
+                        OLED_FB_SIZE,                 // element count (each element is of size transfer_data_size)
+                        true);                        // start
 }
 
-void clearSSD1331() { memset(oledFB, 0, sizeof(oledFB)); }
+void clearSSD1331() { memset(oledFB, 0, OLED_FB_SIZE); }
 
 void ssd1331_init() {
+  if (dmaClaimed) { // don't cut off a frame that's still going out, and drop any queued one
+    drawing = true;
+    if (framePending) {
+      framePending = false;
+      displayStats.dropped++;
+    }
+    while (dmaActive)
+      tight_loop_contents();
+    while (spi_is_busy(SSD1331_SPI))
+      ;
+    drawing = false;
+  }
+
   gpio_init(DC);
   gpio_set_dir(DC, GPIO_OUT);
   gpio_put(DC, 1);
@@ -962,8 +429,112 @@ void ssd1331_init() {
   ssd1331WriteCommand(SSD1331_CMD_NORMALDISPLAY); // 0xA4
   ssd1331WriteCommand(SSD1331_CMD_DISPLAYON);     //--turn on oled panel
 
-  dma_tx = dma_claim_unused_channel(true);
-  c = dma_channel_get_default_config(dma_tx);
-  channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
-  channel_config_set_dreq(&c, spi_get_index(SSD1331_SPI) ? DREQ_SPI1_TX : DREQ_SPI0_TX);
-}
\ No newline at end of file
+  if (!dmaClaimed) {
+    dma_tx = dma_claim_unused_channel(true);
+    c = dma_channel_get_default_config(dma_tx);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_dreq(&c, spi_get_index(SSD1331_SPI) ? DREQ_SPI1_TX : DREQ_SPI0_TX);
+
+    dma_channel_set_irq1_enabled(dma_tx, true);
+    irq_add_shared_handler(DMA_IRQ_1, ssd1331DmaIrq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_1, true);
+    dmaClaimed = true;
+  }
+}
+// Just the remap, so the menu's flip doesn't reset the panel. Holds queued
+// frames back until it gets a gap between DMA transfers
+static bool ssd1331SetFlip() {
+  drawing = true;
+  if (dmaActive || spi_is_busy(SSD1331_SPI))
+    return false;
+
+  gpio_put(DC, 0);
+  ssd1331WriteCommand(SSD1331_CMD_SETREMAP);
+  ssd1331WriteCommand(OLED_FLIP ? 0x60 : 0x72);
+  drawing = false;
+  return true;
+}
+
+// Boot time setup: SPI bus and pins, then the panel itself
+static void ssd1331Begin() {
+  spi_init(SSD1331_SPI, SSD1331_SPEED);
+  spi_set_format(spi0, 8, SPI_CPOL_1, SPI_CPHA_1, SPI_MSB_FIRST);
+  gpio_set_function(SCK, GPIO_FUNC_SPI);
+  gpio_set_function(MOSI, GPIO_FUNC_SPI);
+
+  ssd1331_init();
+}
+
+static void ssd1331Clear() {
+  ssd1331BeginDraw();
+  clearSSD1331();
+}
+
+static void ssd1331SetPixel(int x, int y, uint16_t color) {
+  ssd1331BeginDraw();
+  setPixelSSD1331(x, y, color);
+}
+
+static void ssd1331FillRect(int x0, int x1, int y0, int y1, uint16_t color) {
+  ssd1331BeginDraw();
+  rgbFillRect(oledFB, OLED_W * 2, x0, x1, y0, y1, color);
+}
+
+static void ssd1331BlitMask(const uint8_t *mask, int maskStride, int x, int y, int w, int h, uint16_t fg, uint16_t bg) {
+  ssd1331BeginDraw();
+  rgbBlitMask(oledFB, OLED_W * 2, mask, maskStride, x, y, w, h, fg, bg);
+}
+
+static void ssd1331BlitText(const char *text, int n, int x, int y, uint16_t fg, uint16_t bg) {
+  ssd1331BeginDraw();
+  rgbBlitText(oledFB, OLED_W * 2, text, n, x, y, fg, bg);
+}
+
+static void ssd1331BlitVMU(const uint8_t *lcd, const RowColors *colors, bool smooth, int firstRow, int lastRow) {
+  ssd1331BeginDraw();
+  if (smooth)
+    vmuBlitRGB565Smooth(lcd, LCD_NumCols, LCD_Height, firstRow, lastRow, colors, oledFB, OLED_W * 2);
+  else
+    vmuBlitRGB565(lcd, LCD_NumCols, firstRow, lastRow, colors, oledFB, OLED_W * 2);
+}
+
+// Only 96 of the 128 test mode columns fit, so it gets the middle
+static void ssd1331BlitTest(const uint8_t *lcd, const RowColors *colors, int firstRow, int lastRow) {
+  const int numCols = LCD_TestWidth / 8;
+  const int skipCols = (LCD_TestWidth - OLED_W) / 16;
+
+  ssd1331BeginDraw();
+  testBlitRGB565(lcd, numCols, skipCols, numCols - skipCols, firstRow, lastRow, colors, oledFB, OLED_W * 2);
+}
+
+// The window is always full width, the DMA sends whole rows
+static uint32_t ssd1331Flush(int x0, int x1, int y0, int y1) {
+  updateSSD1331Rows(y0, y1);
+  return (y1 - y0) * OLED_W * 2;
+}
+
+static uint8_t *ssd1331UiRow(int y) { return &oledFB[y * OLED_W * 2]; }
+
+const DisplayDriver ssd1331Driver = {
+    .name = "SSD1331",
+    .width = OLED_W,
+    .height = OLED_H,
+    .xOffset = 0,
+    .frameUs = SSD1331_FRAME_US,
+    .begin = ssd1331Begin,
+    .init = ssd1331_init,
+    .setFlip = ssd1331SetFlip,
+    .splash = splashSSD1331,
+    .clear = ssd1331Clear,
+    .beginDraw = ssd1331BeginDraw,
+    .setPixel = ssd1331SetPixel,
+    .fillRect = ssd1331FillRect,
+    .blitMask = ssd1331BlitMask,
+    .blitText = ssd1331BlitText,
+    .blitVMU = ssd1331BlitVMU,
+    .blitTest = ssd1331BlitTest,
+    .flush = ssd1331Flush,
+    .busy = ssd1331FramePending,
+    .poll = ssd1331Poll,
+    .uiRow = ssd1331UiRow,
+};
@@ -8,9 +8,11 @@
 #include "pico/binary_info.h"
 #include "hardware/spi.h"
 #include "hardware/dma.h"
+#include "hardware/irq.h"
 
 #define SSD1331_SPI spi0
 #define SSD1331_SPEED 50000000 // 62.5MHz
+#define SSD1331_FRAME_US 8333  // don't start VMU frames faster than 120Hz, a full one is ~2ms of SPI
 #define SCK 2
 #define MOSI 3
 #define DC 14
@@ -18,9 +20,12 @@
 
 #define OLED_W 96
 #define OLED_H 64
+#define OLED_FB_SIZE (OLED_W * OLED_H * 2)
 
 #define OLED_FLIP flashData[18]
 
+extern uint8_t *oledFB; // back buffer, draw here
+
 // SSD1331 Commands
 #define SSD1331_CMD_DRAWLINE 0x21       //!< Draw line
 #define SSD1331_CMD_DRAWRECT 0x22       //!< Draw rectangle
@@ -51,12 +56,6 @@
 #define SSD1331_CMD_PRECHARGELEVEL 0xBB //!< Set pre-charge voltage
 #define SSD1331_CMD_VCOMH 0xBE          //!< Set Vcomh voltge
 
-float cos_32s(float x);
-float cos32(float x);
-float sin32(float x);
-double atan66(double x);
-double atan_66s(double x);
-
 void fast_hsv2rgb_32bit(uint16_t, uint8_t, uint8_t, uint8_t *, uint8_t *, uint8_t *);
 
 void ssd1331WriteCommand(const uint8_t data);
@@ -69,6 +68,14 @@ void setPixelSSD1331(const uint8_t x, const uint8_t y, const uint16_t color);
 
 void clearSSD1331(void);
 
+void ssd1331BeginDraw(void);
+
+void ssd1331Poll(void);
+
+bool ssd1331FramePending(void);
+
+void updateSSD1331Rows(int y0, int y1);
+
 void updateSSD1331(void);
 
 void splashSSD1331(void);
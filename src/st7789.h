@@ -8,9 +8,10 @@
 #include "pico/binary_info.h"
 #include "hardware/spi.h"
 #include "hardware/dma.h"
+#include "hardware/irq.h"
 
 #define ST7789_SPI spi0
-#define ST7789_SPEED 60000000 // 40MHz
+#define ST7789_SPEED 62500000 // clk_peri / 2, as fast as the SPI block goes
 #define ST7789_DC 5
 #define ST7789_CS 1
 #define ST7789_SCK 2
@@ -18,6 +19,18 @@
 #define ST7789_RST 6
 #define ST7789_BL_EN 7
 
+// 240x280 panel, the RAM rows start 20 lines down. The 96x64 UI is
+// stretched to ST7789_OUT_W x ST7789_OUT_H in the middle, nearest neighbour.
+// 2.5x makes every VMU pixel (2x2 in the UI) a 5x5 square
+#define ST7789_W 240
+#define ST7789_H 280
+#define ST7789_ROW_OFFSET 20
+#define ST7789_OUT_W 240
+#define ST7789_OUT_H 160
+#define ST7789_UI_X ((ST7789_W - ST7789_OUT_W) / 2)
+#define ST7789_UI_Y (ST7789_ROW_OFFSET + (ST7789_H - ST7789_OUT_H) / 2)
+#define ST7789_FRAME_US 16667 // a full 240x160 frame is ~10ms of SPI
+
 #define ST7789_CMD_NOP             0x00        /**< no operation command */
 #define ST7789_CMD_SWRESET         0x01        /**< software reset command */
 #define ST7789_CMD_SLPIN           0x10        /**< sleep in command */
@@ -83,6 +96,17 @@
 #define ST7789_CMD_NVMSET          0xFC        /**< nvm setting command */
 #define ST7789_CMD_PROMACT         0xFE        /**< program action command */
 
+typedef struct {
+  uint32_t frames;     // updates streamed out
+  uint32_t lines;      // panel lines sent
+  uint32_t fps;        // from the gap between the last two updates
+  uint32_t lastSendUs; // window setup until the last line has left the DMA
+  uint32_t lastCpuUs;  // CPU time of the last update: setup plus line scaling in the IRQ
+  uint32_t maxCpuUs;
+} ST7789Stats;
+
+extern ST7789Stats st7789Stats;
+
 void st7789WriteCommand(const uint8_t data);
 
 void st7789WriteData(const uint8_t data);
@@ -0,0 +1,426 @@
+/* store.c
+ *  content-addressed block store for the VMU pages
+ */
+
+#include <string.h>
+#include "store.h"
+
+#define STORE_MAGIC 0x53504D56
+#define STORE_SECTORS (STORE_BLOCKS / STORE_SECTOR_BLOCKS)
+#define STORE_INDEX_BITS 10                       // lossy hash index of the pool, 1024 entries
+#define STORE_LOW_WATER (4 * STORE_SECTOR_BLOCKS) // idle steps collect garbage below this many erased blocks
+#define STORE_NONE 0xFFFF
+#define RECORDS_PER_PAGE (STORE_FLASH_PAGE / sizeof(StoreRecord))
+
+StoreStats storeStats;
+
+static const StoreFlash *Flash;
+static uint16_t Map[STORE_SLOTS];                 // pool block behind each page block
+static uint16_t Refs[STORE_BLOCKS];               // page blocks mapped to each pool block
+static uint32_t Erased[(STORE_BLOCKS + 31) / 32]; // pool blocks ready to program
+static uint32_t ErasedBlocks;
+static uint16_t Index[1 << STORE_INDEX_BITS]; // pool block last seen with each hash, checked before use
+static uint32_t Active;   // table area in use
+static uint32_t Sequence; // of its snapshot
+static uint32_t LogNext;  // first free record in its log
+static uint32_t SpareErased; // sectors of the other area erased ahead of the next snapshot
+static uint32_t AllocNext;   // where the search for an erased block carries on from
+
+#define SNAPSHOT_SIZE (sizeof(StoreHeader) + sizeof(Map) + sizeof(Refs))
+
+static uint32_t blockOffset(uint32_t Block) {
+  if (Block < STORE_POOL_A_BLOCKS)
+    return STORE_POOL_A + Block * STORE_BLOCK_SIZE;
+  return STORE_POOL_B + (Block - STORE_POOL_A_BLOCKS) * STORE_BLOCK_SIZE;
+}
+
+static const uint8_t *blockData(uint32_t Block) { return Flash->Base + blockOffset(Block); }
+
+static uint32_t areaOffset(uint32_t Area) { return STORE_TABLES + Area * STORE_AREA_SIZE; }
+
+static int isErased(uint32_t Block) { return (Erased[Block / 32] >> (Block % 32)) & 1; }
+
+static void setErased(uint32_t Block) {
+  if (!isErased(Block)) {
+    Erased[Block / 32] |= 1u << (Block % 32);
+    ErasedBlocks++;
+  }
+}
+
+static void clearErased(uint32_t Block) {
+  if (isErased(Block)) {
+    Erased[Block / 32] &= ~(1u << (Block % 32));
+    ErasedBlocks--;
+  }
+}
+
+static uint32_t blockHash(const uint8_t *Data) {
+  const uint32_t *Words = (const uint32_t *)Data;
+  uint32_t Hash = 2166136261u;
+  for (uint32_t i = 0; i < STORE_BLOCK_SIZE / sizeof(uint32_t); i++)
+    Hash = (Hash ^ Words[i]) * 16777619u;
+  return Hash >> (32 - STORE_INDEX_BITS);
+}
+
+static int blockIsErased(uint32_t Block) {
+  const uint32_t *Words = (const uint32_t *)blockData(Block);
+  for (uint32_t i = 0; i < STORE_BLOCK_SIZE / sizeof(uint32_t); i++)
+    if (Words[i] != 0xFFFFFFFF)
+      return 0;
+  return 1;
+}
+
+static void addRef(uint32_t Block) {
+  if (!Refs[Block]) {
+    storeStats.Live++;
+    clearErased(Block);
+  }
+  Refs[Block]++;
+}
+
+static void dropRef(uint32_t Block) {
+  if (!--Refs[Block])
+    storeStats.Live--;
+}
+
+// Garbage collection moved a pool block
+static void moveBlock(uint32_t From, uint32_t To) {
+  for (uint32_t Slot = 0; Slot < STORE_SLOTS; Slot++)
+    if (Map[Slot] == From)
+      Map[Slot] = To;
+  Refs[To] = Refs[From];
+  Refs[From] = 0;
+}
+
+static uint32_t tablesCheck(uint32_t Seq, const uint16_t *Blocks, const uint16_t *Counts) {
+  uint32_t Check = Seq ^ STORE_MAGIC;
+  for (uint32_t i = 0; i < STORE_SLOTS; i++)
+    Check = ((Check << 5) | (Check >> 27)) ^ Blocks[i];
+  for (uint32_t i = 0; i < STORE_BLOCKS; i++)
+    Check = ((Check << 5) | (Check >> 27)) ^ Counts[i];
+  return Check;
+}
+
+static uint16_t recordCheck(const StoreRecord *Record) {
+  return ~(Record->Slot ^ (uint16_t)((Record->Block << 5) | (Record->Block >> 11)) ^ (Record->Kind << 12));
+}
+
+// The part of a table (at Start in the snapshot) that falls in the flash page at At
+static void copyPart(uint8_t *Page, uint32_t At, const void *Part, uint32_t Start, uint32_t Size) {
+  uint32_t From = At > Start ? At : Start;
+  uint32_t To = At + STORE_FLASH_PAGE < Start + Size ? At + STORE_FLASH_PAGE : Start + Size;
+  if (From < To)
+    memcpy(Page + From - At, (const uint8_t *)Part + From - Start, To - From);
+}
+
+static void snapshotPage(const StoreHeader *Header, uint32_t At, uint8_t *Page) {
+  memset(Page, 0xFF, STORE_FLASH_PAGE);
+  copyPart(Page, At, Header, 0, sizeof(StoreHeader));
+  copyPart(Page, At, Map, sizeof(StoreHeader), sizeof(Map));
+  copyPart(Page, At, Refs, sizeof(StoreHeader) + sizeof(Map), sizeof(Refs));
+}
+
+// Write the tables to the other area and switch to it. Its header goes in last, so an area only
+// counts once all of it is there and a power cut part way leaves the old one in use
+static void writeSnapshot() {
+  uint32_t Area = Active ^ 1;
+  uint32_t Offset = areaOffset(Area);
+  uint8_t Page[STORE_FLASH_PAGE];
+
+  for (uint32_t Sector = 0; Sector < STORE_AREA_SIZE / STORE_SECTOR_SIZE; Sector++)
+    if (!(SpareErased & (1u << Sector)))
+      Flash->Erase(Offset + Sector * STORE_SECTOR_SIZE);
+
+  StoreHeader Header = {STORE_MAGIC, Sequence + 1, tablesCheck(Sequence + 1, Map, Refs), 0};
+  for (uint32_t At = STORE_FLASH_PAGE; At < SNAPSHOT_SIZE; At += STORE_FLASH_PAGE) {
+    snapshotPage(&Header, At, Page);
+    Flash->Program(Offset + At, Page, STORE_FLASH_PAGE);
+  }
+  snapshotPage(&Header, 0, Page);
+  Flash->Program(Offset, Page, STORE_FLASH_PAGE);
+
+  Active = Area;
+  Sequence++;
+  LogNext = 0;
+  SpareErased = 0;
+  storeStats.Snapshots++;
+}
+
+// Append a change to the log. Programming only clears bits, so the rest of the flash page is
+// written as 0xFF. A full log is folded into a snapshot instead, which has the change in it already
+static void logRecord(uint32_t Kind, uint32_t Slot, uint32_t Block) {
+  StoreRecord Records[RECORDS_PER_PAGE];
+
+  if (LogNext == STORE_LOG_RECORDS) {
+    writeSnapshot();
+    return;
+  }
+  memset(Records, 0xFF, sizeof(Records));
+  StoreRecord *Record = &Records[LogNext % RECORDS_PER_PAGE];
+  Record->Slot = Slot;
+  Record->Block = Block;
+  Record->Kind = Kind;
+  Record->Check = recordCheck(Record);
+  Flash->Program(areaOffset(Active) + STORE_LOG_OFFSET + (LogNext - LogNext % RECORDS_PER_PAGE) * sizeof(StoreRecord),
+                 (const uint8_t *)Records, sizeof(Records));
+  LogNext++;
+}
+
+static void eraseSector(uint32_t Sector) {
+  Flash->Erase(blockOffset(Sector * STORE_SECTOR_BLOCKS));
+  for (uint32_t Block = Sector * STORE_SECTOR_BLOCKS; Block < (Sector + 1) * STORE_SECTOR_BLOCKS; Block++)
+    setErased(Block);
+  storeStats.Erases++;
+}
+
+// Writes leave a sector's worth of erased blocks alone, so garbage collection always has room to
+// move a sector's live blocks out of the way, even after a power cut part way through doing so
+static uint32_t available() { return ErasedBlocks > STORE_SECTOR_BLOCKS ? ErasedBlocks - STORE_SECTOR_BLOCKS : 0; }
+
+// The next erased block outside sector Skip, carrying on round the pool from the last one
+static int findErased(int Skip) {
+  for (uint32_t n = 0; n < STORE_BLOCKS; n++) {
+    uint32_t Block = AllocNext;
+    AllocNext = (AllocNext + 1) % STORE_BLOCKS;
+    if (isErased(Block) && (int)(Block / STORE_SECTOR_BLOCKS) != Skip)
+      return Block;
+  }
+  return -1;
+}
+
+// Make erased blocks out of ones nothing maps to any more. A sector with nothing live in it is
+// erased; otherwise the live blocks of the sector with fewest are moved to erased blocks elsewhere
+// first. Returns 0 if there's nothing to gain
+static int collect() {
+  int Victim = -1;
+  uint32_t VictimLive = STORE_SECTOR_BLOCKS, VictimErased = 0;
+
+  for (uint32_t Sector = 0; Sector < STORE_SECTORS; Sector++) {
+    uint32_t Live = 0, Dead = 0, Clear = 0;
+    for (uint32_t Block = Sector * STORE_SECTOR_BLOCKS; Block < (Sector + 1) * STORE_SECTOR_BLOCKS; Block++) {
+      if (Refs[Block])
+        Live++;
+      else if (isErased(Block))
+        Clear++;
+      else
+        Dead++;
+    }
+    if (!Dead)
+      continue;
+    if (!Live) {
+      eraseSector(Sector);
+      return 1;
+    }
+    if (Live < VictimLive) {
+      Victim = Sector;
+      VictimLive = Live;
+      VictimErased = Clear;
+    }
+  }
+  if (Victim < 0 || VictimLive > ErasedBlocks - VictimErased)
+    return 0;
+
+  uint32_t Buffer[STORE_BLOCK_SIZE / sizeof(uint32_t)]; // programming can't read from flash
+  for (uint32_t Block = Victim * STORE_SECTOR_BLOCKS; Block < (uint32_t)(Victim + 1) * STORE_SECTOR_BLOCKS; Block++) {
+    if (!Refs[Block])
+      continue;
+    uint32_t To = findErased(Victim);
+    memcpy(Buffer, blockData(Block), STORE_BLOCK_SIZE);
+    Flash->Program(blockOffset(To), (const uint8_t *)Buffer, STORE_BLOCK_SIZE);
+    clearErased(To);
+    moveBlock(Block, To);
+    logRecord(STORE_MOVE, Block, To);
+    uint32_t Hash = blockHash((const uint8_t *)Buffer);
+    if (Index[Hash] == Block)
+      Index[Hash] = To;
+    storeStats.Moves++;
+  }
+  eraseSector(Victim);
+  return 1;
+}
+
+static int allocate() {
+  while (!available())
+    if (!collect())
+      return -1;
+  return findErased(-1);
+}
+
+static int loadArea(uint32_t Area, uint32_t *Seq) {
+  const uint8_t *Base = Flash->Base + areaOffset(Area);
+  const StoreHeader *Header = (const StoreHeader *)Base;
+  const uint16_t *Blocks = (const uint16_t *)(Base + sizeof(StoreHeader));
+
+  if (Header->Magic != STORE_MAGIC || Header->Check != tablesCheck(Header->Sequence, Blocks, Blocks + STORE_SLOTS))
+    return 0;
+  for (uint32_t Slot = 0; Slot < STORE_SLOTS; Slot++)
+    if (Blocks[Slot] >= STORE_BLOCKS)
+      return 0;
+  *Seq = Header->Sequence;
+  return 1;
+}
+
+static void replayLog() {
+  const StoreRecord *Log = (const StoreRecord *)(Flash->Base + areaOffset(Active) + STORE_LOG_OFFSET);
+
+  LogNext = 0;
+  for (uint32_t i = 0; i < STORE_LOG_RECORDS; i++) {
+    StoreRecord Record = Log[i];
+    if (Record.Slot == 0xFFFF && Record.Block == 0xFFFF && Record.Kind == 0xFFFF && Record.Check == 0xFFFF)
+      continue; // erased
+    LogNext = i + 1; // appending carries on after anything programmed, torn or not
+    if (Record.Check != recordCheck(&Record) || Record.Block >= STORE_BLOCKS)
+      continue;
+    if (Record.Kind == STORE_MAP && Record.Slot < STORE_SLOTS) {
+      addRef(Record.Block);
+      dropRef(Map[Record.Slot]);
+      Map[Record.Slot] = Record.Block;
+    } else if (Record.Kind == STORE_MOVE && Record.Slot < STORE_BLOCKS) {
+      moveBlock(Record.Slot, Record.Block);
+    }
+  }
+}
+
+int storeInit(const StoreFlash *StoreFlash) {
+  uint32_t Seq[2];
+  int Valid[2];
+  int Result = STORE_LOADED;
+
+  Flash = StoreFlash;
+  memset(Index, 0xFF, sizeof(Index));
+
+  Valid[0] = loadArea(0, &Seq[0]);
+  Valid[1] = loadArea(1, &Seq[1]);
+  if (Valid[0] || Valid[1]) {
+    Active = Valid[1] && (!Valid[0] || Seq[1] > Seq[0]);
+    Sequence = Seq[Active];
+    const uint8_t *Base = Flash->Base + areaOffset(Active) + sizeof(StoreHeader);
+    memcpy(Map, Base, sizeof(Map));
+    memcpy(Refs, Base + sizeof(Map), sizeof(Refs));
+    replayLog();
+  } else {
+    // Older firmware's layout (or blank flash): page N block B is pool block (N - 1) * 256 + B.
+    // Blocks that are the same are shared straight away, which only changes the map
+    for (uint32_t Slot = 0; Slot < STORE_SLOTS; Slot++) {
+      uint32_t Hash = blockHash(blockData(Slot));
+      uint32_t Same = Index[Hash];
+      Refs[Slot] = 0;
+      if (Same != STORE_NONE && !memcmp(blockData(Same), blockData(Slot), STORE_BLOCK_SIZE)) {
+        Map[Slot] = Same;
+        Refs[Same]++;
+      } else {
+        Map[Slot] = Slot;
+        Refs[Slot] = 1;
+        Index[Hash] = Slot;
+      }
+    }
+    memset(&Refs[STORE_SLOTS], 0, sizeof(Refs) - STORE_SLOTS * sizeof(Refs[0]));
+    Active = 1;
+    Sequence = 0;
+    SpareErased = 0;
+    writeSnapshot(); // into area 0
+    Result = STORE_MIGRATED;
+  }
+
+  // Everything nothing maps to is either erased, or garbage for collect()
+  memset(Erased, 0, sizeof(Erased));
+  ErasedBlocks = 0;
+  storeStats.Live = 0;
+  for (uint32_t Block = 0; Block < STORE_BLOCKS; Block++) {
+    if (Refs[Block]) {
+      storeStats.Live++;
+      Index[blockHash(blockData(Block))] = Block;
+    } else if (blockIsErased(Block)) {
+      setErased(Block);
+    }
+  }
+
+  SpareErased = 0;
+  const uint32_t *Spare = (const uint32_t *)(Flash->Base + areaOffset(Active ^ 1));
+  for (uint32_t Sector = 0; Sector < STORE_AREA_SIZE / STORE_SECTOR_SIZE; Sector++) {
+    uint32_t i = 0;
+    while (i < STORE_SECTOR_SIZE / sizeof(uint32_t) && Spare[Sector * STORE_SECTOR_SIZE / sizeof(uint32_t) + i] == 0xFFFFFFFF)
+      i++;
+    if (i == STORE_SECTOR_SIZE / sizeof(uint32_t))
+      SpareErased |= 1u << Sector;
+  }
+
+  AllocNext = (Sequence * 1031 + LogNext * STORE_SECTOR_BLOCKS) % STORE_BLOCKS; // don't start wearing the same place each boot
+  storeStats.Erased = available();
+  return Result;
+}
+
+void storeReadPage(uint32_t Page, uint8_t *Card) {
+  for (uint32_t Block = 0; Block < STORE_PAGE_BLOCKS; Block++)
+    memcpy(&Card[Block * STORE_BLOCK_SIZE], blockData(Map[Page * STORE_PAGE_BLOCKS + Block]), STORE_BLOCK_SIZE);
+}
+
+uint32_t storeBlockOffset(uint32_t Page, uint32_t Block) { return blockOffset(Map[Page * STORE_PAGE_BLOCKS + Block]); }
+
+int storeWrite(uint32_t Page, uint32_t Block, const uint8_t *Data) {
+  uint32_t Slot = Page * STORE_PAGE_BLOCKS + Block;
+
+  if (!memcmp(blockData(Map[Slot]), Data, STORE_BLOCK_SIZE))
+    return 1;
+
+  // The index can be stale (or lose blocks to collisions), so what it points at is checked
+  uint32_t Hash = blockHash(Data);
+  uint32_t New = Index[Hash];
+  if (New != STORE_NONE && !isErased(New) && !memcmp(blockData(New), Data, STORE_BLOCK_SIZE)) {
+    storeStats.Shared++;
+  } else {
+    int Free = allocate();
+    if (Free < 0)
+      return 0;
+    New = Free;
+    Flash->Program(blockOffset(New), Data, STORE_BLOCK_SIZE);
+    storeStats.Writes++;
+    Index[Hash] = New;
+  }
+
+  // Only now the data's in flash does the map change, first in RAM then in the log.
+  // Read back the old block after allocate(), garbage collection may have moved it
+  addRef(New);
+  dropRef(Map[Slot]);
+  Map[Slot] = New;
+  logRecord(STORE_MAP, Slot, New);
+  storeStats.Erased = available();
+  return 1;
+}
+
+int storeIdleStep(void) {
+  int Done = 0;
+
+  if (available() < STORE_LOW_WATER && collect()) {
+    Done = 1;
+  } else if (LogNext >= STORE_LOG_RECORDS / 2 && SpareErased != (1u << (STORE_AREA_SIZE / STORE_SECTOR_SIZE)) - 1) {
+    uint32_t Sector = __builtin_ctz(~SpareErased);
+    Flash->Erase(areaOffset(Active ^ 1) + Sector * STORE_SECTOR_SIZE);
+    SpareErased |= 1u << Sector;
+    Done = 1;
+  }
+  storeStats.Erased = available();
+  return Done;
+}
+
+int storeCheck(void) {
+  static uint16_t Counts[STORE_BLOCKS];
+
+  memset(Counts, 0, sizeof(Counts));
+  for (uint32_t Slot = 0; Slot < STORE_SLOTS; Slot++) {
+    if (Map[Slot] >= STORE_BLOCKS || isErased(Map[Slot]))
+      return 0;
+    Counts[Map[Slot]]++;
+  }
+  for (uint32_t Block = 0; Block < STORE_BLOCKS; Block++) {
+    if (Refs[Block] != Counts[Block])
+      return 0;
+    if (isErased(Block) && !blockIsErased(Block))
+      return 0;
+  }
+  return 1;
+}
+
+uint32_t storeImportCheck(const StoreImport *Import) {
+  return ~(Import->Magic ^ (Import->Wipe << 8) ^ (Import->Load << 24) ^ 0x5AA55AA5);
+}
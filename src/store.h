@@ -0,0 +1,109 @@
+/* store.h
+ *  content-addressed block store under the 8 VMU pages. Identical 512 byte
+ *  blocks are kept once in flash: each page is a map from its 256 blocks to
+ *  blocks in a shared pool, with a refcount per pool block. Writes are
+ *  copy-on-write, a changed block goes to a block already holding the same
+ *  data or to an erased one and the map follows, so nothing is rewritten in
+ *  place. The map and refcounts live in one of two table areas, a snapshot
+ *  followed by a log of changes. No SDK dependencies, flash is reached
+ *  through StoreFlash so it can be built and checked on a PC
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#define STORE_BLOCK_SIZE 512
+#define STORE_PAGES 8
+#define STORE_PAGE_BLOCKS 256
+#define STORE_SLOTS (STORE_PAGES * STORE_PAGE_BLOCKS) // page blocks
+#define STORE_SECTOR_SIZE 4096                        // FLASH_SECTOR_SIZE
+#define STORE_SECTOR_BLOCKS (STORE_SECTOR_SIZE / STORE_BLOCK_SIZE)
+#define STORE_FLASH_PAGE 256                          // FLASH_PAGE_SIZE
+#define STORE_FLASH_SIZE (2 * 1024 * 1024)
+
+// Flash layout, offsets from the start of flash. Pool A is where pages 1-8 used to be kept as plain
+// 128KB images, so flash from older firmware is a store with every page mapped straight through.
+// flashData and the scrubber's checksum log (scrub.h) sit between it and the tables
+#define STORE_POOL_A 0x020000
+#define STORE_POOL_A_BLOCKS 2048
+#define STORE_TABLES 0x122000                    // two table areas
+#define STORE_AREA_SIZE (4 * STORE_SECTOR_SIZE) // snapshot in the first three sectors
+#define STORE_LOG_OFFSET (3 * STORE_SECTOR_SIZE) // and its log in the fourth
+#define STORE_IMPORT 0x12A000                    // a header sector then a page, see StoreImport
+#define STORE_IMPORT_SIZE (STORE_SECTOR_SIZE + STORE_PAGE_BLOCKS * STORE_BLOCK_SIZE)
+#define STORE_POOL_B (STORE_IMPORT + STORE_IMPORT_SIZE) // to the end of flash
+#define STORE_BLOCKS (STORE_POOL_A_BLOCKS + (STORE_FLASH_SIZE - STORE_POOL_B) / STORE_BLOCK_SIZE)
+
+typedef struct StoreFlash_s {
+  const uint8_t *Base;                                                  // start of flash, for reading
+  void (*Erase)(uint32_t Offset);                                       // one sector
+  void (*Program)(uint32_t Offset, const uint8_t *Data, uint32_t Size); // whole flash pages, Data in RAM
+} StoreFlash;
+
+typedef struct StoreHeader_s {
+  uint32_t Magic;
+  uint32_t Sequence; // the valid area with the highest is the current one
+  uint32_t Check;    // over the sequence, map and refcounts
+  uint32_t Reserved;
+} StoreHeader;
+
+// One change in a table area's log, applied to its snapshot in order
+typedef struct StoreRecord_s {
+  uint16_t Slot;  // page * STORE_PAGE_BLOCKS + block, or the pool block moved from
+  uint16_t Block; // pool block
+  uint16_t Kind;
+  uint16_t Check; // catches a record torn by a power cut
+} StoreRecord;
+
+#define STORE_MAP 1  // Slot now maps to Block
+#define STORE_MOVE 2 // every slot mapped to pool block Slot now maps to Block (garbage collection)
+#define STORE_LOG_RECORDS (STORE_SECTOR_SIZE / sizeof(StoreRecord))
+
+// Pages written by a data-only image (tools/make_image), taken into the store at boot
+typedef struct StoreImport_s {
+  uint32_t Magic;
+  uint32_t Wipe;  // pages to format blank, bit 0 for page 1
+  uint32_t Load;  // page (1-8) to load from the page image after the header sector, 0 for none
+  uint32_t Check;
+} StoreImport;
+
+#define STORE_IMPORT_MAGIC 0x504D4956
+
+typedef struct StoreStats_s {
+  uint32_t Live;      // pool blocks in use
+  uint32_t Erased;    // pool blocks ready to write, not counting those kept back for garbage collection
+  uint32_t Writes;    // blocks programmed
+  uint32_t Shared;    // writes that found their data already in the pool
+  uint32_t Erases;    // pool sectors erased
+  uint32_t Moves;     // blocks moved by garbage collection
+  uint32_t Snapshots; // table snapshots written
+} StoreStats;
+
+extern StoreStats storeStats;
+
+#define STORE_LOADED 0
+#define STORE_MIGRATED 1 // no tables, pages taken from where older firmware kept them
+
+// Load the tables (or build them from older firmware's layout) and find the erased pool blocks
+int storeInit(const StoreFlash *Flash);
+
+// Copy a page (counting from 0) out of the store
+void storeReadPage(uint32_t Page, uint8_t *Card);
+
+// Where a page block lives in flash
+uint32_t storeBlockOffset(uint32_t Page, uint32_t Block);
+
+// Write a page block, copy-on-write. Data must be in RAM. Returns 0 if the pool is full, which
+// can't happen as it's larger than all pages put together
+int storeWrite(uint32_t Page, uint32_t Block, const uint8_t *Data);
+
+// Flash work done ahead of time so writes rarely wait on an erase: collecting garbage when erased
+// blocks run low, and erasing the other table area a sector at a time for the next snapshot.
+// Returns 1 if it did something
+int storeIdleStep(void);
+
+// Refcounts match the map and nothing in use is taken as erased (for tools)
+int storeCheck(void);
+
+uint32_t storeImportCheck(const StoreImport *Import);
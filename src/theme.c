@@ -0,0 +1,75 @@
+/* theme.c
+ *  VMU screen colour themes
+ */
+
+#include "theme.h"
+
+#define HUE_STEPS 1536 // 6 sectors of 256
+#define RAINBOW_SPEED 24 // hue steps per tick, a full cycle in 3.2 s
+#define PULSE_TICKS 64   // breathing period, 3.2 s
+#define PULSE_PEAK 48    // brightest background, out of 256
+
+const char *const themeNames[THEME_COUNT] = {"Solid", "Gradient", "Rainbow", "Pulse"};
+
+// Each channel of an RGB565 colour times level / 256
+static uint16_t scaleColor(uint16_t color, int level) {
+  int r = ((color >> 11) * level) >> 8;
+  int g = (((color >> 5) & 0x3f) * level) >> 8;
+  int b = ((color & 0x1f) * level) >> 8;
+  return (r << 11) | (g << 5) | b;
+}
+
+// From a towards b by t / 256, per channel
+static uint16_t mixColor(uint16_t a, uint16_t b, int t) {
+  int r = (a >> 11) + ((((b >> 11) - (a >> 11)) * t) >> 8);
+  int g = ((a >> 5) & 0x3f) + (((((b >> 5) & 0x3f) - ((a >> 5) & 0x3f)) * t) >> 8);
+  int bl = (a & 0x1f) + ((((b & 0x1f) - (a & 0x1f)) * t) >> 8);
+  return (r << 11) | (g << 5) | bl;
+}
+
+// Fully saturated, full brightness hue, 0 to HUE_STEPS - 1 from red round to red
+static uint16_t hueColor(int hue) {
+  int up = hue & 0xff, down = 0xff - up;
+  int r, g, b;
+
+  switch (hue >> 8) {
+  case 0: r = 0xff, g = up, b = 0; break;
+  case 1: r = down, g = 0xff, b = 0; break;
+  case 2: r = 0, g = 0xff, b = up; break;
+  case 3: r = 0, g = down, b = 0xff; break;
+  case 4: r = up, g = 0, b = 0xff; break;
+  default: r = 0xff, g = 0, b = down; break;
+  }
+  return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+}
+
+bool themeAnimated(int theme) { return theme == THEME_RAINBOW || theme == THEME_PULSE; }
+
+void themeColors(int theme, uint16_t color, uint32_t tick, int rows, RowColors *colors) {
+  int phase = tick % PULSE_TICKS;
+  int pulse = (phase < PULSE_TICKS / 2 ? phase : PULSE_TICKS - phase) * PULSE_PEAK * 2 / PULSE_TICKS;
+
+  if (rows > ROW_COLORS)
+    rows = ROW_COLORS;
+
+  for (int row = 0; row < rows; row++) {
+    switch (theme) {
+    case THEME_GRADIENT: // pale at the top down to the page colour
+      colors->fg[row] = mixColor(0xffff, color, 96 + row * 160 / rows);
+      colors->bg[row] = 0;
+      break;
+    case THEME_RAINBOW: // the whole hue circle down the screen, scrolling up
+      colors->fg[row] = hueColor((row * HUE_STEPS / rows + tick * RAINBOW_SPEED) % HUE_STEPS);
+      colors->bg[row] = 0;
+      break;
+    case THEME_PULSE: // background glows in the page colour, fading towards the bottom
+      colors->fg[row] = color;
+      colors->bg[row] = scaleColor(color, pulse * (2 * rows - row) / (2 * rows));
+      break;
+    default:
+      colors->fg[row] = color;
+      colors->bg[row] = 0;
+      break;
+    }
+  }
+}
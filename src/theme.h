@@ -0,0 +1,25 @@
+/* theme.h
+ *  VMU screen colour themes, built on the page's palette colour as per row
+ *  colour tables for the blitters (no SDK dependencies so they can be built
+ *  and checked on a PC)
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "blit.h"
+
+typedef enum { THEME_SOLID, THEME_GRADIENT, THEME_RAINBOW, THEME_PULSE, THEME_COUNT } VMUTheme;
+
+#define THEME_FRAME_MS 50 // animated themes move on a tick every 50 ms
+
+extern const char *const themeNames[THEME_COUNT];
+
+// Whether the theme changes with the tick, i.e. the screen needs redrawing without a new frame
+bool themeAnimated(int theme);
+
+// Fill rows [0, rows) of colors for the theme over the page colour at the given tick.
+// Unknown themes (erased flash) are drawn solid. Costs the same few operations per row for every theme
+void themeColors(int theme, uint16_t color, uint32_t tick, int rows, RowColors *colors);
@@ -0,0 +1,245 @@
+// Checks the VMU blitters in src/blit.c against the original per-pixel
+// setPixel loops and times both. Absolute numbers are for the host CPU, the
+// ratio is what to look at.
+//
+// Build: gcc -O2 -o blit_bench blit_bench.c ../src/blit.c
+//        gcc -O2 -DBLIT_INTERP=1 -I. -o blit_bench_interp blit_bench.c ../src/blit.c
+//        (the interpolator path, run against the model in hardware/interp.h)
+// Usage: blit_bench [iterations]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "../src/blit.h"
+
+#define LCD_NumCols 6
+#define LCD_Height 32
+#define LCDFramebufferSize 192
+
+static uint8_t LCD[LCDFramebufferSize];
+static uint8_t TestLCD[128 * 64 / 8];
+static uint8_t RefRGB[96 * 64 * 2] __attribute__((aligned(4)));
+static uint8_t OutRGB[96 * 64 * 2] __attribute__((aligned(4)));
+static uint8_t RefPage[128 * 64 / 8];
+static uint8_t OutPage[128 * 64 / 8];
+static volatile uint32_t Sink;
+
+// setPixelSSD1331() and setPixelSSD1306() as in the firmware
+static void SetPixelRGB(int x, int y, uint16_t Color)
+{
+	RefRGB[(y * 192) + (x * 2)] = Color >> 8;
+	RefRGB[(y * 192) + (x * 2) + 1] = Color & 0xff;
+}
+
+static void SetPixelPage(int x, int y, int On)
+{
+	int ByteIdx = (y >> 3) * 128 + x;
+	uint8_t Mask = 1 << (y & 7);
+	if (On)
+		RefPage[ByteIdx] |= Mask;
+	else
+		RefPage[ByteIdx] &= ~Mask;
+}
+
+static RowColors Table;
+
+// the original drawing loop from maple.c, with the colour looked up per row
+static void ReferenceDraw(int RGB)
+{
+	for (int fb = 0; fb < LCDFramebufferSize; fb++)
+	{
+		int y = (fb / LCD_NumCols) * 2;
+		int mod = (fb % LCD_NumCols) * 16;
+		for (int bb = 0; bb <= 7; bb++)
+		{
+			int x = mod + (14 - bb * 2);
+			int On = (LCD[fb] >> bb) & 0x01;
+			uint16_t Pixel = On ? Table.fg[y / 2] : Table.bg[y / 2];
+			for (int i = 0; i < 4; i++)
+			{
+				if (RGB)
+					SetPixelRGB(x + (i & 1), y + (i >> 1), Pixel);
+				else
+					SetPixelPage(x + 16 + (i & 1), y + (i >> 1), On && Table.fg[0]);
+			}
+		}
+	}
+}
+
+// Scale2x straight from its definition, one pixel at a time, edges repeating
+static int VMUPixel(int x, int y)
+{
+	x = x < 0 ? 0 : x > 47 ? 47 : x;
+	y = y < 0 ? 0 : y > LCD_Height - 1 ? LCD_Height - 1 : y;
+	return (LCD[y * LCD_NumCols + x / 8] >> (7 - x % 8)) & 1;
+}
+
+static void ReferenceScale2x(void)
+{
+	for (int y = 0; y < LCD_Height; y++)
+	{
+		for (int x = 0; x < 48; x++)
+		{
+			int P = VMUPixel(x, y), A = VMUPixel(x, y - 1), B = VMUPixel(x + 1, y);
+			int C = VMUPixel(x - 1, y), D = VMUPixel(x, y + 1);
+			int E[4];
+			E[0] = C == A && C != D && A != B ? A : P;
+			E[1] = A == B && A != C && B != D ? B : P;
+			E[2] = D == C && D != B && C != A ? C : P;
+			E[3] = B == D && B != A && D != C ? D : P;
+			for (int i = 0; i < 4; i++)
+				SetPixelRGB(x * 2 + (i & 1), y * 2 + (i >> 1), E[i] ? Table.fg[y] : Table.bg[y]);
+		}
+	}
+}
+
+// the same per-pixel approach at 1:1 for the 128x64 test mode screen,
+// cropped to the middle 96 columns on the SSD1331
+static void ReferenceDrawTest(void)
+{
+	for (int y = 0; y < 64; y++)
+	{
+		for (int x = 0; x < 128; x++)
+		{
+			int On = (TestLCD[y * 16 + x / 8] >> (7 - (x & 7))) & 1;
+			if (x >= 16 && x < 112)
+				SetPixelRGB(x - 16, y, On ? Table.fg[y] : Table.bg[y]);
+			SetPixelPage(x, y, On && Table.fg[0]);
+		}
+	}
+}
+
+static double Now(void)
+{
+	struct timespec Ts;
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return Ts.tv_sec + Ts.tv_nsec * 1e-9;
+}
+
+// Gradient picks random per row colours on a random background instead of Color on black.
+// The SSD1306 blitters only take on/off, so they're checked with solid colours
+static int Check(uint16_t Color, int Gradient)
+{
+	memset(RefRGB, 0x55, sizeof(RefRGB));
+	memset(OutRGB, 0x55, sizeof(OutRGB));
+	memset(RefPage, 0x55, sizeof(RefPage));
+	memset(OutPage, 0x55, sizeof(OutPage));
+
+	rowColorsSolid(&Table, Color);
+	if (Gradient)
+		for (int Row = 0; Row < ROW_COLORS; Row++)
+		{
+			Table.fg[Row] = rand();
+			Table.bg[Row] = rand();
+		}
+
+	ReferenceDraw(1);
+	ReferenceDraw(0);
+	vmuBlitRGB565(LCD, LCD_NumCols, 0, LCD_Height, &Table, OutRGB, 192);
+	vmuBlitPage(LCD, LCD_NumCols, 0, LCD_Height, Color != 0, OutPage, 128, 16);
+
+	if (memcmp(RefRGB, OutRGB, sizeof(RefRGB)))
+	{
+		fprintf(stderr, "vmuBlitRGB565 mismatch (colour %04x)\n", Color);
+		return 0;
+	}
+	if (!Gradient && memcmp(RefPage, OutPage, sizeof(RefPage)))
+	{
+		fprintf(stderr, "vmuBlitPage mismatch (colour %04x)\n", Color);
+		return 0;
+	}
+
+	ReferenceScale2x();
+	vmuBlitRGB565Smooth(LCD, LCD_NumCols, LCD_Height, 0, LCD_Height, &Table, OutRGB, 192);
+
+	if (memcmp(RefRGB, OutRGB, sizeof(RefRGB)))
+	{
+		fprintf(stderr, "vmuBlitRGB565Smooth mismatch (colour %04x)\n", Color);
+		return 0;
+	}
+
+	ReferenceDrawTest();
+	testBlitRGB565(TestLCD, 16, 2, 14, 0, 64, &Table, OutRGB, 192);
+	testBlitPage(TestLCD, 16, 0, 64, Color != 0, OutPage, 128, 0);
+
+	if (memcmp(RefRGB, OutRGB, sizeof(RefRGB)))
+	{
+		fprintf(stderr, "testBlitRGB565 mismatch (colour %04x)\n", Color);
+		return 0;
+	}
+	if (!Gradient && memcmp(RefPage, OutPage, sizeof(RefPage)))
+	{
+		fprintf(stderr, "testBlitPage mismatch (colour %04x)\n", Color);
+		return 0;
+	}
+	return 1;
+}
+
+int main(int argc, char *argv[])
+{
+	int Iterations = argc > 1 ? atoi(argv[1]) : 20000;
+	const uint16_t Colors[] = { 0x0000, 0xffff, 0xf81f, 0x1234 };
+
+	srand(1);
+	for (int Frame = 0; Frame < 64; Frame++)
+	{
+		for (int i = 0; i < LCDFramebufferSize; i++)
+			LCD[i] = Frame == 0 ? 0xff : rand();
+		for (int i = 0; i < (int)sizeof(TestLCD); i++)
+			TestLCD[i] = Frame == 0 ? 0xff : rand();
+		for (int c = 0; c < (int)(sizeof(Colors) / sizeof(Colors[0])); c++)
+			if (!Check(Colors[c], 0) || !Check(Colors[c], 1))
+				return 1;
+	}
+	printf("Output matches the setPixel loops%s\n", BLIT_INTERP ? " (interp0 model)" : "");
+
+	rowColorsSolid(&Table, 0xffff);
+	double Start = Now();
+	for (int i = 0; i < Iterations; i++)
+	{
+		ReferenceDraw(1);
+		Sink += RefRGB[i & 0xff];
+	}
+	double RefRGBTime = Now() - Start;
+
+	Start = Now();
+	for (int i = 0; i < Iterations; i++)
+	{
+		vmuBlitRGB565(LCD, LCD_NumCols, 0, LCD_Height, &Table, OutRGB, 192);
+		Sink += OutRGB[i & 0xff];
+	}
+	double BlitRGBTime = Now() - Start;
+
+	Start = Now();
+	for (int i = 0; i < Iterations; i++)
+	{
+		vmuBlitRGB565Smooth(LCD, LCD_NumCols, LCD_Height, 0, LCD_Height, &Table, OutRGB, 192);
+		Sink += OutRGB[i & 0xff];
+	}
+	double SmoothTime = Now() - Start;
+
+	Start = Now();
+	for (int i = 0; i < Iterations; i++)
+	{
+		ReferenceDraw(0);
+		Sink += RefPage[i & 0xff];
+	}
+	double RefPageTime = Now() - Start;
+
+	Start = Now();
+	for (int i = 0; i < Iterations; i++)
+	{
+		vmuBlitPage(LCD, LCD_NumCols, 0, LCD_Height, 1, OutPage, 128, 16);
+		Sink += OutPage[i & 0xff];
+	}
+	double BlitPageTime = Now() - Start;
+
+	printf("SSD1331: setPixel %.2f us/frame, blit %.2f us/frame (%.1fx)\n",
+		RefRGBTime * 1e6 / Iterations, BlitRGBTime * 1e6 / Iterations, RefRGBTime / BlitRGBTime);
+	printf("Scale2x: %.2f us/frame (%.1fx the doubling blit)\n", SmoothTime * 1e6 / Iterations, SmoothTime / BlitRGBTime);
+	printf("SSD1306: setPixel %.2f us/frame, blit %.2f us/frame (%.1fx)\n",
+		RefPageTime * 1e6 / Iterations, BlitPageTime * 1e6 / Iterations, RefPageTime / BlitPageTime);
+	return 0;
+}
@@ -0,0 +1,422 @@
+// Host stand-in for the OLEDs: renders VMU screens, test mode screens and
+// menu text into an in-memory SSD1331 (RGB565) or SSD1306 (page) buffer with
+// the same src/blit.c routines the firmware uses, and writes the result as a
+// PPM. Every render is also done pixel by pixel from the source data and the
+// two must match, so a blitter change that moves a single pixel fails here.
+// -g compares against a saved frame (golden image), -b times the fast path.
+//
+// Build: gcc -O2 -o display_emu display_emu.c ../src/blit.c ../src/theme.c ../src/font.c
+// Usage: display_emu [-p ssd1331|ssd1306] [-c <rgb565 hex>] [-t <theme> [-k <tick>]] [-s] [-r] [-o out.ppm] [-g golden.ppm] [-b <iterations>]
+//                    vmu [lcd.bin] | test [lcd.bin] | text <line>...
+//
+// vmu takes a 192 byte VMU LCD image and test a 1024 byte 128x64 one, both
+// 1bpp MSB first; without a file a test pattern is used. text puts up to five
+// lines in the menu's font and layout. -t draws the VMU screens in a colour
+// theme (0 solid, 1 gradient, 2 rainbow, 3 pulse, see src/theme.h) over the
+// -c colour, at animation tick -k; the SSD1306 is always solid. -s upscales
+// the VMU screen with Scale2x instead of doubling it (colour panels). -r turns the
+// output 180 degrees, the way the panel shows it with OLED Flip off.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "../src/blit.h"
+#include "../src/theme.h"
+#include "../src/font.h"
+
+#define UI_W 96
+#define UI_H 64
+#define PANEL_W 128 // widest panel, the SSD1306
+#define PANEL_H 64
+#define VMU_SIZE 192
+#define TEST_SIZE 1024
+
+extern tFont Font;
+
+typedef enum { SCENE_VMU, SCENE_TEST, SCENE_TEXT } Scene;
+
+static int Page;        // SSD1306 rather than SSD1331
+static int Width;       // panel width, 96 or 128
+static int XOffset;     // where the 96x64 UI area starts
+static uint16_t Color = 0xffff;
+static int Theme = THEME_SOLID;
+static uint32_t Tick;
+static RowColors Colors; // Color in Theme, per row
+static int Smooth;
+
+static uint8_t Source[TEST_SIZE];
+static const char *Lines[5];
+static int NumLines;
+
+static uint8_t Fast[PANEL_W * PANEL_H * 2] __attribute__((aligned(4)));
+static uint16_t Ref[PANEL_W * PANEL_H]; // reference output, one RGB565 value per pixel
+
+static double Now(void)
+{
+	struct timespec Ts;
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return Ts.tv_sec + Ts.tv_nsec * 1e-9;
+}
+
+// Pixel (x, y) of the fast buffer as RGB565, lit SSD1306 pixels in Color
+static uint16_t FastPixel(int x, int y)
+{
+	if (Page)
+		return (Fast[(y >> 3) * PANEL_W + x] >> (y & 7)) & 1 ? Color : 0;
+	return Fast[(y * Width + x) * 2] << 8 | Fast[(y * Width + x) * 2 + 1];
+}
+
+static void RefPixel(int x, int y, uint16_t Value)
+{
+	if (x >= 0 && x < UI_W && y >= 0 && y < UI_H)
+		Ref[y * Width + x + XOffset] = Page ? (Value ? Color : 0) : Value;
+}
+
+static int FontIndex(char c)
+{
+	for (int i = 0; i < Font.length; i++)
+		if (Font.chars[i].code == c)
+			return i;
+	return -1;
+}
+
+// The menu's putString(), right to left from x 88, lines 12 pixels apart
+// from the bottom. Whole cells go through the glyph atlas in one call per
+// line, cells hanging off the left edge are clipped a pixel at a time
+static void FastText(void)
+{
+	for (int Line = 0; Line < NumLines; Line++)
+	{
+		int Len = strlen(Lines[Line]);
+		int Right = 88 - 1;
+		int y = 59 - Line * 12 - 9;
+		char Cells[UI_W / GLYPH_W];
+		int n = 0, Left = 0;
+
+		for (int i = Len - 1; i >= 0; i--)
+		{
+			int x = Right - GLYPH_W * (i + 1);
+			const Glyph *G = glyphFor(Lines[Line][i]);
+
+			if (x >= 0)
+			{
+				if (n == 0)
+					Left = x;
+				Cells[n++] = Lines[Line][i];
+			}
+			else if (x + GLYPH_W > 0)
+			{
+				for (int r = 0; r < GLYPH_H; r++)
+					for (int c = -x; c < GLYPH_W; c++)
+					{
+						int On = G->rows[r] & (0x80 >> c);
+						if (Page)
+							pageFillRect(Fast, PANEL_W, x + c + XOffset, x + c + XOffset + 1, y + r, y + r + 1, On && Color);
+						else
+							rgbFillRect(Fast, Width * 2, x + c + XOffset, x + c + XOffset + 1, y + r, y + r + 1, On ? Color : 0);
+					}
+			}
+		}
+		if (!n)
+			continue;
+		if (Page)
+			pageBlitText(Fast, PANEL_W, Cells, n, Left + XOffset, y, Color != 0, 0);
+		else
+			rgbBlitText(Fast, Width * 2, Cells, n, Left + XOffset, y, Color, 0);
+	}
+}
+
+static void RefText(void)
+{
+	for (int Line = 0; Line < NumLines; Line++)
+	{
+		for (int i = 0; Lines[Line][i]; i++)
+		{
+			int Index = FontIndex(Lines[Line][i]);
+			if (Index < 0)
+				continue;
+			const uint8_t *a = Font.chars[Index].image->data;
+			for (int r = 0; r <= 9; r++)
+				for (int j = 2; j <= 7; j++)
+					RefPixel(88 - i * 6 - j, 59 - Line * 12 - r, ((1 << j) & a[r]) ? 0 : Color);
+		}
+	}
+}
+
+static void RenderFast(Scene What)
+{
+	switch (What)
+	{
+	case SCENE_VMU:
+		if (Page)
+			vmuBlitPage(Source, 6, 0, 32, Color != 0, Fast, PANEL_W, XOffset);
+		else if (Smooth)
+			vmuBlitRGB565Smooth(Source, 6, 32, 0, 32, &Colors, Fast, Width * 2);
+		else
+			vmuBlitRGB565(Source, 6, 0, 32, &Colors, Fast, Width * 2);
+		break;
+	case SCENE_TEST:
+		if (Page)
+			testBlitPage(Source, 16, 0, 64, Color != 0, Fast, PANEL_W, 0);
+		else
+			testBlitRGB565(Source, 16, 2, 14, 0, 64, &Colors, Fast, Width * 2);
+		break;
+	case SCENE_TEXT:
+		FastText();
+		break;
+	}
+}
+
+// VMU pixel, edges repeating
+static int VMUPixel(int x, int y)
+{
+	x = x < 0 ? 0 : x > 47 ? 47 : x;
+	y = y < 0 ? 0 : y > 31 ? 31 : y;
+	return (Source[y * 6 + x / 8] >> (7 - x % 8)) & 1;
+}
+
+// Scale2x as it's defined: each pixel P to 2x2, taking a neighbour's value
+// where P sits on a diagonal edge between them
+static void RefScale2x(void)
+{
+	for (int y = 0; y < 32; y++)
+		for (int x = 0; x < 48; x++)
+		{
+			int P = VMUPixel(x, y), A = VMUPixel(x, y - 1), B = VMUPixel(x + 1, y);
+			int C = VMUPixel(x - 1, y), D = VMUPixel(x, y + 1);
+			int E[4] = {
+				C == A && C != D && A != B ? A : P,
+				A == B && A != C && B != D ? B : P,
+				D == C && D != B && C != A ? C : P,
+				B == D && B != A && D != C ? D : P,
+			};
+			for (int i = 0; i < 4; i++)
+				RefPixel(x * 2 + (i & 1), y * 2 + (i >> 1), E[i] ? Colors.fg[y] : Colors.bg[y]);
+		}
+}
+
+// Straight from the source data, no tables or word tricks
+static void RenderRef(Scene What)
+{
+	switch (What)
+	{
+	case SCENE_VMU:
+		if (Smooth && !Page)
+		{
+			RefScale2x();
+			break;
+		}
+		for (int y = 0; y < UI_H; y++)
+			for (int x = 0; x < UI_W; x++)
+				RefPixel(x, y, (Source[(y / 2) * 6 + x / 16] >> (7 - (x / 2) % 8)) & 1 ? Colors.fg[y / 2] : Colors.bg[y / 2]);
+		break;
+	case SCENE_TEST:
+		for (int y = 0; y < 64; y++)
+			for (int x = 0; x < Width; x++)
+			{
+				int TestX = x + (128 - Width) / 2;
+				Ref[y * Width + x] = (Source[y * 16 + TestX / 8] >> (7 - TestX % 8)) & 1 ? Colors.fg[y] : Colors.bg[y];
+			}
+		break;
+	case SCENE_TEXT:
+		RefText();
+		break;
+	}
+}
+
+static int Compare(void)
+{
+	int Bad = 0;
+	for (int y = 0; y < PANEL_H; y++)
+		for (int x = 0; x < Width; x++)
+			if (FastPixel(x, y) != Ref[y * Width + x])
+			{
+				if (!Bad)
+					fprintf(stderr, "First difference at %d,%d: blit %04x, reference %04x\n", x, y, FastPixel(x, y), Ref[y * Width + x]);
+				Bad++;
+			}
+	return Bad;
+}
+
+// RGB888 frame as seen on the panel
+static void ToRGB(uint8_t *Out, int Rotate)
+{
+	for (int y = 0; y < PANEL_H; y++)
+		for (int x = 0; x < Width; x++)
+		{
+			uint16_t v = Rotate ? FastPixel(Width - 1 - x, PANEL_H - 1 - y) : FastPixel(x, y);
+			uint8_t *p = &Out[(y * Width + x) * 3];
+			p[0] = ((v >> 11) & 0x1f) * 255 / 31;
+			p[1] = ((v >> 5) & 0x3f) * 255 / 63;
+			p[2] = (v & 0x1f) * 255 / 31;
+		}
+}
+
+static int WritePPM(const char *Path, const uint8_t *RGB)
+{
+	FILE *File = fopen(Path, "wb");
+	if (!File)
+	{
+		fprintf(stderr, "Can't create %s\n", Path);
+		return 0;
+	}
+	fprintf(File, "P6\n%d %d\n255\n", Width, PANEL_H);
+	fwrite(RGB, 3, Width * PANEL_H, File);
+	fclose(File);
+	return 1;
+}
+
+// Only reads what WritePPM() writes
+static int ReadPPM(const char *Path, uint8_t *RGB)
+{
+	FILE *File = fopen(Path, "rb");
+	int w, h, Max;
+	if (!File)
+	{
+		fprintf(stderr, "Can't open %s\n", Path);
+		return 0;
+	}
+	if (fscanf(File, "P6 %d %d %d", &w, &h, &Max) != 3 || fgetc(File) == EOF || w != Width || h != PANEL_H || Max != 255 ||
+		fread(RGB, 3, w * h, File) != (size_t)(w * h))
+	{
+		fprintf(stderr, "%s isn't a %dx%d PPM from this tool\n", Path, Width, PANEL_H);
+		fclose(File);
+		return 0;
+	}
+	fclose(File);
+	return 1;
+}
+
+static int Usage(void)
+{
+	fprintf(stderr, "Usage: display_emu [-p ssd1331|ssd1306] [-c <rgb565 hex>] [-t <theme> [-k <tick>]] [-s] [-r] [-o out.ppm] [-g golden.ppm] [-b <iterations>]\n"
+		"                   vmu [lcd.bin] | test [lcd.bin] | text <line>...\n");
+	return 2;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *OutPath = NULL, *GoldenPath = NULL;
+	int Iterations = 0, Rotate = 0;
+	Scene What;
+	int a = 1;
+
+	for (; a < argc && argv[a][0] == '-'; a++)
+	{
+		if (!strcmp(argv[a], "-p") && a + 1 < argc)
+		{
+			a++;
+			if (!strcmp(argv[a], "ssd1306"))
+				Page = 1;
+			else if (strcmp(argv[a], "ssd1331"))
+				return Usage();
+		}
+		else if (!strcmp(argv[a], "-c") && a + 1 < argc)
+			Color = strtoul(argv[++a], NULL, 16);
+		else if (!strcmp(argv[a], "-t") && a + 1 < argc)
+			Theme = atoi(argv[++a]);
+		else if (!strcmp(argv[a], "-k") && a + 1 < argc)
+			Tick = strtoul(argv[++a], NULL, 0);
+		else if (!strcmp(argv[a], "-s"))
+			Smooth = 1;
+		else if (!strcmp(argv[a], "-r"))
+			Rotate = 1;
+		else if (!strcmp(argv[a], "-o") && a + 1 < argc)
+			OutPath = argv[++a];
+		else if (!strcmp(argv[a], "-g") && a + 1 < argc)
+			GoldenPath = argv[++a];
+		else if (!strcmp(argv[a], "-b") && a + 1 < argc)
+			Iterations = atoi(argv[++a]);
+		else
+			return Usage();
+	}
+	if (a >= argc)
+		return Usage();
+
+	glyphAtlasBuild(&Font);
+	Width = Page ? 128 : 96;
+	XOffset = Page ? 16 : 0;
+
+	if (!strcmp(argv[a], "vmu") || !strcmp(argv[a], "test"))
+	{
+		What = argv[a][0] == 'v' ? SCENE_VMU : SCENE_TEST;
+		int Size = What == SCENE_VMU ? VMU_SIZE : TEST_SIZE;
+		if (a + 1 < argc)
+		{
+			FILE *File = fopen(argv[a + 1], "rb");
+			if (!File || fread(Source, 1, Size, File) != (size_t)Size)
+			{
+				fprintf(stderr, "Need %d bytes from %s\n", Size, argv[a + 1]);
+				return 1;
+			}
+			fclose(File);
+		}
+		else // diagonal stripes, a border and a solid corner, so a shifted or mirrored pixel shows
+		{
+			int w = What == SCENE_VMU ? 48 : 128, h = What == SCENE_VMU ? 32 : 64;
+			for (int y = 0; y < h; y++)
+				for (int x = 0; x < w; x++)
+					if ((x + y) % 5 == 0 || x == 0 || y == 0 || x == w - 1 || y == h - 1 || (x < 6 && y < 4))
+						Source[y * (w / 8) + x / 8] |= 0x80 >> (x % 8);
+		}
+	}
+	else if (!strcmp(argv[a], "text"))
+	{
+		What = SCENE_TEXT;
+		for (a++; a < argc && NumLines < 5; a++)
+			Lines[NumLines++] = argv[a];
+	}
+	else
+		return Usage();
+
+	// the firmware only themes colour panels
+	themeColors(Page ? THEME_SOLID : Theme, Color, Tick, What == SCENE_VMU ? 32 : 64, &Colors);
+
+	RenderFast(What);
+	RenderRef(What);
+	int Bad = Compare();
+	if (Bad)
+	{
+		fprintf(stderr, "%d pixels differ from the reference render\n", Bad);
+		return 1;
+	}
+
+	static uint8_t RGB[PANEL_W * PANEL_H * 3], Golden[PANEL_W * PANEL_H * 3];
+	ToRGB(RGB, Rotate);
+
+	if (OutPath && !WritePPM(OutPath, RGB))
+		return 1;
+
+	if (GoldenPath)
+	{
+		if (!ReadPPM(GoldenPath, Golden))
+			return 1;
+		Bad = 0;
+		for (int i = 0; i < Width * PANEL_H; i++)
+			Bad += memcmp(&RGB[i * 3], &Golden[i * 3], 3) != 0;
+		if (Bad)
+		{
+			fprintf(stderr, "%d pixels differ from %s\n", Bad, GoldenPath);
+			return 1;
+		}
+	}
+
+	if (Iterations > 0)
+	{
+		double Start = Now();
+		for (int i = 0; i < Iterations; i++)
+			RenderFast(What);
+		double Elapsed = Now() - Start;
+		printf("%.2f us/frame\n", Elapsed * 1e6 / Iterations);
+
+		// what an animated theme adds to each frame before it's drawn
+		Start = Now();
+		for (uint32_t i = 0; i < (uint32_t)Iterations; i++)
+			themeColors(Theme, Color, i, 64, &Colors);
+		Elapsed = Now() - Start;
+		printf("%.2f us/colour table\n", Elapsed * 1e6 / Iterations);
+	}
+	return 0;
+}
@@ -0,0 +1,104 @@
+// Gets VMU pages out of a MaplePad flash dump. Pages are kept in the block
+// store (src/store.h), shared blocks and all, so a page isn't a plain 128KB
+// stretch of flash any more: the store is loaded from the dump as the firmware
+// would and each page read back through its block map. Dumps from older
+// firmware, which did keep plain pages, come out the same way.
+//
+// Build: gcc -O2 -o dump_pages dump_pages.c ../src/store.c
+// Usage: dump_pages flash.bin [page 1-8]...
+//
+// flash.bin is everything from the first page on:
+// picotool save -r 10020000 10200000 flash.bin
+// Each page is written as dump<page>.bin, all eight without a page list.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../src/store.h"
+
+#define CARD_SIZE (STORE_PAGE_BLOCKS * STORE_BLOCK_SIZE)
+
+static uint8_t Flash[STORE_FLASH_SIZE] __attribute__((aligned(4)));
+static uint8_t Card[CARD_SIZE];
+
+// Loading the store can write to flash (the first time, or after a power cut), which only
+// changes this copy
+static void FlashErase(uint32_t Offset)
+{
+	memset(&Flash[Offset], 0xFF, STORE_SECTOR_SIZE);
+}
+
+static void FlashProgram(uint32_t Offset, const uint8_t *Data, uint32_t Size)
+{
+	for (uint32_t i = 0; i < Size; i++)
+	{
+		Flash[Offset + i] &= Data[i];
+	}
+}
+
+static const StoreFlash RamFlash = {Flash, FlashErase, FlashProgram};
+
+int main(int argc, char **argv)
+{
+	int Bad = argc < 2;
+	for (int i = 2; i < argc; i++)
+	{
+		Bad |= atoi(argv[i]) < 1 || atoi(argv[i]) > STORE_PAGES;
+	}
+	if (Bad)
+	{
+		fprintf(stderr, "Usage: dump_pages flash.bin [page 1-8]...\n"
+						"  flash.bin from picotool save -r 10020000 10200000 flash.bin\n");
+		return 1;
+	}
+
+	FILE *File = fopen(argv[1], "rb");
+	if (!File)
+	{
+		fprintf(stderr, "Can't open %s\n", argv[1]);
+		return 1;
+	}
+	memset(Flash, 0xFF, sizeof(Flash));
+	uint32_t Size = fread(&Flash[STORE_POOL_A], 1, STORE_FLASH_SIZE - STORE_POOL_A, File);
+	fclose(File);
+	if (Size != STORE_FLASH_SIZE - STORE_POOL_A)
+	{
+		fprintf(stderr, "%s should be a %u byte dump from 0x10020000\n", argv[1], STORE_FLASH_SIZE - STORE_POOL_A);
+		return 1;
+	}
+
+	int Loaded = storeInit(&RamFlash);
+	if (!storeCheck())
+	{
+		fprintf(stderr, "Block store in %s doesn't add up\n", argv[1]);
+		return 1;
+	}
+	printf("%s: %s, %u pool blocks in use\n", argv[1], Loaded == STORE_MIGRATED ? "plain pages from older firmware" : "block store", storeStats.Live);
+
+	for (int Page = 1; Page <= STORE_PAGES; Page++)
+	{
+		int Wanted = argc == 2;
+		for (int i = 2; i < argc; i++)
+		{
+			Wanted |= atoi(argv[i]) == Page;
+		}
+		if (!Wanted)
+		{
+			continue;
+		}
+
+		char Path[32];
+		snprintf(Path, sizeof(Path), "dump%d.bin", Page);
+		storeReadPage(Page - 1, Card);
+		File = fopen(Path, "wb");
+		if (!File || fwrite(Card, 1, CARD_SIZE, File) != CARD_SIZE)
+		{
+			fprintf(stderr, "Failed writing %s\n", Path);
+			return 1;
+		}
+		fclose(File);
+		printf("Wrote %s\n", Path);
+	}
+	return 0;
+}
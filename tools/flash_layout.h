@@ -0,0 +1,107 @@
+// Flash layout shared with the firmware. Keep in sync with maple.c and menu.h
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#define FLASH_OFFSET (128 * 1024) // maple.c: firmware lives below this, VMU pages in the block store above (src/store.h)
+#define NUM_PAGES 8
+#define FLASH_DATA_OFFSET (FLASH_OFFSET * 9) // maple.c: flashData[] sector
+#define FLASH_DATA_SIZE 64
+#define FLASH_SECTOR_SIZE 4096
+#define CHECKSUM_LOG_OFFSET (FLASH_DATA_OFFSET + FLASH_SECTOR_SIZE) // maple.c: scrubber's checksum log (scrub.h)
+#define CARD_SIZE (128 * 1024)
+
+#define CURRENT_FW_VERSION 0x0A // maple.h: VER_1_5
+
+// flashData indices (menu.h)
+enum EFlashData
+{
+	FD_xCenter = 0,
+	FD_xMin,
+	FD_xMax,
+	FD_yCenter,
+	FD_yMin,
+	FD_yMax,
+	FD_lMin,
+	FD_lMax,
+	FD_rMin,
+	FD_rMax,
+	FD_invertX,
+	FD_invertY,
+	FD_invertL,
+	FD_invertR,
+	FD_firstBoot,
+	FD_currentPage,
+	FD_rumbleEnable,
+	FD_vmuEnable,
+	FD_oledFlip,
+	FD_swapXY,
+	FD_swapLR,
+	FD_oledType,
+	FD_triggerMode,
+	FD_xDeadzone,
+	FD_xAntiDeadzone,
+	FD_yDeadzone,
+	FD_yAntiDeadzone,
+	FD_lDeadzone,
+	FD_lAntiDeadzone,
+	FD_rDeadzone,
+	FD_rAntiDeadzone,
+	FD_autoResetEnable,
+	FD_autoResetTimer,
+	FD_version,
+	FD_settingsImport,
+	FD_flashErrors,
+	FD_bootVideo,
+	FD_vmuTheme,
+	FD_vmuSmooth
+};
+
+#define SETTINGS_IMPORT_MAGIC 0xA5 // menu.h
+
+// Same defaults main() writes on first boot
+static inline void DefaultFlashData(uint8_t *FlashData)
+{
+	memset(FlashData, 0xFF, FLASH_DATA_SIZE); // untouched bytes read back as erased flash
+
+	FlashData[FD_xMin] = 0x00;
+	FlashData[FD_xCenter] = 0x80;
+	FlashData[FD_xMax] = 0xff;
+	FlashData[FD_xDeadzone] = 0x0f;
+	FlashData[FD_xAntiDeadzone] = 0x04;
+	FlashData[FD_invertX] = 0;
+
+	FlashData[FD_yMin] = 0x00;
+	FlashData[FD_yCenter] = 0x00;
+	FlashData[FD_yMax] = 0xff;
+	FlashData[FD_yDeadzone] = 0x0f;
+	FlashData[FD_yAntiDeadzone] = 0x04;
+	FlashData[FD_invertY] = 0;
+
+	FlashData[FD_lMin] = 0x00;
+	FlashData[FD_lMax] = 0xff;
+	FlashData[FD_lDeadzone] = 0x00;
+	FlashData[FD_lAntiDeadzone] = 0x04;
+	FlashData[FD_invertL] = 0;
+
+	FlashData[FD_rMin] = 0x00;
+	FlashData[FD_rMax] = 0xff;
+	FlashData[FD_rDeadzone] = 0x00;
+	FlashData[FD_rAntiDeadzone] = 0x04;
+	FlashData[FD_invertR] = 0;
+
+	FlashData[FD_currentPage] = 1;
+	FlashData[FD_oledFlip] = 0;
+	FlashData[FD_swapXY] = 0;
+	FlashData[FD_swapLR] = 0;
+	FlashData[FD_autoResetEnable] = 0;
+	FlashData[FD_autoResetTimer] = 0x5A; // 180s
+	FlashData[FD_flashErrors] = 0;
+	FlashData[FD_bootVideo] = 0;
+	FlashData[FD_vmuTheme] = 0; // THEME_SOLID
+	FlashData[FD_vmuSmooth] = 0;
+	FlashData[FD_version] = CURRENT_FW_VERSION;
+
+	FlashData[FD_firstBoot] = 0; // skip first boot pre-format
+}
@@ -0,0 +1,282 @@
+// Times a BIOS "format memory card" against a simulated VMU page, with and
+// without the fast path in src/format.c (FormatBlockWritten). Each frame the
+// console sends some memory card messages, then polls the controller, and the
+// controller status slot does what maple.c does: flush one dirty sector once
+// FLASH_WRITE_DELAY polls have gone by without a write. The card is usable
+// again once flash holds the formatted card.
+//
+// Also checks that both paths leave the same card in flash (the BIOS's own
+// root, nothing of MaplePad's layout), and that saving a file or deleting the
+// last one isn't taken for a format.
+//
+// Build: gcc -O2 -o format_sim format_sim.c ../src/format.c
+// Usage: format_sim [-d] [messages per frame]
+//
+// -d has the BIOS write the directory before the FAT and root, in which case
+// the directory can't be cleared early but the end of the format still is
+// spotted.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../src/format.h"
+
+#define CARD_SIZE (CARD_BLOCKS * BLOCK_SIZE)
+#define FLASH_WRITE_DELAY 16 // polls without a write before a flush, as in maple.c
+#define PHASE_SIZE 128       // a block comes in 4 phases, then a complete write
+#define FRAME_MS 16.667
+
+static uint8_t Flash[CARD_SIZE];
+static uint8_t Card[CARD_SIZE]; // the RAM copy
+static uint32_t Dirty;
+static uint32_t MessagesSinceWrite;
+static uint32_t FormatBlocks;
+static int Flushes;
+
+static uint8_t Root[BLOCK_SIZE];
+static uint8_t FAT[BLOCK_SIZE];
+static const uint8_t EmptyBlock[BLOCK_SIZE];
+
+// A used card: MaplePad's layout and a few saves, already in flash
+static void UsedCard(void)
+{
+	memset(Card, 0xFF, CARD_SIZE);
+	CheckFormatted(Card, 1);
+	uint16_t *CardFAT = (uint16_t *)&Card[FAT_BLOCK * BLOCK_SIZE];
+	for (int File = 0; File < 5; File++)
+	{
+		uint8_t *Entry = &Card[(DIRECTORY_BLOCK - File * 2) * BLOCK_SIZE + 32]; // over both directory sectors
+		memset(Entry, 0x40 + File, 32);
+		for (int Block = 0; Block < 10; Block++)
+		{
+			CardFAT[File * 10 + Block] = Block == 9 ? 0xFFFA : File * 10 + Block + 1;
+			memset(&Card[(File * 10 + Block) * BLOCK_SIZE], rand(), BLOCK_SIZE);
+		}
+	}
+	memcpy(Flash, Card, CARD_SIZE);
+	Dirty = 0;
+	MessagesSinceWrite = FLASH_WRITE_DELAY;
+	FormatBlocks = 0;
+	Flushes = 0;
+}
+
+// What the BIOS writes: its own root (the date differs from ours) and a FAT with only the
+// system blocks allocated
+static void BIOSBlocks(void)
+{
+	memcpy(Root, &Card[ROOT_BLOCK * BLOCK_SIZE], BLOCK_SIZE);
+	Root[0x30] = 0x19; // timestamp
+	Root[0x31] = 0x99;
+	Root[0x10] = 0;    // no custom colour
+
+	uint16_t *Entries = (uint16_t *)FAT;
+	for (int Block = 0; Block < CARD_BLOCKS; Block++)
+	{
+		Entries[Block] = 0xFFFC;
+	}
+	for (int Block = FORMAT_FIRST_BLOCK; Block < DIRECTORY_BLOCK; Block++)
+	{
+		Entries[Block + 1] = Block;
+	}
+	Entries[FORMAT_FIRST_BLOCK] = 0xFFFA;
+	Entries[FAT_BLOCK] = 0xFFFA;
+	Entries[ROOT_BLOCK] = 0xFFFA;
+}
+
+// BlockWrite() and BlockCompleteWrite()
+static void WritePhase(int Block, int Phase, const uint8_t *Data)
+{
+	uint8_t *Dest = &Card[Block * BLOCK_SIZE + Phase * PHASE_SIZE];
+	if (memcmp(Dest, Data, PHASE_SIZE))
+	{
+		memcpy(Dest, Data, PHASE_SIZE);
+		Dirty |= 1u << (Block * BLOCK_SIZE / CARD_SECTOR_SIZE);
+	}
+	MessagesSinceWrite = 0;
+}
+
+static int CompleteWrite(int Block, int FastPath)
+{
+	MessagesSinceWrite = 0;
+	if (!FastPath)
+	{
+		return 0;
+	}
+
+	uint32_t Cleared = 0;
+	int Done = FormatBlockWritten(&FormatBlocks, Card, Block, &Cleared);
+	if (Done)
+	{
+		MessagesSinceWrite = FLASH_WRITE_DELAY;
+	}
+	Dirty |= Cleared;
+	return Done;
+}
+
+// The controller status slot
+static void StatusPoll(void)
+{
+	if (Dirty && MessagesSinceWrite >= FLASH_WRITE_DELAY)
+	{
+		int Sector = 31 - __builtin_clz(Dirty);
+		Dirty &= ~(1u << Sector);
+		memcpy(&Flash[Sector * CARD_SECTOR_SIZE], &Card[Sector * CARD_SECTOR_SIZE], CARD_SECTOR_SIZE);
+		Flushes++;
+	}
+	else if (MessagesSinceWrite < FLASH_WRITE_DELAY)
+	{
+		MessagesSinceWrite++;
+	}
+}
+
+// Runs one format, returns the frames until flash holds the formatted card
+static int Format(int FastPath, int DirectoryFirst, int PerFrame, int *FormatFrames, uint8_t *Result)
+{
+	UsedCard();
+	BIOSBlocks();
+
+	int Order[FORMAT_BLOCKS];
+	const uint8_t *Data[FORMAT_BLOCKS];
+	int n = 0;
+	if (!DirectoryFirst)
+	{
+		Order[n] = ROOT_BLOCK, Data[n++] = Root;
+		Order[n] = FAT_BLOCK, Data[n++] = FAT;
+	}
+	for (int Block = DIRECTORY_BLOCK; Block >= FORMAT_FIRST_BLOCK; Block--)
+	{
+		Order[n] = Block, Data[n++] = EmptyBlock;
+	}
+	if (DirectoryFirst)
+	{
+		Order[n] = FAT_BLOCK, Data[n++] = FAT;
+		Order[n] = ROOT_BLOCK, Data[n++] = Root;
+	}
+
+	int Message = 0, Frame = 0;
+	*FormatFrames = 0;
+	for (;;)
+	{
+		for (int i = 0; i < PerFrame && Message < n * 5; i++, Message++)
+		{
+			int Block = Order[Message / 5], Phase = Message % 5;
+			if (Phase < 4)
+			{
+				WritePhase(Block, Phase, &Data[Message / 5][Phase * PHASE_SIZE]);
+			}
+			else
+			{
+				CompleteWrite(Block, FastPath);
+			}
+		}
+		if (Message == n * 5 && !*FormatFrames)
+		{
+			*FormatFrames = Frame + 1;
+		}
+		StatusPoll();
+		Frame++;
+		if (Message == n * 5 && !Dirty)
+		{
+			break;
+		}
+	}
+
+	if (memcmp(Flash, Card, CARD_SIZE) || !IsFreshFormat(Flash) || memcmp(&Flash[ROOT_BLOCK * BLOCK_SIZE], Root, BLOCK_SIZE))
+	{
+		fprintf(stderr, "%s format left the wrong card in flash\n", FastPath ? "Fast path" : "Baseline");
+		exit(1);
+	}
+	memcpy(Result, Flash, CARD_SIZE);
+	return Frame;
+}
+
+// Ordinary traffic mustn't end a format early: saving a file (data, FAT, directory) and
+// deleting the last file (FAT, then its directory entry)
+static int CheckNotFormat(void)
+{
+	uint8_t Block[BLOCK_SIZE];
+	UsedCard();
+	memset(Block, 0x5A, BLOCK_SIZE);
+	for (int Phase = 0; Phase < 4; Phase++)
+	{
+		WritePhase(100, Phase, &Block[Phase * PHASE_SIZE]);
+	}
+	if (CompleteWrite(100, 1))
+	{
+		return 0;
+	}
+	memcpy(Block, &Card[FAT_BLOCK * BLOCK_SIZE], BLOCK_SIZE);
+	((uint16_t *)Block)[100] = 0xFFFA;
+	for (int Phase = 0; Phase < 4; Phase++)
+	{
+		WritePhase(FAT_BLOCK, Phase, &Block[Phase * PHASE_SIZE]);
+	}
+	if (CompleteWrite(FAT_BLOCK, 1) || !Card[DIRECTORY_BLOCK * BLOCK_SIZE + 32])
+	{
+		return 0; // user blocks still allocated, the directory must be left alone
+	}
+
+	BIOSBlocks();
+	for (int Phase = 0; Phase < 4; Phase++)
+	{
+		WritePhase(FAT_BLOCK, Phase, &FAT[Phase * PHASE_SIZE]);
+	}
+	if (CompleteWrite(FAT_BLOCK, 1) || Card[DIRECTORY_BLOCK * BLOCK_SIZE + 32])
+	{
+		return 0; // everything freed, the directory goes with it, but that's no format
+	}
+	for (int Phase = 0; Phase < 4; Phase++)
+	{
+		WritePhase(DIRECTORY_BLOCK, Phase, &EmptyBlock[Phase * PHASE_SIZE]);
+	}
+	return !CompleteWrite(DIRECTORY_BLOCK, 1);
+}
+
+int main(int argc, char *argv[])
+{
+	int DirectoryFirst = 0, PerFrame = 1;
+	for (int i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-d"))
+		{
+			DirectoryFirst = 1;
+		}
+		else
+		{
+			PerFrame = atoi(argv[i]);
+		}
+	}
+	if (PerFrame < 1)
+	{
+		fprintf(stderr, "Usage: format_sim [-d] [messages per frame]\n");
+		return 1;
+	}
+
+	static uint8_t Baseline[CARD_SIZE], Fast[CARD_SIZE];
+	int BaseFormat, FastFormat;
+	srand(1);
+	int BaseFrames = Format(0, DirectoryFirst, PerFrame, &BaseFormat, Baseline);
+	int BaseFlushes = Flushes;
+	srand(1);
+	int FastFrames = Format(1, DirectoryFirst, PerFrame, &FastFormat, Fast);
+	int FastFlushes = Flushes;
+
+	if (memcmp(Baseline, Fast, CARD_SIZE))
+	{
+		fprintf(stderr, "Fast path and baseline disagree on the formatted card\n");
+		return 1;
+	}
+	if (!CheckNotFormat())
+	{
+		fprintf(stderr, "Ordinary writes were taken for a format\n");
+		return 1;
+	}
+
+	printf("%s order, %d card messages a frame, BIOS done after %d frames\n",
+		DirectoryFirst ? "Directory first" : "Root, FAT, directory", PerFrame, BaseFormat);
+	printf("Baseline:  usable after %d frames (%.0f ms), %d sector writes\n", BaseFrames, BaseFrames * FRAME_MS, BaseFlushes);
+	printf("Fast path: usable after %d frames (%.0f ms), %d sector writes\n", FastFrames, FastFrames * FRAME_MS, FastFlushes);
+	printf("Same card in flash, saves and deletes not taken for a format\n");
+	return 0;
+}
@@ -0,0 +1,75 @@
+// Software model of the RP2040 interpolator, so blit_bench can build src/blit.c
+// with BLIT_INTERP and check that path on a PC. Covers what blit.c uses from
+// the SDK's hardware/interp.h: each lane shifts its input right, masks it and
+// adds its BASE, with cross input taking the other lane's accumulator. Sign
+// extension, cross result, blend and clamp modes aren't modelled.
+//
+// Registers are host sized so BASE can hold a pointer, as it does on the RP2040
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct
+{
+	uint32_t Shift;
+	uint32_t MaskLsb, MaskMsb;
+	bool CrossInput;
+} interp_config;
+
+typedef struct
+{
+	uint32_t accum[2];
+	uintptr_t base[3];
+	interp_config ctrl[2];
+} interp_hw_t;
+
+static interp_hw_t Interp0Model;
+#define interp0 (&Interp0Model)
+
+static inline interp_config interp_default_config(void)
+{
+	interp_config Config = { 0, 0, 31, false };
+	return Config;
+}
+
+static inline void interp_config_set_shift(interp_config *Config, uint32_t Shift)
+{
+	Config->Shift = Shift;
+}
+
+static inline void interp_config_set_mask(interp_config *Config, uint32_t MaskLsb, uint32_t MaskMsb)
+{
+	Config->MaskLsb = MaskLsb;
+	Config->MaskMsb = MaskMsb;
+}
+
+static inline void interp_config_set_cross_input(interp_config *Config, bool CrossInput)
+{
+	Config->CrossInput = CrossInput;
+}
+
+static inline void interp_set_config(interp_hw_t *Interp, uint32_t Lane, interp_config *Config)
+{
+	Interp->ctrl[Lane] = *Config;
+}
+
+static inline void interp_set_base(interp_hw_t *Interp, uint32_t Lane, uintptr_t Value)
+{
+	Interp->base[Lane] = Value;
+}
+
+static inline void interp_set_accumulator(interp_hw_t *Interp, uint32_t Lane, uint32_t Value)
+{
+	Interp->accum[Lane] = Value;
+}
+
+// What reading PEEK0/PEEK1 returns: the lane's shifted and masked input plus its BASE
+static inline uintptr_t interp_peek_lane_result(interp_hw_t *Interp, uint32_t Lane)
+{
+	const interp_config *Config = &Interp->ctrl[Lane];
+	uint32_t Input = Interp->accum[Config->CrossInput ? !Lane : Lane];
+	uint32_t Mask = (0xffffffffu >> (31 - Config->MaskMsb)) & ~((1u << Config->MaskLsb) - 1);
+	return Interp->base[Lane] + ((Input >> Config->Shift) & Mask);
+}
@@ -0,0 +1,317 @@
+// Builds a complete MaplePad flash image as a single UF2: firmware, all eight
+// pre-formatted VMU pages and a settings block that skips the first boot setup.
+// The pages go into the firmware's block store (src/store.h), built here on a
+// copy of erased flash, along with the scrubber's checksum log (src/scrub.h).
+//
+// Without -f only the requested VMU pages and/or settings are emitted, which
+// makes a small data-only update for a unit that's already running MaplePad.
+// Its store can't be rewritten from here, so the pages go in the import area
+// instead and the firmware writes them into the store on the next boot: pages
+// to wipe, and at most one dump. The checksum log is left alone, the firmware
+// logs imported pages as it writes them.
+//
+// Build: gcc -O2 -o make_image make_image.c ../src/format.c ../src/scrub.c ../src/store.c
+// Usage: make_image -f maplepad.bin [-p <page> <dump.bin>]... -o maplepad_full.uf2
+//        make_image [-p <page> <dump.bin>]... [-r <first>-<last>] [-s settings.bin | -S] -o update.uf2
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../src/format.h"
+#include "../src/scrub.h"
+#include "../src/store.h"
+#include "flash_layout.h"
+#include "uf2.h"
+
+static uint8_t Firmware[FLASH_OFFSET];
+static uint32_t FirmwareSize = 0;
+static uint8_t Pages[NUM_PAGES][CARD_SIZE];
+static uint8_t FlashData[FLASH_DATA_SIZE];
+static ChecksumRecord ChecksumLog[CHECKSUM_RECORDS];
+static uint8_t Flash[STORE_FLASH_SIZE] __attribute__((aligned(4))); // what the store makes of erased flash
+static uint8_t ImportHeader[UF2_PAYLOAD_SIZE];
+
+static void FlashErase(uint32_t Offset)
+{
+	memset(&Flash[Offset], 0xFF, STORE_SECTOR_SIZE);
+}
+
+static void FlashProgram(uint32_t Offset, const uint8_t *Data, uint32_t Size)
+{
+	for (uint32_t i = 0; i < Size; i++)
+	{
+		Flash[Offset + i] &= Data[i];
+	}
+}
+
+static const StoreFlash RamFlash = {Flash, FlashErase, FlashProgram};
+
+static int ReadFile(const char *Path, uint8_t *Buffer, uint32_t MaxSize, uint32_t *Size)
+{
+	FILE *File = fopen(Path, "rb");
+	if (!File)
+	{
+		fprintf(stderr, "Can't open %s\n", Path);
+		return 0;
+	}
+	*Size = fread(Buffer, 1, MaxSize, File);
+	int TooBig = fgetc(File) != EOF;
+	fclose(File);
+	if (TooBig)
+	{
+		fprintf(stderr, "%s is larger than %u bytes\n", Path, MaxSize);
+		return 0;
+	}
+	return 1;
+}
+
+static void Usage()
+{
+	fprintf(stderr, "Usage: make_image [-f maplepad.bin] [-p <page 1-8> <dump.bin>]... [-r <first>-<last>] [-s settings.bin | -S] -o out.uf2\n"
+					"  -f  firmware, makes a full image with every page and settings\n"
+					"  -p  VMU dump to load into a page (unformatted pages are formatted), one per data-only image\n"
+					"  -r  range of pages to wipe in a data-only image\n"
+					"  -s  64 byte settings dump to include (picotool save -r 10120000 10120040)\n"
+					"  -S  include default settings\n");
+	exit(1);
+}
+
+int main(int argc, char **argv)
+{
+	const char *FirmwarePath = NULL;
+	const char *OutPath = NULL;
+	const char *DumpPaths[NUM_PAGES] = {NULL};
+	const char *SettingsPath = NULL;
+	int EmitPage[NUM_PAGES] = {0};
+	int EmitSettings = 0;
+	int NumDumps = 0;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-f") && i + 1 < argc)
+		{
+			FirmwarePath = argv[++i];
+		}
+		else if (!strcmp(argv[i], "-o") && i + 1 < argc)
+		{
+			OutPath = argv[++i];
+		}
+		else if (!strcmp(argv[i], "-p") && i + 2 < argc)
+		{
+			int Page = atoi(argv[++i]);
+			if (Page < 1 || Page > NUM_PAGES)
+			{
+				Usage();
+			}
+			NumDumps += !DumpPaths[Page - 1];
+			DumpPaths[Page - 1] = argv[++i];
+			EmitPage[Page - 1] = 1;
+		}
+		else if (!strcmp(argv[i], "-r") && i + 1 < argc)
+		{
+			int First, Last;
+			if (sscanf(argv[++i], "%d-%d", &First, &Last) != 2 || First < 1 || Last > NUM_PAGES || First > Last)
+			{
+				Usage();
+			}
+			for (int Page = First; Page <= Last; Page++)
+			{
+				EmitPage[Page - 1] = 1;
+			}
+		}
+		else if (!strcmp(argv[i], "-s") && i + 1 < argc)
+		{
+			SettingsPath = argv[++i];
+			EmitSettings = 1;
+		}
+		else if (!strcmp(argv[i], "-S"))
+		{
+			EmitSettings = 1;
+		}
+		else
+		{
+			Usage();
+		}
+	}
+	if (!OutPath)
+	{
+		Usage();
+	}
+
+	if (FirmwarePath)
+	{
+		if (!ReadFile(FirmwarePath, Firmware, sizeof(Firmware), &FirmwareSize))
+		{
+			return 1;
+		}
+		for (int Page = 0; Page < NUM_PAGES; Page++)
+		{
+			EmitPage[Page] = 1;
+		}
+		EmitSettings = 1;
+	}
+	else if (NumDumps > 1)
+	{
+		fprintf(stderr, "A data-only image can only load one dump, make one image per page\n");
+		return 1;
+	}
+
+	// Pages start out as erased flash, same as readFlash() sees on a fresh chip
+	for (int Page = 1; Page <= NUM_PAGES; Page++)
+	{
+		uint8_t *Card = Pages[Page - 1];
+		memset(Card, 0xFF, CARD_SIZE);
+		if (DumpPaths[Page - 1])
+		{
+			uint32_t Size;
+			if (!ReadFile(DumpPaths[Page - 1], Card, CARD_SIZE, &Size))
+			{
+				return 1;
+			}
+			if (Size != CARD_SIZE)
+			{
+				fprintf(stderr, "%s should be a %u byte VMU dump\n", DumpPaths[Page - 1], CARD_SIZE);
+				return 1;
+			}
+		}
+		CheckFormatted(Card, Page); // no-op for already formatted dumps
+	}
+
+	DefaultFlashData(FlashData);
+	if (SettingsPath)
+	{
+		uint32_t Size;
+		if (!ReadFile(SettingsPath, FlashData, FLASH_DATA_SIZE, &Size))
+		{
+			return 1;
+		}
+		if (Size != FLASH_DATA_SIZE)
+		{
+			fprintf(stderr, "%s should be a %u byte settings dump\n", SettingsPath, FLASH_DATA_SIZE);
+			return 1;
+		}
+		FlashData[FD_firstBoot] = 0;
+	}
+	FlashData[FD_settingsImport] = SETTINGS_IMPORT_MAGIC; // firmware keeps these settings whatever version wrote them
+
+	int NumPages = 0;
+	for (int Page = 0; Page < NUM_PAGES; Page++)
+	{
+		NumPages += EmitPage[Page];
+	}
+	if (!NumPages && !EmitSettings)
+	{
+		fprintf(stderr, "Nothing to write\n");
+		return 1;
+	}
+
+	FILE *Out = fopen(OutPath, "wb");
+	if (!Out)
+	{
+		fprintf(stderr, "Can't open %s\n", OutPath);
+		return 1;
+	}
+
+	uint32_t NumBlocks = UF2NumBlocks(FirmwareSize) + (EmitSettings ? UF2NumBlocks(FLASH_DATA_SIZE) : 0);
+	uint32_t BlockNo = 0;
+	uint32_t PoolEnd = STORE_POOL_B;
+	int Ok = 1;
+	if (FirmwarePath)
+	{
+		// The store as the firmware would leave it after writing every page to erased flash
+		memset(Flash, 0xFF, sizeof(Flash));
+		storeInit(&RamFlash);
+		for (int Page = 0; Page < NUM_PAGES; Page++)
+		{
+			for (int Block = 0; Block < STORE_PAGE_BLOCKS; Block++)
+			{
+				storeWrite(Page, Block, &Pages[Page][Block * STORE_BLOCK_SIZE]);
+			}
+		}
+		if (!storeCheck())
+		{
+			fprintf(stderr, "Block store doesn't add up\n");
+			return 1;
+		}
+		for (uint32_t Offset = STORE_POOL_B; Offset < STORE_FLASH_SIZE; Offset++)
+		{
+			if (Flash[Offset] != 0xFF)
+			{
+				PoolEnd = Offset + 1; // pool B past this was left erased, stale data there is only garbage to the firmware
+			}
+		}
+
+		// Log the pages' checksums as the firmware's logChecksums() would on a freshly erased log
+		static ChecksumTable Checksums;
+		memset(ChecksumLog, 0xFF, sizeof(ChecksumLog));
+		for (int Page = 0; Page < NUM_PAGES; Page++)
+		{
+			for (int Sector = 0; Sector < SCRUB_SECTORS; Sector++)
+			{
+				checksumSet(&Checksums, Page, Sector, sectorChecksum((const uint32_t *)&Pages[Page][Sector * FLASH_SECTOR_SIZE], FLASH_SECTOR_SIZE / 4, 0));
+			}
+		}
+		ChecksumRecord Records[CHECKSUM_PAGE_RECORDS];
+		int Offset;
+		while ((Offset = checksumLogNext(&Checksums, Records)) >= 0)
+		{
+			memcpy((uint8_t *)ChecksumLog + Offset, Records, sizeof(Records));
+		}
+
+		NumBlocks += UF2NumBlocks(STORE_POOL_A_BLOCKS * STORE_BLOCK_SIZE) + UF2NumBlocks(sizeof(ChecksumLog)) +
+					 UF2NumBlocks(STORE_IMPORT + STORE_SECTOR_SIZE - STORE_TABLES) + UF2NumBlocks(PoolEnd - STORE_POOL_B);
+		Ok = UF2WriteRange(Out, 0, Firmware, FirmwareSize, &BlockNo, NumBlocks) &&
+			 UF2WriteRange(Out, STORE_POOL_A, &Flash[STORE_POOL_A], STORE_POOL_A_BLOCKS * STORE_BLOCK_SIZE, &BlockNo, NumBlocks) &&
+			 UF2WriteRange(Out, CHECKSUM_LOG_OFFSET, (const uint8_t *)ChecksumLog, sizeof(ChecksumLog), &BlockNo, NumBlocks) &&
+			 UF2WriteRange(Out, STORE_TABLES, &Flash[STORE_TABLES], STORE_IMPORT + STORE_SECTOR_SIZE - STORE_TABLES, &BlockNo, NumBlocks) && // clears any import
+			 UF2WriteRange(Out, STORE_POOL_B, &Flash[STORE_POOL_B], PoolEnd - STORE_POOL_B, &BlockNo, NumBlocks);
+	}
+	else if (NumPages)
+	{
+		StoreImport Import = {STORE_IMPORT_MAGIC, 0, 0, 0};
+		int Load = 0;
+		for (int Page = 1; Page <= NUM_PAGES; Page++)
+		{
+			if (DumpPaths[Page - 1])
+			{
+				Load = Page;
+			}
+			else if (EmitPage[Page - 1])
+			{
+				Import.Wipe |= 1u << (Page - 1);
+			}
+		}
+		Import.Load = Load;
+		Import.Check = storeImportCheck(&Import);
+		memset(ImportHeader, 0xFF, sizeof(ImportHeader));
+		memcpy(ImportHeader, &Import, sizeof(Import));
+
+		NumBlocks += UF2NumBlocks(sizeof(ImportHeader)) + (Load ? UF2NumBlocks(CARD_SIZE) : 0);
+		Ok = UF2WriteRange(Out, STORE_IMPORT, ImportHeader, sizeof(ImportHeader), &BlockNo, NumBlocks);
+		if (Ok && Load)
+		{
+			Ok = UF2WriteRange(Out, STORE_IMPORT + STORE_SECTOR_SIZE, Pages[Load - 1], CARD_SIZE, &BlockNo, NumBlocks);
+		}
+	}
+	if (Ok && EmitSettings)
+	{
+		Ok = UF2WriteRange(Out, FLASH_DATA_OFFSET, FlashData, FLASH_DATA_SIZE, &BlockNo, NumBlocks);
+	}
+	fclose(Out);
+
+	if (!Ok || BlockNo != NumBlocks)
+	{
+		fprintf(stderr, "Failed writing %s\n", OutPath);
+		return 1;
+	}
+	if (FirmwarePath)
+	{
+		printf("Wrote %s: %u byte firmware, %d VMU pages in %u pool blocks, settings (%u blocks)\n", OutPath, FirmwareSize, NumPages, storeStats.Live, NumBlocks);
+	}
+	else
+	{
+		printf("Wrote %s: %d VMU pages to import, %s (%u blocks)\n", OutPath, NumPages, EmitSettings ? "settings" : "no settings", NumBlocks);
+	}
+	return 0;
+}
@@ -0,0 +1,291 @@
+// Packs a splash image or a boot animation for the firmware (see
+// src/pack.h) and writes it as C source, ready to paste over the panel
+// driver's splash or the animation in src/anim.c. The result is unpacked
+// again with the firmware's own decoder and must match the input.
+//
+// Build: gcc -O2 -o pack_image pack_image.c ../src/pack.c
+// Usage: pack_image -w <width> [-m] [-n name] [-o out.c] image.bin
+//        pack_image -w <width> -a <frame ms> [-n name] [-o out.c] frame.bin...
+//
+// image.bin is raw RGB565 in panel byte order (high byte first), width
+// pixels per line. With -m it's one byte per pixel instead, anything but 0
+// lit, and gets packed as SSD1306 pages: one bit per pixel, eight lines of
+// 128 columns. With -a each file is one RGB565 frame of an animation, all
+// the same size, and each is coded as what changed since the one before.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../src/pack.h"
+
+#define MAX_IMAGE (1 << 20)
+
+#define MAX_FRAMES 1024
+
+static uint8_t Input[MAX_IMAGE];
+static uint8_t Image[MAX_IMAGE] __attribute__((aligned(4)));
+static uint8_t Previous[MAX_IMAGE] __attribute__((aligned(4)));
+static uint8_t Check[MAX_IMAGE] __attribute__((aligned(4)));
+static uint8_t Packed[MAX_IMAGE * 16];
+static PackedFrame Frames[MAX_FRAMES];
+
+static void Usage()
+{
+	fprintf(stderr, "Usage: pack_image -w <width> [-m] [-n name] [-o out.c] image.bin\n"
+		"       pack_image -w <width> -a <frame ms> [-n name] [-o out.c] frame.bin...\n"
+		"  -w  pixels per line\n"
+		"  -m  one byte per pixel, packed into 1bpp SSD1306 pages\n"
+		"  -a  animation, one RGB565 frame per file shown for this many ms\n"
+		"  -n  C name for the image, default splash\n");
+	exit(1);
+}
+
+// Units from x on that equal another line (the one above, or the same line
+// last frame), and that repeat the unit at x
+static int MatchLine(const uint8_t *Line, const uint8_t *Other, int x, int Width, int Unit)
+{
+	int n = 0;
+	while (Other && x + n < Width && n < PACK_MAX && !memcmp(Line + (x + n) * Unit, Other + (x + n) * Unit, Unit))
+		n++;
+	return n;
+}
+
+static int MatchRun(const uint8_t *Line, int x, int Width, int Unit)
+{
+	int n = 1;
+	while (x + n < Width && n < PACK_MAX && !memcmp(Line + (x + n) * Unit, Line + x * Unit, Unit))
+		n++;
+	return n;
+}
+
+// Greedy: skip, copy from above or repeat when that's shorter than literals.
+// Prev is the same line last frame, NULL outside animations
+static int PackLine(const uint8_t *Line, const uint8_t *Above, const uint8_t *Prev, int Width, int Unit, uint8_t *Out)
+{
+	const int MinUp = Unit == 1 ? 3 : 2, MinRun = Unit == 1 ? 4 : 3;
+	int Size = 0, LitStart = 0, LitCount = 0;
+
+	for (int x = 0; x < Width;)
+	{
+		int Skip = MatchLine(Line, Prev, x, Width, Unit);
+		int Up = MatchLine(Line, Above, x, Width, Unit);
+		int Run = MatchRun(Line, x, Width, Unit);
+		int Op = -1, Count = 0;
+
+		if (Skip >= MinUp && Skip >= Up && Skip >= Run)
+			Op = PACK_SKIP, Count = Skip;
+		else if (Up >= MinUp && Up >= Run)
+			Op = PACK_UP, Count = Up;
+		else if (Run >= MinRun)
+			Op = PACK_RUN, Count = Run;
+
+		if (Op < 0)
+		{
+			if (!LitCount)
+				LitStart = x;
+			LitCount++;
+			x++;
+		}
+		if (LitCount && (Op >= 0 || LitCount == PACK_MAX || x == Width))
+		{
+			Out[Size++] = (PACK_LITERAL << 6) | (LitCount - 1);
+			memcpy(Out + Size, Line + LitStart * Unit, LitCount * Unit);
+			Size += LitCount * Unit;
+			LitCount = 0;
+		}
+		if (Op >= 0)
+		{
+			Out[Size++] = (Op << 6) | (Count - 1);
+			if (Op == PACK_RUN)
+			{
+				memcpy(Out + Size, Line + x * Unit, Unit);
+				Size += Unit;
+			}
+			x += Count;
+		}
+	}
+	return Size;
+}
+
+static int ReadImage(const char *Path, size_t *Size)
+{
+	FILE *File = fopen(Path, "rb");
+	if (!File)
+	{
+		fprintf(stderr, "Can't open %s\n", Path);
+		return 0;
+	}
+	*Size = fread(Input, 1, sizeof(Input), File);
+	fclose(File);
+	return 1;
+}
+
+static void WriteData(FILE *Out, const char *Name, uint32_t Size)
+{
+	fprintf(Out, "static const uint8_t %s_data[%u] = {", Name, Size);
+	for (uint32_t i = 0; i < Size; i++)
+		fprintf(Out, "%s0x%02x,", i % 16 ? " " : "\n    ", Packed[i]);
+	fprintf(Out, "\n};\n\n");
+}
+
+// Each frame is coded over the lines that changed and unpacked over the
+// previous one, the way the firmware plays it
+static int PackAnimation(char **Paths, int FrameCount, int Width, int FrameMs, const char *Name, FILE *Out)
+{
+	const int Stride = Width * 2;
+	PackedImage Img = {Width, 0, 2, 0, Packed};
+	size_t InSize, FrameSize = 0;
+	uint32_t Size = 0;
+
+	for (int f = 0; f < FrameCount; f++)
+	{
+		if (!ReadImage(Paths[f], &InSize))
+			return 0;
+		if (!f)
+		{
+			FrameSize = InSize;
+			Img.height = InSize / Stride;
+		}
+		if (!Img.height || InSize != FrameSize || InSize != (size_t)Img.height * Stride)
+		{
+			fprintf(stderr, "%s isn't a %d pixel wide RGB565 frame the size of the first\n", Paths[f], Width);
+			return 0;
+		}
+		memcpy(Image, Input, InSize);
+
+		int y0 = 0, y1 = Img.height;
+		if (f)
+		{
+			while (y0 < y1 && !memcmp(Image + y0 * Stride, Previous + y0 * Stride, Stride))
+				y0++;
+			while (y1 > y0 && !memcmp(Image + (y1 - 1) * Stride, Previous + (y1 - 1) * Stride, Stride))
+				y1--;
+		}
+		Frames[f].y0 = y0;
+		Frames[f].y1 = y1;
+		Frames[f].offset = Size;
+
+		for (int y = y0; y < y1; y++)
+			Size += PackLine(Image + y * Stride, y ? Image + (y - 1) * Stride : NULL, f ? Previous + y * Stride : NULL, Width, 2,
+				Packed + Size);
+
+		const uint8_t *Src = Packed + Frames[f].offset;
+		for (int y = y0; y < y1; y++)
+			Src = unpackLine(&Img, Src, Check + y * Stride, y ? Check + (y - 1) * Stride : NULL);
+		if (memcmp(Check, Image, InSize))
+		{
+			fprintf(stderr, "Unpacked frame %d doesn't match\n", f);
+			return 0;
+		}
+		memcpy(Previous, Image, InSize);
+	}
+
+	fprintf(Out, "// %dx%d RGB565, %d frames at %d ms, %u bytes packed from %u by tools/pack_image\n", Width, Img.height, FrameCount,
+		FrameMs, Size, (unsigned)(FrameSize * FrameCount));
+	WriteData(Out, Name, Size);
+	fprintf(Out, "static const PackedFrame %s_frames[%d] = {", Name, FrameCount);
+	for (int f = 0; f < FrameCount; f++)
+		fprintf(Out, "%s{%d, %d, %u},", f % 4 ? " " : "\n    ", Frames[f].y0, Frames[f].y1, Frames[f].offset);
+	fprintf(Out, "\n};\n\nconst PackedAnimation %s = {{%d, %d, 2, sizeof(%s_data), %s_data}, %d, %d, %s_frames};\n", Name, Width,
+		Img.height, Name, Name, FrameCount, FrameMs, Name);
+
+	fprintf(stderr, "%s: %d frames, %u -> %u bytes (%.1f%%)\n", Name, FrameCount, (unsigned)(FrameSize * FrameCount), Size,
+		Size * 100.0 / (FrameSize * FrameCount));
+	return 1;
+}
+
+int main(int argc, char **argv)
+{
+	const char *OutPath = NULL, *Name = "splash";
+	char *InPaths[MAX_FRAMES];
+	int InCount = 0, Width = 0, Mono = 0, FrameMs = 0;
+
+	for (int i = 1; i < argc; i++)
+	{
+		if (!strcmp(argv[i], "-w") && i + 1 < argc)
+			Width = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-m"))
+			Mono = 1;
+		else if (!strcmp(argv[i], "-a") && i + 1 < argc)
+			FrameMs = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+			Name = argv[++i];
+		else if (!strcmp(argv[i], "-o") && i + 1 < argc)
+			OutPath = argv[++i];
+		else if (argv[i][0] != '-' && InCount < MAX_FRAMES)
+			InPaths[InCount++] = argv[i];
+		else
+			Usage();
+	}
+	if (!InCount || Width <= 0 || (!FrameMs && InCount > 1) || (FrameMs && (Mono || FrameMs < 0)))
+		Usage();
+
+	FILE *Out = OutPath ? fopen(OutPath, "w") : stdout;
+	if (!Out)
+	{
+		fprintf(stderr, "Can't open %s\n", OutPath);
+		return 1;
+	}
+	if (FrameMs)
+	{
+		int Ok = PackAnimation(InPaths, InCount, Width, FrameMs, Name, Out);
+		if (OutPath)
+			fclose(Out);
+		return Ok ? 0 : 1;
+	}
+
+	size_t InSize;
+	if (!ReadImage(InPaths[0], &InSize))
+		return 1;
+
+	PackedImage Img;
+	int Unit = Mono ? 1 : 2;
+	int InHeight = InSize / (Width * (Mono ? 1 : 2));
+	if (!InHeight || InSize != (size_t)InHeight * Width * (Mono ? 1 : 2) || (Mono && InHeight % 8))
+	{
+		fprintf(stderr, "%s isn't a whole number of %d pixel lines%s\n", InPaths[0], Width, Mono ? " in pages of eight" : "");
+		return 1;
+	}
+
+	if (Mono)
+	{
+		memset(Image, 0, InSize / 8);
+		for (int y = 0; y < InHeight; y++)
+			for (int x = 0; x < Width; x++)
+				if (Input[y * Width + x])
+					Image[(y / 8) * Width + x] |= 1 << (y & 7);
+		Img.height = InHeight / 8;
+	}
+	else
+	{
+		memcpy(Image, Input, InSize);
+		Img.height = InHeight;
+	}
+	Img.width = Width;
+	Img.unit = Unit;
+
+	int Stride = Width * Unit;
+	uint32_t Size = 0;
+	for (int y = 0; y < Img.height; y++)
+		Size += PackLine(Image + y * Stride, y ? Image + (y - 1) * Stride : NULL, NULL, Width, Unit, Packed + Size);
+	Img.size = Size;
+	Img.data = Packed;
+
+	unpackImage(&Img, Check, Stride);
+	if (memcmp(Check, Image, Img.height * Stride))
+	{
+		fprintf(stderr, "Unpacked image doesn't match\n");
+		return 1;
+	}
+
+	fprintf(Out, "// %dx%d %s, %u bytes packed from %u by tools/pack_image\n", Width, InHeight, Mono ? "1bpp SSD1306 pages" : "RGB565",
+		Size, (unsigned)InSize);
+	WriteData(Out, Name, Size);
+	fprintf(Out, "static const PackedImage %s = {%d, %d, %d, sizeof(%s_data), %s_data};\n", Name, Img.width, Img.height, Unit, Name, Name);
+	if (OutPath)
+		fclose(Out);
+
+	fprintf(stderr, "%s: %u -> %u bytes (%.0f%%)\n", Name, (unsigned)InSize, Size, Size * 100.0 / InSize);
+	return 0;
+}
@@ -0,0 +1,338 @@
+// Checks the integer rasterisers in src/raster.c against per-pixel
+// references and times them against the float drawEllipse() they replace.
+// The host has an FPU and the M0+ doesn't, so the float numbers here flatter
+// the old code; the span counts are the fillRect calls a panel would see.
+//
+// Build: gcc -O2 -o raster_bench raster_bench.c ../src/raster.c -lm
+// Usage: raster_bench [iterations]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include "../src/raster.h"
+
+#define CANVAS 512
+#define ORIGIN 256
+
+static uint8_t Ref[CANVAS][CANVAS];
+static uint8_t Out[CANVAS][CANVAS];
+static int Spans;
+static volatile uint32_t Sink;
+
+static void Plot(int x, int y)
+{
+	Ref[y + ORIGIN][x + ORIGIN] = 1;
+}
+
+static void DrawSpan(void *Ctx, int x0, int x1, int y)
+{
+	(void)Ctx;
+	if (x0 > x1)
+	{
+		fprintf(stderr, "span %d..%d on row %d is backwards\n", x0, x1, y);
+		exit(1);
+	}
+	for (int x = x0; x <= x1; x++)
+		Out[y + ORIGIN][x + ORIGIN]++;
+	Spans++;
+}
+
+static void CountSpan(void *Ctx, int x0, int x1, int y)
+{
+	Sink += x0 + x1 + y;
+	(*(int *)Ctx)++;
+}
+
+// Plain per-pixel Bresenham and midpoint ellipse, as published by Zingl
+static void ReferenceLine(int x0, int y0, int x1, int y1)
+{
+	int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+	int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+	int err = dx + dy;
+
+	for (;;)
+	{
+		Plot(x0, y0);
+		if (x0 == x1 && y0 == y1)
+			break;
+		int e2 = 2 * err;
+		if (e2 >= dy)
+		{
+			err += dy;
+			x0 += sx;
+		}
+		if (e2 <= dx)
+		{
+			err += dx;
+			y0 += sy;
+		}
+	}
+}
+
+static void ReferenceEllipse(int xm, int ym, int a, int b)
+{
+	int x = -a, y = 0;
+	long e2 = (long)b * b, err = x * (2 * e2 + x) + e2;
+
+	do
+	{
+		Plot(xm - x, ym + y);
+		Plot(xm + x, ym + y);
+		Plot(xm + x, ym - y);
+		Plot(xm - x, ym - y);
+		e2 = 2 * err;
+		if (e2 >= (x * 2 + 1) * (long)b * b)
+			err += (++x * 2 + 1) * (long)b * b;
+		if (e2 <= (y * 2 + 1) * (long)a * a)
+			err += (++y * 2 + 1) * (long)a * a;
+	} while (x <= 0);
+	while (y++ < b)
+	{
+		Plot(xm, ym + y);
+		Plot(xm, ym - y);
+	}
+}
+
+// drawEllipse() as it was, cos32() and sin32() included
+static float Cos32s(float x)
+{
+	const float c1 = 0.99940307, c2 = -0.49558072, c3 = 0.03679168;
+	float x2 = x * x;
+	return c1 + x2 * (c2 + c3 * x2);
+}
+
+static float Cos32(float x)
+{
+	x = fmod(x, 2 * M_PI);
+	if (x < 0)
+		x = -x;
+	switch ((int)(x * (2 / M_PI)))
+	{
+	case 0: return Cos32s(x);
+	case 1: return -Cos32s(M_PI - x);
+	case 2: return -Cos32s(x - M_PI);
+	case 3: return Cos32s(2 * M_PI - x);
+	}
+	return 0;
+}
+
+static float Sin32(float x)
+{
+	return Cos32(M_PI / 2 - x);
+}
+
+static void FloatEllipse(int xc, int yc, int xr, int yr, int Angle)
+{
+	float rangle = Angle * M_PI / 180.0, kf = (360 * M_PI / 180.0) / 120;
+	float sangle = Sin32(rangle), cangle = Cos32(rangle);
+
+	for (int i = 0; i < 120; i++)
+	{
+		float x = xc + xr * Cos32(i * kf);
+		float y = yc + yr * Sin32(i * kf);
+		Sink += (int)roundf(xc + (x - xc) * cangle - (y - yc) * sangle);
+		Sink += (int)roundf(yc + (x - xc) * sangle + (y - yc) * cangle);
+	}
+}
+
+static void Clear(void)
+{
+	memset(Ref, 0, sizeof(Ref));
+	memset(Out, 0, sizeof(Out));
+}
+
+// Outlines must hit the reference pixels exactly, once each
+static int SameOutline(const char *What)
+{
+	for (int y = 0; y < CANVAS; y++)
+		for (int x = 0; x < CANVAS; x++)
+			if (Ref[y][x] != (Out[y][x] != 0) || Out[y][x] > 1)
+			{
+				fprintf(stderr, "%s: pixel %d,%d is %d, expected %d\n", What, x - ORIGIN, y - ORIGIN, Out[y][x], Ref[y][x]);
+				return 0;
+			}
+	return 1;
+}
+
+// A fill must cover each row of the outline from end to end, once
+static int FillsOutline(const char *What)
+{
+	for (int y = 0; y < CANVAS; y++)
+	{
+		int Left = CANVAS, Right = -1;
+		for (int x = 0; x < CANVAS; x++)
+			if (Ref[y][x])
+			{
+				if (x < Left)
+					Left = x;
+				Right = x;
+			}
+		for (int x = 0; x < CANVAS; x++)
+			if (Out[y][x] != (x >= Left && x <= Right))
+			{
+				fprintf(stderr, "%s: row %d pixel %d is %d\n", What, y - ORIGIN, x - ORIGIN, Out[y][x]);
+				return 0;
+			}
+	}
+	return 1;
+}
+
+static int Check(void)
+{
+	char What[64];
+
+	for (int i = 0; i < 2000; i++)
+	{
+		int x0 = rand() % 200 - 100, y0 = rand() % 200 - 100;
+		int x1 = rand() % 200 - 100, y1 = rand() % 200 - 100;
+		if (i < 8) // axis aligned and single pixel lines
+			x1 = i & 1 ? x0 : x1, y1 = i & 2 ? y0 : y1;
+		Clear();
+		ReferenceLine(x0, y0, x1, y1);
+		rasterLine(x0, y0, x1, y1, DrawSpan, NULL);
+		snprintf(What, sizeof(What), "line %d,%d-%d,%d", x0, y0, x1, y1);
+		if (!SameOutline(What))
+			return 0;
+	}
+
+	for (int a = 1; a <= 100; a += a < 20 ? 1 : 7)
+	{
+		for (int b = 1; b <= 100; b += b < 20 ? 1 : 7)
+		{
+			Clear();
+			ReferenceEllipse(3, -2, a, b);
+			rasterEllipse(3, -2, a, b, false, DrawSpan, NULL);
+			snprintf(What, sizeof(What), "ellipse %dx%d", a, b);
+			if (!SameOutline(What))
+				return 0;
+			memset(Out, 0, sizeof(Out));
+			rasterEllipse(3, -2, a, b, true, DrawSpan, NULL);
+			snprintf(What, sizeof(What), "filled ellipse %dx%d", a, b);
+			if (!FillsOutline(What))
+				return 0;
+		}
+	}
+
+	for (int Angle = 0; Angle < ANGLE_TURN; Angle += 7)
+	{
+		Clear();
+		rasterEllipseRotated(0, 0, 40, 15, Angle, false, DrawSpan, NULL);
+		memcpy(Ref, Out, sizeof(Ref));
+		for (int y = 0; y < CANVAS; y++)
+			for (int x = 0; x < CANVAS; x++)
+				Ref[y][x] = Ref[y][x] != 0;
+		memset(Out, 0, sizeof(Out));
+		rasterEllipseRotated(0, 0, 40, 15, Angle, true, DrawSpan, NULL);
+		snprintf(What, sizeof(What), "filled ellipse at angle %d", Angle);
+		if (!FillsOutline(What))
+			return 0;
+	}
+
+	int SinErr = 0, AtanErr = 0;
+	for (int Angle = -2 * ANGLE_TURN; Angle < 2 * ANGLE_TURN; Angle++)
+	{
+		int Err = abs(sinQ15(Angle) - (int)lround(sin(Angle * 2 * M_PI / ANGLE_TURN) * Q15_ONE));
+		Err = abs(cosQ15(Angle) - (int)lround(cos(Angle * 2 * M_PI / ANGLE_TURN) * Q15_ONE)) > Err ? abs(cosQ15(Angle) - (int)lround(cos(Angle * 2 * M_PI / ANGLE_TURN) * Q15_ONE)) : Err;
+		if (Err > SinErr)
+			SinErr = Err;
+	}
+	for (int y = -300; y <= 300; y++)
+	{
+		for (int x = -300; x <= 300; x++)
+		{
+			if (!x && !y)
+				continue;
+			double Exact = atan2(y, x) * ANGLE_TURN / (2 * M_PI);
+			double Err = fabs(fmod(atan2Angle(y, x) - Exact + 1.5 * ANGLE_TURN, ANGLE_TURN) - ANGLE_TURN / 2);
+			if (Err > 1.0)
+			{
+				fprintf(stderr, "atan2Angle(%d, %d) = %d, expected %.2f\n", y, x, atan2Angle(y, x), Exact);
+				return 0;
+			}
+			if (Err * 100 > AtanErr)
+				AtanErr = Err * 100;
+		}
+	}
+	if (SinErr > 0)
+	{
+		fprintf(stderr, "sinQ15 is out by %d\n", SinErr);
+		return 0;
+	}
+	printf("sinQ15 exact, atan2Angle within %d.%02d units\n", AtanErr / 100, AtanErr % 100);
+	return 1;
+}
+
+static double Now(void)
+{
+	struct timespec Ts;
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return Ts.tv_sec + Ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[])
+{
+	int Iterations = argc > 1 ? atoi(argv[1]) : 100000;
+	int Count;
+
+	srand(1);
+	if (!Check())
+		return 1;
+	printf("Output matches the per-pixel rasterisers\n");
+
+	double Start = Now();
+	for (int i = 0; i < Iterations; i++)
+		FloatEllipse(48, 32, 30, 20, 30 + (i & 1));
+	double FloatTime = Now() - Start;
+
+	Count = 0;
+	Start = Now();
+	for (int i = 0; i < Iterations; i++)
+		rasterEllipseRotated(48, 32, 30, 20, ANGLE_FROM_DEGREES(30 + (i & 1)), false, CountSpan, &Count);
+	double RotatedTime = Now() - Start;
+	int RotatedSpans = Count / Iterations;
+
+	Count = 0;
+	Start = Now();
+	for (int i = 0; i < Iterations; i++)
+		rasterEllipseRotated(48, 32, 30, 20, ANGLE_FROM_DEGREES(30 + (i & 1)), true, CountSpan, &Count);
+	double RotatedFillTime = Now() - Start;
+	int RotatedFillSpans = Count / Iterations;
+
+	Count = 0;
+	Start = Now();
+	for (int i = 0; i < Iterations; i++)
+		rasterEllipse(48, 32, 30, 20 + (i & 1), false, CountSpan, &Count);
+	double EllipseTime = Now() - Start;
+	int EllipseSpans = Count / Iterations;
+
+	Count = 0;
+	Start = Now();
+	for (int i = 0; i < Iterations; i++)
+		rasterEllipse(48, 32, 20 + (i & 1), 20 + (i & 1), true, CountSpan, &Count);
+	double CircleTime = Now() - Start;
+	int CircleSpans = Count / Iterations;
+
+	Count = 0;
+	Start = Now();
+	for (int i = 0; i < Iterations; i++)
+		rasterLine(0, i & 1, 95, 63, CountSpan, &Count);
+	double LineTime = Now() - Start;
+	int LineSpans = Count / Iterations;
+
+	Start = Now();
+	for (int i = 0; i < Iterations; i++)
+		Sink += sinQ15(i) + atan2Angle(i & 255, 100);
+	double TrigTime = Now() - Start;
+
+	printf("float drawEllipse 30x20 @30deg: %.3f us (120 dots)\n", FloatTime * 1e6 / Iterations);
+	printf("rotated ellipse 30x20 @30deg:   %.3f us, %d spans\n", RotatedTime * 1e6 / Iterations, RotatedSpans);
+	printf("  filled:                       %.3f us, %d spans\n", RotatedFillTime * 1e6 / Iterations, RotatedFillSpans);
+	printf("midpoint ellipse 30x20:         %.3f us, %d spans\n", EllipseTime * 1e6 / Iterations, EllipseSpans);
+	printf("filled circle r20:              %.3f us, %d spans\n", CircleTime * 1e6 / Iterations, CircleSpans);
+	printf("line 96x64 diagonal:            %.3f us, %d spans\n", LineTime * 1e6 / Iterations, LineSpans);
+	printf("sinQ15 + atan2Angle:            %.3f us\n", TrigTime * 1e6 / Iterations);
+	return 0;
+}
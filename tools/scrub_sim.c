@@ -0,0 +1,240 @@
+// Runs the flash scrubber and checksum log in src/scrub.c against a
+// simulated VMU page, with the controller status slot doing what maple.c
+// does: flush a dirty sector (and log its checksum) once writes have settled,
+// otherwise take a scrub step. The game writes blocks at random, half of them
+// into the sector the scrubber is part way through, and bits get flipped in
+// flash now and then, including while the power is off. Every flipped bit
+// must be found, by the scrubber or by readFlash() checking the page against
+// the log when it's loaded again, and nothing else may be reported bad.
+//
+// Each scrub step is also timed against the Maple bus: it starts as the
+// controller response goes out, and the next request could follow straight
+// after. Its response has to start within the console's timeout, so a step
+// must be done in time for that even with slow uncached flash reads.
+//
+// Build: gcc -O2 -o scrub_sim scrub_sim.c ../src/scrub.c
+// Usage: scrub_sim [-n] [-r] [-x ns] [polls]
+//
+// -n leaves out the flush's scrubSectorWritten() call, which should make
+// the check fail with sectors wrongly reported bad.
+// -r takes the checksums from the page as it's read in (no log), which
+// should make the check fail with sectors corrupted while powered off missed.
+// -x sets the time for one uncached 32-bit flash read in ns (default 2000,
+// a serial read at a quarter of 125MHz; quad reads are about 400).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "../src/scrub.h"
+
+#define PAGE_SIZE (SCRUB_SECTOR_SIZE * SCRUB_SECTORS)
+#define FLASH_WRITE_DELAY 16 // polls without a write before a flush, as in maple.c
+#define BLOCK_SIZE 512
+
+// Maple bus timing
+#define MAPLE_BYTE_NS 4000           // 2Mbit/s
+#define CONTROLLER_RESPONSE_BYTES 17 // header, function, condition, CRC
+#define SHORTEST_REQUEST_BYTES 5     // header and CRC
+#define RESPONSE_TIMEOUT_NS 1000000  // the console gives up on a response that hasn't started within 1ms
+#define PACKET_NS 20000              // core0 turning a request round into a response
+#define CHECKSUM_WORD_NS 64          // sectorChecksum() per word, 8 cycles at 125MHz
+
+static uint8_t Flash[PAGE_SIZE] __attribute__((aligned(4)));
+static uint8_t Card[PAGE_SIZE] __attribute__((aligned(4))); // the RAM copy
+static ChecksumRecord Log[CHECKSUM_RECORDS];               // the log sector
+static ChecksumTable Table;
+static uint32_t Dirty;
+static uint32_t Corrupt; // sectors with a flipped bit in flash that haven't been reported yet
+static ScrubState Scrub;
+static int SkipFix, NoLog;
+static long LogErases, Found, Wrong, Missed;
+
+static const uint8_t *Chunk(uint32_t Offset)
+{
+	return &Flash[Offset];
+}
+
+static uint32_t Checksum(const uint8_t *Page, int Sector)
+{
+	return sectorChecksum((const uint32_t *)&Page[Sector * SCRUB_SECTOR_SIZE], SCRUB_SECTOR_SIZE / 4, 0);
+}
+
+// logChecksums(): flash programming can only clear bits
+static void LogChecksums(void)
+{
+	ChecksumRecord Records[CHECKSUM_PAGE_RECORDS];
+	int Offset;
+
+	while ((Offset = checksumLogNext(&Table, Records)) != -1)
+	{
+		if (Offset == CHECKSUM_LOG_FULL)
+		{
+			memset(Log, 0xFF, sizeof(Log));
+			checksumLogErased(&Table);
+			LogErases++;
+			continue;
+		}
+		uint8_t *Dest = (uint8_t *)Log + Offset;
+		for (int i = 0; i < CHECKSUM_LOG_PAGE; i++)
+			Dest[i] &= ((uint8_t *)Records)[i];
+	}
+}
+
+static void Reported(int Sector)
+{
+	if (Corrupt & (1u << Sector))
+		Found++;
+	else
+		Wrong++;
+	Corrupt &= ~(1u << Sector);
+}
+
+// Power cycle: the table comes back from the log and readFlash() loads the page
+static void ReadFlash(void)
+{
+	checksumLoad(&Table, Log);
+	if (NoLog)
+		Table.Known[0] = 0;
+	memcpy(Card, Flash, PAGE_SIZE);
+	for (int Sector = 0; Sector < SCRUB_SECTORS; Sector++)
+		if (checksumSet(&Table, 0, Sector, Checksum(Card, Sector)))
+			Reported(Sector);
+	LogChecksums();
+
+	// RAM now holds whatever flash had, nothing left to find these against
+	Missed += __builtin_popcount(Corrupt);
+	Corrupt = 0;
+	Dirty = 0;
+	scrubReset(&Scrub);
+}
+
+// flushSector(): program the sector from RAM, which also repairs any flipped bit
+static void Flush(int Sector)
+{
+	memcpy(&Flash[Sector * SCRUB_SECTOR_SIZE], &Card[Sector * SCRUB_SECTOR_SIZE], SCRUB_SECTOR_SIZE);
+	checksumSet(&Table, 0, Sector, Checksum(Card, Sector));
+	Corrupt &= ~(1u << Sector);
+	if (!SkipFix)
+		scrubSectorWritten(&Scrub, Sector);
+	LogChecksums();
+}
+
+int main(int argc, char *argv[])
+{
+	long Polls = 2000000, Writes = 0, Flushes = 0, Flipped = 0, PowerCycles = 0, Steps = 0, Late = 0;
+	long WordNs = 2000;
+
+	for (int a = 1; a < argc; a++)
+	{
+		if (!strcmp(argv[a], "-n"))
+			SkipFix = 1;
+		else if (!strcmp(argv[a], "-r"))
+			NoLog = 1;
+		else if (!strcmp(argv[a], "-x") && a + 1 < argc)
+			WordNs = atol(argv[++a]);
+		else
+			Polls = atol(argv[a]);
+	}
+
+	srand(1);
+	for (int i = 0; i < PAGE_SIZE; i++)
+		Card[i] = rand();
+	memcpy(Flash, Card, PAGE_SIZE);
+	memset(Log, 0xFF, sizeof(Log));
+	for (int Sector = 0; Sector < SCRUB_SECTORS; Sector++)
+		checksumSet(&Table, 0, Sector, Checksum(Card, Sector));
+	LogChecksums();
+	scrubReset(&Scrub);
+
+	// A scrub step starts as the controller response goes out. The earliest the next request can
+	// be in is straight after it, and its response must start within the timeout of that
+	long RequestIn = (CONTROLLER_RESPONSE_BYTES + SHORTEST_REQUEST_BYTES) * MAPLE_BYTE_NS;
+	long StepNs = (SCRUB_CHUNK / 4) * (WordNs + CHECKSUM_WORD_NS);
+	long RespondBy = RequestIn + RESPONSE_TIMEOUT_NS;
+	long RespondAt = (StepNs > RequestIn ? StepNs : RequestIn) + PACKET_NS;
+
+	// The last stretch has no writes or flips, so everything flipped gets a full pass
+	long Quiet = (long)SCRUB_SECTORS * (SCRUB_SECTOR_SIZE / SCRUB_CHUNK) * SCRUB_INTERVAL * 2;
+	int SinceWrite = FLASH_WRITE_DELAY;
+
+	for (long Poll = 0; Poll < Polls + Quiet; Poll++)
+	{
+		if (Poll < Polls && rand() % 200 == 0)
+		{
+			int Sector = rand() % 2 ? (int)Scrub.Sector : rand() % SCRUB_SECTORS;
+			int Block = Sector * (SCRUB_SECTOR_SIZE / BLOCK_SIZE) + rand() % (SCRUB_SECTOR_SIZE / BLOCK_SIZE);
+			for (int i = 0; i < BLOCK_SIZE; i++)
+				Card[Block * BLOCK_SIZE + i] = rand();
+			Dirty |= 1u << Sector;
+			SinceWrite = 0;
+			Writes++;
+		}
+		if (Poll < Polls && rand() % 5000 == 0)
+		{
+			int Sector = rand() % SCRUB_SECTORS;
+			if (!(Dirty & (1u << Sector)))
+			{
+				Flash[Sector * SCRUB_SECTOR_SIZE + rand() % SCRUB_SECTOR_SIZE] ^= 1 << (rand() % 8);
+				Corrupt |= 1u << Sector;
+				Flipped++;
+			}
+		}
+		if (Poll < Polls && rand() % 50000 == 0)
+		{
+			// Unflushed writes are lost, and a bit may flip while the power's off
+			if (rand() % 2)
+			{
+				int Sector = rand() % SCRUB_SECTORS;
+				Flash[Sector * SCRUB_SECTOR_SIZE + rand() % SCRUB_SECTOR_SIZE] ^= 1 << (rand() % 8);
+				Corrupt |= 1u << Sector;
+				Flipped++;
+			}
+			ReadFlash();
+			SinceWrite = FLASH_WRITE_DELAY;
+			PowerCycles++;
+			continue;
+		}
+
+		// the controller status slot
+		if (Dirty && SinceWrite >= FLASH_WRITE_DELAY)
+		{
+			int Sector = 31 - __builtin_clz(Dirty);
+			Dirty &= ~(1u << Sector);
+			Flush(Sector);
+			Flushes++;
+		}
+		else if (SinceWrite < FLASH_WRITE_DELAY)
+			SinceWrite++;
+		else
+		{
+			uint32_t Checked = Scrub.PollsSinceStep + 1 == SCRUB_INTERVAL;
+			int Bad = scrubPoll(&Scrub, Chunk, Table.Sums[0], Dirty);
+			if (Checked)
+			{
+				Steps++;
+				if (RespondAt > RespondBy)
+					Late++;
+			}
+			if (Bad >= 0)
+			{
+				Reported(Bad);
+				Dirty |= 1u << Bad; // rewritten from RAM at the next slot
+			}
+		}
+	}
+
+	printf("%ld polls, %ld block writes, %ld flushes, %ld log erases, %ld power cycles, %u sectors checked\n",
+		Polls, Writes, Flushes, LogErases, PowerCycles, Scrub.SectorsChecked);
+	printf("%ld bits flipped, %ld sectors found bad, %ld reported bad wrongly, %ld missed, %d still corrupt\n",
+		Flipped, Found, Wrong, Missed, __builtin_popcount(Corrupt));
+	printf("%ld scrub steps of %.0fus, next response at %.0fus of %.0fus allowed, %ld late\n",
+		Steps, StepNs / 1000.0, RespondAt / 1000.0, RespondBy / 1000.0, Late);
+	if (Wrong || Missed || Corrupt || Late)
+	{
+		fprintf(stderr, "FAIL\n");
+		return 1;
+	}
+	printf("OK\n");
+	return 0;
+}
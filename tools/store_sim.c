@@ -0,0 +1,266 @@
+// Runs the block store in src/store.c against simulated NOR flash (programming
+// can only clear bits, erasing is by sector). It starts from flash in older
+// firmware's layout, with some pages the same, then the game writes blocks at
+// random: new data, blank blocks and copies of blocks from other pages, with
+// whole pages copied now and then. Idle steps go in between, as in the
+// controller status slot, and the power is cut at random flash operations.
+// After each cut the store is loaded again and every page must read back as
+// written, apart from the block being written at the time, which may be old
+// or new. Finally every page block gets different data, which must still fit,
+// and keeps getting more, which leaves live blocks scattered over every pool
+// sector for garbage collection to move out of the way.
+//
+// Build: gcc -O2 -o store_sim store_sim.c ../src/store.c
+// Usage: store_sim [steps]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <setjmp.h>
+#include "../src/store.h"
+
+#define CARD_SIZE (STORE_PAGE_BLOCKS * STORE_BLOCK_SIZE)
+
+static uint8_t Flash[STORE_FLASH_SIZE] __attribute__((aligned(4)));
+static uint8_t Pages[STORE_PAGES][CARD_SIZE] __attribute__((aligned(4))); // what each page should hold
+static uint8_t Card[CARD_SIZE] __attribute__((aligned(4)));
+static uint8_t Data[STORE_BLOCK_SIZE] __attribute__((aligned(4)));
+
+static jmp_buf Cut;
+static long OpsLeft = -1; // flash operations until the power's cut, -1 for never
+static long Programs, Erases, PowerCuts;
+static long Copies, CopyWrites;
+static long Step; // kept across a power cut's longjmp
+static int InFlightPage = -1, InFlightBlock;
+static uint8_t InFlight[STORE_BLOCK_SIZE]; // what it was being written with
+
+static void Fail(const char *Why)
+{
+	fprintf(stderr, "FAIL: %s\n", Why);
+	exit(1);
+}
+
+static void Erase(uint32_t Offset)
+{
+	if (Offset % STORE_SECTOR_SIZE || Offset < STORE_POOL_A || Offset + STORE_SECTOR_SIZE > STORE_FLASH_SIZE)
+		Fail("bad erase");
+	Erases++;
+	if (OpsLeft >= 0 && OpsLeft-- == 0)
+	{
+		memset(&Flash[Offset], 0xFF, STORE_SECTOR_SIZE / 2); // cut part way through
+		longjmp(Cut, 1);
+	}
+	memset(&Flash[Offset], 0xFF, STORE_SECTOR_SIZE);
+}
+
+static void Program(uint32_t Offset, const uint8_t *Source, uint32_t Size)
+{
+	if (Offset % STORE_FLASH_PAGE || Size % STORE_FLASH_PAGE || Offset < STORE_POOL_A || Offset + Size > STORE_FLASH_SIZE)
+		Fail("bad program");
+	for (uint32_t i = 0; i < Size; i++)
+		if (Source[i] != 0xFF && (Flash[Offset + i] & Source[i]) != Source[i])
+			Fail("programmed over data without an erase"); // 0xFF leaves a byte as it is
+	Programs++;
+	int CutHere = OpsLeft >= 0 && OpsLeft-- == 0;
+	for (uint32_t i = 0; i < (CutHere ? Size / 2 : Size); i++)
+		Flash[Offset + i] &= Source[i];
+	if (CutHere)
+		longjmp(Cut, 1);
+}
+
+static const StoreFlash Sim = {Flash, Erase, Program};
+
+// Load the store again, as after a power cut, which could itself be cut
+static int Boot(void)
+{
+	for (;;)
+	{
+		if (!setjmp(Cut))
+			return storeInit(&Sim);
+		PowerCuts++;
+	}
+}
+
+static void Verify(void)
+{
+	if (!storeCheck())
+		Fail("refcounts don't match the map");
+	for (int Page = 0; Page < STORE_PAGES; Page++)
+	{
+		storeReadPage(Page, Card);
+		for (int Block = 0; Block < STORE_PAGE_BLOCKS; Block++)
+		{
+			uint8_t *Read = &Card[Block * STORE_BLOCK_SIZE];
+			uint8_t *Want = &Pages[Page][Block * STORE_BLOCK_SIZE];
+			if (!memcmp(Read, Want, STORE_BLOCK_SIZE))
+				continue;
+			if (Page == InFlightPage && Block == InFlightBlock && !memcmp(Read, InFlight, STORE_BLOCK_SIZE))
+				memcpy(Want, Read, STORE_BLOCK_SIZE); // the cut write made it
+			else
+				Fail("page doesn't read back as written");
+		}
+	}
+	InFlightPage = -1;
+}
+
+static void Write(int Page, int Block, const uint8_t *Source)
+{
+	InFlightPage = Page;
+	InFlightBlock = Block;
+	memcpy(InFlight, Source, STORE_BLOCK_SIZE);
+	memcpy(Card, Source, STORE_BLOCK_SIZE); // the store programs from RAM
+	if (!storeWrite(Page, Block, Card))
+		Fail("store full");
+	memcpy(&Pages[Page][Block * STORE_BLOCK_SIZE], InFlight, STORE_BLOCK_SIZE);
+	InFlightPage = -1;
+}
+
+static void RandomCard(uint8_t *Dest)
+{
+	for (int i = 0; i < CARD_SIZE; i++)
+		Dest[i] = rand();
+	memset(&Dest[200 * STORE_BLOCK_SIZE], 0, 41 * STORE_BLOCK_SIZE); // unused blocks, blank as on a real card
+}
+
+static int CompareBlocks(const void *a, const void *b)
+{
+	return memcmp(*(const uint8_t **)a, *(const uint8_t **)b, STORE_BLOCK_SIZE);
+}
+
+// Different blocks across all pages, the least the pool could hold them in
+static int Distinct(void)
+{
+	static const uint8_t *Blocks[STORE_SLOTS];
+	for (int Slot = 0; Slot < STORE_SLOTS; Slot++)
+		Blocks[Slot] = &Pages[Slot / STORE_PAGE_BLOCKS][(Slot % STORE_PAGE_BLOCKS) * STORE_BLOCK_SIZE];
+	qsort(Blocks, STORE_SLOTS, sizeof(Blocks[0]), CompareBlocks);
+	int Count = 1;
+	for (int Slot = 1; Slot < STORE_SLOTS; Slot++)
+		Count += memcmp(Blocks[Slot - 1], Blocks[Slot], STORE_BLOCK_SIZE) != 0;
+	return Count;
+}
+
+int main(int argc, char *argv[])
+{
+	long Steps = argc > 1 ? atol(argv[1]) : 200000;
+
+	// Older firmware's layout: pages 1-3 the same card, the rest different
+	srand(1);
+	memset(Flash, 0xFF, sizeof(Flash));
+	RandomCard(Pages[0]);
+	for (int Page = 0; Page < STORE_PAGES; Page++)
+	{
+		if (Page > 0 && Page < 3)
+			memcpy(Pages[Page], Pages[0], CARD_SIZE);
+		else if (Page)
+			RandomCard(Pages[Page]);
+		memcpy(&Flash[STORE_POOL_A + Page * CARD_SIZE], Pages[Page], CARD_SIZE);
+	}
+	if (Boot() != STORE_MIGRATED)
+		Fail("older layout not taken over");
+	Verify();
+	printf("Taken over from the older layout: %d different blocks in %u pool blocks\n", Distinct(), storeStats.Live);
+
+	for (Step = 0; Step < Steps; Step++)
+	{
+		if (Step % 3000 == 2999)
+			OpsLeft = rand() % 40;
+		if (setjmp(Cut))
+		{
+			PowerCuts++;
+			OpsLeft = -1;
+			Boot();
+			Verify();
+			continue;
+		}
+
+		int Op = rand() % 100;
+		if (Op < 40)
+		{
+			int Page = rand() % STORE_PAGES, Block = rand() % STORE_PAGE_BLOCKS;
+			int Kind = rand() % 10;
+			if (Kind < 4)
+				memcpy(Data, &Pages[rand() % STORE_PAGES][(rand() % STORE_PAGE_BLOCKS) * STORE_BLOCK_SIZE], STORE_BLOCK_SIZE);
+			else if (Kind < 6)
+				memset(Data, 0, STORE_BLOCK_SIZE);
+			else if (Kind < 7)
+				memset(Data, 0xFF, STORE_BLOCK_SIZE);
+			else
+				for (int i = 0; i < STORE_BLOCK_SIZE; i++)
+					Data[i] = rand();
+			Write(Page, Block, Data);
+		}
+		else if (Op == 40 && rand() % 20 == 0)
+		{
+			int From = rand() % STORE_PAGES, To = rand() % STORE_PAGES;
+			uint32_t Before = storeStats.Writes;
+			static uint8_t Copy[CARD_SIZE];
+			memcpy(Copy, Pages[From], CARD_SIZE);
+			for (int Block = 0; Block < STORE_PAGE_BLOCKS; Block++)
+				Write(To, Block, &Copy[Block * STORE_BLOCK_SIZE]);
+			Copies++;
+			CopyWrites += storeStats.Writes - Before;
+		}
+		else
+		{
+			storeIdleStep();
+		}
+
+		if (Step % 5000 == 0)
+			Verify();
+	}
+	OpsLeft = -1;
+	Verify();
+	Boot();
+	Verify();
+	printf("%ld steps, %ld power cuts, %ld page copies programming %ld blocks between them\n", Steps, PowerCuts, Copies, CopyWrites);
+	printf("%u blocks programmed, %u found already in the pool, %u sectors erased, %u blocks moved, %u snapshots\n",
+		storeStats.Writes, storeStats.Shared, storeStats.Erases, storeStats.Moves, storeStats.Snapshots);
+	printf("%d different blocks in %u pool blocks, %u erased\n", Distinct(), storeStats.Live, storeStats.Erased);
+
+	// Every page block different
+	for (int Page = 0; Page < STORE_PAGES; Page++)
+	{
+		for (int Block = 0; Block < STORE_PAGE_BLOCKS; Block++)
+		{
+			for (int i = 0; i < STORE_BLOCK_SIZE; i++)
+				Data[i] = rand();
+			Write(Page, Block, Data);
+		}
+	}
+	Verify();
+	Boot();
+	Verify();
+	printf("All %d page blocks different: %u pool blocks, %u erased\n", STORE_SLOTS, storeStats.Live, storeStats.Erased);
+
+	uint32_t Moves = storeStats.Moves;
+	for (Step = 0; Step < Steps / 4; Step++)
+	{
+		if (Step % 3000 == 2999)
+			OpsLeft = rand() % 40;
+		if (setjmp(Cut))
+		{
+			PowerCuts++;
+			OpsLeft = -1;
+			Boot();
+			Verify();
+			continue;
+		}
+		if (rand() % 4)
+		{
+			for (int i = 0; i < STORE_BLOCK_SIZE; i++)
+				Data[i] = rand();
+			Write(rand() % STORE_PAGES, rand() % STORE_PAGE_BLOCKS, Data);
+		}
+		else
+			storeIdleStep();
+	}
+	OpsLeft = -1;
+	Verify();
+	Boot();
+	Verify();
+	printf("Kept writing different data: %u blocks moved by garbage collection, %ld power cuts in all\n", storeStats.Moves - Moves, PowerCuts);
+	printf("Flash: %ld programs, %ld erases\nOK\n", Programs, Erases);
+	return 0;
+}
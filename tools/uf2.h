@@ -0,0 +1,66 @@
+// Minimal UF2 writer for RP2040 flash images (see https://github.com/microsoft/uf2)
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#define UF2_MAGIC_START0 0x0A324655
+#define UF2_MAGIC_START1 0x9E5D5157
+#define UF2_MAGIC_END 0x0AB16F30
+#define UF2_FLAG_FAMILY_ID_PRESENT 0x00002000
+#define UF2_RP2040_FAMILY_ID 0xE48BFF56
+#define UF2_PAYLOAD_SIZE 256
+
+#define RP2040_FLASH_BASE 0x10000000
+
+typedef struct UF2Block_s
+{
+	uint32_t MagicStart0;
+	uint32_t MagicStart1;
+	uint32_t Flags;
+	uint32_t TargetAddr;
+	uint32_t PayloadSize;
+	uint32_t BlockNo;
+	uint32_t NumBlocks;
+	uint32_t FamilyID;
+	uint8_t Data[476];
+	uint32_t MagicEnd;
+} UF2Block;
+
+// Number of 256 byte UF2 blocks needed to cover Size bytes
+static inline uint32_t UF2NumBlocks(uint32_t Size)
+{
+	return (Size + UF2_PAYLOAD_SIZE - 1) / UF2_PAYLOAD_SIZE;
+}
+
+// Writes Size bytes of Data to be flashed at Address (relative to start of flash).
+// BlockNo is advanced; NumBlocks must be the total for the whole file.
+static inline int UF2WriteRange(FILE *File, uint32_t Address, const uint8_t *Data, uint32_t Size, uint32_t *BlockNo, uint32_t NumBlocks)
+{
+	UF2Block Block;
+	for (uint32_t Offset = 0; Offset < Size; Offset += UF2_PAYLOAD_SIZE)
+	{
+		uint32_t Chunk = Size - Offset < UF2_PAYLOAD_SIZE ? Size - Offset : UF2_PAYLOAD_SIZE;
+		memset(&Block, 0, sizeof(Block));
+		Block.MagicStart0 = UF2_MAGIC_START0;
+		Block.MagicStart1 = UF2_MAGIC_START1;
+		Block.Flags = UF2_FLAG_FAMILY_ID_PRESENT;
+		Block.TargetAddr = RP2040_FLASH_BASE + Address + Offset;
+		Block.PayloadSize = UF2_PAYLOAD_SIZE; // RP2040 bootrom only accepts full 256 byte payloads
+		Block.BlockNo = (*BlockNo)++;
+		Block.NumBlocks = NumBlocks;
+		Block.FamilyID = UF2_RP2040_FAMILY_ID;
+		memcpy(Block.Data, &Data[Offset], Chunk);
+		if (Chunk < UF2_PAYLOAD_SIZE)
+		{
+			memset(&Block.Data[Chunk], 0xFF, UF2_PAYLOAD_SIZE - Chunk); // pad as erased flash
+		}
+		Block.MagicEnd = UF2_MAGIC_END;
+		if (fwrite(&Block, sizeof(Block), 1, File) != 1)
+		{
+			return 0;
+		}
+	}
+	return 1;
+}